@@ -292,6 +292,7 @@ kotlin {
     // documented in workspace CLAUDE.md as fix #4.
     @OptIn(ExperimentalWasmDsl::class)
     wasmJs {
+        configureAll()
         browser()
         nodejs()
     }
@@ -390,7 +391,9 @@ kotlin {
         }
     }
 
-    jvm()
+    jvm {
+        configureAll()
+    }
 
     swiftExport {
         moduleName = "KLang"
@@ -399,6 +402,17 @@ kotlin {
 
     // Removed generated sources; build/gen is no longer a source root
 
+    // Strict-C long double backend (fp/HostLongDouble). Every native target
+    // binds the same header-only kernels in tools/klang_longdouble.h so
+    // nativeMain can use the commonized bindings; targets whose ABI has no x87
+    // extended or binary128 type report that format unsupported at run time.
+    targets.withType<KotlinNativeTarget>().configureEach {
+        compilations.getByName("main").cinterops.create("klongdouble") {
+            definitionFile.set(project.file("src/nativeInterop/cinterop/klongdouble.def"))
+            includeDirs(project.file("tools"))
+        }
+    }
+
     sourceSets {
         commonMain {
             dependencies {
@@ -417,8 +431,20 @@ kotlin {
                 // kotlin-test-annotations-common pair did not propagate to
                 // the Android KMP target's host-test compilation.
                 implementation(kotlin("test"))
+                // runTest for the suspend entry points (describeParallel etc.)
+                implementation(libs.kotlinx.coroutines.test)
             }
         }
+        // posixMain sits between nativeMain and every native group with
+        // <sys/mman.h> (Apple, Linux, Android Native), so POSIX-only actuals
+        // such as the mmap heap image backend stay out of mingwX64, whose
+        // actuals live in mingwMain.
+        val posixMain by creating {
+            dependsOn(nativeMain.get())
+        }
+        appleMain { dependsOn(posixMain) }
+        linuxMain { dependsOn(posixMain) }
+        androidNativeMain { dependsOn(posixMain) }
     }
 }
 
@@ -446,17 +472,30 @@ afterEvaluate {
                 implementation(libs.kotlinx.benchmark.runtime)
             }
         }
+    // concurrentBenchmark holds benchmarks that block on coroutines
+    // (`runBlocking` exists on JVM and native only, not JS or Wasm).
+    val concurrentBenchmarkSs = ssContainer.findByName("concurrentBenchmark")
+        ?: ssContainer.create("concurrentBenchmark").apply {
+            dependsOn(commonBenchmarkSs)
+            dependencies {
+                implementation(libs.kotlinx.benchmark.runtime)
+                implementation(libs.kotlinx.coroutines.core)
+            }
+        }
     listOf(
         "macosArm64" to "macosArm64Benchmark",
         "linuxX64"   to "linuxX64Benchmark",
         "linuxArm64" to "linuxArm64Benchmark",
         "mingwX64"   to "mingwX64Benchmark",
-        // JS benchmarks run on the Node runtime; the standard JS target
-        // provides the `jsBenchmark` source set.
+        "jvm"        to "jvmBenchmark",
+        // JS and Wasm benchmarks run on the Node runtime; the standard JS and
+        // wasmJs targets provide the `jsBenchmark` / `wasmJsBenchmark` sets.
         "js"         to "jsBenchmark",
-    ).forEach { (_, benchmarkSetName) ->
+        "wasmJs"     to "wasmJsBenchmark",
+    ).forEach { (targetName, benchmarkSetName) ->
         val benchmarkSs = ssContainer.findByName(benchmarkSetName) ?: return@forEach
-        benchmarkSs.dependsOn(commonBenchmarkSs)
+        val concurrent = targetName != "js" && targetName != "wasmJs"
+        benchmarkSs.dependsOn(if (concurrent) concurrentBenchmarkSs else commonBenchmarkSs)
     }
 }
 
@@ -469,10 +508,17 @@ afterEvaluate {
 // measurement iterations, and structured ops/sec output — independent of
 // the regular test harness, so the JS mocha 2-second timeout that broke
 // TuiBufferBenchmarkTest is no longer in the path.
+//
+// The `alloc` configuration reruns the suite on the JVM under JMH's gc
+// profiler (`./gradlew jvmBenchmarkAllocBenchmark`) for bytes allocated per
+// op; it is kept separate so the profiler never skews the `main` timings.
+// wasmWasi is not a kotlinx-benchmark target.
 // ---------------------------------------------------------------------------
 benchmark {
     targets {
+        register("jvmBenchmark")
         register("jsBenchmark")
+        register("wasmJsBenchmark")
         register("macosArm64Benchmark")
         register("linuxX64Benchmark")
         register("linuxArm64Benchmark")
@@ -485,6 +531,152 @@ benchmark {
             iterationTime = 1
             iterationTimeUnit = "s"
         }
+        register("alloc") {
+            warmups = 2
+            iterations = 3
+            iterationTime = 1
+            iterationTimeUnit = "s"
+            advanced("jvmProfiler", "gc")
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Benchmark comparison: C baselines and regression gating
+//
+//   benchmarkCBaseline  builds tools/klang_bench_baseline.c with the host C
+//                       compiler (-Pklang.benchmark.cc, default `cc`) and writes
+//                       its rows, in the kotlinx-benchmark report format, to
+//                       build/reports/benchmarks/c/baseline.json
+//   benchmarkCompare    prints the newest `main` run of every target as ns/op,
+//                       "x slower than C" and, from the newest `alloc` run,
+//                       bytes allocated per op; then fails if any result
+//                       regressed against the stored baseline
+//   benchmarkBaseline   stores the newest `main` run as that baseline
+//
+// Results are keyed by benchmark name plus @Param values, so the C rows, the
+// stored baseline and a new run line up on every target. A result regresses
+// when it is slower than its baseline by more than
+// klang.benchmark.regressionThreshold (a fraction, gradle.properties) and by
+// more than the two runs' combined score error. Baselines are only
+// comparable on the host class that recorded them.
+// ---------------------------------------------------------------------------
+data class BenchmarkRow(val nsPerOp: Double, val errorNs: Double, val bytesPerOp: Double?)
+
+fun benchmarkUnitNs(unit: String): Double = when (unit) {
+    "s" -> 1e9
+    "ms" -> 1e6
+    "us" -> 1e3
+    else -> 1.0
+}
+
+/** Read a kotlinx-benchmark (JMH-format) JSON report, every score normalized to ns/op. */
+@Suppress("UNCHECKED_CAST")
+fun readBenchmarkReport(file: File): Map<String, BenchmarkRow> {
+    val rows = groovy.json.JsonSlurper().parse(file) as List<Map<String, Any?>>
+    return rows.associate { row ->
+        val params = (row["params"] as? Map<String, Any?>).orEmpty()
+        val key = row["benchmark"].toString() +
+            params.entries.sortedBy { it.key }.joinToString("") { "[${it.key}=${it.value}]" }
+        val primary = row["primaryMetric"] as Map<String, Any?>
+        val unit = primary["scoreUnit"].toString()
+        val score = (primary["score"] as Number).toDouble()
+        val error = (primary["scoreError"] as? Number)?.toDouble()?.takeUnless { it.isNaN() } ?: 0.0
+        val throughput = unit.startsWith("ops/")
+        val scale = benchmarkUnitNs(if (throughput) unit.removePrefix("ops/") else unit.removeSuffix("/op"))
+        val ns = if (throughput) scale / score else score * scale
+        val errorNs = if (throughput) ns * error / score else error * scale
+        val secondary = (row["secondaryMetrics"] as? Map<String, Any?>).orEmpty()
+        val alloc = secondary.entries.firstOrNull { it.key.endsWith("gc.alloc.rate.norm") }?.value as? Map<String, Any?>
+        key to BenchmarkRow(ns, errorNs, (alloc?.get("score") as? Number)?.toDouble())
+    }
+}
+
+/** The newest run directory under build/reports/benchmarks/<configuration>, or null. */
+fun latestBenchmarkRun(configuration: String): File? =
+    layout.buildDirectory.dir("reports/benchmarks/$configuration").get().asFile
+        .listFiles()?.filter { it.isDirectory }?.maxByOrNull { it.lastModified() }
+
+fun benchmarkReports(run: File): List<File> =
+    run.listFiles()?.filter { it.extension == "json" }?.sortedBy { it.name }.orEmpty()
+
+val benchmarkExecOperations = serviceOf<ExecOperations>()
+val benchmarkBaselineDir = file(providers.gradleProperty("klang.benchmark.baselineDir").getOrElse("benchmarks/baseline"))
+val benchmarkCReport = layout.buildDirectory.file("reports/benchmarks/c/baseline.json")
+
+tasks.register("benchmarkCBaseline") {
+    group = "benchmark"
+    description = "Builds and runs tools/klang_bench_baseline.c, the C rows benchmarkCompare divides by."
+    val source = file("tools/klang_bench_baseline.c")
+    inputs.files(source, file("tools/klang_longdouble.h"))
+    outputs.file(benchmarkCReport)
+    outputs.upToDateWhen { false }
+    doLast {
+        val report = benchmarkCReport.get().asFile
+        report.parentFile.mkdirs()
+        val exe = File(report.parentFile, "klang_bench_baseline")
+        val cc = providers.gradleProperty("klang.benchmark.cc").getOrElse("cc")
+        benchmarkExecOperations.exec {
+            commandLine(cc, "-std=gnu11", "-O2", "-pthread", "-o", exe.path, source.path, "-lm")
+        }
+        benchmarkExecOperations.exec {
+            commandLine(exe.path, "--json", report.path)
+        }
+    }
+}
+
+tasks.register("benchmarkCompare") {
+    group = "benchmark"
+    description = "Prints the newest benchmark run against C and the stored baseline; fails on regressions."
+    doLast {
+        val latest = latestBenchmarkRun("main")
+            ?: throw GradleException("No reports under build/reports/benchmarks/main; run ./gradlew benchmark first")
+        val threshold = providers.gradleProperty("klang.benchmark.regressionThreshold").getOrElse("0.15").toDouble()
+        val cRows = benchmarkCReport.get().asFile.takeIf { it.exists() }?.let(::readBenchmarkReport).orEmpty()
+        if (cRows.isEmpty()) logger.lifecycle("No C baseline; run ./gradlew benchmarkCBaseline for the \"vs C\" column")
+        val allocRun = latestBenchmarkRun("alloc")
+        val regressions = mutableListOf<String>()
+        for (report in benchmarkReports(latest)) {
+            val rows = readBenchmarkReport(report)
+            val alloc = allocRun?.resolve(report.name)?.takeIf { it.exists() }?.let(::readBenchmarkReport).orEmpty()
+            val baselineFile = benchmarkBaselineDir.resolve(report.name)
+            val baseline = baselineFile.takeIf { it.exists() }?.let(::readBenchmarkReport).orEmpty()
+            logger.lifecycle("\n== ${report.nameWithoutExtension} (${latest.name}) ==")
+            logger.lifecycle("%-84s %14s %9s %10s %9s".format("benchmark", "ns/op", "vs C", "B/op", "vs base"))
+            for ((key, row) in rows.toSortedMap()) {
+                val vsC = cRows[key]?.let { "%.2fx".format(row.nsPerOp / it.nsPerOp) } ?: "-"
+                val bytes = (alloc[key]?.bytesPerOp ?: row.bytesPerOp)?.let { "%.1f".format(it) } ?: "-"
+                val old = baseline[key]
+                val delta = old?.let { "%+.1f%%".format((row.nsPerOp / it.nsPerOp - 1) * 100) } ?: "-"
+                val name = key.removePrefix("io.github.kotlinmania.klang.")
+                logger.lifecycle("%-84s %14.2f %9s %10s %9s".format(name, row.nsPerOp, vsC, bytes, delta))
+                if (old != null && row.nsPerOp > old.nsPerOp * (1 + threshold) &&
+                    row.nsPerOp - old.nsPerOp > row.errorNs + old.errorNs
+                ) {
+                    regressions += "${report.nameWithoutExtension} $name: %.2f -> %.2f ns/op".format(old.nsPerOp, row.nsPerOp)
+                }
+            }
+            if (baseline.isEmpty()) {
+                logger.lifecycle("(no stored baseline ${baselineFile.relativeTo(projectDir)}; run ./gradlew benchmarkBaseline to record one)")
+            }
+        }
+        if (regressions.isNotEmpty()) {
+            throw GradleException(
+                "Benchmarks regressed by more than ${(threshold * 100).toInt()}%:\n" + regressions.joinToString("\n"),
+            )
+        }
+    }
+}
+
+tasks.register("benchmarkBaseline") {
+    group = "benchmark"
+    description = "Stores the newest benchmark run as the baseline benchmarkCompare checks against."
+    doLast {
+        val latest = latestBenchmarkRun("main")
+            ?: throw GradleException("No reports under build/reports/benchmarks/main; run ./gradlew benchmark first")
+        benchmarkBaselineDir.mkdirs()
+        for (report in benchmarkReports(latest)) report.copyTo(benchmarkBaselineDir.resolve(report.name), overwrite = true)
+        logger.lifecycle("Stored ${latest.name} as the baseline in ${benchmarkBaselineDir.relativeTo(projectDir)}")
     }
 }
 
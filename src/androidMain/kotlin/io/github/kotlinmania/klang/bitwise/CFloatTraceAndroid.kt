@@ -0,0 +1,11 @@
+package io.github.kotlinmania.klang.bitwise
+
+// `ThreadLocal` comes from the default `java.lang` import on Kotlin/JVM
+// (no explicit import line needed).
+private val threadRing = ThreadLocal<CFloatTraceRing?>()
+
+internal actual fun boundTraceRing(): CFloatTraceRing? = threadRing.get()
+
+internal actual fun bindTraceRingToThread(ring: CFloatTraceRing?) {
+    threadRing.set(ring)
+}
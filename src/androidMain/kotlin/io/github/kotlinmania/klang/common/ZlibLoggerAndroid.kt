@@ -2,12 +2,20 @@
 
 package io.github.kotlinmania.klang.common
 
+import kotlinx.coroutines.CoroutineScope
+import kotlinx.coroutines.DelicateCoroutinesApi
+import kotlinx.coroutines.ExperimentalCoroutinesApi
+import kotlinx.coroutines.launch
+import kotlinx.coroutines.newSingleThreadContext
+import kotlinx.coroutines.runBlocking
+
 actual var LOG_FILE_PATH: String? = null
 
 // No filesystem access without dragging in a file-IO library; route to
-// println() in the spirit of the JS variant that routes to console.log.
+// print() (blocks already end in newlines) in the spirit of the JS variant
+// that routes to console.log.
 actual fun logToFile(line: String) {
-    println(line)
+    print(line)
 }
 
 // `System.getenv` resolves to the Kotlin/JVM stdlib bridge at the call site
@@ -17,3 +25,24 @@ actual fun getEnv(name: String): String? = System.getenv(name)
 // Wall-clock millis-since-epoch as a string. Avoids any datetime library
 // without an `import java.*` line.
 actual fun currentTimestamp(): String = System.currentTimeMillis().toString()
+
+// Blocks go to the writer thread; the shutdown hook drains the queue.
+internal actual val logWriterMode: LogWriterMode = LogWriterMode.BACKGROUND
+
+// The writer gets its own (daemon) thread so it runs even when Dispatchers.Default
+// is saturated by the producers waiting on it.
+@OptIn(DelicateCoroutinesApi::class, ExperimentalCoroutinesApi::class)
+internal actual fun launchLogWriter(body: suspend () -> Unit) {
+    CoroutineScope(newSingleThreadContext("klang-log-writer")).launch { body() }
+}
+
+internal actual fun <T> blockOnLogWriter(body: suspend () -> T): T = runBlocking { body() }
+
+// `Runtime` and `Thread` come from the default `java.lang` import.
+internal actual fun installLogFlushHook(flush: () -> Unit) {
+    try {
+        Runtime.getRuntime().addShutdownHook(Thread { flush() })
+    } catch (_: Throwable) {
+        // Security manager or shutdown already in progress
+    }
+}
@@ -0,0 +1,5 @@
+package io.github.kotlinmania.klang.fp
+
+// ART compiles float ops to SSE/VFP/NEON scalar instructions; the vector check
+// still guards against flush-to-zero on older 32-bit ARM cores.
+internal actual val float32HostIsBinary32: Boolean = true
@@ -0,0 +1,4 @@
+package io.github.kotlinmania.klang.int
+
+// Math.multiplyHigh needs API 31; minSdk is 24, so use the portable product.
+internal actual fun multiplyHighUnsigned(a: Long, b: Long): Long = multiplyHighUnsignedPortable(a, b)
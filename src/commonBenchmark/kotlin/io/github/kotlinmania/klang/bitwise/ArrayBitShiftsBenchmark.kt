@@ -0,0 +1,53 @@
+package io.github.kotlinmania.klang.bitwise
+
+import kotlinx.benchmark.Benchmark
+import kotlinx.benchmark.BenchmarkMode
+import kotlinx.benchmark.BenchmarkTimeUnit
+import kotlinx.benchmark.Mode
+import kotlinx.benchmark.OutputTimeUnit
+import kotlinx.benchmark.Scope
+import kotlinx.benchmark.Setup
+import kotlinx.benchmark.State
+
+/**
+ * Single-threaded [ArrayBitShifts] throughput on a 2^20-limb (2 MiB of
+ * payload) number: the 16-bit limb layout against the same value packed
+ * into 64-bit words.
+ *
+ * `ArrayBitShiftsParallelBenchmark` (concurrentBenchmark, JVM and native only)
+ * runs the parallel variants on the same sizes.
+ */
+@State(Scope.Benchmark)
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(BenchmarkTimeUnit.MICROSECONDS)
+class ArrayBitShiftsBenchmark {
+
+    companion object {
+        const val LIMBS = 1 shl 20
+    }
+
+    private val limbs = IntArray(LIMBS)
+    private val words = LongArray(LIMBS / 4)
+
+    @Setup
+    fun setup() {
+        for (i in 0 until LIMBS) limbs[i] = (i * 40503) and 0xFFFF
+        ArrayBitShifts.pack16To64(limbs, 0, LIMBS, words)
+    }
+
+    // Bits shifted out of the top wrap back in as carryIn, so the data never decays to zero
+
+    @Benchmark
+    fun shl16Limbs(): Int = ArrayBitShifts.shl16LEInPlace(limbs, 0, LIMBS, 5, limbs[LIMBS - 1] ushr 11).carryOut
+
+    @Benchmark
+    fun rsh16Limbs(): Int {
+        val low = limbs[0] and 0x1F
+        ArrayBitShifts.rsh16LEInPlace(limbs, 0, LIMBS, 5)
+        limbs[LIMBS - 1] = limbs[LIMBS - 1] or (low shl 11)
+        return low
+    }
+
+    @Benchmark
+    fun shl64Words(): Long = ArrayBitShifts.shl64LEInPlace(words, 0, words.size, 5, words[words.size - 1] ushr 59).carryOut
+}
@@ -0,0 +1,96 @@
+package io.github.kotlinmania.klang.fp
+
+import io.github.kotlinmania.klang.bitwise.Float128Math
+import io.github.kotlinmania.klang.int.UInt128
+import io.github.kotlinmania.klang.int.hpc.HeapUInt128
+import io.github.kotlinmania.klang.mem.GlobalHeap
+import io.github.kotlinmania.klang.mem.KMalloc
+import kotlinx.benchmark.Benchmark
+import kotlinx.benchmark.BenchmarkMode
+import kotlinx.benchmark.BenchmarkTimeUnit
+import kotlinx.benchmark.Mode
+import kotlinx.benchmark.OutputTimeUnit
+import kotlinx.benchmark.Scope
+import kotlinx.benchmark.Setup
+import kotlinx.benchmark.State
+
+/**
+ * Quad-precision arithmetic benchmarks comparing
+ *   - [Float128Math] on register-resident [UInt128] bit patterns (true binary128)
+ *   - the same kernel through its [HeapUInt128] wrappers
+ *   - [CFloat128] double-double (~106 bits, Double exponent range)
+ *
+ * Float128Math buys exact `__float128` results; these numbers show what
+ * that costs relative to double-double on each target.
+ */
+@State(Scope.Benchmark)
+@BenchmarkMode(Mode.Throughput)
+@OutputTimeUnit(BenchmarkTimeUnit.NANOSECONDS)
+class Float128ArithmeticBenchmark {
+
+    // ---- Float128Math inputs (1.5 and 2.7 widened from Double) ----
+    private val qa: UInt128 = Float128Math.fromFloat64(1.5.toRawBits())
+    private val qb: UInt128 = Float128Math.fromFloat64(2.7.toRawBits())
+    private val qc: UInt128 = Float128Math.fromFloat64(0.1.toRawBits())
+    private lateinit var ha: HeapUInt128
+    private lateinit var hb: HeapUInt128
+
+    // ---- CFloat128 inputs ----
+    private val da: CFloat128 = CFloat128.fromDouble(1.5)
+    private val db: CFloat128 = CFloat128.fromDouble(2.7)
+
+    @Setup
+    fun setup() {
+        GlobalHeap.init(1 shl 20)   // 1 MB
+        KMalloc.init(1 shl 18)      // 256 KB
+        ha = HeapUInt128.fromUInt128(qa)
+        hb = HeapUInt128.fromUInt128(qb)
+    }
+
+    // ===== add =====
+
+    @Benchmark
+    fun float128MathAdd(): UInt128 = Float128Math.addBits(qa, qb)
+
+    @Benchmark
+    fun doubleDoubleAdd(): CFloat128 = da + db
+
+    // ===== multiply =====
+
+    @Benchmark
+    fun float128MathMultiply(): UInt128 = Float128Math.mulBits(qa, qb)
+
+    @Benchmark
+    fun doubleDoubleMultiply(): CFloat128 = da * db
+
+    // ===== divide =====
+
+    @Benchmark
+    fun float128MathDivide(): UInt128 = Float128Math.divBits(qa, qb)
+
+    @Benchmark
+    fun doubleDoubleDivide(): CFloat128 = da / db
+
+    // ===== sqrt =====
+
+    @Benchmark
+    fun float128MathSqrt(): UInt128 = Float128Math.sqrtBits(qb)
+
+    @Benchmark
+    fun doubleDoubleSqrt(): CFloat128 = db.sqrt()
+
+    // ===== fma =====
+
+    @Benchmark
+    fun float128MathFma(): UInt128 = Float128Math.fmaBits(qa, qb, qc)
+
+    // ===== heap wrapper overhead =====
+
+    /** Heap load + kernel + heap store; frees the result to keep the arena steady. */
+    @Benchmark
+    fun float128MathHeapMultiply(): Int {
+        val addr = Float128Math.mulBits(ha, hb).addr
+        KMalloc.free(addr)
+        return addr
+    }
+}
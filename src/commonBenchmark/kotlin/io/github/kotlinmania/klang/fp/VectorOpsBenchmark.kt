@@ -0,0 +1,106 @@
+package io.github.kotlinmania.klang.fp
+
+import io.github.kotlinmania.klang.mem.GlobalHeap
+import io.github.kotlinmania.klang.mem.KMalloc
+import io.github.kotlinmania.klang.mem.U32View
+import kotlinx.benchmark.Benchmark
+import kotlinx.benchmark.BenchmarkMode
+import kotlinx.benchmark.BenchmarkTimeUnit
+import kotlinx.benchmark.Mode
+import kotlinx.benchmark.OutputTimeUnit
+import kotlinx.benchmark.Scope
+import kotlinx.benchmark.Setup
+import kotlinx.benchmark.State
+
+/**
+ * Deterministic vector/matrix benchmarks comparing
+ *   - [VectorOps.dotAccumulate] (one dependency chain)
+ *   - [VectorOps.dotBlocked] (8 independent lanes, fixed combine tree)
+ *   - [VectorOps.gemv] / [VectorOps.gemm] on `FloatArray` and heap [U32View]
+ *
+ * Sizes follow the inference path: 4096-wide dots and a 64×256 · 256×64 GEMM.
+ */
+@State(Scope.Benchmark)
+@BenchmarkMode(Mode.Throughput)
+@OutputTimeUnit(BenchmarkTimeUnit.MICROSECONDS)
+class VectorOpsBenchmark {
+
+    private val dotLength = 4096
+    private val x = FloatArray(dotLength) { (it % 17 - 8) * 0.125f }
+    private val y = FloatArray(dotLength) { (it % 13 - 6) * 0.25f }
+
+    private val m = 64
+    private val k = 256
+    private val n = 64
+    private val a = FloatArray(m * k) { (it % 11 - 5) * 0.5f }
+    private val b = FloatArray(k * n) { (it % 7 - 3) * 0.75f }
+    private val c = FloatArray(m * n)
+    private val gemvOut = FloatArray(m)
+
+    private lateinit var hx: U32View
+    private lateinit var hy: U32View
+    private lateinit var ha: U32View
+    private lateinit var hb: U32View
+    private lateinit var hc: U32View
+
+    @Setup
+    fun setup() {
+        GlobalHeap.init(1 shl 20)   // 1 MB
+        KMalloc.init(1 shl 18)      // 256 KB
+        hx = heapCopy(x)
+        hy = heapCopy(y)
+        ha = heapCopy(a)
+        hb = heapCopy(b)
+        hc = U32View(GlobalHeap.malloc(m * n * 4), m * n)
+    }
+
+    private fun heapCopy(values: FloatArray): U32View {
+        val view = U32View(GlobalHeap.malloc(values.size * 4), values.size)
+        GlobalHeap.writeFloats(view.base, values)
+        return view
+    }
+
+    // ===== dot =====
+
+    @Benchmark
+    fun dotSequential(): Float = VectorOps.dotAccumulate(dotLength, x, 0, y, 0)
+
+    @Benchmark
+    fun dotBlocked(): Float = VectorOps.dotBlocked(dotLength, x, 0, y, 0)
+
+    @Benchmark
+    fun dotBlockedHeap(): Float = VectorOps.dotBlocked(dotLength, hx, 0, hy, 0)
+
+    // ===== gemv =====
+
+    @Benchmark
+    fun gemv(): FloatArray {
+        VectorOps.gemv(m, k, a, 0, k, x, 0, gemvOut, 0)
+        return gemvOut
+    }
+
+    // ===== gemm =====
+
+    /** Baseline: one sequential dot per output element, strided column access. */
+    @Benchmark
+    fun gemmDotPerElement(): FloatArray {
+        val col = FloatArray(k)
+        for (j in 0 until n) {
+            for (p in 0 until k) col[p] = b[p * n + j]
+            for (i in 0 until m) c[i * n + j] = VectorOps.dotAccumulate(k, a, i * k, col, 0)
+        }
+        return c
+    }
+
+    @Benchmark
+    fun gemm(): FloatArray {
+        VectorOps.gemm(m, n, k, a, 0, k, b, 0, n, c, 0, n)
+        return c
+    }
+
+    @Benchmark
+    fun gemmHeap(): Int {
+        VectorOps.gemm(m, n, k, ha, 0, k, hb, 0, n, hc, 0, n)
+        return hc.get(0)
+    }
+}
@@ -0,0 +1,58 @@
+package io.github.kotlinmania.klang.mem
+
+import kotlinx.benchmark.Benchmark
+import kotlinx.benchmark.BenchmarkMode
+import kotlinx.benchmark.BenchmarkTimeUnit
+import kotlinx.benchmark.Mode
+import kotlinx.benchmark.OutputTimeUnit
+import kotlinx.benchmark.Param
+import kotlinx.benchmark.Scope
+import kotlinx.benchmark.Setup
+import kotlinx.benchmark.State
+
+/**
+ * Steady-state KMalloc churn on a quiet heap, one size class at a time.
+ *
+ * [KMallocFragmentationBenchmark] measures a heap full of holes; this one
+ * measures the allocator's fixed cost: a malloc/free pair that always hits
+ * the same bin, and a LIFO batch of [BATCH] blocks the way a parser or an
+ * interpreter frame allocates. The C baseline
+ * (`tools/klang_bench_baseline.c`) runs the same loops on the host malloc.
+ */
+@State(Scope.Benchmark)
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(BenchmarkTimeUnit.NANOSECONDS)
+class KMallocChurnBenchmark {
+
+    companion object {
+        const val BATCH = 64
+    }
+
+    @Param("16", "256", "4096")
+    var size: Int = 0
+
+    private val batch = IntArray(BATCH)
+
+    @Setup
+    fun setup() {
+        KMalloc.init(BATCH * (size + 64) + (1 shl 20))
+        // Warm the bin so the first measured malloc reuses a freed block
+        for (i in 0 until BATCH) batch[i] = KMalloc.malloc(size)
+        for (i in BATCH - 1 downTo 0) KMalloc.free(batch[i])
+    }
+
+    @Benchmark
+    fun mallocFree(): Int {
+        val p = KMalloc.malloc(size)
+        KMalloc.free(p)
+        return p
+    }
+
+    /** [BATCH] mallocs, then frees in reverse order; one op is the whole batch. */
+    @Benchmark
+    fun mallocFreeBatch(): Int {
+        for (i in 0 until BATCH) batch[i] = KMalloc.malloc(size)
+        for (i in BATCH - 1 downTo 0) KMalloc.free(batch[i])
+        return batch[0]
+    }
+}
@@ -0,0 +1,97 @@
+package io.github.kotlinmania.klang.mem
+
+import kotlinx.benchmark.Benchmark
+import kotlinx.benchmark.BenchmarkMode
+import kotlinx.benchmark.Mode
+import kotlinx.benchmark.OutputTimeUnit
+import kotlinx.benchmark.Scope
+import kotlinx.benchmark.Setup
+import kotlinx.benchmark.State
+
+/**
+ * KMalloc throughput on a fragmented heap.
+ *
+ * Setup allocates [LIVE] blocks with a deterministic mix of small (16..1024)
+ * and large (1 KiB..64 KiB) sizes, then frees every other one, leaving a
+ * heap riddled with free holes of every size class. Each benchmark method
+ * then runs one malloc/free churn step against that heap.
+ *
+ * With the old first-fit walk over a single large list, `largeChurn` paid
+ * for every hole smaller than the request; the bitmap index answers from the
+ * first non-empty size class in O(1). `smallChurn` exercises the bin mask
+ * when the exact bin is empty and a larger bin has to be split.
+ */
+@State(Scope.Benchmark)
+@BenchmarkMode(Mode.Throughput)
+@OutputTimeUnit(kotlinx.benchmark.BenchmarkTimeUnit.MILLISECONDS)
+class KMallocFragmentationBenchmark {
+
+    companion object {
+        const val LIVE = 4096
+        const val HEAP_BYTES = 256 shl 20
+    }
+
+    private val live = IntArray(LIVE)
+    private var seed = 0x9E3779B9.toInt()
+    private var cursor = 0
+
+    private fun next(): Int {
+        // xorshift32: deterministic size stream on every target
+        var x = seed
+        x = x xor (x shl 13)
+        x = x xor (x ushr 17)
+        x = x xor (x shl 5)
+        seed = x
+        return x and Int.MAX_VALUE
+    }
+
+    private fun smallSize(): Int = 16 + next() % 1009
+    private fun largeSize(): Int = 1024 + next() % (63 shl 10)
+
+    @Setup
+    fun setup() {
+        KMalloc.init(HEAP_BYTES)
+        seed = 0x9E3779B9.toInt()
+        cursor = 0
+        for (i in 0 until LIVE) {
+            live[i] = KMalloc.malloc(if (i and 3 == 0) largeSize() else smallSize())
+        }
+        for (i in 0 until LIVE step 2) {
+            KMalloc.free(live[i])
+            live[i] = 0
+        }
+    }
+
+    /** Replace one slot with a fresh large block. */
+    @Benchmark
+    fun largeChurn(): Int {
+        val slot = cursor
+        cursor = (cursor + 1) and (LIVE - 1)
+        KMalloc.free(live[slot])
+        val p = KMalloc.malloc(largeSize())
+        live[slot] = p
+        return p
+    }
+
+    /** Replace one slot with a fresh small block. */
+    @Benchmark
+    fun smallChurn(): Int {
+        val slot = cursor
+        cursor = (cursor + 1) and (LIVE - 1)
+        KMalloc.free(live[slot])
+        val p = KMalloc.malloc(smallSize())
+        live[slot] = p
+        return p
+    }
+
+    /** Mixed 3:1 small/large churn, the shape of most interpreter workloads. */
+    @Benchmark
+    fun mixedChurn(): Int {
+        val slot = cursor
+        cursor = (cursor + 1) and (LIVE - 1)
+        KMalloc.free(live[slot])
+        val p = KMalloc.malloc(if (slot and 3 == 0) largeSize() else smallSize())
+        live[slot] = p
+        return p
+    }
+}
@@ -0,0 +1,89 @@
+package io.github.kotlinmania.klang.mem
+
+import kotlinx.benchmark.Benchmark
+import kotlinx.benchmark.BenchmarkMode
+import kotlinx.benchmark.BenchmarkTimeUnit
+import kotlinx.benchmark.Mode
+import kotlinx.benchmark.OutputTimeUnit
+import kotlinx.benchmark.Param
+import kotlinx.benchmark.Scope
+import kotlinx.benchmark.Setup
+import kotlinx.benchmark.State
+
+/**
+ * Heap memory throughput against block size: the word kernels behind
+ * [GlobalHeap.memcpy] / [GlobalHeap.memmove] / [GlobalHeap.memset]
+ * ([FastMem]) and the [CLib] scans built on [FastStringMem].
+ *
+ * Sizes run from one short string to 1 MiB, so the table shows where the
+ * head/tail overhead stops dominating and where the word loop reaches its
+ * ceiling. `tools/klang_bench_baseline.c` times the same operations with the
+ * host libc under the same names; `./gradlew benchmarkCompare` reports the
+ * ratio.
+ */
+@State(Scope.Benchmark)
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(BenchmarkTimeUnit.NANOSECONDS)
+class MemoryThroughputBenchmark {
+
+    @Param("16", "256", "4096", "65536", "1048576")
+    var size: Int = 0
+
+    private var src = 0
+    private var dst = 0
+    private var text = 0
+    private var fill = 0
+
+    @Setup
+    fun setup() {
+        KMalloc.init(4 * size + (1 shl 16))
+        src = KMalloc.malloc(size + 16)
+        dst = KMalloc.malloc(size + 16)
+        text = KMalloc.malloc(size + 16)
+        for (i in 0 until size + 16) GlobalHeap.sb(src + i, (((i * 31 + 7) and 0x7F) or 1).toByte())
+        GlobalHeap.memcpy(dst, src, size + 16)
+        GlobalHeap.memcpy(text, src, size)
+        GlobalHeap.sb(text + size - 1, 0)
+    }
+
+    @Benchmark
+    fun memcpyAligned(): Int {
+        GlobalHeap.memcpy(dst, src, size)
+        return dst
+    }
+
+    /** Source three bytes off the destination's alignment: the shift-merge path. */
+    @Benchmark
+    fun memcpyMisaligned(): Int {
+        GlobalHeap.memcpy(dst, src + 3, size)
+        return dst
+    }
+
+    /** Overlapping forward move by one byte, the worst case for direction choice. */
+    @Benchmark
+    fun memmoveOverlap(): Int {
+        GlobalHeap.memmove(dst + 1, dst, size)
+        return dst
+    }
+
+    @Benchmark
+    fun memset(): Int {
+        fill = (fill + 1) and 0x7F
+        GlobalHeap.memset(dst, fill, size)
+        return dst
+    }
+
+    /** Equal buffers, so the scan runs the full length. */
+    @Benchmark
+    fun memcmpEqual(): Int {
+        GlobalHeap.memcpy(dst, src, size)
+        return CLib.memcmp(src, dst, size)
+    }
+
+    /** The byte is absent (every source byte is odd and below 0x80). */
+    @Benchmark
+    fun memchrMiss(): Int = CLib.memchr(src, 0x80, size)
+
+    @Benchmark
+    fun strlen(): Int = CLib.strlen(text)
+}
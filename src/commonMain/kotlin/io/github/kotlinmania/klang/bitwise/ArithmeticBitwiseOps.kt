@@ -228,12 +228,12 @@ class ArithmeticBitwiseOps(
         bits: Int,
     ): Long {
         if (bits !in 0..<bitLength) {
-            ZlibLogger.logBitwise("leftShift($value, $bits) -> 0 (out of range for $bitLength-bit)", "leftShift")
+            ZlibLogger.logBitwise("leftShift") { "leftShift($value, $bits) -> 0 (out of range for $bitLength-bit)" }
             return 0L
         }
         if (bits == 0) {
             val result = normalize(value)
-            ZlibLogger.logBitwise("leftShift($value, $bits) -> $result (no shift, normalized)", "leftShift")
+            ZlibLogger.logBitwise("leftShift") { "leftShift($value, $bits) -> $result (no shift, normalized)" }
             return result
         }
 
@@ -241,7 +241,7 @@ class ArithmeticBitwiseOps(
         val scale = pow2(bits)
         val mod = maxValue + 1L
         val result = (original * scale) % mod
-        ZlibLogger.logBitwise("leftShift($value, $bits) -> $result [$bitLength-bit arithmetic]", "leftShift")
+        ZlibLogger.logBitwise("leftShift") { "leftShift($value, $bits) -> $result [$bitLength-bit arithmetic]" }
         return result
     }
 
@@ -427,7 +427,7 @@ class ArithmeticBitwiseOps(
         var remaining1 = norm1
         var remaining2 = norm2
 
-        ZlibLogger.logBitwise("and($value1, $value2) starting bit-by-bit analysis [max $maxBits bits]", "and")
+        ZlibLogger.logBitwise("and") { "and($value1, $value2) starting bit-by-bit analysis [max $maxBits bits]" }
 
         for (i in 0 until maxBits) {
             if (remaining1 == 0L || remaining2 == 0L) break
@@ -438,7 +438,7 @@ class ArithmeticBitwiseOps(
             // AND the bits: 0&0=0, 0&1=0, 1&0=0, 1&1=1
             if (bit1 == 1L && bit2 == 1L) {
                 result += powerOf2
-                ZlibLogger.logBitwise("and: bit position $i: 1&1=1, adding $powerOf2 to result", "and")
+                ZlibLogger.logBitwise("and") { "and: bit position $i: 1&1=1, adding $powerOf2 to result" }
             }
 
             remaining1 /= 2
@@ -446,7 +446,7 @@ class ArithmeticBitwiseOps(
             powerOf2 *= 2
         }
 
-        ZlibLogger.logBitwise("and($value1, $value2) -> $result [binary: ${value1.toString(2)} & ${value2.toString(2)} = ${result.toString(2)}]", "and")
+        ZlibLogger.logBitwise("and") { "and($value1, $value2) -> $result [binary: ${value1.toString(2)} & ${value2.toString(2)} = ${result.toString(2)}]" }
         return result
     }
 
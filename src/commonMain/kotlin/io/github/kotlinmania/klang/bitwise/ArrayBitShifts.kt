@@ -8,7 +8,9 @@ import kotlinx.coroutines.launch
 /**
  * Array-wide bit shifts for limb arrays (little-endian) with optional sticky tracking.
  * These are scalar implementations designed to be allocation-free and branch-light.
- * Future: provide platform-optimized actuals (JVM Vector API / Kotlin/Native Vector128).
+ * The 16-bit limb API keeps one limb per Int; the packed word mode
+ * (`shl32LEInPlace`, `shl64LEInPlace`, ...) shifts the same number stored as
+ * 32/64-bit words with one native funnel step per word.
  * 
  * @native-bitshift-allowed This is a core BitShift implementation file.
  * Native bitwise operations (shl, shr, ushr, and, or) are permitted here
@@ -16,12 +18,6 @@ import kotlinx.coroutines.launch
  */
 object ArrayBitShifts {
     data class ShiftResult(val carryOut: Int, val sticky: Boolean)
-    private val eng16 get() = BitShiftEngine(BitShiftConfig.defaultMode, 16)
-    private val a16 = ArithmeticBitwiseOps(16)
-    private val a32 = ArithmeticBitwiseOps.BITS_32
-    private const val BASE16: Int = 65536
-    // Use vector-friendly 3-pass even for small limb windows like HPC16x8 (8 limbs)
-    private const val VECTOR_THRESHOLD: Int = 8
     // Heuristics for parallel fanout
     private const val MIN_PAR_CHUNK: Int = 8192
 
@@ -35,27 +31,15 @@ object ArrayBitShifts {
     fun shl16LEInPlace(a: IntArray, from: Int, len: Int, s: Int, carryIn: Int = 0): ShiftResult {
         require(s in 0..15) { "s must be in 0..15" }
         if (len <= 0 || s == 0) return ShiftResult(carryIn and 0xFFFF, false)
-        val pow2s = ShiftTables16.POW2[s]
-        val mask16 = ShiftTables16.MASK16
-        val maskLowS = ShiftTables16.LOW_MASK[s]
-        if (len >= VECTOR_THRESHOLD) return shl16ThreePass(a, from, len, s, carryIn)
-        var carry = carryIn and 0xFFFF
-        var sticky = false
-        for (i in from until from + len) {
-            val cur = (a[i] and mask16).toLong()
-            val rs = eng16.leftShift(cur, s)
-            val lowShifted = a16.normalize(rs.value).toInt()
-            val carryLow = if (maskLowS == 0) 0 else (carry % (maskLowS + 1))
-            val combined = BitwiseOps.orArithmetic(lowShifted, carryLow)
-            a[i] = (combined % BASE16)
-            carry = if (maskLowS == 0) 0 else (rs.carry.toInt() % (maskLowS + 1))
-        }
-        return ShiftResult(carry and 0xFFFF, sticky)
+        val carryOut = (a[from + len - 1] and 0xFFFF) ushr (16 - s)
+        shl16Range(a, from, from + len, s, carryIn and ShiftTables16.LOW_MASK[s])
+        return ShiftResult(carryOut, false)
     }
 
     /**
-     * Parallel 3-pass left shift using coroutines. Works best for large arrays (len >= ~64K).
-     * Splits work into chunks; Pass A computes lo/hi locally, Pass C merges with neighbor hi.
+     * Parallel left shift using coroutines. Works best for large arrays (len >= ~64K).
+     * Each chunk shifts its own range in place; the only data exchanged between
+     * chunks is the limb just below each chunk, captured before any chunk starts.
      * Returns carryOut (upper s bits of last limb). Sticky is currently false (left shift).
      */
     suspend fun shl16LEInPlaceParallel(
@@ -68,253 +52,320 @@ object ArrayBitShifts {
     ): ShiftResult {
         require(s in 0..15) { "s must be in 0..15" }
         if (len <= 0 || s == 0) return ShiftResult(carryIn and 0xFFFF, false)
-        val pow2s = ShiftTables16.POW2[s]
-        val mask16 = ShiftTables16.MASK16
-        val pow2_16_minus_s = ShiftTables16.POW2[16 - s]
-        val maskLowS = ShiftTables16.LOW_MASK[s]
-
-        val lo = IntArray(len)
-        val hi = IntArray(len)
-
-        fun decideChunks(n: Int): Int {
-            if (n < MIN_PAR_CHUNK) return 1
-            val target = if (parallelism > 0) parallelism else 4
-            val maxChunks = target.coerceAtMost(8)
-            val bySize = (n / MIN_PAR_CHUNK).coerceAtLeast(1)
-            return bySize.coerceAtMost(maxChunks)
-        }
-
-        val chunks = decideChunks(len)
-        if (chunks == 1) {
-            // Fall back to scalar 3-pass (still cache-friendly)
-            return shl16ThreePass(a, from, len, s, carryIn)
-        }
-
-        val boundaries = IntArray(chunks)
+        val chunks = decideChunks(len, parallelism)
+        if (chunks == 1) return shl16LEInPlace(a, from, len, s, carryIn)
 
+        val back = 16 - s
         val chunkSize = (len + chunks - 1) / chunks
-        // Pass A+B: compute lo and hi
+        val carryOut = (a[from + len - 1] and 0xFFFF) ushr back
+        // Bits entering each chunk from below, read before any chunk writes
+        val carryBelow = IntArray(chunks) { ck ->
+            if (ck == 0) carryIn and ShiftTables16.LOW_MASK[s] else (a[from + ck * chunkSize - 1] and 0xFFFF) ushr back
+        }
         coroutineScope {
             for (ck in 0 until chunks) {
                 val start = ck * chunkSize
                 val end = minOf(len, start + chunkSize)
                 if (start >= end) continue
                 launch(context = parallelDispatcher) {
-                    var i = start
-                    while (i < end) {
-                        val v = a[from + i] and mask16
-                        lo[i] = (v * pow2s) and mask16
-                        hi[i] = (v / pow2_16_minus_s) and mask16
-                        i++
-                    }
-                    boundaries[ck] = hi[end - 1]
+                    shl16Range(a, from + start, from + end, s, carryBelow[ck])
                 }
             }
         }
-        // Pass C: merge with neighbor hi (requires one boundary per chunk)
-        val carryInNorm = if (maskLowS == 0) 0 else (carryIn % (maskLowS + 1))
+        return ShiftResult(carryOut, false)
+    }
+
+    /**
+     * In-place right shift of a little-endian IntArray of 16-bit limbs: a[from .. from+len-1].
+     * Returns carryOut (low s bits shifted out from the first limb) and sticky (OR of all bits shifted out).
+     */
+    fun rsh16LEInPlace(a: IntArray, from: Int, len: Int, s: Int): ShiftResult {
+        require(s in 0..15) { "s must be in 0..15" }
+        if (len <= 0 || s == 0) return ShiftResult(0, false)
+        val carryOut = a[from] and ShiftTables16.LOW_MASK[s]
+        val sticky = rsh16Range(a, from, from + len, s, 0)
+        return ShiftResult(carryOut, sticky)
+    }
+
+    /**
+     * Parallel right shift using coroutines. Returns carryOut (low s bits dropped from limb 0)
+     * and sticky (OR of all dropped bits across limbs). Chunks exchange only the
+     * limb just above each chunk, captured before any chunk starts.
+     */
+    suspend fun rsh16LEInPlaceParallel(
+        a: IntArray,
+        from: Int,
+        len: Int,
+        s: Int,
+        parallelism: Int = 0,
+    ): ShiftResult {
+        require(s in 0..15) { "s must be in 0..15" }
+        if (len <= 0 || s == 0) return ShiftResult(0, false)
+        val chunks = decideChunks(len, parallelism)
+        if (chunks == 1) return rsh16LEInPlace(a, from, len, s)
+
+        val chunkSize = (len + chunks - 1) / chunks
+        val carryOut = a[from] and ShiftTables16.LOW_MASK[s]
+        // Bits entering each chunk from above, read before any chunk writes
+        val carryAbove = IntArray(chunks) { ck ->
+            val next = (ck + 1) * chunkSize
+            if (next >= len) 0 else (a[from + next] shl (16 - s)) and 0xFFFF
+        }
+        val stickyPerChunk = BooleanArray(chunks)
         coroutineScope {
             for (ck in 0 until chunks) {
                 val start = ck * chunkSize
                 val end = minOf(len, start + chunkSize)
                 if (start >= end) continue
                 launch(context = parallelDispatcher) {
-                    var i = start
-                    var neighbor = if (i == 0) carryInNorm else {
-                        if (i == start) boundaries[ck - 1] else hi[i - 1]
-                    }
-                    while (i < end) {
-                        if (i != start) neighbor = hi[i - 1]
-                        val combined = BitwiseOps.orArithmeticGeneral(lo[i], neighbor)
-                        a[from + i] = combined % BASE16
-                        i++
-                    }
+                    stickyPerChunk[ck] = rsh16Range(a, from + start, from + end, s, carryAbove[ck])
                 }
             }
         }
-
-        val carryOut = (hi[len - 1] and maskLowS) and 0xFFFF
-        return ShiftResult(carryOut, false)
+        return ShiftResult(carryOut, stickyPerChunk.any { it })
     }
 
-    // 3-pass left shift for better auto-vectorization
-    private fun shl16ThreePass(a: IntArray, from: Int, len: Int, s: Int, carryIn: Int): ShiftResult {
-        val lo = IntArray(len)
-        val hi = IntArray(len)
-        val pow2s = ShiftTables16.POW2[s]
-        val mask16 = ShiftTables16.MASK16
-
-        // Pass A: lo = (val * 2^s) mod 2^16
-        var idx = 0
-        while (idx < len) {
-            val v = a[from + idx] and mask16
-            lo[idx] = (v * pow2s) and mask16
-            idx++
+    /** Left shift a[lo until hi] by s (1..15), walking down so each limb still sees its original lower neighbor. */
+    private fun shl16Range(a: IntArray, lo: Int, hi: Int, s: Int, carryLow: Int) {
+        val back = 16 - s
+        var i = hi - 1
+        while (i > lo) {
+            a[i] = ((a[i] shl s) or ((a[i - 1] and 0xFFFF) ushr back)) and 0xFFFF
+            i--
         }
-        // Pass B: hi = floor(val / 2^(16-s)) (top s bits moved to low)
-        idx = 0
-        while (idx < len) {
-            val v = a[from + idx] and mask16
-            hi[idx] = (v / ShiftTables16.POW2[16 - s]) and mask16
-            idx++
-        }
-        // Pass C: combine with neighbor carry; carryIn feeds element 0
-        val maskLowS = ShiftTables16.LOW_MASK[s]
-        var carry = carryIn and 0xFFFF
-        idx = 0
-        while (idx < len) {
-            val neighbor = if (idx == 0) (if (maskLowS == 0) 0 else (carry % (maskLowS + 1))) else hi[idx - 1]
-            val combined = BitwiseOps.orArithmeticGeneral(lo[idx], neighbor)
-            a[from + idx] = combined % BASE16
-            idx++
+        a[lo] = ((a[lo] shl s) or carryLow) and 0xFFFF
+    }
+
+    /** Right shift a[lo until hi] by s (1..15), walking up; returns OR of dropped bits != 0. */
+    private fun rsh16Range(a: IntArray, lo: Int, hi: Int, s: Int, carryHigh: Int): Boolean {
+        val back = 16 - s
+        val lowMask = ShiftTables16.LOW_MASK[s]
+        var dropped = 0
+        val last = hi - 1
+        for (i in lo until last) {
+            val v = a[i] and 0xFFFF
+            dropped = dropped or (v and lowMask)
+            a[i] = (v ushr s) or ((a[i + 1] shl back) and 0xFFFF)
         }
-        val carryOut = if (len > 0) (hi[len - 1] and maskLowS) else 0
-        return ShiftResult(carryOut and 0xFFFF, false)
+        val v = a[last] and 0xFFFF
+        dropped = dropped or (v and lowMask)
+        a[last] = (v ushr s) or carryHigh
+        return dropped != 0
     }
 
+    // ========================================================================
+    // Packed word mode: the same little-endian bignum as 32- or 64-bit words
+    // ========================================================================
+    //
+    // A 16-bit limb array of n limbs packs into ceil(n/2) Ints or ceil(n/4)
+    // Longs (limb 0 in the low bits of word 0). Shifting the packed words by s
+    // shifts the same number; one funnel step per word replaces 2 or 4 limb
+    // steps and halves or quarters the memory traffic. When n is not a
+    // multiple of the word size, the unused top limbs of the last word absorb
+    // bits that the 16-bit API would have reported as carryOut.
+    //
+    // Word-mode carries are full words, and sticky is simply carryOut != 0:
+    // bits moving between words are not lost.
+
+    /** Result of a 64-bit word shift: [carryOut] holds up to 63 bits. */
+    data class WordShiftResult(val carryOut: Long, val sticky: Boolean)
+
     /**
-     * In-place right shift of a little-endian IntArray of 16-bit limbs: a[from .. from+len-1].
-     * Returns carryOut (low s bits shifted out from the first limb) and sticky (OR of all bits shifted out).
+     * In-place left shift of a little-endian IntArray of 32-bit words by s (0..31).
+     * The low s bits of [carryIn] enter word 0; returns the top s bits of the last word.
      */
-    fun rsh16LEInPlace(a: IntArray, from: Int, len: Int, s: Int): ShiftResult {
-        require(s in 0..15) { "s must be in 0..15" }
+    fun shl32LEInPlace(a: IntArray, from: Int, len: Int, s: Int, carryIn: Int = 0): ShiftResult {
+        require(s in 0..31) { "s must be in 0..31" }
+        // Nothing shifts: the incoming carry passes through, as in shl16LEInPlace
+        if (len <= 0 || s == 0) return ShiftResult(carryIn, false)
+        val carryOut = a[from + len - 1] ushr (32 - s)
+        shl32Range(a, from, from + len, s, carryIn and ((1 shl s) - 1))
+        return ShiftResult(carryOut, false)
+    }
+
+    /**
+     * In-place right shift of a little-endian IntArray of 32-bit words by s (0..31).
+     * Returns the low s bits dropped from word 0.
+     */
+    fun rsh32LEInPlace(a: IntArray, from: Int, len: Int, s: Int): ShiftResult {
+        require(s in 0..31) { "s must be in 0..31" }
         if (len <= 0 || s == 0) return ShiftResult(0, false)
-        val pow2s = ShiftTables16.POW2[s]
-        val mask16 = ShiftTables16.MASK16
-        if (len >= VECTOR_THRESHOLD) return rsh16ThreePass(a, from, len, s)
-        var nextCarry = 0
-        var sticky = false
-        var carryOut = 0
-        for (i in from + len - 1 downTo from) {
-            val cur = (a[i] and mask16).toLong()
-            val rs = eng16.unsignedRightShift(cur, s)
-            val lowPart = a16.normalize(rs.value).toInt()
-            // compute nextCarry * 2^(16-s) arithmetically
-            val shiftHi = 16 - s
-            val highPart = if (shiftHi == 0) nextCarry % 65536 else a32.leftShift(nextCarry.toLong(), shiftHi).toInt()
-            val out = BitwiseOps.orArithmeticGeneral(lowPart, highPart)
-            val dropped = if (s == 0) 0 else (cur.toInt() % pow2s)
-            if (i == from) carryOut = dropped
-            sticky = sticky or (dropped != 0)
-            a[i] = (out % BASE16)
-            nextCarry = dropped
-        }
-        return ShiftResult(carryOut and 0xFFFF, sticky)
+        val carryOut = a[from] and ((1 shl s) - 1)
+        rsh32Range(a, from, from + len, s, 0)
+        return ShiftResult(carryOut, carryOut != 0)
     }
 
-    private fun rsh16ThreePass(a: IntArray, from: Int, len: Int, s: Int): ShiftResult {
-        val hi = IntArray(len)
-        val dropped = IntArray(len)
-        val mask16 = BASE16 - 1
-        val pow2s = a32.leftShift(1L, s).toInt()
-        val pow2_16_minus_s = a32.leftShift(1L, 16 - s).toInt()
-
-        // Pass A: hi = floor(val / 2^s)
-        var idx = 0
-        while (idx < len) {
-            val v = a[from + idx] and mask16
-            hi[idx] = a16.rightShift(v.toLong(), s).toInt() and mask16
-            idx++
-        }
-        // Pass B: dropped = val % 2^s
-        idx = 0
-        while (idx < len) {
-            val v = a[from + idx] and mask16
-            dropped[idx] = if (s == 0) 0 else (v % pow2s)
-            idx++
-        }
-        // Pass C: out[i] = hi[i] OR ((i+1<) dropped[i+1] * 2^(16-s))
-        var sticky = false
-        idx = 0
-        while (idx < len) {
-            val neighbor = if (idx + 1 < len) ((dropped[idx + 1].toLong() * pow2_16_minus_s) % BASE16).toInt() else 0
-            val combined = BitwiseOps.orArithmeticGeneral(hi[idx], neighbor)
-            a[from + idx] = combined % BASE16
-            sticky = sticky or (dropped[idx] != 0)
-            idx++
-        }
-        val carryOut = if (len > 0) dropped[0] else 0
-        return ShiftResult(carryOut and 0xFFFF, sticky)
+    /**
+     * In-place left shift of a little-endian LongArray of 64-bit words by s (0..63).
+     * The low s bits of [carryIn] enter word 0; returns the top s bits of the last word.
+     */
+    fun shl64LEInPlace(a: LongArray, from: Int, len: Int, s: Int, carryIn: Long = 0L): WordShiftResult {
+        require(s in 0..63) { "s must be in 0..63" }
+        if (len <= 0 || s == 0) return WordShiftResult(carryIn, false)
+        val carryOut = a[from + len - 1] ushr (64 - s)
+        shl64Range(a, from, from + len, s, carryIn and ((1L shl s) - 1L))
+        return WordShiftResult(carryOut, false)
     }
 
     /**
-     * Parallel 3-pass right shift using coroutines. Returns carryOut (low s bits dropped from limb 0)
-     * and sticky (OR of all dropped bits across limbs).
+     * In-place right shift of a little-endian LongArray of 64-bit words by s (0..63).
+     * Returns the low s bits dropped from word 0.
      */
-    suspend fun rsh16LEInPlaceParallel(
-        a: IntArray,
+    fun rsh64LEInPlace(a: LongArray, from: Int, len: Int, s: Int): WordShiftResult {
+        require(s in 0..63) { "s must be in 0..63" }
+        if (len <= 0 || s == 0) return WordShiftResult(0L, false)
+        val carryOut = a[from] and ((1L shl s) - 1L)
+        rsh64Range(a, from, from + len, s, 0L)
+        return WordShiftResult(carryOut, carryOut != 0L)
+    }
+
+    /**
+     * Parallel [shl64LEInPlace]. Chunks shift in place and exchange only the
+     * word below each chunk; no scratch arrays proportional to [len].
+     */
+    suspend fun shl64LEInPlaceParallel(
+        a: LongArray,
         from: Int,
         len: Int,
         s: Int,
+        carryIn: Long = 0L,
         parallelism: Int = 0,
-    ): ShiftResult {
-        require(s in 0..15) { "s must be in 0..15" }
-        if (len <= 0 || s == 0) return ShiftResult(0, false)
-
-        fun decideChunks(n: Int): Int {
-            if (n < MIN_PAR_CHUNK) return 1
-            val target = if (parallelism > 0) parallelism else 4
-            val maxChunks = target.coerceAtMost(8)
-            val bySize = (n / MIN_PAR_CHUNK).coerceAtLeast(1)
-            return bySize.coerceAtMost(maxChunks)
-        }
-        val chunks = decideChunks(len)
-        if (chunks == 1) return rsh16ThreePass(a, from, len, s)
-
-        val hi = IntArray(len)
-        val dropped = IntArray(len)
-        val mask16 = BASE16 - 1
-        val pow2s = ArithmeticBitwiseOps.BITS_32.leftShift(1L, s).toInt()
-        val pow2_16_minus_s = ArithmeticBitwiseOps.BITS_32.leftShift(1L, 16 - s).toInt()
-        val firstDroppedPerChunk = IntArray(chunks)
+    ): WordShiftResult {
+        require(s in 0..63) { "s must be in 0..63" }
+        if (len <= 0 || s == 0) return WordShiftResult(carryIn, false)
+        val chunks = decideChunks(len, parallelism)
+        if (chunks == 1) return shl64LEInPlace(a, from, len, s, carryIn)
 
         val chunkSize = (len + chunks - 1) / chunks
-        // Pass A+B: hi and dropped
+        val carryOut = a[from + len - 1] ushr (64 - s)
+        val carryBelow = LongArray(chunks) { ck ->
+            if (ck == 0) carryIn and ((1L shl s) - 1L) else a[from + ck * chunkSize - 1] ushr (64 - s)
+        }
         coroutineScope {
             for (ck in 0 until chunks) {
                 val start = ck * chunkSize
                 val end = minOf(len, start + chunkSize)
                 if (start >= end) continue
                 launch(context = parallelDispatcher) {
-                    var i = start
-                    while (i < end) {
-                        val v = a[from + i] and mask16
-                        hi[i] = ArithmeticBitwiseOps.BITS_32.rightShift(v.toLong(), s).toInt() and mask16
-                        dropped[i] = if (s == 0) 0 else (v % pow2s)
-                        i++
-                    }
-                    firstDroppedPerChunk[ck] = dropped[start]
+                    shl64Range(a, from + start, from + end, s, carryBelow[ck])
                 }
             }
         }
-        // Pass C: combine; need dropped[i+1] or firstDropped of next chunk
+        return WordShiftResult(carryOut, false)
+    }
+
+    /**
+     * Parallel [rsh64LEInPlace]. Chunks shift in place and exchange only the
+     * word above each chunk; no scratch arrays proportional to [len].
+     */
+    suspend fun rsh64LEInPlaceParallel(
+        a: LongArray,
+        from: Int,
+        len: Int,
+        s: Int,
+        parallelism: Int = 0,
+    ): WordShiftResult {
+        require(s in 0..63) { "s must be in 0..63" }
+        if (len <= 0 || s == 0) return WordShiftResult(0L, false)
+        val chunks = decideChunks(len, parallelism)
+        if (chunks == 1) return rsh64LEInPlace(a, from, len, s)
+
+        val chunkSize = (len + chunks - 1) / chunks
+        val carryOut = a[from] and ((1L shl s) - 1L)
+        val carryAbove = LongArray(chunks) { ck ->
+            val next = (ck + 1) * chunkSize
+            if (next >= len) 0L else a[from + next] shl (64 - s)
+        }
         coroutineScope {
             for (ck in 0 until chunks) {
                 val start = ck * chunkSize
                 val end = minOf(len, start + chunkSize)
                 if (start >= end) continue
-                val nextChunkFirst = if (ck + 1 < chunks) firstDroppedPerChunk[ck + 1] else 0
                 launch(context = parallelDispatcher) {
-                    var i = start
-                    while (i < end) {
-                        val neighbor = if (i + 1 < end) {
-                            ((dropped[i + 1].toLong() * pow2_16_minus_s) % BASE16).toInt()
-                        } else {
-                            ((nextChunkFirst.toLong() * pow2_16_minus_s) % BASE16).toInt()
-                        }
-                        val combined = BitwiseOps.orArithmeticGeneral(hi[i], neighbor)
-                        a[from + i] = combined % BASE16
-                        i++
-                    }
+                    rsh64Range(a, from + start, from + end, s, carryAbove[ck])
                 }
             }
         }
-        // Aggregate carry/sticky from dropped[]
-        val carryOut = if (len > 0) dropped[0] and 0xFFFF else 0
-        var sticky = false
-        var i = 0
-        while (i < len) { sticky = sticky or (dropped[i] != 0); i++ }
-        return ShiftResult(carryOut, sticky)
+        return WordShiftResult(carryOut, carryOut != 0L)
+    }
+
+    // Funnel shifts over one range; s is 1..width-1, carries are pre-positioned.
+    private fun shl32Range(a: IntArray, lo: Int, hi: Int, s: Int, carryLow: Int) {
+        val back = 32 - s
+        var i = hi - 1
+        while (i > lo) {
+            a[i] = (a[i] shl s) or (a[i - 1] ushr back)
+            i--
+        }
+        a[lo] = (a[lo] shl s) or carryLow
+    }
+
+    private fun rsh32Range(a: IntArray, lo: Int, hi: Int, s: Int, carryHigh: Int) {
+        val back = 32 - s
+        val last = hi - 1
+        for (i in lo until last) a[i] = (a[i] ushr s) or (a[i + 1] shl back)
+        a[last] = (a[last] ushr s) or carryHigh
+    }
+
+    private fun shl64Range(a: LongArray, lo: Int, hi: Int, s: Int, carryLow: Long) {
+        val back = 64 - s
+        var i = hi - 1
+        while (i > lo) {
+            a[i] = (a[i] shl s) or (a[i - 1] ushr back)
+            i--
+        }
+        a[lo] = (a[lo] shl s) or carryLow
+    }
+
+    private fun rsh64Range(a: LongArray, lo: Int, hi: Int, s: Int, carryHigh: Long) {
+        val back = 64 - s
+        val last = hi - 1
+        for (i in lo until last) a[i] = (a[i] ushr s) or (a[i + 1] shl back)
+        a[last] = (a[last] ushr s) or carryHigh
+    }
+
+    /** Pack [limbs] 16-bit limbs from src[srcFrom..] into 64-bit words at dst[dstFrom..] (top of last word zeroed). */
+    fun pack16To64(src: IntArray, srcFrom: Int, limbs: Int, dst: LongArray, dstFrom: Int = 0) {
+        val words = (limbs + 3) ushr 2
+        for (w in 0 until words) {
+            var acc = 0L
+            val base = srcFrom + w * 4
+            val n = minOf(4, limbs - w * 4)
+            for (k in 0 until n) acc = acc or ((src[base + k].toLong() and 0xFFFFL) shl (k * 16))
+            dst[dstFrom + w] = acc
+        }
+    }
+
+    /** Unpack 64-bit words into [limbs] 16-bit limbs (inverse of [pack16To64]). */
+    fun unpack64To16(src: LongArray, srcFrom: Int, dst: IntArray, dstFrom: Int, limbs: Int) {
+        for (i in 0 until limbs) {
+            dst[dstFrom + i] = ((src[srcFrom + (i ushr 2)] ushr ((i and 3) * 16)) and 0xFFFFL).toInt()
+        }
+    }
+
+    /** Pack [limbs] 16-bit limbs into 32-bit words (top half of an odd last word zeroed). */
+    fun pack16To32(src: IntArray, srcFrom: Int, limbs: Int, dst: IntArray, dstFrom: Int = 0) {
+        val words = (limbs + 1) ushr 1
+        for (w in 0 until words) {
+            val lo = src[srcFrom + 2 * w] and 0xFFFF
+            val hi = if (2 * w + 1 < limbs) src[srcFrom + 2 * w + 1] and 0xFFFF else 0
+            dst[dstFrom + w] = lo or (hi shl 16)
+        }
+    }
+
+    /** Unpack 32-bit words into [limbs] 16-bit limbs (inverse of [pack16To32]). */
+    fun unpack32To16(src: IntArray, srcFrom: Int, dst: IntArray, dstFrom: Int, limbs: Int) {
+        for (i in 0 until limbs) {
+            dst[dstFrom + i] = (src[srcFrom + (i ushr 1)] ushr ((i and 1) * 16)) and 0xFFFF
+        }
+    }
+
+    private fun decideChunks(n: Int, parallelism: Int): Int {
+        if (n < MIN_PAR_CHUNK) return 1
+        val target = if (parallelism > 0) parallelism else 4
+        val maxChunks = target.coerceAtMost(8)
+        val bySize = (n / MIN_PAR_CHUNK).coerceAtLeast(1)
+        return bySize.coerceAtMost(maxChunks)
     }
 
     /** Word-shift (multiple of 16 bits) left in-place for 16-bit limbs. */
@@ -337,88 +388,109 @@ object ArrayBitShifts {
 
     // LimbBuffer overloads removed; use heap-address overloads below for packed LE bytes in GlobalHeap.
 
-    // Heap-address overloads (operate directly on packed LE bytes in GlobalHeap)
+    // Heap-address overloads (operate directly on packed LE bytes in GlobalHeap).
+    // Limbs are read from PackedBuffer.data in place; every run of four limbs
+    // that fills one backing Long is shifted as a single 64-bit funnel step.
+
     fun shl16LEInPlace(baseAddr: Int, fromLimb: Int, len: Int, s: Int, carryIn: Int = 0): ShiftResult {
         require(s in 0..15) { "s must be in 0..15" }
-        if (len <= 0 || s == 0) return ShiftResult(carryIn and 0xFFFF, false) // @native-bitshift-allowed
-        
-        val pow2s = ShiftTables16.POW2[s]
-        val mask16 = ShiftTables16.MASK16
-        val maskLowS = ShiftTables16.LOW_MASK[s]
-        val eng16Local = BitShiftEngine(BitShiftConfig.defaultMode, 16)
-        
-        var carry = carryIn and 0xFFFF // @native-bitshift-allowed
-        var sticky = false
-        
-        for (i in 0 until len) {
-            val off = baseAddr + (fromLimb + i) * 2
-            val lowByte = GlobalHeap.lbu(off)
-            val highByte = GlobalHeap.lbu(off + 1)
-            // Compose 16-bit value from bytes (little-endian) using BitShiftEngine
-            val highShifted = eng16Local.byteShiftLeft(highByte.toLong(), 1)
-            val orResult = eng16Local.bitwiseOr(lowByte.toLong(), highShifted.value)
-            val cur = eng16Local.bitwiseAnd(orResult, mask16.toLong()).toInt()
-            
-            val rs = eng16.leftShift(cur.toLong(), s)
-            val lowShifted = a16.normalize(rs.value).toInt()
-            val carryLow = if (maskLowS == 0) 0 else (carry % (maskLowS + 1))
-            val combined = BitwiseOps.orArithmetic(lowShifted, carryLow)
-            val result = (combined % BASE16)
-            
-            // Decompose back to bytes (little-endian) using BitShiftEngine
-            val resultByte0 = eng16Local.bitwiseAnd(result.toLong(), 0xFF)
-            GlobalHeap.sb(off, resultByte0.toByte())
-            val highByteResult = eng16Local.byteShiftRight(result.toLong(), 1)
-            val resultByte1 = eng16Local.bitwiseAnd(highByteResult.value, 0xFF)
-            GlobalHeap.sb(off + 1, resultByte1.toByte())
-            
-            // Compute carry as top s bits of original value (shifted out)
-            carry = if (maskLowS == 0) 0 else ((cur / ShiftTables16.POW2[16 - s]) % (maskLowS + 1))
+        if (len <= 0 || s == 0) return ShiftResult(carryIn and 0xFFFF, false)
+        val start = baseAddr + fromLimb * 2
+        if ((start and 1) != 0) return shl16HeapUnaligned(start, len, s, carryIn)
+
+        val data = GlobalHeap.packed.data
+        val back = 16 - s
+        val carryLow = carryIn and ShiftTables16.LOW_MASK[s]
+        val carryOut = limbAt(data, start + (len - 1) * 2) ushr back
+        // Walk down: everything below the current position is still original
+        var addr = start + (len - 1) * 2
+        while (addr >= start) {
+            if ((addr and 7) == 6 && addr - 6 >= start) {
+                val w = addr ushr 3
+                val below = if (addr - 6 == start) carryLow.toLong() else data[w - 1] ushr (64 - s)
+                data[w] = (data[w] shl s) or below
+                addr -= 8
+            } else {
+                val below = if (addr == start) carryLow else limbAt(data, addr - 2) ushr back
+                setLimbAt(data, addr, ((limbAt(data, addr) shl s) or below) and 0xFFFF)
+                addr -= 2
+            }
         }
-        return ShiftResult(carry and 0xFFFF, sticky) // @native-bitshift-allowed
+        return ShiftResult(carryOut, false)
     }
 
     fun rsh16LEInPlace(baseAddr: Int, fromLimb: Int, len: Int, s: Int): ShiftResult {
         require(s in 0..15) { "s must be in 0..15" }
         if (len <= 0 || s == 0) return ShiftResult(0, false)
-        
-        val pow2s = ShiftTables16.POW2[s]
-        val mask16 = ShiftTables16.MASK16
-        val eng16Local = BitShiftEngine(BitShiftConfig.defaultMode, 16)
-        
-        var nextCarry = 0
+        val start = baseAddr + fromLimb * 2
+        if ((start and 1) != 0) return rsh16HeapUnaligned(start, len, s)
+
+        val data = GlobalHeap.packed.data
+        val back = 16 - s
+        val lowMask = ShiftTables16.LOW_MASK[s]
+        val lowMask4 = lowMask.toLong() * 0x0001_0001_0001_0001L
+        val end = start + len * 2
+        val carryOut = limbAt(data, start) and lowMask
+        var sticky = false
+        // Walk up: everything above the current position is still original
+        var addr = start
+        while (addr < end) {
+            if ((addr and 7) == 0 && addr + 8 <= end) {
+                val w = addr ushr 3
+                val v = data[w]
+                sticky = sticky || (v and lowMask4) != 0L
+                val above = if (addr + 8 < end) data[w + 1] shl (64 - s) else 0L
+                data[w] = (v ushr s) or above
+                addr += 8
+            } else {
+                val v = limbAt(data, addr)
+                sticky = sticky || (v and lowMask) != 0
+                val above = if (addr + 2 < end) (limbAt(data, addr + 2) shl back) and 0xFFFF else 0
+                setLimbAt(data, addr, (v ushr s) or above)
+                addr += 2
+            }
+        }
+        return ShiftResult(carryOut, sticky)
+    }
+
+    /** 16-bit limb at an even byte address (never spans two Longs). */
+    private fun limbAt(data: LongArray, addr: Int): Int =
+        ((data[addr ushr 3] ushr ((addr and 7) shl 3)) and 0xFFFFL).toInt()
+
+    private fun setLimbAt(data: LongArray, addr: Int, v: Int) {
+        val idx = addr ushr 3
+        val shift = (addr and 7) shl 3
+        data[idx] = (data[idx] and (0xFFFFL shl shift).inv()) or (v.toLong() shl shift)
+    }
+
+    // Odd base addresses: limbs may straddle two Longs, so go through GlobalHeap.
+    private fun shl16HeapUnaligned(start: Int, len: Int, s: Int, carryIn: Int): ShiftResult {
+        val back = 16 - s
+        var addr = start + (len - 1) * 2
+        val carryOut = (GlobalHeap.lh(addr).toInt() and 0xFFFF) ushr back
+        while (addr >= start) {
+            val below = if (addr == start) carryIn and ShiftTables16.LOW_MASK[s]
+                else (GlobalHeap.lh(addr - 2).toInt() and 0xFFFF) ushr back
+            GlobalHeap.sh(addr, ((GlobalHeap.lh(addr).toInt() shl s) or below).toShort())
+            addr -= 2
+        }
+        return ShiftResult(carryOut, false)
+    }
+
+    private fun rsh16HeapUnaligned(start: Int, len: Int, s: Int): ShiftResult {
+        val back = 16 - s
+        val lowMask = ShiftTables16.LOW_MASK[s]
+        val end = start + len * 2
+        val carryOut = GlobalHeap.lh(start).toInt() and lowMask
         var sticky = false
-        var carryOut = 0
-        
-        for (i in len - 1 downTo 0) {
-            val off = baseAddr + (fromLimb + i) * 2
-            val lowByte = GlobalHeap.lbu(off)
-            val highByte = GlobalHeap.lbu(off + 1)
-            // Compose 16-bit value from bytes (little-endian) using BitShiftEngine
-            val highShifted = eng16Local.byteShiftLeft(highByte.toLong(), 1)
-            val orResult = eng16Local.bitwiseOr(lowByte.toLong(), highShifted.value)
-            val cur = eng16Local.bitwiseAnd(orResult, mask16.toLong()).toInt()
-            
-            val rs = eng16.unsignedRightShift(cur.toLong(), s)
-            val lowPart = a16.normalize(rs.value).toInt()
-            // compute nextCarry * 2^(16-s) arithmetically
-            val shiftHi = 16 - s
-            val highPart = if (shiftHi == 0) nextCarry % 65536 else a32.leftShift(nextCarry.toLong(), shiftHi).toInt()
-            val out = BitwiseOps.orArithmeticGeneral(lowPart, highPart)
-            val dropped = if (s == 0) 0 else (cur % pow2s)
-            if (i == 0) carryOut = dropped
-            sticky = sticky or (dropped != 0) // @native-bitshift-allowed
-            val result = (out % BASE16)
-            
-            // Decompose back to bytes (little-endian) using BitShiftEngine
-            val resultByte0 = eng16Local.bitwiseAnd(result.toLong(), 0xFF)
-            GlobalHeap.sb(off, resultByte0.toByte())
-            val highByteResult = eng16Local.byteShiftRight(result.toLong(), 1)
-            val resultByte1 = eng16Local.bitwiseAnd(highByteResult.value, 0xFF)
-            GlobalHeap.sb(off + 1, resultByte1.toByte())
-            
-            nextCarry = dropped
+        var addr = start
+        while (addr < end) {
+            val v = GlobalHeap.lh(addr).toInt() and 0xFFFF
+            sticky = sticky || (v and lowMask) != 0
+            val above = if (addr + 2 < end) GlobalHeap.lh(addr + 2).toInt() shl back else 0
+            GlobalHeap.sh(addr, ((v ushr s) or above).toShort())
+            addr += 2
         }
-        return ShiftResult(carryOut and 0xFFFF, sticky) // @native-bitshift-allowed
+        return ShiftResult(carryOut, sticky)
     }
 }
@@ -228,6 +228,11 @@ data class ShiftResult(
  * - ARITHMETIC: ~40ns (20× slower)
  * - **Trade-off**: Speed vs determinism
  *
+ * The facade resolves mode and width on every call. Hot loops that know both
+ * at compile time should call the specialized engines ([NativeShift32],
+ * [ArithmeticShift16], ...) directly, and use [leftShiftPacked] /
+ * [leftShiftValue] / [unsignedRightShiftValue] to avoid a [ShiftResult] per call.
+ *
  * ## Carry Propagation
  *
  * Carry bits enable multi-limb arithmetic:
@@ -299,7 +304,13 @@ class BitShiftEngine(
         }
 
     /** Arithmetic operations helper (for ARITHMETIC mode). */
-    private val arithmeticOps = if (bitWidth in 1..32) ArithmeticBitwiseOps(bitWidth) else null
+    private val arithmeticOps =
+        when (bitWidth) {
+            8 -> ArithmeticShift8.ops
+            16 -> ArithmeticShift16.ops
+            32 -> ArithmeticShift32.ops
+            else -> null
+        }
 
     /**
      * Perform left shift with carry detection.
@@ -329,59 +340,53 @@ class BitShiftEngine(
         if (bits !in 0..<bitWidth) {
             return ShiftResult(0L, 0L, true)
         }
-
-        val activeMode = if (mode == BitShiftMode.AUTO) {
-            BitShiftConfig.resolveMode(bitWidth)
-        } else {
-            mode
+        if (bitWidth == 64) {
+            requireNative64()
+            val carry = NativeShift64.leftShiftCarry(value, bits)
+            return ShiftResult(NativeShift64.leftShift(value, bits), carry, carry != 0L)
         }
+        return ShiftPacked.toShiftResult(leftShiftPacked(value, bits))
+    }
 
-        return when (activeMode) {
-            BitShiftMode.NATIVE -> {
-                val originalValue = normalize(value)
-                val shiftedValue =
-                    when (bitWidth) {
-                        8 -> (originalValue.toInt() shl bits).toLong()
-                        16 -> (originalValue.toInt() shl bits).toLong()
-                        32 -> (originalValue.toInt() shl bits).toLong()
-                        64 -> originalValue shl bits
-                        else -> error("Unexpected bitWidth in native leftShift: $bitWidth")
-                    }
-
-                val result = normalize(shiftedValue)
-                val carry = if (shiftedValue != result) (shiftedValue ushr bitWidth) else 0L
-                val overflow = shiftedValue > maxValue
-
-                ShiftResult(result, carry, overflow)
-            }
-
-            BitShiftMode.ARITHMETIC -> {
-                // Note: ARITHMETIC mode only supports bitWidth ≤ 32.
-                if (arithmeticOps == null) {
-                    throw IllegalStateException(
-                        "ARITHMETIC mode is not supported for bitWidth > 32. " +
-                        "Current bitWidth: $bitWidth. Use NATIVE mode instead."
-                    )
-                }
-
-                val originalValue = normalize(value)
-                var result = originalValue
-                var carry = 0L
-                var overflow = false
-
-                repeat(bits) {
-                    val doubled = result * 2
-                    if (doubled > maxValue) {
-                        carry = (carry * 2) + (doubled ushr bitWidth)
-                        overflow = true
-                    }
-                    result = normalize(doubled)
-                }
+    /**
+     * Left shift returning value and carry packed in one `Long` (no allocation).
+     *
+     * Low 32 bits hold the shifted value, high 32 bits the shifted-out carry;
+     * decode with [ShiftPacked]. A shift count outside `0 until bitWidth`
+     * returns 0.
+     *
+     * @param value Value to shift (normalized to bit width)
+     * @param bits Number of positions to shift (0 to bitWidth-1)
+     * @return Packed value and carry
+     * @throws IllegalStateException if bitWidth is 64 (use [leftShift])
+     */
+    fun leftShiftPacked(value: Long, bits: Int): Long {
+        val native = activeMode() == BitShiftMode.NATIVE
+        return when (bitWidth) {
+            8 -> if (native) NativeShift8.leftShiftPacked(value, bits) else ArithmeticShift8.leftShiftPacked(value, bits)
+            16 -> if (native) NativeShift16.leftShiftPacked(value, bits) else ArithmeticShift16.leftShiftPacked(value, bits)
+            32 -> if (native) NativeShift32.leftShiftPacked(value, bits) else ArithmeticShift32.leftShiftPacked(value, bits)
+            else -> throw IllegalStateException(
+                "leftShiftPacked supports bitWidth ≤ 32; current bitWidth: $bitWidth. Use leftShift instead."
+            )
+        }
+    }
 
-                ShiftResult(result, carry, overflow)
+    /**
+     * Left shift returning only the shifted value (no allocation).
+     *
+     * Same value as `leftShift(value, bits).value`.
+     */
+    fun leftShiftValue(value: Long, bits: Int): Long {
+        val native = activeMode() == BitShiftMode.NATIVE
+        return when (bitWidth) {
+            8 -> if (native) NativeShift8.leftShift(value, bits) else ArithmeticShift8.leftShift(value, bits)
+            16 -> if (native) NativeShift16.leftShift(value, bits) else ArithmeticShift16.leftShift(value, bits)
+            32 -> if (native) NativeShift32.leftShift(value, bits) else ArithmeticShift32.leftShift(value, bits)
+            else -> {
+                requireNative64()
+                NativeShift64.leftShift(value, bits)
             }
-
-            BitShiftMode.AUTO -> error("BitShiftMode.AUTO must resolve before execution")
         }
     }
 
@@ -413,43 +418,7 @@ class BitShiftEngine(
         if (bits !in 0..<bitWidth) {
             return ShiftResult(if (value < 0) -1L else 0L, 0L, false)
         }
-
-        val activeMode = if (mode == BitShiftMode.AUTO) {
-            BitShiftConfig.resolveMode(bitWidth)
-        } else {
-            mode
-        }
-
-        return when (activeMode) {
-            BitShiftMode.NATIVE -> {
-                val originalValue = normalize(value)
-                val result =
-                    when (bitWidth) {
-                        8 -> ((originalValue.toInt() and 0xFF) ushr bits).toLong()
-                        16 -> ((originalValue.toInt() and 0xFFFF) ushr bits).toLong()
-                        32 -> (originalValue.toInt() ushr bits).toLong()
-                        64 -> originalValue ushr bits
-                        else -> error("Unexpected bitWidth in native rightShift: $bitWidth")
-                    }
-
-                ShiftResult(normalize(result), 0L, false)
-            }
-
-            BitShiftMode.ARITHMETIC -> {
-                // Note: ARITHMETIC mode only supports bitWidth ≤ 32.
-                if (arithmeticOps == null) {
-                    throw IllegalStateException(
-                        "ARITHMETIC mode is not supported for bitWidth > 32. " +
-                        "Current bitWidth: $bitWidth. Use NATIVE mode instead."
-                    )
-                }
-
-                val result = arithmeticOps.rightShift(normalize(value), bits)
-                ShiftResult(result, 0L, false)
-            }
-
-            BitShiftMode.AUTO -> error("BitShiftMode.AUTO must resolve before execution")
-        }
+        return ShiftResult(unsignedRightShiftValue(value, bits), 0L, false)
     }
 
     /**
@@ -480,42 +449,38 @@ class BitShiftEngine(
         if (bits !in 0..<bitWidth) {
             return ShiftResult(0L, 0L, false)
         }
+        return ShiftResult(unsignedRightShiftValue(value, bits), 0L, false)
+    }
 
-        val activeMode = if (mode == BitShiftMode.AUTO) {
-            BitShiftConfig.resolveMode(bitWidth)
-        } else {
-            mode
-        }
-
-        return when (activeMode) {
-            BitShiftMode.NATIVE -> {
-                val originalValue = normalize(value)
-                val result =
-                    when (bitWidth) {
-                        8 -> (originalValue.toInt() and 0xFF) ushr bits
-                        16 -> (originalValue.toInt() and 0xFFFF) ushr bits
-                        32 -> (originalValue.toInt() ushr bits).toLong()
-                        64 -> originalValue ushr bits
-                        else -> error("Unexpected bitWidth in native unsignedRightShift: $bitWidth")
-                    }
-
-                ShiftResult(normalize(result.toLong()), 0L, false)
+    /**
+     * Zero-filling right shift returning only the value (no allocation).
+     *
+     * Same value as `unsignedRightShift(value, bits).value`.
+     */
+    fun unsignedRightShiftValue(value: Long, bits: Int): Long {
+        val native = activeMode() == BitShiftMode.NATIVE
+        return when (bitWidth) {
+            8 -> if (native) NativeShift8.rightShift(value, bits) else ArithmeticShift8.rightShift(value, bits)
+            16 -> if (native) NativeShift16.rightShift(value, bits) else ArithmeticShift16.rightShift(value, bits)
+            32 -> if (native) NativeShift32.rightShift(value, bits) else ArithmeticShift32.rightShift(value, bits)
+            else -> {
+                requireNative64()
+                NativeShift64.rightShift(value, bits)
             }
+        }
+    }
 
-            BitShiftMode.ARITHMETIC -> {
-                // Note: ARITHMETIC mode only supports bitWidth ≤ 32.
-                if (arithmeticOps == null) {
-                    throw IllegalStateException(
-                        "ARITHMETIC mode is not supported for bitWidth > 32. " +
-                        "Current bitWidth: $bitWidth. Use NATIVE mode instead."
-                    )
-                }
-
-                val result = arithmeticOps.rightShift(normalize(value), bits)
-                ShiftResult(result, 0L, false)
-            }
+    /** Resolve AUTO to the mode validated for this width. */
+    private fun activeMode(): BitShiftMode =
+        if (mode == BitShiftMode.AUTO) BitShiftConfig.resolveMode(bitWidth) else mode
 
-            BitShiftMode.AUTO -> error("BitShiftMode.AUTO must resolve before execution")
+    private fun requireNative64() {
+        // Note: ARITHMETIC mode only supports bitWidth ≤ 32.
+        if (activeMode() == BitShiftMode.ARITHMETIC) {
+            throw IllegalStateException(
+                "ARITHMETIC mode is not supported for bitWidth > 32. " +
+                "Current bitWidth: $bitWidth. Use NATIVE mode instead."
+            )
         }
     }
 
@@ -0,0 +1,298 @@
+@file:Suppress("NOTHING_TO_INLINE")
+
+package io.github.kotlinmania.klang.bitwise
+
+/**
+ * @native-bitshift-allowed This is a core BitShift implementation file.
+ * Native bitwise operations (shl, shr, ushr, and, or) are permitted here
+ * as this file provides the specialized BitShift engines.
+ */
+
+/**
+ * Specialized BitShift engines: one singleton per (mode, width).
+ *
+ * [BitShiftEngine] decides mode and width at runtime on every call and returns
+ * a [ShiftResult] object. The engines here fix both at compile time, so every
+ * method is an `inline` body of a few operations with no branches on
+ * configuration and no allocation:
+ *
+ * | Engine | Width | Strategy |
+ * |--------|-------|----------|
+ * | [NativeShift8] / [NativeShift16] / [NativeShift32] / [NativeShift64] | 8 / 16 / 32 / 64 | `shl`/`ushr` |
+ * | [ArithmeticShift8] / [ArithmeticShift16] / [ArithmeticShift32] | 8 / 16 / 32 | Multiply/divide by powers of two |
+ *
+ * Values follow the facade's conventions: inputs are normalized to the width
+ * (unsigned), `rightShift` and `unsignedRightShift` are both zero-filling on
+ * the normalized value, and a shift count outside `0 until width` yields 0.
+ *
+ * ## Packed Carry
+ *
+ * For widths up to 32, the carry-returning `leftShiftPacked` returns value and
+ * carry in one `Long` — value in the low 32 bits, shifted-out bits in the
+ * high 32 — instead of a [ShiftResult]. Decode with [ShiftPacked]. The 64-bit
+ * engine cannot pack both, so it offers [NativeShift64.leftShiftCarry].
+ *
+ * ## Usage Example
+ *
+ * ```kotlin
+ * val p = NativeShift16.leftShiftPacked(0x8001, 1)
+ * ShiftPacked.value(p)     // 0x0002
+ * ShiftPacked.carry(p)     // 0x1
+ *
+ * // Deterministic path, same bits on every platform
+ * val q = ArithmeticShift16.leftShiftPacked(0x8001, 1)   // == p
+ * ```
+ *
+ * @see BitShiftEngine The dynamic facade, which dispatches to these engines
+ * @since 0.1.0
+ */
+object ShiftPacked {
+    /** Shifted value (low 32 bits). */
+    inline fun value(packed: Long): Long = packed and 0xFFFFFFFFL
+
+    /** Bits shifted out past the width (high 32 bits). */
+    inline fun carry(packed: Long): Long = packed ushr 32
+
+    /** True if any bit was shifted out. */
+    inline fun overflow(packed: Long): Boolean = (packed ushr 32) != 0L
+
+    /** Pack [value] (< 2^32) and [carry] (< 2^32). */
+    inline fun pack(value: Long, carry: Long): Long = (carry shl 32) or value
+
+    /** Expand to a [ShiftResult] for APIs that still need one. */
+    fun toShiftResult(packed: Long): ShiftResult = ShiftResult(value(packed), carry(packed), overflow(packed))
+}
+
+// ============================================================================
+// Native engines
+// ============================================================================
+
+/** 8-bit engine using native shift operators. */
+object NativeShift8 {
+    const val BIT_WIDTH: Int = 8
+    const val MASK: Long = 0xFFL
+
+    inline fun normalize(value: Long): Long = value and MASK
+
+    inline fun leftShift(value: Long, bits: Int): Long =
+        if (bits !in 0..<BIT_WIDTH) 0L else ((value and MASK) shl bits) and MASK
+
+    inline fun leftShiftPacked(value: Long, bits: Int): Long {
+        if (bits !in 0..<BIT_WIDTH) return 0L
+        val wide = (value and MASK) shl bits
+        return ((wide ushr BIT_WIDTH) shl 32) or (wide and MASK)
+    }
+
+    inline fun rightShift(value: Long, bits: Int): Long =
+        if (bits !in 0..<BIT_WIDTH) 0L else (value and MASK) ushr bits
+
+    inline fun unsignedRightShift(value: Long, bits: Int): Long = rightShift(value, bits)
+
+    inline fun and(a: Long, b: Long): Long = (a and b) and MASK
+    inline fun or(a: Long, b: Long): Long = (a or b) and MASK
+    inline fun xor(a: Long, b: Long): Long = (a xor b) and MASK
+    inline fun not(value: Long): Long = value.inv() and MASK
+
+    /** Low [bits] bits set (1..8). */
+    inline fun mask(bits: Int): Long = if (bits >= BIT_WIDTH) MASK else (1L shl bits) - 1L
+}
+
+/** 16-bit engine using native shift operators. */
+object NativeShift16 {
+    const val BIT_WIDTH: Int = 16
+    const val MASK: Long = 0xFFFFL
+
+    inline fun normalize(value: Long): Long = value and MASK
+
+    inline fun leftShift(value: Long, bits: Int): Long =
+        if (bits !in 0..<BIT_WIDTH) 0L else ((value and MASK) shl bits) and MASK
+
+    inline fun leftShiftPacked(value: Long, bits: Int): Long {
+        if (bits !in 0..<BIT_WIDTH) return 0L
+        val wide = (value and MASK) shl bits
+        return ((wide ushr BIT_WIDTH) shl 32) or (wide and MASK)
+    }
+
+    inline fun rightShift(value: Long, bits: Int): Long =
+        if (bits !in 0..<BIT_WIDTH) 0L else (value and MASK) ushr bits
+
+    inline fun unsignedRightShift(value: Long, bits: Int): Long = rightShift(value, bits)
+
+    inline fun and(a: Long, b: Long): Long = (a and b) and MASK
+    inline fun or(a: Long, b: Long): Long = (a or b) and MASK
+    inline fun xor(a: Long, b: Long): Long = (a xor b) and MASK
+    inline fun not(value: Long): Long = value.inv() and MASK
+
+    /** Low [bits] bits set (1..16). */
+    inline fun mask(bits: Int): Long = if (bits >= BIT_WIDTH) MASK else (1L shl bits) - 1L
+}
+
+/** 32-bit engine using native shift operators (computed in `Long`, so the carry is exact). */
+object NativeShift32 {
+    const val BIT_WIDTH: Int = 32
+    const val MASK: Long = 0xFFFFFFFFL
+
+    inline fun normalize(value: Long): Long = value and MASK
+
+    inline fun leftShift(value: Long, bits: Int): Long =
+        if (bits !in 0..<BIT_WIDTH) 0L else ((value and MASK) shl bits) and MASK
+
+    inline fun leftShiftPacked(value: Long, bits: Int): Long {
+        if (bits !in 0..<BIT_WIDTH) return 0L
+        val wide = (value and MASK) shl bits
+        return ((wide ushr BIT_WIDTH) shl 32) or (wide and MASK)
+    }
+
+    inline fun rightShift(value: Long, bits: Int): Long =
+        if (bits !in 0..<BIT_WIDTH) 0L else (value and MASK) ushr bits
+
+    inline fun unsignedRightShift(value: Long, bits: Int): Long = rightShift(value, bits)
+
+    inline fun and(a: Long, b: Long): Long = (a and b) and MASK
+    inline fun or(a: Long, b: Long): Long = (a or b) and MASK
+    inline fun xor(a: Long, b: Long): Long = (a xor b) and MASK
+    inline fun not(value: Long): Long = value.inv() and MASK
+
+    /** Low [bits] bits set (1..32). */
+    inline fun mask(bits: Int): Long = if (bits >= BIT_WIDTH) MASK else (1L shl bits) - 1L
+}
+
+/** 64-bit engine using native shift operators. */
+object NativeShift64 {
+    const val BIT_WIDTH: Int = 64
+
+    inline fun normalize(value: Long): Long = value
+
+    inline fun leftShift(value: Long, bits: Int): Long =
+        if (bits !in 0..<BIT_WIDTH) 0L else value shl bits
+
+    /** Bits shifted out by `leftShift(value, bits)` (0 for a zero or out-of-range shift). */
+    inline fun leftShiftCarry(value: Long, bits: Int): Long =
+        if (bits !in 1..<BIT_WIDTH) 0L else value ushr (BIT_WIDTH - bits)
+
+    inline fun rightShift(value: Long, bits: Int): Long =
+        if (bits !in 0..<BIT_WIDTH) 0L else value ushr bits
+
+    inline fun unsignedRightShift(value: Long, bits: Int): Long = rightShift(value, bits)
+
+    inline fun and(a: Long, b: Long): Long = a and b
+    inline fun or(a: Long, b: Long): Long = a or b
+    inline fun xor(a: Long, b: Long): Long = a xor b
+    inline fun not(value: Long): Long = value.inv()
+
+    /** Low [bits] bits set (1..64). */
+    inline fun mask(bits: Int): Long = if (bits >= BIT_WIDTH) -1L else (1L shl bits) - 1L
+}
+
+// ============================================================================
+// Arithmetic engines (no shift operators on the data path)
+// ============================================================================
+
+/** Powers of two 2^0 .. 2^32 as `Long`, shared by the arithmetic engines. */
+@PublishedApi
+internal val POW2_LONG: LongArray = LongArray(33).also { t ->
+    var p = 1L
+    for (i in 0..32) {
+        t[i] = p
+        p *= 2
+    }
+}
+
+/** 8-bit engine using multiplication/division by powers of two. */
+object ArithmeticShift8 {
+    const val BIT_WIDTH: Int = 8
+    const val MODULUS: Long = 0x100L
+
+    @PublishedApi
+    internal val ops: ArithmeticBitwiseOps = ArithmeticBitwiseOps(BIT_WIDTH)
+
+    inline fun normalize(value: Long): Long = value.mod(MODULUS)
+
+    inline fun leftShift(value: Long, bits: Int): Long =
+        if (bits !in 0..<BIT_WIDTH) 0L else (normalize(value) * POW2_LONG[bits]) % MODULUS
+
+    inline fun leftShiftPacked(value: Long, bits: Int): Long {
+        if (bits !in 0..<BIT_WIDTH) return 0L
+        val wide = normalize(value) * POW2_LONG[bits]
+        return (wide / MODULUS) * POW2_LONG[32] + wide % MODULUS
+    }
+
+    inline fun rightShift(value: Long, bits: Int): Long =
+        if (bits !in 0..<BIT_WIDTH) 0L else normalize(value) / POW2_LONG[bits]
+
+    inline fun unsignedRightShift(value: Long, bits: Int): Long = rightShift(value, bits)
+
+    inline fun and(a: Long, b: Long): Long = ops.and(a, b)
+    inline fun or(a: Long, b: Long): Long = ops.or(a, b)
+    inline fun xor(a: Long, b: Long): Long = ops.xor(a, b)
+    inline fun not(value: Long): Long = ops.not(value)
+
+    /** Low [bits] bits set (1..8). */
+    inline fun mask(bits: Int): Long = POW2_LONG[bits] - 1L
+}
+
+/** 16-bit engine using multiplication/division by powers of two. */
+object ArithmeticShift16 {
+    const val BIT_WIDTH: Int = 16
+    const val MODULUS: Long = 0x10000L
+
+    @PublishedApi
+    internal val ops: ArithmeticBitwiseOps = ArithmeticBitwiseOps(BIT_WIDTH)
+
+    inline fun normalize(value: Long): Long = value.mod(MODULUS)
+
+    inline fun leftShift(value: Long, bits: Int): Long =
+        if (bits !in 0..<BIT_WIDTH) 0L else (normalize(value) * POW2_LONG[bits]) % MODULUS
+
+    inline fun leftShiftPacked(value: Long, bits: Int): Long {
+        if (bits !in 0..<BIT_WIDTH) return 0L
+        val wide = normalize(value) * POW2_LONG[bits]
+        return (wide / MODULUS) * POW2_LONG[32] + wide % MODULUS
+    }
+
+    inline fun rightShift(value: Long, bits: Int): Long =
+        if (bits !in 0..<BIT_WIDTH) 0L else normalize(value) / POW2_LONG[bits]
+
+    inline fun unsignedRightShift(value: Long, bits: Int): Long = rightShift(value, bits)
+
+    inline fun and(a: Long, b: Long): Long = ops.and(a, b)
+    inline fun or(a: Long, b: Long): Long = ops.or(a, b)
+    inline fun xor(a: Long, b: Long): Long = ops.xor(a, b)
+    inline fun not(value: Long): Long = ops.not(value)
+
+    /** Low [bits] bits set (1..16). */
+    inline fun mask(bits: Int): Long = POW2_LONG[bits] - 1L
+}
+
+/** 32-bit engine using multiplication/division by powers of two (products stay below 2^63). */
+object ArithmeticShift32 {
+    const val BIT_WIDTH: Int = 32
+    const val MODULUS: Long = 0x1_0000_0000L
+
+    @PublishedApi
+    internal val ops: ArithmeticBitwiseOps = ArithmeticBitwiseOps.BITS_32
+
+    inline fun normalize(value: Long): Long = value.mod(MODULUS)
+
+    inline fun leftShift(value: Long, bits: Int): Long =
+        if (bits !in 0..<BIT_WIDTH) 0L else (normalize(value) * POW2_LONG[bits]) % MODULUS
+
+    inline fun leftShiftPacked(value: Long, bits: Int): Long {
+        if (bits !in 0..<BIT_WIDTH) return 0L
+        val wide = normalize(value) * POW2_LONG[bits]
+        return (wide / MODULUS) * POW2_LONG[32] + wide % MODULUS
+    }
+
+    inline fun rightShift(value: Long, bits: Int): Long =
+        if (bits !in 0..<BIT_WIDTH) 0L else normalize(value) / POW2_LONG[bits]
+
+    inline fun unsignedRightShift(value: Long, bits: Int): Long = rightShift(value, bits)
+
+    inline fun and(a: Long, b: Long): Long = ops.and(a, b)
+    inline fun or(a: Long, b: Long): Long = ops.or(a, b)
+    inline fun xor(a: Long, b: Long): Long = ops.xor(a, b)
+    inline fun not(value: Long): Long = ops.not(value)
+
+    /** Low [bits] bits set (1..32). */
+    inline fun mask(bits: Int): Long = POW2_LONG[bits] - 1L
+}
@@ -1,6 +1,11 @@
+@file:OptIn(ExperimentalAtomicApi::class)
+
 package io.github.kotlinmania.klang.bitwise
 
 import kotlin.concurrent.Volatile
+import kotlin.concurrent.atomics.AtomicInt
+import kotlin.concurrent.atomics.AtomicReference
+import kotlin.concurrent.atomics.ExperimentalAtomicApi
 
 /**
  * CFloatTrace: Diagnostic tracer for CFloat32 arithmetic operations.
@@ -27,32 +32,31 @@ import kotlin.concurrent.Volatile
  *
  * ```
  * ┌─────────────────┐
- * │  CFloatTrace    │ ← Singleton tracer
- * │   (disabled)    │
+ * │  CFloatTrace    │ ← Singleton controller: enabled, epoch, filters
  * └────────┬────────┘
- *          │
- *     ┌────┴────┐
- *     │ enabled │
- *     └────┬────┘
- *          │
- *    ┌─────▼──────┐
- *    │   Entry[]  │ ← Recorded operations
- *    │  (buffer)  │
- *    └────────────┘
+ *          │ one writer per thread (lazily bound)
+ *    ┌─────┴──────┬────────────┐
+ *    ▼            ▼            ▼
+ * ┌────────┐  ┌────────┐  ┌────────┐
+ * │ ring 0 │  │ ring 1 │  │ ring 2 │ ← Fixed IntArray, 4 ints per record
+ * └────────┘  └────────┘  └────────┘
  * ```
  *
- * ## Entry Structure
+ * Every thread that logs gets its own pre-allocated [CFloatTraceRing], so
+ * recording an operation is a few array stores and one volatile write: no
+ * allocation, no lock, no shared counter. A full ring overwrites its oldest
+ * record, so tracing can stay on indefinitely with bounded memory.
+ *
+ * ## Record Layout
  *
- * Each recorded operation captures:
- * - **op**: Operation name ("+", "-", "*", "/", "sqrt", etc.)
+ * Each recorded operation is packed into four ints:
+ * - **op | flags**: Opcode byte (index into the op name table) and a has-rhs flag
  * - **lhsBits**: Left operand as raw IEEE 754 bits
- * - **rhsBits**: Right operand bits (null for unary operations)
+ * - **rhsBits**: Right operand bits (0 and flag clear for unary operations)
  * - **resultBits**: Result as raw IEEE 754 bits
  *
- * Provides computed properties:
- * - **lhs**: Float value of left operand
- * - **rhs**: Float value of right operand (if applicable)
- * - **result**: Float value of result
+ * [stop] and [entries] decode records into [Entry] objects; allocation only
+ * happens on that read path.
  *
  * ## Usage Examples
  *
@@ -81,33 +85,16 @@ import kotlin.concurrent.Volatile
  *     val y = CFloat32(0.2f)
  *     x + y  // Test if 0.1 + 0.2 is exactly 0.3
  * }
- *
- * println("Result: $result")
- * trace.forEach { entry ->
- *     println("${entry.op}: ${entry.lhs} ${entry.rhs} → ${entry.result}")
- * }
  * ```
  *
- * ### Debugging Precision Loss
+ * ### Production Canary
  * ```kotlin
+ * // 64K records per thread, keep 1 in 100 divisions and multiplies
+ * CFloatTrace.configure(capacity = 1 shl 16, sampleEvery = 100)
+ * CFloatTrace.traceOps("div", "divF", "times", "timesF")
  * CFloatTrace.start()
- *
- * var sum = CFloat32(0.0f)
- * repeat(1000) {
- *     sum += CFloat32(0.001f)  // Accumulate small values
- * }
- *
- * val entries = CFloatTrace.stop()
- *
- * // Analyze where precision degrades
- * entries.forEachIndexed { i, entry ->
- *     val expected = (i + 1) * 0.001f
- *     val actual = entry.result
- *     val error = kotlin.math.abs(expected - actual)
- *     if (error > 1e-6f) {
- *         println("Iteration $i: error = $error")
- *     }
- * }
+ * runModel()
+ * val dump = CFloatTrace.export()   // write to disk, replay with tools/cfloat_trace_replay
  * ```
  *
  * ### Tracking NaN Propagation
@@ -122,119 +109,68 @@ import kotlin.concurrent.Volatile
  *
  * // Find where NaN was introduced
  * val nanEntry = trace.firstOrNull { it.result.isNaN() }
- * if (nanEntry != null) {
- *     println("NaN introduced by: ${nanEntry.op}")
- *     println("  Left: ${nanEntry.lhs}, Right: ${nanEntry.rhs}")
- * }
- * ```
- *
- * ### Comparing Implementations
- * ```kotlin
- * // Trace custom implementation
- * val (customResult, customTrace) = CFloatTrace.withTracing {
- *     computeWithCFloat32()
- * }
- *
- * // Trace native implementation
- * val nativeResult = computeWithNativeFloat()
- *
- * // Compare bit patterns
- * customTrace.forEach { entry ->
- *     println("Custom: 0x${entry.resultBits.toString(16)}")
- * }
  * ```
  *
  * ## State Management
  *
- * ### enabled: Boolean
- * Controls whether operations are recorded.
- * - **false** (default): No overhead, operations not tracked
- * - **true**: Every CFloat32 operation is recorded
+ * | Call | Effect |
+ * |------|--------|
+ * | [start] | Clears all rings (new epoch) and enables recording |
+ * | [stop] | Disables recording, returns the decoded entries |
+ * | [reset] | Clears all rings, keeps the enabled state |
+ * | [configure] | Sets ring capacity and 1-in-N sampling (applies from the next epoch) |
+ * | [traceOps] / [traceAllOps] | Op filter, checked before sampling |
+ * | [export] | Compact binary dump of every live ring |
  *
- * ### start()
- * Enables tracing and clears any previous entries.
- * ```kotlin
- * CFloatTrace.start()  // Begin new trace session
- * ```
- *
- * ### stop(): List<Entry>
- * Disables tracing and returns all recorded entries.
- * ```kotlin
- * val entries = CFloatTrace.stop()  // End trace, get results
- * ```
- *
- * ### reset()
- * Clears recorded entries without changing enabled state.
- * ```kotlin
- * CFloatTrace.reset()  // Clear buffer, keep tracing
- * ```
- *
- * ### withTracing(block): Pair<T, List<Entry>>
- * Executes a block with tracing enabled, returns result and trace.
- * Automatically handles exceptions and cleanup.
- * ```kotlin
- * val (result, trace) = CFloatTrace.withTracing {
- *     // Code to trace
- * }
- * ```
+ * Writers notice a new epoch on their next record and reset their own ring,
+ * so control calls never write into another thread's buffer.
  *
  * ## Performance Impact
  *
  * ### When Disabled (default)
- * - **Overhead**: ~0-1% (single volatile boolean check)
- * - **Memory**: ~0 bytes (empty list)
- * - **Safe for production**: Yes
+ * - **Overhead**: Single volatile boolean check
+ * - **Memory**: 0 bytes (rings are created on first record)
  *
  * ### When Enabled
- * - **Overhead**: ~5-10× slower (logging, allocation)
- * - **Memory**: ~40 bytes per operation
- * - **Use for**: Debugging, testing, analysis only
- *
- * **Recommendation**: Only enable in development/testing, never in production hot paths.
+ * - **Overhead**: Filter bit test, sampling countdown, four IntArray stores
+ * - **Memory**: 16 bytes × capacity per logging thread, fixed
+ * - **Echo**: Setting [echo] restores the old per-op `TRACE` stdout line (slow)
  *
  * ## Thread Safety
  *
- * **Current implementation**: NOT thread-safe
- * - **enabled**: Volatile for visibility, but not atomic with list operations
- * - **entries**: Mutable list with no synchronization
+ * - **Writers**: One ring per thread, bound through a thread-local slot;
+ *   appends are wait-free
+ * - **Readers**: [entries]/[export] may run while writers are active; records
+ *   overwritten during the copy are cut, never returned torn
+ * - **Control**: [start], [stop], [reset], [configure] and the filters are
+ *   meant to be called from one controlling thread
  *
- * **Safe usage patterns**:
- * - Single-threaded tracing only
- * - Per-thread tracer instances (future enhancement)
- * - External synchronization if multi-threaded
+ * Records are ordered within a writer; [entries] concatenates writers in
+ * the order they first recorded, with no global order between threads.
  *
- * **Thread-safe wrapper example**:
- * ```kotlin
- * object ThreadSafeCFloatTrace {
- *     private val lock = Any()
- *     
- *     fun <T> traceSync(block: () -> T): Pair<T, List<CFloatTrace.Entry>> {
- *         synchronized(lock) {
- *             return CFloatTrace.withTracing(block)
- *         }
- *     }
- * }
+ * ## Binary Dump Format
+ *
+ * Little-endian, produced by [export]:
+ * ```
+ * "CFTR"  u32 version (1)  u32 sampleEvery
+ * u32 opCount  opCount × (u8 length, ASCII name)      // opcode = table index
+ * u32 writerCount
+ * writerCount × (u32 writerId, u64 dropped, u32 recordCount, recordCount × 4 × u32)
  * ```
  *
  * ## Integration with CFloat32
  *
- * CFloat32 operations should call `log()` when appropriate:
+ * CFloat32 operations log with the opcode constants:
  * ```kotlin
  * operator fun plus(other: CFloat32): CFloat32 {
  *     val result = Float32Math.addBits(this.bits, other.bits)
- *     CFloatTrace.log("+", this.bits, other.bits, result)
+ *     CFloatTrace.log(CFloatTrace.OP_PLUS, this.bits, other.bits, result)
  *     return CFloat32.fromBits(result)
  * }
  * ```
  *
- * ## Output Format
- *
- * When logging is enabled, each operation prints to stdout:
- * ```
- * TRACE + lhs=1.0 rhs=2.0 result=3.0
- * TRACE * lhs=3.0 rhs=0.5 result=1.5
- * TRACE / lhs=1.0 rhs=3.0 result=0.33333334
- * ```
+ * The `String` overload of [log] is kept for ad-hoc ops; unknown names are
+ * registered in the op table on first use.
  *
  * ## Use Cases
  *
@@ -260,21 +196,9 @@ import kotlin.concurrent.Volatile
  *
  * ## Limitations
  *
- * - **Not thread-safe**: Single-threaded use only
- * - **Memory growth**: Unbounded buffer (manual reset required)
- * - **Performance cost**: 5-10× slowdown when enabled
- * - **No filtering**: Records all operations (no selective tracing)
- * - **No timestamps**: Operations not timestamped
- *
- * ## Future Enhancements
- *
- * Potential improvements:
- * - Thread-local tracing for multi-threaded code
- * - Filtering by operation type or value range
- * - Statistical summaries (min/max/avg precision loss)
- * - Export to various formats (JSON, CSV, binary)
- * - Call stack capture for operation attribution
- * - Configurable buffer size with overflow handling
+ * - **Bounded history**: Only the newest `capacity` records per thread are kept
+ * - **No cross-thread order**: Records carry no timestamp or global sequence
+ * - **256 op names**: Opcodes are a single byte
  *
  * ## Related Components
  *
@@ -289,20 +213,78 @@ import kotlin.concurrent.Volatile
  * @since 0.1.0
  */
 object CFloatTrace {
+    // ===== Opcodes (index into the op name table) =====
+
+    const val OP_PLUS: Int = 0
+    const val OP_PLUS_F: Int = 1
+    const val OP_MINUS: Int = 2
+    const val OP_MINUS_F: Int = 3
+    const val OP_TIMES: Int = 4
+    const val OP_TIMES_F: Int = 5
+    const val OP_TIMES_EXACT: Int = 6
+    const val OP_TIMES_EXACT_F: Int = 7
+    const val OP_PLUS_EXACT: Int = 8
+    const val OP_PLUS_EXACT_F: Int = 9
+    const val OP_DIV: Int = 10
+    const val OP_DIV_F: Int = 11
+    const val OP_FMA: Int = 12
+    const val OP_FMA_F: Int = 13
+    const val OP_ABS: Int = 14
+
+    /** Opcodes are one byte. */
+    const val MAX_OPS: Int = 256
+
+    /** Default per-thread ring capacity in records (1 MB of IntArray). */
+    const val DEFAULT_CAPACITY: Int = 1 shl 16
+
+    private const val FLAG_RHS: Int = 1 shl 8
+    private const val DUMP_VERSION: Int = 1
+
+    /** Names for the built-in opcodes, in opcode order. */
+    private val BUILTIN_OPS = arrayOf(
+        "plus", "plusF", "minus", "minusF", "times", "timesF", "timesExact", "timesExactF",
+        "plusExact", "plusExactF", "div", "divF", "fma", "fmaF", "abs",
+    )
+
+    /** Op name table, copy-on-write; index = opcode. */
+    private val opNames = AtomicReference(BUILTIN_OPS.copyOf())
+
     /**
      * Controls whether tracing is currently active.
      *
      * When true, all CFloat32 operations that call `log()` will be recorded.
      * When false (default), logging is skipped for minimal overhead.
-     *
-     * Marked `@Volatile` for visibility across threads, though the tracer
-     * itself is not thread-safe.
      */
     @Volatile
     var enabled: Boolean = false
         private set
 
-    private val entries = mutableListOf<Entry>()
+    /** When true, every recorded op is also printed as a `TRACE` line (debugging only). */
+    @Volatile
+    var echo: Boolean = false
+
+    /** Per-thread ring capacity in records; see [configure]. */
+    @Volatile
+    var capacity: Int = DEFAULT_CAPACITY
+        private set
+
+    /** Record one op in every [sampleEvery] that pass the filter, per thread; see [configure]. */
+    @Volatile
+    var sampleEvery: Int = 1
+        private set
+
+    /** Bumped by [start]/[reset]/[configure]; writers reset their ring when it changes. */
+    @Volatile
+    private var epoch: Int = 0
+
+    /** 256-bit op filter: bit `op` set iff that opcode is recorded. */
+    @Volatile
+    private var opMask: LongArray = LongArray(MAX_OPS / 64) { -1L }
+
+    /** Rings that have recorded in the current epoch, in first-record order. */
+    private val rings = AtomicReference(emptyArray<CFloatTraceRing>())
+
+    private val nextWriterId = AtomicInt(0)
 
     /**
      * A single recorded floating-point operation with bit-level details.
@@ -311,9 +293,9 @@ object CFloatTrace {
      * as raw IEEE 754 bit patterns, allowing exact reconstruction and analysis.
      *
      * ## Fields
-     * - **op**: Operation name (e.g., "+", "-", "*", "/", "sqrt", "abs")
+     * - **op**: Operation name (e.g., "plus", "minus", "times", "div", "abs")
      * - **lhsBits**: Left operand as 32-bit IEEE 754 bit pattern
-     * - **rhsBits**: Right operand bits (null for unary operations like sqrt)
+     * - **rhsBits**: Right operand bits (null for unary operations like abs)
      * - **resultBits**: Result as 32-bit IEEE 754 bit pattern
      *
      * ## Computed Properties
@@ -326,13 +308,13 @@ object CFloatTrace {
      * ## Example
      * ```kotlin
      * val entry = Entry(
-     *     op = "+",
+     *     op = "plus",
      *     lhsBits = 0x3F800000,  // 1.0f
      *     rhsBits = 0x40000000,  // 2.0f
      *     resultBits = 0x40400000 // 3.0f
      * )
      * println("${entry.lhs} ${entry.op} ${entry.rhs} = ${entry.result}")
-     * // Output: 1.0 + 2.0 = 3.0
+     * // Output: 1.0 plus 2.0 = 3.0
      * ```
      *
      * @property op The operation that was performed
@@ -348,10 +330,10 @@ object CFloatTrace {
     ) {
         /** The left operand as a Float value. */
         val lhs: Float get() = Float.fromBits(lhsBits)
-        
+
         /** The right operand as a Float value, or null for unary operations. */
         val rhs: Float? get() = rhsBits?.let { Float.fromBits(it) }
-        
+
         /** The result as a Float value. */
         val result: Float get() = Float.fromBits(resultBits)
     }
@@ -359,50 +341,30 @@ object CFloatTrace {
     /**
      * Starts a new tracing session.
      *
-     * Clears any previously recorded entries and enables tracing.
-     * All CFloat32 operations that call `log()` will be recorded until `stop()` is called.
-     *
-     * ## Example
-     * ```kotlin
-     * CFloatTrace.start()
-     * val a = CFloat32(1.0f)
-     * val b = a + CFloat32(2.0f)
-     * val entries = CFloatTrace.stop()
-     * println("Recorded ${entries.size} operations")
-     * ```
+     * Clears every ring (new epoch) and enables tracing. All CFloat32
+     * operations that call `log()` will be recorded until `stop()` is called.
      *
      * @see stop
      * @see withTracing
      */
     fun start() {
+        reset()
         enabled = true
-        entries.clear()
     }
 
     /**
      * Stops tracing and returns all recorded entries.
      *
-     * Disables tracing and returns a copy of all recorded operations.
-     * The internal buffer is preserved (use `reset()` to clear it).
+     * The rings are preserved (use `reset()` to clear them), so [export]
+     * still sees the same records afterwards.
      *
-     * ## Example
-     * ```kotlin
-     * CFloatTrace.start()
-     * // ... perform operations ...
-     * val trace = CFloatTrace.stop()
-     * 
-     * trace.forEach { entry ->
-     *     println("${entry.op}: ${entry.lhs} → ${entry.result}")
-     * }
-     * ```
-     *
-     * @return List of all recorded Entry objects (defensive copy)
+     * @return Decoded entries of every writer, oldest first per writer
      * @see start
      * @see reset
      */
     fun stop(): List<Entry> {
         enabled = false
-        return entries.toList()
+        return entries()
     }
 
     /**
@@ -416,31 +378,6 @@ object CFloatTrace {
      *
      * Exception-safe: tracing is stopped even if the block throws.
      *
-     * ## Example
-     * ```kotlin
-     * val (result, trace) = CFloatTrace.withTracing {
-     *     val x = CFloat32(2.0f)
-     *     val y = CFloat32(3.0f)
-     *     x * y + CFloat32(1.0f)
-     * }
-     * 
-     * println("Result: $result")
-     * println("Operations: ${trace.size}")
-     * trace.forEach { println(it) }
-     * ```
-     *
-     * ## Exception Handling
-     * ```kotlin
-     * try {
-     *     val (_, trace) = CFloatTrace.withTracing {
-     *         CFloat32(1.0f) / CFloat32(0.0f)  // May throw or return Infinity
-     *     }
-     *     println("Trace before error: $trace")
-     * } catch (e: Exception) {
-     *     // Tracing was still stopped properly
-     * }
-     * ```
-     *
      * @param T The return type of the block
      * @param block The code to execute with tracing enabled
      * @return Pair of (block result, list of recorded entries)
@@ -461,62 +398,204 @@ object CFloatTrace {
     /**
      * Clears all recorded entries without changing the enabled state.
      *
-     * Useful for resetting the buffer during a long tracing session without
-     * stopping and restarting tracing.
-     *
-     * ## Example
-     * ```kotlin
-     * CFloatTrace.start()
-     * 
-     * // Phase 1
-     * performOperation1()
-     * val trace1 = CFloatTrace.stop()
-     * 
-     * // Phase 2 (new trace session)
-     * CFloatTrace.reset()
-     * CFloatTrace.start()
-     * performOperation2()
-     * val trace2 = CFloatTrace.stop()
-     * ```
-     *
-     * @see start
-     * @see stop
+     * Writers drop their old records lazily, on their next log call.
      */
     fun reset() {
-        entries.clear()
+        epoch++
+        rings.store(emptyArray())
     }
 
     /**
-     * Records a single operation if tracing is enabled.
+     * Set the per-thread ring size and sampling rate.
      *
-     * This method is called by CFloat32 operations to record their execution.
-     * When tracing is disabled, this method returns immediately with minimal overhead.
+     * Takes effect from the next epoch (this call starts one): existing records
+     * are discarded and writers re-create their rings at the new capacity.
      *
-     * Also prints a trace line to stdout showing the operation in human-readable form.
+     * @param capacity Records per thread, a power of two
+     * @param sampleEvery Keep the first of every N filtered ops per thread (1 = all)
+     * @throws IllegalArgumentException if capacity is not a positive power of two or sampleEvery < 1
+     */
+    fun configure(capacity: Int = this.capacity, sampleEvery: Int = this.sampleEvery) {
+        require(capacity > 0 && (capacity and (capacity - 1)) == 0) { "capacity must be a power of two" }
+        require(sampleEvery >= 1) { "sampleEvery must be >= 1" }
+        this.capacity = capacity
+        this.sampleEvery = sampleEvery
+        reset()
+    }
+
+    /** Record only the named ops (names are registered if new). Unknown ops logged later are filtered out. */
+    fun traceOps(vararg ops: String) {
+        val mask = LongArray(MAX_OPS / 64)
+        for (name in ops) {
+            val op = opcodeOf(name)
+            mask[op ushr 6] = mask[op ushr 6] or (1L shl (op and 63))
+        }
+        opMask = mask
+    }
+
+    /** Record every op (default). */
+    fun traceAllOps() {
+        opMask = LongArray(MAX_OPS / 64) { -1L }
+    }
+
+    /**
+     * Opcode for [name], registering it in the op table on first use.
      *
-     * ## Example Usage in CFloat32
-     * ```kotlin
-     * operator fun plus(other: CFloat32): CFloat32 {
-     *     val resultBits = Float32Math.addBits(this.bits, other.bits)
-     *     CFloatTrace.log("+", this.bits, other.bits, resultBits)
-     *     return CFloat32.fromBits(resultBits)
-     * }
-     * ```
+     * @throws IllegalStateException if all [MAX_OPS] opcodes are taken
+     */
+    fun opcodeOf(name: String): Int {
+        while (true) {
+            val names = opNames.load()
+            val found = names.indexOf(name)
+            if (found >= 0) return found
+            require(name.length in 1..255 && name.all { it.code < 128 }) { "op names must be 1..255 ASCII chars" }
+            check(names.size < MAX_OPS) { "CFloatTrace op table full ($MAX_OPS names)" }
+            if (opNames.compareAndSet(names, names + name)) return names.size
+        }
+    }
+
+    /** Name registered for [op], or `"op<n>"` if none. */
+    fun opName(op: Int): String = opNames.load().getOrNull(op) ?: "op$op"
+
+    /** Total records lost to ring wrap-around in the current epoch, over all writers. */
+    fun droppedCount(): Long = liveRings().sumOf { it.first.dropped }
+
+    /**
+     * Records a binary operation if tracing is enabled (allocation-free hot path).
      *
-     * ## Output Format
-     * ```
-     * TRACE + lhs=1.0 rhs=2.0 result=3.0
-     * TRACE sqrt lhs=4.0 rhs=null result=2.0
-     * ```
+     * @param op Opcode, one of the `OP_*` constants or an [opcodeOf] result
+     */
+    fun log(op: Int, lhs: Int, rhs: Int, result: Int) {
+        if (!enabled) return
+        record(op and 0xFF, FLAG_RHS, lhs, rhs, result)
+    }
+
+    /** Records a unary operation if tracing is enabled. */
+    fun logUnary(op: Int, operand: Int, result: Int) {
+        if (!enabled) return
+        record(op and 0xFF, 0, operand, 0, result)
+    }
+
+    /**
+     * Records a single operation by name if tracing is enabled.
      *
-     * @param op Operation name (conventionally "+", "-", "*", "/", "sqrt", etc.)
+     * Convenience overload for ad-hoc ops; the name is looked up in the op
+     * table on every call, so hot paths should use the `Int` opcode overloads.
+     *
+     * @param op Operation name (registered on first use)
      * @param lhs Left operand raw bits (or sole operand for unary operations)
      * @param rhs Right operand raw bits (null for unary operations)
      * @param result Result raw bits
      */
     fun log(op: String, lhs: Int, rhs: Int?, result: Int) {
         if (!enabled) return
-        entries += Entry(op, lhs, rhs, result)
-        println("TRACE $op lhs=${Float.fromBits(lhs)} rhs=${rhs?.let { Float.fromBits(it) }} result=${Float.fromBits(result)}")
+        val code = opcodeOf(op)
+        if (rhs == null) record(code, 0, lhs, 0, result) else record(code, FLAG_RHS, lhs, rhs, result)
+    }
+
+    /** Decode the live records of every writer. */
+    fun entries(): List<Entry> {
+        val names = opNames.load()
+        val out = ArrayList<Entry>()
+        for ((_, records) in liveRings()) {
+            var i = 0
+            while (i < records.size) {
+                val head = records[i]
+                val op = head and 0xFF
+                val rhs = if (head and FLAG_RHS != 0) records[i + 2] else null
+                out += Entry(names.getOrNull(op) ?: "op$op", records[i + 1], rhs, records[i + 3])
+                i += CFloatTraceRing.RECORD_INTS
+            }
+        }
+        return out
+    }
+
+    /**
+     * Compact binary dump of every live ring (format in the class docs).
+     *
+     * Intended for offline diffing, e.g. `tools/cfloat_trace_replay`, which
+     * recomputes each record with C `float` arithmetic.
+     */
+    fun export(): ByteArray {
+        val names = opNames.load()
+        val live = liveRings()
+        var size = 4 + 4 + 4 + 4 + 4
+        for (n in names) size += 1 + n.length
+        for ((_, records) in live) size += 4 + 8 + 4 + records.size * 4
+        val out = ByteArray(size)
+        var p = 0
+        fun u8(v: Int) { out[p++] = v.toByte() }
+        fun u32(v: Int) { u8(v); u8(v ushr 8); u8(v ushr 16); u8(v ushr 24) }
+        fun u64(v: Long) { u32(v.toInt()); u32((v ushr 32).toInt()) }
+        u8('C'.code); u8('F'.code); u8('T'.code); u8('R'.code)
+        u32(DUMP_VERSION)
+        u32(sampleEvery)
+        u32(names.size)
+        for (n in names) {
+            u8(n.length)
+            for (ch in n) u8(ch.code)
+        }
+        u32(live.size)
+        for ((ring, records) in live) {
+            u32(ring.writerId)
+            u64(ring.dropped)
+            u32(records.size / CFloatTraceRing.RECORD_INTS)
+            for (w in records) u32(w)
+        }
+        return out
+    }
+
+    // ===== Internals =====
+
+    private fun record(op: Int, flags: Int, lhs: Int, rhs: Int, result: Int) {
+        val mask = opMask
+        if ((mask[op ushr 6] ushr (op and 63)) and 1L == 0L) return
+        val ring = writerRing()
+        if (!ring.sample()) return
+        ring.append(op or flags, lhs, rhs, result)
+        if (echo) {
+            val rhsText = if (flags and FLAG_RHS != 0) Float.fromBits(rhs).toString() else "null"
+            println("TRACE ${opName(op)} lhs=${Float.fromBits(lhs)} rhs=$rhsText result=${Float.fromBits(result)}")
+        }
+    }
+
+    /** Calling thread's ring for the current epoch, creating or resetting it as needed. */
+    private fun writerRing(): CFloatTraceRing {
+        val e = epoch
+        val bound = boundTraceRing()
+        if (bound != null && bound.epoch == e) return bound
+        val cap = capacity
+        val ring = if (bound != null && bound.capacity == cap) bound
+        else CFloatTraceRing(cap, bound?.writerId ?: nextWriterId.fetchAndAdd(1))
+        ring.reset(e, sampleEvery)
+        if (ring !== bound) bindTraceRingToThread(ring)
+        register(ring)
+        return ring
+    }
+
+    private fun register(ring: CFloatTraceRing) {
+        while (true) {
+            val cur = rings.load()
+            for (r in cur) if (r === ring) return
+            if (rings.compareAndSet(cur, cur + ring)) return
+        }
+    }
+
+    /** Snapshots of rings belonging to the current epoch. */
+    private fun liveRings(): List<Pair<CFloatTraceRing, IntArray>> {
+        val e = epoch
+        val out = ArrayList<Pair<CFloatTraceRing, IntArray>>()
+        for (ring in rings.load()) {
+            if (ring.epoch != e) continue
+            val records = ring.snapshot()
+            if (ring.epoch == e) out += ring to records
+        }
+        return out
     }
 }
+
+/** Trace ring bound to the calling thread, or null before its first record. */
+internal expect fun boundTraceRing(): CFloatTraceRing?
+
+/** Bind [ring] to the calling thread. */
+internal expect fun bindTraceRingToThread(ring: CFloatTraceRing?)
@@ -0,0 +1,112 @@
+@file:OptIn(ExperimentalAtomicApi::class)
+
+package io.github.kotlinmania.klang.bitwise
+
+import kotlin.concurrent.Volatile
+import kotlin.concurrent.atomics.AtomicIntArray
+import kotlin.concurrent.atomics.ExperimentalAtomicApi
+
+/**
+ * Fixed-capacity, single-writer ring of packed [CFloatTrace] records.
+ *
+ * Each record is four ints in one pre-allocated [AtomicIntArray]:
+ *
+ * ```
+ * [ op | flags << 8 ][ lhs bits ][ rhs bits ][ result bits ]
+ * ```
+ *
+ * Only the owning thread appends or resets; other threads read with
+ * [snapshot]. The writer first claims the next record by bumping `claimed`,
+ * stores the four slots, and then publishes the new [written] count. The
+ * slots are atomic, so the slot stores stay ordered between the two counter
+ * writes and a reader's slot loads stay ordered before its re-read of
+ * `claimed`: every record below `written` is complete, and a reader that
+ * sees `claimed` knows which older slot may be mid-overwrite.
+ * When the ring is full the oldest record is overwritten and counted in
+ * [dropped].
+ *
+ * @property capacity Record capacity (power of two)
+ * @property writerId Stable id of the owning thread's writer, used in dumps
+ */
+internal class CFloatTraceRing(val capacity: Int, val writerId: Int) {
+    private val slots = AtomicIntArray(capacity * RECORD_INTS)
+    private val mask = capacity - 1
+
+    /** Records appended since the last [reset]; published after the slots are written. */
+    @Volatile
+    var written: Long = 0L
+        private set
+
+    /** Records the writer has started storing; `written + 1` while an append is in flight. */
+    @Volatile
+    private var claimed: Long = 0L
+
+    /** Trace epoch this ring was last reset for; stale rings are ignored by readers. */
+    @Volatile
+    var epoch: Int = -1
+        private set
+
+    private var sampleEvery = 1
+    private var sampleCountdown = 0
+
+    /** Records overwritten because the ring wrapped. */
+    val dropped: Long get() = (written - capacity).coerceAtLeast(0L)
+
+    /** Owner only: clear the ring for [epoch] with 1-in-[sampleEvery] sampling. */
+    fun reset(epoch: Int, sampleEvery: Int) {
+        this.sampleEvery = sampleEvery
+        sampleCountdown = 0
+        claimed = 0L
+        written = 0L
+        this.epoch = epoch
+    }
+
+    /** Owner only: true if the next op should be recorded (first of every `sampleEvery`). */
+    fun sample(): Boolean {
+        if (sampleEvery == 1) return true
+        val c = sampleCountdown
+        if (c == 0) {
+            sampleCountdown = sampleEvery - 1
+            return true
+        }
+        sampleCountdown = c - 1
+        return false
+    }
+
+    /** Owner only: append one record, overwriting the oldest when full. */
+    fun append(head: Int, lhs: Int, rhs: Int, result: Int) {
+        val n = written
+        claimed = n + 1
+        val base = (n.toInt() and mask) * RECORD_INTS
+        slots.storeAt(base, head)
+        slots.storeAt(base + 1, lhs)
+        slots.storeAt(base + 2, rhs)
+        slots.storeAt(base + 3, result)
+        written = n + 1
+    }
+
+    /**
+     * Copy the live records, oldest first, as `RECORD_INTS` ints each.
+     *
+     * Safe against a concurrent writer: after copying, `claimed` is re-read and
+     * every record whose slot the writer has started overwriting, including
+     * the one still in flight, is cut from the front.
+     */
+    fun snapshot(): IntArray {
+        val end = written
+        val start = (end - capacity).coerceAtLeast(0L)
+        val count = (end - start).toInt()
+        val out = IntArray(count * RECORD_INTS)
+        for (i in 0 until count) {
+            val src = ((start + i).toInt() and mask) * RECORD_INTS
+            for (k in 0 until RECORD_INTS) out[i * RECORD_INTS + k] = slots.loadAt(src + k)
+        }
+        val safeStart = (claimed - capacity).coerceAtLeast(start)
+        val torn = (safeStart - start).toInt().coerceAtMost(count)
+        return if (torn == 0) out else out.copyOfRange(torn * RECORD_INTS, out.size)
+    }
+
+    companion object {
+        const val RECORD_INTS: Int = 4
+    }
+}
@@ -0,0 +1,68 @@
+package io.github.kotlinmania.klang.bitwise
+
+/**
+ * Mutable double-double accumulator for hot loops.
+ *
+ * [DoubleDouble] is immutable, so `acc = acc + x` allocates a new value on
+ * every step. DDAccumulator updates [hi] and [lo] in place using the same
+ * error-free transformations, producing bit-identical results:
+ *
+ * ```kotlin
+ * val acc = DDAccumulator()
+ * for (i in a.indices) acc.addProduct(a[i], b[i])
+ * val dot = acc.toDoubleDouble()   // == fold(zero) { r, i -> r.addProduct(a[i], b[i]) }
+ * ```
+ *
+ * Not thread-safe; use one accumulator per thread and [add] the partial sums.
+ *
+ * @property hi High-order component of the running value
+ * @property lo Low-order component of the running value
+ * @since 0.1.0
+ */
+class DDAccumulator(var hi: Double = 0.0, var lo: Double = 0.0) {
+
+    /** Add a Double; same result as [DoubleDouble.plus] with a Double. */
+    fun add(value: Double) {
+        val s = hi + value
+        val loSum = lo + DoubleDouble.twoSumError(hi, value, s)
+        hi = s + loSum
+        lo = DoubleDouble.quickTwoSumError(s, loSum, hi)
+    }
+
+    /** Add a DoubleDouble; same result as [DoubleDouble.plus]. */
+    fun add(value: DoubleDouble) {
+        val s = hi + value.hi
+        val loSum = lo + value.lo + DoubleDouble.twoSumError(hi, value.hi, s)
+        hi = s + loSum
+        lo = DoubleDouble.quickTwoSumError(s, loSum, hi)
+    }
+
+    /** Add another accumulator's running value (e.g. merging per-thread partial sums). */
+    fun add(other: DDAccumulator) {
+        val s = hi + other.hi
+        val loSum = lo + other.lo + DoubleDouble.twoSumError(hi, other.hi, s)
+        hi = s + loSum
+        lo = DoubleDouble.quickTwoSumError(s, loSum, hi)
+    }
+
+    /** Add `a * b` with the product error captured; same result as [DoubleDouble.addProduct]. */
+    fun addProduct(a: Double, b: Double) {
+        val p = a * b
+        val s = hi + p
+        val t = lo + DoubleDouble.twoProdError(a, b, p) + DoubleDouble.twoSumError(hi, p, s)
+        hi = s + t
+        lo = DoubleDouble.quickTwoSumError(s, t, hi)
+    }
+
+    /** Snapshot the running value. */
+    fun toDoubleDouble(): DoubleDouble = DoubleDouble(hi, lo)
+
+    /** Collapse to the nearest Double. */
+    fun toDouble(): Double = hi + lo
+
+    /** Reset to zero for reuse. */
+    fun reset() {
+        hi = 0.0
+        lo = 0.0
+    }
+}
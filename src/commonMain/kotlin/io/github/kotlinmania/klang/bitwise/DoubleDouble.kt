@@ -99,6 +99,17 @@ package io.github.kotlinmania.klang.bitwise
  * // Useful for determinants, dot products, etc.
  * ```
  *
+ * ### Allocation-Free Kernels
+ * Each operator allocates only its result. For loops with millions of steps, use
+ * [sum] / [dot] (state kept in locals) or a mutable [DDAccumulator]; the error
+ * terms ([twoSumError], [quickTwoSumError], [twoProdError]) are public, so
+ * custom kernels can keep `hi`/`lo` in their own locals:
+ * ```kotlin
+ * val total = DoubleDouble.sum(values)          // == values.fold(zero) { acc, v -> acc + v }
+ * val acc = DDAccumulator()
+ * for (i in a.indices) acc.addProduct(a[i], b[i])
+ * ```
+ *
  * ## Performance
  *
  * | Operation | Double | DoubleDouble | Slowdown |
@@ -166,9 +177,9 @@ data class DoubleDouble(val hi: Double, val lo: Double) {
      * ## Algorithm
      * ```
      * 1. Sum high parts: s = hi + other.hi
-     * 2. Compute error: e = twoSum(hi, other.hi).error
+     * 2. Compute error: e = twoSumError(hi, other.hi, s)
      * 3. Add low parts and error: loSum = lo + other.lo + e
-     * 4. Normalize result: quickTwoSum(s, loSum)
+     * 4. Normalize result: (s + loSum, quickTwoSumError(s, loSum, s + loSum))
      * ```
      *
      * ## Complexity
@@ -179,10 +190,10 @@ data class DoubleDouble(val hi: Double, val lo: Double) {
      * @return High-precision sum
      */
     operator fun plus(other: DoubleDouble): DoubleDouble {
-        val (s, e) = twoSum(hi, other.hi)
-        val loSum = lo + other.lo + e
-        val (resHi, resLo) = quickTwoSum(s, loSum)
-        return DoubleDouble(resHi, resLo)
+        val s = hi + other.hi
+        val loSum = lo + other.lo + twoSumError(hi, other.hi, s)
+        val resHi = s + loSum
+        return DoubleDouble(resHi, quickTwoSumError(s, loSum, resHi))
     }
 
     /**
@@ -194,21 +205,27 @@ data class DoubleDouble(val hi: Double, val lo: Double) {
      * @return High-precision sum
      */
     operator fun plus(value: Double): DoubleDouble {
-        val (s, e) = twoSum(hi, value)
-        val loSum = lo + e
-        val (resHi, resLo) = quickTwoSum(s, loSum)
-        return DoubleDouble(resHi, resLo)
+        val s = hi + value
+        val loSum = lo + twoSumError(hi, value, s)
+        val resHi = s + loSum
+        return DoubleDouble(resHi, quickTwoSumError(s, loSum, resHi))
     }
 
     /**
      * Subtract another DoubleDouble.
      *
-     * Implemented as addition of negated value: `this + (-value)`.
+     * Same result as `this + (-value)` without materializing the negation.
      *
      * @param value DoubleDouble to subtract
      * @return High-precision difference
      */
-    operator fun minus(value: DoubleDouble): DoubleDouble = this + (-value)
+    operator fun minus(value: DoubleDouble): DoubleDouble {
+        val bHi = -value.hi
+        val s = hi + bHi
+        val loSum = lo - value.lo + twoSumError(hi, bHi, s)
+        val resHi = s + loSum
+        return DoubleDouble(resHi, quickTwoSumError(s, loSum, resHi))
+    }
 
     /**
      * Negate this DoubleDouble.
@@ -227,19 +244,19 @@ data class DoubleDouble(val hi: Double, val lo: Double) {
      * ## Algorithm
      * ```
      * 1. Multiply high part: p = hi * value
-     * 2. Compute error: e = twoProd(hi, value).error
+     * 2. Compute error: e = twoProdError(hi, value, p)
      * 3. Add low part contribution: loTerm = lo * value + e
-     * 4. Normalize result: quickTwoSum(p, loTerm)
+     * 4. Normalize result: (p + loTerm, quickTwoSumError(p, loTerm, p + loTerm))
      * ```
      *
      * @param value Double multiplier
      * @return High-precision product
      */
     operator fun times(value: Double): DoubleDouble {
-        val (p, e) = twoProd(hi, value)
-        val loTerm = lo * value + e
-        val (resHi, resLo) = quickTwoSum(p, loTerm)
-        return DoubleDouble(resHi, resLo)
+        val p = hi * value
+        val loTerm = lo * value + twoProdError(hi, value, p)
+        val resHi = p + loTerm
+        return DoubleDouble(resHi, quickTwoSumError(p, loTerm, resHi))
     }
 
     /**
@@ -260,12 +277,27 @@ data class DoubleDouble(val hi: Double, val lo: Double) {
      * @return High-precision product
      */
     operator fun times(other: DoubleDouble): DoubleDouble {
-        val (p, e) = twoProd(hi, other.hi)
-        var result = DoubleDouble(p, e)
-        result = result.addProduct(hi, other.lo)
-        result = result.addProduct(lo, other.hi)
-        result = result.addProduct(lo, other.lo)
-        return result
+        var rHi = hi * other.hi
+        var rLo = twoProdError(hi, other.hi, rHi)
+        // Three addProduct steps, unrolled on locals
+        var p = hi * other.lo
+        var s = rHi + p
+        var t = rLo + twoProdError(hi, other.lo, p) + twoSumError(rHi, p, s)
+        rHi = s + t
+        rLo = quickTwoSumError(s, t, rHi)
+
+        p = lo * other.hi
+        s = rHi + p
+        t = rLo + twoProdError(lo, other.hi, p) + twoSumError(rHi, p, s)
+        rHi = s + t
+        rLo = quickTwoSumError(s, t, rHi)
+
+        p = lo * other.lo
+        s = rHi + p
+        t = rLo + twoProdError(lo, other.lo, p) + twoSumError(rHi, p, s)
+        rHi = s + t
+        rLo = quickTwoSumError(s, t, rHi)
+        return DoubleDouble(rHi, rLo)
     }
 
     /**
@@ -288,11 +320,11 @@ data class DoubleDouble(val hi: Double, val lo: Double) {
      * @return High-precision result of `this + (a * b)`
      */
     fun addProduct(a: Double, b: Double): DoubleDouble {
-        val (p, e) = twoProd(a, b)
-        val (s, err) = twoSum(hi, p)
-        val t = lo + e + err
-        val (resHi, resLo) = quickTwoSum(s, t)
-        return DoubleDouble(resHi, resLo)
+        val p = a * b
+        val s = hi + p
+        val t = lo + twoProdError(a, b, p) + twoSumError(hi, p, s)
+        val resHi = s + t
+        return DoubleDouble(resHi, quickTwoSumError(s, t, resHi))
     }
 
     /**
@@ -370,92 +402,121 @@ data class DoubleDouble(val hi: Double, val lo: Double) {
         }
 
         /**
-         * TwoSum: Error-free transformation for addition.
+         * Sum of [values] in `[from, to)` with a double-double accumulator.
+         *
+         * Bit-identical to folding `acc + values[i]` from zero, but the running
+         * sum lives in two local Doubles: no allocation per element.
+         *
+         * @param values Addends
+         * @param from First index (inclusive)
+         * @param to End index (exclusive)
+         * @return High-precision sum
+         */
+        fun sum(values: DoubleArray, from: Int = 0, to: Int = values.size): DoubleDouble {
+            var accHi = 0.0
+            var accLo = 0.0
+            for (i in from until to) {
+                val v = values[i]
+                val s = accHi + v
+                val loSum = accLo + twoSumError(accHi, v, s)
+                accHi = s + loSum
+                accLo = quickTwoSumError(s, loSum, accHi)
+            }
+            return DoubleDouble(accHi, accLo)
+        }
+
+        /**
+         * Dot product `Σ a[i] × b[i]` over the first [length] elements, accumulated in double-double.
          *
-         * Computes both the sum and the roundoff error:
-         * - result.first = a + b (rounded)
-         * - result.second = exact error in the sum
+         * Bit-identical to folding `acc.addProduct(a[i], b[i])` from zero;
+         * every product's rounding error is captured by [twoProdError].
+         *
+         * @param a First vector
+         * @param b Second vector
+         * @param length Number of elements (defaults to the shorter vector)
+         * @return High-precision dot product
+         */
+        fun dot(a: DoubleArray, b: DoubleArray, length: Int = minOf(a.size, b.size)): DoubleDouble {
+            require(length <= a.size && length <= b.size) { "length $length exceeds vector size" }
+            var accHi = 0.0
+            var accLo = 0.0
+            for (i in 0 until length) {
+                val x = a[i]
+                val y = b[i]
+                val p = x * y
+                val s = accHi + p
+                val t = accLo + twoProdError(x, y, p) + twoSumError(accHi, p, s)
+                accHi = s + t
+                accLo = quickTwoSumError(s, t, accHi)
+            }
+            return DoubleDouble(accHi, accLo)
+        }
+
+        /**
+         * TwoSum error term: given `s = a + b` (rounded), returns the exact
+         * roundoff so that `a + b = s + err`.
          *
          * ## Algorithm (Knuth 1969)
          * ```
-         * s = a + b           // Rounded sum
          * bb = s - a          // Recover b (with rounding)
          * err = (a - (s - bb)) + (b - bb)  // Exact error
          * ```
          *
-         * ## Properties
-         * - Exact: `a + b = s + err` (mathematically exact)
-         * - Fast: 6 floating-point operations
+         * Only the error is returned, so the transformation costs no
+         * allocation; callers compute `s` themselves:
+         * ```kotlin
+         * val s = a + b
+         * val e = DoubleDouble.twoSumError(a, b, s)
+         * ```
          *
          * @param a First addend
          * @param b Second addend
-         * @return Pair of (sum, error)
+         * @param s The rounded sum `a + b`
+         * @return Roundoff error of `s`
          */
-        private fun twoSum(a: Double, b: Double): Pair<Double, Double> {
-            val s = a + b
+        fun twoSumError(a: Double, b: Double, s: Double): Double {
             val bb = s - a
-            val err = (a - (s - bb)) + (b - bb)
-            return s to err
+            return (a - (s - bb)) + (b - bb)
         }
 
         /**
-         * QuickTwoSum: Fast error-free transformation when |a| ≥ |b|.
+         * QuickTwoSum error term, valid when |a| ≥ |b|: given `s = a + b`,
+         * returns `b - (s - a)`.
          *
-         * Optimized version of TwoSum with precondition that a's magnitude
-         * is greater than or equal to b's magnitude.
-         *
-         * ## Algorithm
-         * ```
-         * s = a + b
-         * err = b - (s - a)
-         * ```
-         *
-         * ## Properties
-         * - Precondition: |a| ≥ |b|
-         * - Fast: 3 floating-point operations (vs 6 for TwoSum)
-         * - Exact when precondition holds
+         * 2 operations instead of [twoSumError]'s 5; exact only when the
+         * precondition holds.
          *
          * @param a Larger magnitude addend
          * @param b Smaller magnitude addend
-         * @return Pair of (sum, error)
+         * @param s The rounded sum `a + b`
+         * @return Roundoff error of `s`
          */
-        private fun quickTwoSum(a: Double, b: Double): Pair<Double, Double> {
-            val s = a + b
-            val err = b - (s - a)
-            return s to err
-        }
+        fun quickTwoSumError(a: Double, b: Double, s: Double): Double = b - (s - a)
 
         /**
-         * TwoProd: Error-free transformation for multiplication.
-         *
-         * Computes both the product and the roundoff error using
-         * Veltkamp/Dekker splitting algorithm.
+         * TwoProd error term: given `p = a * b` (rounded), returns the exact
+         * roundoff so that `a * b = p + err`.
          *
-         * ## Algorithm
+         * ## Algorithm (Veltkamp/Dekker)
          * ```
-         * 1. Compute rounded product: p = a * b
-         * 2. Split a and b into high/low parts (26 bits each)
-         * 3. Recompute product exactly using parts
-         * 4. Error = exact - rounded
+         * 1. Split a and b into high/low parts (26 bits each)
+         * 2. Recompute the product exactly from the parts
+         * 3. Error = exact - rounded
          * ```
          *
-         * ## Properties
-         * - Exact: `a * b = p + err` (mathematically exact)
-         * - Cost: ~15-20 floating-point operations
-         * - Alternative: FMA instruction (1 operation, hardware support)
+         * Exact barring overflow in the split (|a|, |b| below ~2^996).
          *
          * @param a First factor
          * @param b Second factor
-         * @return Pair of (product, error)
+         * @param p The rounded product `a * b`
+         * @return Roundoff error of `p`
          */
-        private fun twoProd(a: Double, b: Double): Pair<Double, Double> {
-            val p = a * b
+        fun twoProdError(a: Double, b: Double, p: Double): Double {
             val aHigh = splitHigh(a)
             val aLow = a - aHigh
             val bHigh = splitHigh(b)
             val bLow = b - bHigh
-            val err = ((aHigh * bHigh - p) + aHigh * bLow + aLow * bHigh) + aLow * bLow
-            return p to err
+            return ((aHigh * bHigh - p) + aHigh * bLow + aLow * bHigh) + aLow * bLow
         }
 
         /**
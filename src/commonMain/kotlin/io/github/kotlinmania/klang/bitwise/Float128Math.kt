@@ -1,174 +1,395 @@
 package io.github.kotlinmania.klang.bitwise
 
 import io.github.kotlinmania.klang.int.SwAR128
+import io.github.kotlinmania.klang.int.UInt128
 import io.github.kotlinmania.klang.int.hpc.HeapUInt128
-import kotlin.math.abs
 
 /**
- * Float128Math - placeholder quad-precision support built on top of the limb-based SWAR engine.
+ * Float128Math - IEEE-754 binary128 (quad precision) arithmetic in software.
  *
- * NOTE: arithmetic operators are currently implemented via double conversions while the
- * limb-based mantissa math is being rebuilt. The bit-level conversions mirror the previous
- * implementation so that constants round-trip through the limb representation.
+ * Bit-exact `__float128` semantics on every Kotlin target: 1 sign bit, 15
+ * exponent bits (bias 16383) and a 112-bit fraction with an implicit leading
+ * one, i.e. a 113-bit significand. Every operation rounds once,
+ * to nearest-even, including subnormal results.
+ *
+ * ## Layers
+ *
+ * - **Register core** (`UInt128` overloads): operands and results are
+ *   [UInt128] bit patterns (`hi` holds sign, exponent and the top 48 fraction
+ *   bits). No heap traffic and no allocation besides the immutable `UInt128`
+ *   values themselves.
+ * - **Heap wrappers** (`HeapUInt128` overloads): load both operands with two
+ *   8-byte reads, run the register core and store one freshly allocated
+ *   result. Kept for [io.github.kotlinmania.klang.float128.Float128] and
+ *   limb-based callers.
+ *
+ * ## Internal Significand Format
+ *
+ * Arithmetic works on significands widened by three guard bits (guard, round,
+ * sticky), so a normal significand has its leading one at bit 115:
+ *
+ * ```
+ * bit 115            bit 3  2  1  0
+ *  1 . f f f ... f f   f    G  R  S       value = sig × 2^(exp − 16383 − 115)
+ * ```
+ *
+ * Bits shifted out to the right are OR-ed ("jammed") into S, which is enough
+ * for correct round-to-nearest-even after a single normalization step.
+ *
+ * ## Special Values
+ *
+ * NaN results use the canonical quiet NaN `0x7FFF_8000_0..0`; NaN operands
+ * propagate quieted. Signed zeros follow IEEE-754 (`x − x = +0`,
+ * `−0 + −0 = −0`, `sqrt(−0) = −0`).
+ *
+ * ## Validation
+ *
+ * `tools/float128_ieee754_validator.c` prints GCC `__float128` results for the
+ * same operations; the kernel here matches them bit for bit, including
+ * subnormal and overflow boundaries. Square roots are checked against the
+ * tool's exact integer root, since libquadmath's `sqrtq` is not always
+ * correctly rounded.
+ *
+ * @see io.github.kotlinmania.klang.fp.CFloat128 Double-double (~106 bits, much faster, Double exponent range)
+ * @since 0.1.0
  */
 object Float128Math {
     private const val EXP_BIAS = 16383
     private const val EXP_MAX = 0x7FFF
-    private const val EXP_MIN = 0
     private const val DOUBLE_BIAS = 1023
 
+    /** Fraction bits stored in the encoding. */
+    private const val FRAC_BITS = 112
+
+    /** Guard bits carried below the significand during arithmetic. */
+    private const val GUARD_BITS = 3
+
+    private const val SIGN_MASK_HI = Long.MIN_VALUE
+    private const val FRAC_MASK_HI = 0x0000_FFFF_FFFF_FFFFL
+    private val HIDDEN_BIT = UInt128(1L shl (FRAC_BITS - 64), 0L)
+
     // Canonical constants -----------------------------------------------------------------------
 
+    val ZERO: UInt128 = UInt128.ZERO
+    val ONE: UInt128 = UInt128(EXP_BIAS.toLong() shl 48, 0L)
+    val NAN: UInt128 = UInt128((EXP_MAX.toLong() shl 48) or (1L shl 47), 0L)
+    val INF: UInt128 = UInt128(EXP_MAX.toLong() shl 48, 0L)
+    val NEG_INF: UInt128 = UInt128(SIGN_MASK_HI or (EXP_MAX.toLong() shl 48), 0L)
+
     val ZERO_BITS: HeapUInt128 = HeapUInt128.zero()
-    val ONE_BITS: HeapUInt128 = pack(0, EXP_BIAS, IntArray(7) { 0 })
-    val NAN_BITS: HeapUInt128 = pack(0, EXP_MAX, mantissaWithBit(0x8000_0000_0000_0000uL))
-    val INF_BITS: HeapUInt128 = pack(0, EXP_MAX, IntArray(7) { 0 })
-    val NEG_INF_BITS: HeapUInt128 = pack(1, EXP_MAX, IntArray(7) { 0 })
+    val ONE_BITS: HeapUInt128 = HeapUInt128.fromUInt128(ONE)
+    val NAN_BITS: HeapUInt128 = HeapUInt128.fromUInt128(NAN)
+    val INF_BITS: HeapUInt128 = HeapUInt128.fromUInt128(INF)
+    val NEG_INF_BITS: HeapUInt128 = HeapUInt128.fromUInt128(NEG_INF)
 
     // Conversion helpers -----------------------------------------------------------------------
 
-    fun fromFloat64Bits(bits: Long): HeapUInt128 {
-        val sign = ((bits ushr 63) and 1L).toInt()
+    /** Widen a binary64 bit pattern to binary128 (always exact). */
+    fun fromFloat64(bits: Long): UInt128 {
+        val signHi = bits and SIGN_MASK_HI
         val exp64 = ((bits ushr 52) and 0x7FFL).toInt()
         val frac64 = bits and 0x000F_FFFF_FFFF_FFFFL
 
         return when (exp64) {
             0 -> {
                 if (frac64 == 0L) {
-                    ZERO_BITS
+                    UInt128(signHi, 0L)
                 } else {
-                    // Subnormal double -> map to subnormal quad (rare). Shift fraction accordingly.
-                    val mantissa = buildMantissa(frac64, 112 - 52)
-                    pack(sign, EXP_MIN, mantissa)
+                    // Subnormal double: normal in binary128's wider exponent range
+                    val msb = 63 - frac64.countLeadingZeroBits()
+                    val exponent = msb - 1074 + EXP_BIAS
+                    val frac = (UInt128(0L, frac64) shl (FRAC_BITS - msb)) and fracMask()
+                    UInt128(signHi or (exponent.toLong() shl 48) or frac.hi, frac.lo)
                 }
             }
             0x7FF -> {
                 if (frac64 == 0L) {
-                    if (sign == 0) INF_BITS else NEG_INF_BITS
+                    UInt128(signHi or (EXP_MAX.toLong() shl 48), 0L)
                 } else {
-                    NAN_BITS
+                    // Keep the payload, force quiet
+                    val frac = UInt128(0L, frac64) shl 60
+                    UInt128(signHi or (EXP_MAX.toLong() shl 48) or (1L shl 47) or frac.hi, frac.lo)
                 }
             }
             else -> {
                 val exponent = exp64 - DOUBLE_BIAS + EXP_BIAS
-                val combined = (1L shl 52) or frac64
-                val mantissa = buildMantissa(combined, 112 - 53)
-                pack(sign, exponent, mantissa)
+                val frac = UInt128(0L, frac64) shl 60
+                UInt128(signHi or (exponent.toLong() shl 48) or frac.hi, frac.lo)
             }
         }
     }
 
-    fun toFloat64Bits(bits: HeapUInt128): Long {
-        val (sign, exp, mantissa) = unpack(bits)
-        return when {
-            exp == EXP_MAX && !mantissaAllZero(mantissa) -> {
-                // NaN
-                (sign.toLong() shl 63) or (0x7FFL shl 52) or 1L
-            }
-            exp == EXP_MAX -> {
-                // Infinity
-                (sign.toLong() shl 63) or (0x7FFL shl 52)
-            }
-            exp == 0 && mantissaAllZero(mantissa) -> {
-                // Zero
-                sign.toLong() shl 63
-            }
-            else -> {
-                val exponent = exp - EXP_BIAS + DOUBLE_BIAS
-                val mantShift = 112 - 53
-                val mantValue = extractMantissa(mantissa, mantShift)
-                val frac = mantValue and 0x000F_FFFF_FFFF_FFFFL
-                (sign.toLong() shl 63) or (exponent.toLong() shl 52) or frac
-            }
+    /** Narrow binary128 to a binary64 bit pattern, rounding to nearest-even. */
+    fun toFloat64(bits: UInt128): Long {
+        val signBit = bits.hi and SIGN_MASK_HI
+        val exp = expOf(bits)
+        val frac = bits and fracMask()
+        if (exp == EXP_MAX) {
+            if (frac.isZero()) return signBit or (0x7FFL shl 52)
+            return signBit or (0x7FFL shl 52) or (1L shl 51) or (frac shr 60).lo
+        }
+        if (exp == 0 && frac.isZero()) return signBit
+        // Subnormal quads are far below the binary64 range; they round to zero
+        if (exp == 0) return signBit
+        var expD = exp - EXP_BIAS + DOUBLE_BIAS
+        if (expD >= 0x7FF) return signBit or (0x7FFL shl 52)
+        val sig = frac or HIDDEN_BIT
+        var shift = FRAC_BITS - 52
+        if (expD <= 0) {
+            shift += 1 - expD
+            expD = 1
         }
+        if (shift > FRAC_BITS + 1) return signBit
+        var q = (sig shr shift).lo
+        val rem = sig and ((UInt128.ONE shl shift) - UInt128.ONE)
+        val half = UInt128.ONE shl (shift - 1)
+        val cmp = rem.compareTo(half)
+        if (cmp > 0 || (cmp == 0 && (q and 1L) != 0L)) q += 1
+        // q carries the hidden bit, so a rounding carry moves into the exponent field
+        return signBit or (((expD - 1).toLong() shl 52) + q)
     }
 
-    // Arithmetic (temporary double conversions) ------------------------------------------------
+    fun fromFloat64Bits(bits: Long): HeapUInt128 = HeapUInt128.fromUInt128(fromFloat64(bits))
 
-    fun addBits(a: HeapUInt128, b: HeapUInt128): HeapUInt128 {
-        if (isNaN(a) || isNaN(b)) return NAN_BITS
-        if (isInf(a)) return if (isInf(b) && compareBits(a, b) != 0) NAN_BITS else a
-        if (isInf(b)) return b
-        val sum = Double.fromBits(toFloat64Bits(a)) + Double.fromBits(toFloat64Bits(b))
-        return fromFloat64Bits(sum.toRawBits())
-    }
+    fun toFloat64Bits(bits: HeapUInt128): Long = toFloat64(bits.toUInt128())
 
-    fun subBits(a: HeapUInt128, b: HeapUInt128): HeapUInt128 = addBits(a, negateBits(b))
+    // Arithmetic: register core ----------------------------------------------------------------
 
-    fun mulBits(a: HeapUInt128, b: HeapUInt128): HeapUInt128 {
-        if (isNaN(a) || isNaN(b)) return NAN_BITS
-        if (isZero(a) || isZero(b)) {
-            val sign = (signOf(a) xor signOf(b))
-            return if (sign == 1) negateBits(ZERO_BITS) else ZERO_BITS
-        }
+    fun addBits(a: UInt128, b: UInt128): UInt128 = addSigned(a, b, negateB = false)
+
+    fun subBits(a: UInt128, b: UInt128): UInt128 = addSigned(a, b, negateB = true)
+
+    fun mulBits(a: UInt128, b: UInt128): UInt128 {
+        val signHi = (a.hi xor b.hi) and SIGN_MASK_HI
+        if (isNaN(a) || isNaN(b)) return propagateNaN(a, b)
         if (isInf(a) || isInf(b)) {
-            val sign = signOf(a) xor signOf(b)
-            return if (sign == 1) NEG_INF_BITS else INF_BITS
+            if (isZero(a) || isZero(b)) return NAN
+            return UInt128(signHi or (EXP_MAX.toLong() shl 48), 0L)
         }
-        val product = Double.fromBits(toFloat64Bits(a)) * Double.fromBits(toFloat64Bits(b))
-        return fromFloat64Bits(product.toRawBits())
+        if (isZero(a) || isZero(b)) return UInt128(signHi, 0L)
+
+        var ea = expOf(a)
+        var sa = sigOf(a)
+        if (ea == 0) { val n = normalizeSubnormal(sa); sa = n.second; ea = n.first }
+        var eb = expOf(b)
+        var sb = sigOf(b)
+        if (eb == 0) { val n = normalizeSubnormal(sb); sb = n.second; eb = n.first }
+
+        // 113 × 113 → 225/226-bit product as (pHi:pLo)
+        val ll = UInt128.multiplyFull(sa.lo, sb.lo)
+        val mid = UInt128.multiplyFull(sa.lo, sb.hi) + UInt128.multiplyFull(sa.hi, sb.lo)
+        val hh = UInt128.multiplyFull(sa.hi, sb.hi)
+        val pLo = ll + UInt128(mid.lo, 0L)
+        val carry = if (pLo < ll) UInt128.ONE else UInt128.ZERO
+        val pHi = hh + UInt128(0L, mid.hi) + carry
+
+        // Leading bit sits at 224 or 225; bring it to 115 or 116 and jam the rest
+        val cut = 2 * FRAC_BITS - (FRAC_BITS + GUARD_BITS)
+        var sig = (pHi shl (128 - cut)) or (pLo shr cut)
+        if (!(pLo and ((UInt128.ONE shl cut) - UInt128.ONE)).isZero()) sig = sig or UInt128.ONE
+        var exp = ea + eb - EXP_BIAS
+        if (!(sig shr (FRAC_BITS + GUARD_BITS + 1)).isZero()) {
+            sig = shiftRightJam(sig, 1)
+            exp += 1
+        }
+        return roundPack(signHi, exp, sig)
     }
 
-    fun divBits(a: HeapUInt128, b: HeapUInt128): HeapUInt128 {
-        if (isNaN(a) || isNaN(b)) return NAN_BITS
-        if (isZero(b)) {
-            return when {
-                isZero(a) -> NAN_BITS
-                signOf(a) xor signOf(b) == 1 -> NEG_INF_BITS
-                else -> INF_BITS
-            }
+    fun divBits(a: UInt128, b: UInt128): UInt128 {
+        val signHi = (a.hi xor b.hi) and SIGN_MASK_HI
+        if (isNaN(a) || isNaN(b)) return propagateNaN(a, b)
+        if (isInf(a)) return if (isInf(b)) NAN else UInt128(signHi or (EXP_MAX.toLong() shl 48), 0L)
+        if (isInf(b)) return UInt128(signHi, 0L)
+        if (isZero(b)) return if (isZero(a)) NAN else UInt128(signHi or (EXP_MAX.toLong() shl 48), 0L)
+        if (isZero(a)) return UInt128(signHi, 0L)
+
+        var ea = expOf(a)
+        var sa = sigOf(a)
+        if (ea == 0) { val n = normalizeSubnormal(sa); sa = n.second; ea = n.first }
+        var eb = expOf(b)
+        var sb = sigOf(b)
+        if (eb == 0) { val n = normalizeSubnormal(sb); sb = n.second; eb = n.first }
+
+        var exp = ea - eb + EXP_BIAS
+        // Keep the quotient in [1, 2): 116 quotient bits with the leading one at 115
+        var rem = sa
+        if (rem < sb) {
+            rem = rem shl 1
+            exp -= 1
         }
-        if (isInf(a)) {
-            return when {
-                isInf(b) -> NAN_BITS
-                signOf(a) xor signOf(b) == 1 -> NEG_INF_BITS
-                else -> INF_BITS
+        var qHi = 0L
+        var qLo = 0L
+        for (i in FRAC_BITS + GUARD_BITS downTo 0) {
+            if (rem >= sb) {
+                rem -= sb
+                if (i >= 64) qHi = qHi or (1L shl (i - 64)) else qLo = qLo or (1L shl i)
             }
+            rem = rem shl 1
         }
-        if (isInf(b)) {
-            return if (signOf(a) xor signOf(b) == 1) negateBits(ZERO_BITS) else ZERO_BITS
-        }
-        val quotient = Double.fromBits(toFloat64Bits(a)) / Double.fromBits(toFloat64Bits(b))
-        return fromFloat64Bits(quotient.toRawBits())
+        if (!rem.isZero()) qLo = qLo or 1L
+        return roundPack(signHi, exp, UInt128(qHi, qLo))
     }
 
-    fun compareBits(a: HeapUInt128, b: HeapUInt128): Int {
-        val diff = Double.fromBits(toFloat64Bits(a)).compareTo(Double.fromBits(toFloat64Bits(b)))
-        return diff
-    }
+    fun sqrtBits(a: UInt128): UInt128 {
+        if (isNaN(a)) return propagateNaN(a, a)
+        if (isZero(a)) return a
+        if (a.hi < 0L) return NAN
+        if (isInf(a)) return a
 
-    fun negateBits(bits: HeapUInt128): HeapUInt128 {
-        val limbs = bits.toIntArray()
-        limbs[SwAR128.LIMB_COUNT - 1] = limbs.last() xor (1 shl 15)
-        return HeapUInt128.fromLimbsUnsafe(limbs)
+        var e = expOf(a)
+        var sig = sigOf(a)
+        if (e == 0) { val n = normalizeSubnormal(sig); sig = n.second; e = n.first }
+        var unbiased = e - EXP_BIAS
+        if ((unbiased and 1) != 0) {
+            sig = sig shl 1
+            unbiased -= 1
+        }
+        // Digit-by-digit root of sig × 2^118: 116 result bits, leading one at 115.
+        // The 114 significant bits of sig feed the first 57 digit pairs; the rest are zero.
+        var rem = UInt128.ZERO
+        var root = UInt128.ZERO
+        for (i in 0 until FRAC_BITS + GUARD_BITS + 1) {
+            val pairShift = FRAC_BITS - 2 * i
+            val pair = if (pairShift >= 0) ((sig shr pairShift).lo and 3L) else 0L
+            rem = (rem shl 2) or UInt128(0L, pair)
+            val trial = (root shl 2) or UInt128.ONE
+            root = root shl 1
+            if (rem >= trial) {
+                rem -= trial
+                root = root or UInt128.ONE
+            }
+        }
+        if (!rem.isZero()) root = root or UInt128.ONE
+        return roundPack(0L, EXP_BIAS + (unbiased shr 1), root)
     }
 
-    fun absBits(bits: HeapUInt128): HeapUInt128 {
-        val limbs = bits.toIntArray()
-        limbs[SwAR128.LIMB_COUNT - 1] = limbs.last() and 0x7FFF
-        return HeapUInt128.fromLimbsUnsafe(limbs)
-    }
+    /** Fused multiply-add `a × b + c` with a single rounding. */
+    fun fmaBits(a: UInt128, b: UInt128, c: UInt128): UInt128 {
+        val signP = (a.hi xor b.hi) and SIGN_MASK_HI
+        if (isNaN(a) || isNaN(b)) return propagateNaN(a, b)
+        val prodInf = isInf(a) || isInf(b)
+        if (prodInf && (isZero(a) || isZero(b))) return NAN
+        if (isNaN(c)) return propagateNaN(c, c)
+        if (prodInf) {
+            if (isInf(c) && (c.hi and SIGN_MASK_HI) != signP) return NAN
+            return UInt128(signP or (EXP_MAX.toLong() shl 48), 0L)
+        }
+        if (isInf(c)) return c
+        if (isZero(a) || isZero(b)) {
+            if (!isZero(c)) return c
+            val signC = c.hi and SIGN_MASK_HI
+            return UInt128(if (signP == signC) signP else 0L, 0L)
+        }
 
-    fun isNaN(bits: HeapUInt128): Boolean {
-        val (sign, exp, mant) = unpack(bits)
-        return exp == EXP_MAX && !mantissaAllZero(mant)
-    }
+        var ea = expOf(a)
+        var sa = sigOf(a)
+        if (ea == 0) { val n = normalizeSubnormal(sa); sa = n.second; ea = n.first }
+        var eb = expOf(b)
+        var sb = sigOf(b)
+        if (eb == 0) { val n = normalizeSubnormal(sb); sb = n.second; eb = n.first }
 
-    fun isInf(bits: HeapUInt128): Boolean {
-        val (_, exp, mant) = unpack(bits)
-        return exp == EXP_MAX && mantissaAllZero(mant)
-    }
+        // Exact product, leading one at bit 224 or 225 of (pHi:pLo)
+        val ll = UInt128.multiplyFull(sa.lo, sb.lo)
+        val mid = UInt128.multiplyFull(sa.lo, sb.hi) + UInt128.multiplyFull(sa.hi, sb.lo)
+        val hh = UInt128.multiplyFull(sa.hi, sb.hi)
+        val pLo0 = ll + UInt128(mid.lo, 0L)
+        val pHi0 = hh + UInt128(0L, mid.hi) + (if (pLo0 < ll) UInt128.ONE else UInt128.ZERO)
+        // Wide format: value = w × 2^(e − bias − WIDE_LEAD). The product's
+        // leading one moves to WIDE_LEAD (or WIDE_LEAD + 1), c's to WIDE_LEAD.
+        var p = Wide(pHi0, pLo0).shl(WIDE_LEAD - 2 * FRAC_BITS)
+        val ep = ea + eb - EXP_BIAS
+        if (isZero(c)) return roundWide(signP, ep, p)
 
-    fun isZero(bits: HeapUInt128): Boolean {
-        val (_, exp, mant) = unpack(bits)
-        return exp == 0 && mantissaAllZero(mant)
+        var ec = expOf(c)
+        var sc = sigOf(c)
+        if (ec == 0) { val n = normalizeSubnormal(sc); sc = n.second; ec = n.first }
+        val signC = c.hi and SIGN_MASK_HI
+        var w = Wide(sc, UInt128.ZERO).shl(WIDE_LEAD - FRAC_BITS - 128)
+
+        // Align to the larger exponent; 134 spare bits keep the jam far below the rounding point
+        var e: Int
+        if (ec > ep) {
+            p = p.shrJam(ec - ep)
+            e = ec
+        } else {
+            w = w.shrJam(ep - ec)
+            e = ep
+        }
+        var r: Wide
+        val signR: Long
+        if (signP == signC) {
+            r = p + w
+            signR = signP
+        } else if (p >= w) {
+            r = p - w
+            signR = signP
+        } else {
+            r = w - p
+            signR = signC
+        }
+        if (r.isZero()) return ZERO
+        // Renormalize after cancellation; roundWide handles a carry past WIDE_LEAD
+        val lead = 255 - r.leadingZeroBits()
+        if (lead < WIDE_LEAD) {
+            r = r.shl(WIDE_LEAD - lead)
+            e -= WIDE_LEAD - lead
+        }
+        return roundWide(signR, e, r)
     }
 
-    fun signOf(bits: HeapUInt128): Int {
-        val top = bits.toIntArray().last()
-        return (top ushr 15) and 1
+    fun compareBits(a: UInt128, b: UInt128): Int {
+        // Double.compareTo ordering: NaN above everything and equal to itself, -0 < +0
+        val aNaN = isNaN(a)
+        val bNaN = isNaN(b)
+        if (aNaN || bNaN) return if (aNaN && bNaN) 0 else if (aNaN) 1 else -1
+        return orderKey(a).compareTo(orderKey(b))
     }
 
+    fun negateBits(bits: UInt128): UInt128 = UInt128(bits.hi xor SIGN_MASK_HI, bits.lo)
+
+    fun absBits(bits: UInt128): UInt128 = UInt128(bits.hi and SIGN_MASK_HI.inv(), bits.lo)
+
+    fun isNaN(bits: UInt128): Boolean = expOf(bits) == EXP_MAX && !(bits and fracMask()).isZero()
+
+    fun isInf(bits: UInt128): Boolean = expOf(bits) == EXP_MAX && (bits and fracMask()).isZero()
+
+    fun isZero(bits: UInt128): Boolean = (bits.hi and SIGN_MASK_HI.inv()) == 0L && bits.lo == 0L
+
+    fun signOf(bits: UInt128): Int = (bits.hi ushr 63).toInt()
+
+    // Arithmetic: heap wrappers ---------------------------------------------------------------
+
+    fun addBits(a: HeapUInt128, b: HeapUInt128): HeapUInt128 =
+        HeapUInt128.fromUInt128(addBits(a.toUInt128(), b.toUInt128()))
+
+    fun subBits(a: HeapUInt128, b: HeapUInt128): HeapUInt128 =
+        HeapUInt128.fromUInt128(subBits(a.toUInt128(), b.toUInt128()))
+
+    fun mulBits(a: HeapUInt128, b: HeapUInt128): HeapUInt128 =
+        HeapUInt128.fromUInt128(mulBits(a.toUInt128(), b.toUInt128()))
+
+    fun divBits(a: HeapUInt128, b: HeapUInt128): HeapUInt128 =
+        HeapUInt128.fromUInt128(divBits(a.toUInt128(), b.toUInt128()))
+
+    fun sqrtBits(a: HeapUInt128): HeapUInt128 = HeapUInt128.fromUInt128(sqrtBits(a.toUInt128()))
+
+    fun fmaBits(a: HeapUInt128, b: HeapUInt128, c: HeapUInt128): HeapUInt128 =
+        HeapUInt128.fromUInt128(fmaBits(a.toUInt128(), b.toUInt128(), c.toUInt128()))
+
+    fun compareBits(a: HeapUInt128, b: HeapUInt128): Int = compareBits(a.toUInt128(), b.toUInt128())
+
+    fun negateBits(bits: HeapUInt128): HeapUInt128 = HeapUInt128.fromUInt128(negateBits(bits.toUInt128()))
+
+    fun absBits(bits: HeapUInt128): HeapUInt128 = HeapUInt128.fromUInt128(absBits(bits.toUInt128()))
+
+    fun isNaN(bits: HeapUInt128): Boolean = isNaN(bits.toUInt128())
+
+    fun isInf(bits: HeapUInt128): Boolean = isInf(bits.toUInt128())
+
+    fun isZero(bits: HeapUInt128): Boolean = isZero(bits.toUInt128())
+
+    fun signOf(bits: HeapUInt128): Int = signOf(bits.toUInt128())
+
     // -----------------------------------------------------------------------------------------
     // Internal helpers
 
@@ -191,55 +412,165 @@ object Float128Math {
 
     internal fun mantissaAllZero(mantissa: IntArray): Boolean = mantissa.all { it and 0xFFFF == 0 }
 
-    private fun buildMantissa(source: Long, lsbShift: Int): IntArray {
-        require(lsbShift >= 0)
-        var base = HeapUInt128.one().shiftLeft(lsbShift)
-        var result = HeapUInt128.zero()
-        var value = source
-        var index = 0
-        while (value != 0L) {
-            if ((value and 1L) != 0L) {
-                result = result + base
+    private fun fracMask(): UInt128 = UInt128(FRAC_MASK_HI, -1L)
+
+    private fun expOf(bits: UInt128): Int = ((bits.hi ushr 48) and 0x7FFFL).toInt()
+
+    /** Significand with the hidden bit (absent for subnormals). */
+    private fun sigOf(bits: UInt128): UInt128 {
+        val frac = bits and fracMask()
+        return if (expOf(bits) == 0) frac else frac or HIDDEN_BIT
+    }
+
+    /** Shift a subnormal significand up to bit 112; returns the matching (possibly ≤ 0) exponent. */
+    private fun normalizeSubnormal(sig: UInt128): Pair<Int, UInt128> {
+        val shift = sig.leadingZeroBits() - (127 - FRAC_BITS)
+        return (1 - shift) to (sig shl shift)
+    }
+
+    private fun propagateNaN(a: UInt128, b: UInt128): UInt128 {
+        val n = if (isNaN(a)) a else b
+        return UInt128(n.hi or (1L shl 47), n.lo)
+    }
+
+    /** Sign-magnitude → unsigned-ordered key (negative values reversed below positives). */
+    private fun orderKey(bits: UInt128): UInt128 =
+        if (bits.hi < 0L) bits.inv() else UInt128(bits.hi xor SIGN_MASK_HI, bits.lo)
+
+    private fun shiftRightJam(x: UInt128, n: Int): UInt128 {
+        if (n == 0) return x
+        if (n >= 128) return if (x.isZero()) UInt128.ZERO else UInt128.ONE
+        val lost = x and ((UInt128.ONE shl n) - UInt128.ONE)
+        val shifted = x shr n
+        return if (lost.isZero()) shifted else shifted or UInt128.ONE
+    }
+
+    private fun addSigned(a: UInt128, b0: UInt128, negateB: Boolean): UInt128 {
+        val b = if (negateB) negateBits(b0) else b0
+        if (isNaN(a) || isNaN(b)) return propagateNaN(a, b0)
+        val signA = a.hi and SIGN_MASK_HI
+        val signB = b.hi and SIGN_MASK_HI
+        if (isInf(a)) return if (isInf(b) && signA != signB) NAN else a
+        if (isInf(b)) return b
+        if (isZero(a)) {
+            if (isZero(b)) return UInt128(if (signA == signB) signA else 0L, 0L)
+            return b
+        }
+        if (isZero(b)) return a
+
+        var ea = expOf(a)
+        var sa = sigOf(a) shl GUARD_BITS
+        var eb = expOf(b)
+        var sb = sigOf(b) shl GUARD_BITS
+        // Subnormals share exponent 1 with the smallest normals
+        if (ea == 0) ea = 1
+        if (eb == 0) eb = 1
+
+        var signR = signA
+        if (ea < eb || (ea == eb && sa < sb)) {
+            val te = ea; ea = eb; eb = te
+            val ts = sa; sa = sb; sb = ts
+            signR = signB
+        }
+        sb = shiftRightJam(sb, ea - eb)
+        var exp = ea
+        var sig: UInt128
+        if (signA == signB) {
+            sig = sa + sb
+            if (!(sig shr (FRAC_BITS + GUARD_BITS + 1)).isZero()) {
+                sig = shiftRightJam(sig, 1)
+                exp += 1
             }
-            value = value ushr 1
-            base = base.shiftLeft(1)
-            index++
-        }
-        val limbs = result.toIntArray()
-        limbs[SwAR128.LIMB_COUNT - 1] = 0
-        return IntArray(7) { idx -> limbs[idx] }
-    }
-
-    private fun extractMantissa(mantissa: IntArray, shift: Int): Long {
-        var value = HeapUInt128.fromLimbsUnsafe(
-            IntArray(SwAR128.LIMB_COUNT) { idx -> if (idx < mantissa.size) mantissa[idx] else 0 }
-        )
-        if (shift > 0) {
-            value = value.shiftRight(shift)
-        }
-        val limbs = value.toIntArray()
-        var result = 0L
-        for (i in SwAR128.LIMB_COUNT - 1 downTo 0) {
-            result = (result shl SwAR128.LIMB_BITS) or (limbs[i].toLong() and 0xFFFF)
-        }
-        return result
-    }
-
-    private fun mantissaWithBit(bit: ULong): IntArray {
-        var value = HeapUInt128.zero()
-        var base = HeapUInt128.one()
-        var remaining = bit
-        var position = 0
-        while (remaining != 0uL) {
-            if ((remaining and 1uL) == 1uL) {
-                value = value + base
+        } else {
+            sig = sa - sb
+            if (sig.isZero()) return ZERO
+            val shift = sig.leadingZeroBits() - (127 - FRAC_BITS - GUARD_BITS)
+            // Do not normalize below exponent 1: the result is then subnormal
+            val s = if (exp - shift < 1) exp - 1 else shift
+            sig = sig shl s
+            exp -= s
+        }
+        return roundPack(signR, exp, sig)
+    }
+
+    /**
+     * Round a 116-bit significand (leading one at bit 115, or lower only when
+     * [exp] is 1) to nearest-even and encode it.
+     */
+    private fun roundPack(signHi: Long, exp0: Int, sig0: UInt128): UInt128 {
+        var exp = exp0
+        var sig = sig0
+        if (exp >= EXP_MAX) return UInt128(signHi or (EXP_MAX.toLong() shl 48), 0L)
+        if (exp <= 0) {
+            sig = shiftRightJam(sig, 1 - exp)
+            exp = 1
+        }
+        val roundBits = (sig.lo and 7L).toInt()
+        sig = sig shr GUARD_BITS
+        if (roundBits > 4 || (roundBits == 4 && (sig.lo and 1L) != 0L)) sig += UInt128.ONE
+        // The hidden bit (or a rounding carry past it) adds into the exponent field
+        return UInt128(signHi, 0L) + (UInt128((exp - 1).toLong() shl 48, 0L) + sig)
+    }
+
+    /** Reduce a wide significand (leading one at bit [WIDE_LEAD]) to 116 bits and round. */
+    private fun roundWide(signHi: Long, exp0: Int, w0: Wide): UInt128 {
+        var exp = exp0
+        var w = w0
+        val lead = 255 - w.leadingZeroBits()
+        if (lead > WIDE_LEAD) {
+            w = w.shrJam(lead - WIDE_LEAD)
+            exp += lead - WIDE_LEAD
+        }
+        val narrowed = w.shrJam(WIDE_LEAD - (FRAC_BITS + GUARD_BITS))
+        return roundPack(signHi, exp, narrowed.lo)
+    }
+
+    /** Bit position of the leading significand one in the 256-bit FMA accumulator. */
+    private const val WIDE_LEAD = 250
+
+    /** 256-bit unsigned helper for the FMA accumulator. */
+    private class Wide(val hi: UInt128, val lo: UInt128) : Comparable<Wide> {
+        fun isZero(): Boolean = hi.isZero() && lo.isZero()
+
+        fun leadingZeroBits(): Int = if (!hi.isZero()) hi.leadingZeroBits() else 128 + lo.leadingZeroBits()
+
+        operator fun plus(o: Wide): Wide {
+            val l = lo + o.lo
+            val c = if (l < lo) UInt128.ONE else UInt128.ZERO
+            return Wide(hi + o.hi + c, l)
+        }
+
+        operator fun minus(o: Wide): Wide {
+            val b = if (lo < o.lo) UInt128.ONE else UInt128.ZERO
+            return Wide(hi - o.hi - b, lo - o.lo)
+        }
+
+        fun shl(n: Int): Wide = when {
+            n == 0 -> this
+            n >= 256 -> Wide(UInt128.ZERO, UInt128.ZERO)
+            n >= 128 -> Wide(lo shl (n - 128), UInt128.ZERO)
+            else -> Wide((hi shl n) or (lo shr (128 - n)), lo shl n)
+        }
+
+        fun shrJam(n: Int): Wide {
+            if (n == 0) return this
+            if (n >= 256) return Wide(UInt128.ZERO, if (isZero()) UInt128.ZERO else UInt128.ONE)
+            val shifted: Wide
+            val lost: Boolean
+            if (n >= 128) {
+                val k = n - 128
+                shifted = Wide(UInt128.ZERO, if (k == 0) hi else hi shr k)
+                lost = !lo.isZero() || (k > 0 && !(hi and ((UInt128.ONE shl k) - UInt128.ONE)).isZero())
+            } else {
+                shifted = Wide(hi shr n, (lo shr n) or (hi shl (128 - n)))
+                lost = !(lo and ((UInt128.ONE shl n) - UInt128.ONE)).isZero()
             }
-            remaining = remaining shr 1
-            base = base.shiftLeft(1)
-            position++
+            return if (lost) Wide(shifted.hi, shifted.lo or UInt128.ONE) else shifted
+        }
+
+        override fun compareTo(other: Wide): Int {
+            val c = hi.compareTo(other.hi)
+            return if (c != 0) c else lo.compareTo(other.lo)
         }
-        val limbs = value.toIntArray()
-        limbs[SwAR128.LIMB_COUNT - 1] = 0
-        return IntArray(7) { idx -> limbs[idx] }
     }
 }
@@ -0,0 +1,221 @@
+package io.github.kotlinmania.klang.bitwise
+
+import io.github.kotlinmania.klang.mem.GlobalHeap
+
+/**
+ * HalfPrecisionMath — bulk-friendly binary16 / bfloat16 ⇄ binary32 kernels.
+ *
+ * Bit-exact with [Float16Math.toFloat32Bits] / [Float16Math.fromFloat32Bits]
+ * (and so with `tools/float16_spotcheck.c`) and with `CBF16.fromFloatBits`,
+ * but shaped for loops:
+ *
+ * ```
+ * f16 → f32   MANTISSA[OFFSET[h >>> 10] + (h & 0x3FF)] | EXPONENT[h >>> 10]
+ * f32 → f16   rebias + round-to-nearest-even in one add, then mask selects
+ *             for overflow (→ Inf), underflow (→ ±0), and NaN (→ 0x7E00)
+ * bf16 → f32  h << 16
+ * f32 → bf16  f + 0x7FFF + lsb, NaN payload kept and forced non-zero
+ * ```
+ *
+ * The split decode tables hold 3072 + 64 + 64 Ints (12 KB) instead of a
+ * 64K-entry table. Like the scalar path, f32 → f16 flushes results below
+ * the smallest normal (2^−14) to signed zero and canonicalizes NaN.
+ *
+ * The heap loops read and write [GlobalHeap.packed] words directly: four
+ * halves per `Long` against two `Long`s of floats. Source and destination
+ * regions must not overlap.
+ *
+ * @native-bitshift-allowed Kernel layer for half-precision conversion; raw shifts permitted.
+ */
+object HalfPrecisionMath {
+    private const val HALF_MASK = 0xFFFF
+    private const val HALF_FRAC_MASK = 0x3FF
+    private const val HALF_EXP_SHIFT = 10
+    private const val F32_ABS_MASK = 0x7FFFFFFF
+    private const val F32_INF = 0x7F800000
+
+    /** (127 − 15) << 23: rebias binary32 → binary16 on the shared bit layout. */
+    private const val REBIAS = 0x38000000
+    /** Smallest binary32 |x| whose binary16 exponent is ≥ 1 (2^−14). */
+    private const val F16_MIN_NORMAL_AS_F32 = 0x38800000
+    private const val F16_INF = 0x7C00
+    private const val F16_NAN = 0x7E00
+
+    private const val BF16_QUIET = 0x40
+    private const val BF16_PAYLOAD = 0x7F
+
+    /** Elements staged per step when the heap loops cannot run on whole words. */
+    private const val STAGE = 256
+
+    // ---- decode tables ----
+    // 0..1023: subnormal payloads as full binary32 magnitudes
+    // 1024..2047: normal fraction bits
+    // 2048..3071: exponent 31 (0 for Inf, the canonical quiet bit for NaN)
+    private val MANTISSA = IntArray(3 shl HALF_EXP_SHIFT).also { t ->
+        for (m in 1..HALF_FRAC_MASK) {
+            val lead = 31 - m.countLeadingZeroBits()
+            t[m] = ((lead - 24 + 127) shl 23) or ((m shl (23 - lead)) and 0x7FFFFF)
+            t[1024 + m] = m shl 13
+            t[2048 + m] = 0x400000
+        }
+    }
+    private val OFFSET = IntArray(64) { i ->
+        when (i and 31) {
+            0 -> 0
+            31 -> 2048
+            else -> 1024
+        }
+    }
+    private val EXPONENT = IntArray(64) { i ->
+        val sign = (i ushr 5) shl 31
+        when (val e = i and 31) {
+            0 -> sign
+            31 -> sign or F32_INF
+            else -> sign or ((e + 112) shl 23)
+        }
+    }
+
+    /** binary16 bits (low 16 used) → binary32 bits. */
+    fun f16ToF32Bits(h: Int): Int {
+        val hi = (h and HALF_MASK) ushr HALF_EXP_SHIFT
+        return MANTISSA[OFFSET[hi] + (h and HALF_FRAC_MASK)] or EXPONENT[hi]
+    }
+
+    /** binary32 bits → binary16 bits, round-to-nearest-even, no data-dependent branches. */
+    fun f32ToF16Bits(f: Int): Int {
+        val sign = (f ushr 16) and 0x8000
+        val abs = f and F32_ABS_MASK
+        var h = (abs - REBIAS + 0xFFF + ((abs ushr 13) and 1)) ushr 13
+        val over = (F16_INF - h) shr 31
+        h = (h and over.inv()) or (F16_INF and over)
+        h = h and ((abs - F16_MIN_NORMAL_AS_F32) shr 31).inv()
+        val nan = (F32_INF - abs) shr 31
+        h = (h and nan.inv()) or (F16_NAN and nan)
+        return sign or h
+    }
+
+    /** bfloat16 bits (low 16 used) → binary32 bits. */
+    fun bf16ToF32Bits(h: Int): Int = h shl 16
+
+    /** binary32 bits → bfloat16 bits, round-to-nearest-even, no data-dependent branches. */
+    fun f32ToBf16Bits(f: Int): Int {
+        val nan = (F32_INF - (f and F32_ABS_MASK)) shr 31
+        val rounded = (f + 0x7FFF + ((f ushr 16) and 1)) ushr 16
+        val top = f ushr 16
+        val quieted = top or ((((top and BF16_PAYLOAD) - 1) shr 31) and BF16_QUIET)
+        return ((rounded and nan.inv()) or (quieted and nan)) and HALF_MASK
+    }
+
+    // ---- heap loops ----
+
+    internal fun f16ToF32(srcAddr: Int, dst: FloatArray, dstOffset: Int, n: Int) =
+        decodeToArray(srcAddr, dst, dstOffset, n) { f16ToF32Bits(it) }
+
+    internal fun bf16ToF32(srcAddr: Int, dst: FloatArray, dstOffset: Int, n: Int) =
+        decodeToArray(srcAddr, dst, dstOffset, n) { bf16ToF32Bits(it) }
+
+    internal fun f16ToF32(srcAddr: Int, dstAddr: Int, n: Int) =
+        decodeHeap(srcAddr, dstAddr, n) { f16ToF32Bits(it) }
+
+    internal fun bf16ToF32(srcAddr: Int, dstAddr: Int, n: Int) =
+        decodeHeap(srcAddr, dstAddr, n) { bf16ToF32Bits(it) }
+
+    internal fun f32ToF16(srcAddr: Int, dstAddr: Int, n: Int) =
+        encodeHeap(srcAddr, dstAddr, n) { f32ToF16Bits(it) }
+
+    internal fun f32ToBf16(srcAddr: Int, dstAddr: Int, n: Int) =
+        encodeHeap(srcAddr, dstAddr, n) { f32ToBf16Bits(it) }
+
+    private inline fun decodeToArray(srcAddr: Int, dst: FloatArray, dstOffset: Int, n: Int, decode: (Int) -> Int) =
+        decodeEach(srcAddr, n, decode) { i, bits -> dst[dstOffset + i] = Float.fromBits(bits) }
+
+    /** Decode [n] halves at [srcAddr], handing each binary32 pattern to [store] with its index. */
+    private inline fun decodeEach(srcAddr: Int, n: Int, decode: (Int) -> Int, store: (Int, Int) -> Unit) {
+        val buf = GlobalHeap.packed
+        val d = buf.data
+        var a = srcAddr
+        var i = 0
+        if ((a and 1) == 0) {
+            // Peel to an 8-byte boundary, then four halves per word
+            while (i < n && (a and 7) != 0) {
+                store(i++, decode((d[a ushr 3] ushr ((a and 7) shl 3)).toInt() and HALF_MASK))
+                a += 2
+            }
+            while (n - i >= 4) {
+                val w = d[a ushr 3]
+                store(i, decode(w.toInt() and HALF_MASK))
+                store(i + 1, decode((w ushr 16).toInt() and HALF_MASK))
+                store(i + 2, decode((w ushr 32).toInt() and HALF_MASK))
+                store(i + 3, decode((w ushr 48).toInt() and HALF_MASK))
+                i += 4
+                a += 8
+            }
+        }
+        while (i < n) {
+            store(i++, decode(buf.getShort(a).toInt() and HALF_MASK))
+            a += 2
+        }
+    }
+
+    private inline fun decodeHeap(srcAddr: Int, dstAddr: Int, n: Int, decode: (Int) -> Int) {
+        val buf = GlobalHeap.packed
+        if ((srcAddr and 7) == 0 && (dstAddr and 7) == 0) {
+            val d = buf.data
+            var si = srcAddr ushr 3
+            var di = dstAddr ushr 3
+            val words = n ushr 2
+            for (k in 0 until words) {
+                val w = d[si++]
+                d[di++] = (decode(w.toInt() and HALF_MASK).toLong() and 0xFFFFFFFFL) or
+                    (decode((w ushr 16).toInt() and HALF_MASK).toLong() shl 32)
+                d[di++] = (decode((w ushr 32).toInt() and HALF_MASK).toLong() and 0xFFFFFFFFL) or
+                    (decode((w ushr 48).toInt() and HALF_MASK).toLong() shl 32)
+            }
+            for (i in words shl 2 until n) {
+                buf.setInt(dstAddr + (i shl 2), decode(buf.getShort(srcAddr + (i shl 1)).toInt() and HALF_MASK))
+            }
+            return
+        }
+        // Staged as Int bit patterns so NaN payloads survive on every target
+        val stage = IntArray(minOf(n, STAGE))
+        var i = 0
+        while (i < n) {
+            val c = minOf(STAGE, n - i)
+            decodeEach(srcAddr + (i shl 1), c, decode) { j, bits -> stage[j] = bits }
+            buf.writeInts(dstAddr + (i shl 2), stage, 0, c)
+            i += c
+        }
+    }
+
+    private inline fun encodeHeap(srcAddr: Int, dstAddr: Int, n: Int, encode: (Int) -> Int) {
+        val buf = GlobalHeap.packed
+        if ((srcAddr and 7) == 0 && (dstAddr and 7) == 0) {
+            val d = buf.data
+            var si = srcAddr ushr 3
+            var di = dstAddr ushr 3
+            val words = n ushr 2
+            for (k in 0 until words) {
+                val lo = d[si++]
+                val hi = d[si++]
+                d[di++] = (encode(lo.toInt()).toLong() and 0xFFFFL) or
+                    ((encode((lo ushr 32).toInt()).toLong() and 0xFFFFL) shl 16) or
+                    ((encode(hi.toInt()).toLong() and 0xFFFFL) shl 32) or
+                    (encode((hi ushr 32).toInt()).toLong() shl 48)
+            }
+            for (i in words shl 2 until n) {
+                buf.setShort(dstAddr + (i shl 1), encode(buf.getInt(srcAddr + (i shl 2))).toShort())
+            }
+            return
+        }
+        val words = IntArray(minOf(n, STAGE))
+        val halves = ShortArray(words.size)
+        var i = 0
+        while (i < n) {
+            val c = minOf(STAGE, n - i)
+            buf.readInts(srcAddr + (i shl 2), words, 0, c)
+            for (j in 0 until c) halves[j] = encode(words[j]).toShort()
+            buf.writeShorts(dstAddr + (i shl 1), halves, 0, c)
+            i += c
+        }
+    }
+}
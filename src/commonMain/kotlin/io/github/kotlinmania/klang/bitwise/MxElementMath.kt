@@ -0,0 +1,157 @@
+package io.github.kotlinmania.klang.bitwise
+
+/**
+ * MxElementMath — bit kernels for microscaling (MX) element formats.
+ *
+ * Element layouts (high to low), following the OCP MX v1.0 definitions:
+ *
+ * ```
+ * E4M3   S EEEE MMM   bias 7, max 448 (0x7E), NaN 0x7F / 0xFF, no infinity
+ * E2M1   S EE M       bias 1, max 6.0 (0x7), values 0, .5, 1, 1.5, 2, 3, 4, 6
+ * ```
+ *
+ * An MX block stores one shared [CE8M0Math] scale `2^k` and encodes every
+ * element as `x × 2^(−k)`. [sharedExponent] chooses `k` so that the block's
+ * largest magnitude lands in the element format's top binade.
+ *
+ * Encoding is done on the IEEE-754 binary32 bit pattern, scale included, so
+ * no float multiply (and no target-dependent rounding) is involved:
+ * round-to-nearest-even, subnormals handled by the same shift, overflow
+ * saturates to the largest finite encoding. NaN encodes to the E4M3 NaN and
+ * to 0 in E2M1 (which has no NaN); infinities saturate.
+ *
+ * @native-bitshift-allowed Kernel layer for MX element formats; raw shifts permitted.
+ */
+object MxElementMath {
+    // ---- E4M3 layout ----
+    private const val E4M3_MAN_BITS = 3
+    private const val E4M3_EXP_MIN = -6
+    /** Largest finite E4M3 magnitude encoding (448.0). */
+    const val E4M3_MAX_ENCODING = 0x7E
+    /** E4M3 NaN magnitude encoding. */
+    const val E4M3_NAN = 0x7F
+    /** Unbiased exponent of the largest E4M3 binade (448 = 1.75 × 2^8). */
+    const val E4M3_EMAX = 8
+
+    // ---- E2M1 layout ----
+    private const val E2M1_MAN_BITS = 1
+    private const val E2M1_EXP_MIN = 0
+    /** Largest finite E2M1 magnitude encoding (6.0). */
+    const val E2M1_MAX_ENCODING = 0x7
+    /** Unbiased exponent of the largest E2M1 binade (6 = 1.5 × 2^2). */
+    const val E2M1_EMAX = 2
+
+    // ---- IEEE-754 binary32 layout ----
+    private const val FP32_MAN_BITS = 23
+    private const val FP32_FRAC_MASK = 0x7FFFFF
+    private const val FP32_IMPLICIT = 0x800000
+    private const val FP32_ABS_MASK = 0x7FFFFFFF
+    private const val FP32_INF = 0x7F800000
+    private const val FP32_EXP_BIAS = 127
+
+    /** Smallest and largest shared exponents representable by a CE8M0 byte (0x00 .. 0xFE). */
+    const val SCALE_EXP_MIN = -127
+    const val SCALE_EXP_MAX = 127
+
+    /**
+     * Shared block exponent `k` for a block whose largest finite magnitude has
+     * bit pattern [maxAbsBits] (0 for an all-zero block), for an element format
+     * whose top binade is [emax]: `floor(log2(max)) − emax`, clamped to the
+     * CE8M0 range. The CE8M0 byte is `k + 127`.
+     */
+    fun sharedExponent(maxAbsBits: Int, emax: Int): Int {
+        if (maxAbsBits == 0) return SCALE_EXP_MIN
+        val expField = maxAbsBits ushr FP32_MAN_BITS
+        val log2 = if (expField != 0) expField - FP32_EXP_BIAS
+            else -FP32_EXP_BIAS - FP32_MAN_BITS + 1 + (31 - maxAbsBits.countLeadingZeroBits())
+        return (log2 - emax).coerceIn(SCALE_EXP_MIN, SCALE_EXP_MAX)
+    }
+
+    /** E4M3 byte for `Float.fromBits(bits) × 2^(−k)`. */
+    fun encodeE4M3(bits: Int, k: Int): Int {
+        val sign = (bits ushr 24) and 0x80
+        val abs = bits and FP32_ABS_MASK
+        if (abs > FP32_INF) return sign or E4M3_NAN
+        return sign or encodeMagnitude(abs, k, E4M3_MAN_BITS, E4M3_EXP_MIN, E4M3_MAX_ENCODING)
+    }
+
+    /** E2M1 nibble for `Float.fromBits(bits) × 2^(−k)`. */
+    fun encodeE2M1(bits: Int, k: Int): Int {
+        val abs = bits and FP32_ABS_MASK
+        if (abs > FP32_INF) return 0
+        val sign = (bits ushr 28) and 0x8
+        return sign or encodeMagnitude(abs, k, E2M1_MAN_BITS, E2M1_EXP_MIN, E2M1_MAX_ENCODING)
+    }
+
+    /** Decode an E4M3 byte to binary32 bits (exact). */
+    fun decodeE4M3Bits(bits: Int): Int {
+        val sign = (bits and 0x80) shl 24
+        val mag = bits and 0x7F
+        if (mag == E4M3_NAN) return sign or 0x7FC00000
+        return sign or decodeMagnitudeBits(mag, E4M3_MAN_BITS, E4M3_EXP_MIN)
+    }
+
+    /** Decode an E2M1 nibble to binary32 bits (exact). */
+    fun decodeE2M1Bits(bits: Int): Int {
+        val sign = (bits and 0x8) shl 28
+        return sign or decodeMagnitudeBits(bits and 0x7, E2M1_MAN_BITS, E2M1_EXP_MIN)
+    }
+
+    /** |x| bit pattern of a finite binary32 [bits], or 0 for NaN and ±Inf (block-maximum key). */
+    fun finiteMagnitudeBits(bits: Int): Int {
+        val abs = bits and FP32_ABS_MASK
+        return if (abs < FP32_INF) abs else 0
+    }
+
+    /** One E2M1 storage byte: element `2i` in the low nibble, `2i + 1` in the high nibble. */
+    fun packE2M1Pair(even: Int, odd: Int): Int = (even and 0xF) or ((odd and 0xF) shl 4)
+
+    /** E2M1 nibble [index] (0 = low, 1 = high) of a storage byte. */
+    fun unpackE2M1(byte: Int, index: Int): Int = (byte ushr (index shl 2)) and 0xF
+
+    /**
+     * Round `m × 2^(e − 23)` (the finite magnitude [abs] scaled by 2^−k) to a
+     * format with [manBits] mantissa bits and minimum normal exponent [eMin].
+     *
+     * The quantum is `2^(max(floor(log2 v), eMin) − manBits)`; the rounded
+     * count of quanta, added to the binade offset, is the encoding, and a
+     * mantissa carry rolls into the exponent field on its own.
+     */
+    private fun encodeMagnitude(abs: Int, k: Int, manBits: Int, eMin: Int, maxEnc: Int): Int {
+        if (abs == 0) return 0
+        if (abs == FP32_INF) return maxEnc
+        val expField = abs ushr FP32_MAN_BITS
+        val m = if (expField == 0) abs else (abs and FP32_FRAC_MASK) or FP32_IMPLICIT
+        val e = (if (expField == 0) 1 - FP32_EXP_BIAS else expField - FP32_EXP_BIAS) - k
+        val log2 = e - FP32_MAN_BITS + (31 - m.countLeadingZeroBits())
+        val et = if (log2 > eMin) log2 else eMin
+        if (et - eMin > 16) return maxEnc
+        val sh = FP32_MAN_BITS + et - manBits - e
+        val count = when {
+            sh <= 0 -> m shl -sh
+            sh >= 25 -> 0
+            else -> {
+                val q = m ushr sh
+                val rem = m and ((1 shl sh) - 1)
+                val half = 1 shl (sh - 1)
+                q + (if (rem > half || (rem == half && (q and 1) != 0)) 1 else 0)
+            }
+        }
+        val enc = ((et - eMin) shl manBits) + count
+        return if (enc > maxEnc) maxEnc else enc
+    }
+
+    private fun decodeMagnitudeBits(mag: Int, manBits: Int, eMin: Int): Int {
+        if (mag == 0) return 0
+        val expField = mag ushr manBits
+        val man = mag and ((1 shl manBits) - 1)
+        // Subnormal: man × 2^(eMin − manBits), normalized into binary32
+        if (expField == 0) {
+            val lead = 31 - man.countLeadingZeroBits()
+            val frac = (man shl (FP32_MAN_BITS - lead)) and FP32_FRAC_MASK
+            return ((eMin - manBits + lead + FP32_EXP_BIAS) shl FP32_MAN_BITS) or frac
+        }
+        val exp = eMin + expField - 1
+        return ((exp + FP32_EXP_BIAS) shl FP32_MAN_BITS) or (man shl (FP32_MAN_BITS - manBits))
+    }
+}
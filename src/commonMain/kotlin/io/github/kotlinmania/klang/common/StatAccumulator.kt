@@ -0,0 +1,185 @@
+package io.github.kotlinmania.klang.common
+
+import kotlin.math.abs
+import kotlin.math.sqrt
+
+/**
+ * StatAccumulator: Single-pass, mergeable descriptive statistics.
+ *
+ * Maintains count, mean, M2 (sum of squared deviations from the mean), min,
+ * max and the absolute deviation about a fixed [center], updating all of them
+ * in one pass with Welford's recurrence. Two accumulators over disjoint data
+ * combine exactly with [merge] (Chan, Golub & LeVeque 1979), so chunks of a
+ * stream, or of an array split across coroutines, can be reduced
+ * independently and folded together afterwards.
+ *
+ * ## Usage Example
+ *
+ * ### Streaming
+ * ```kotlin
+ * val acc = StatAccumulator()
+ * for (chunk in chunks) acc.addAll(chunk)
+ * val std = acc.standardDeviation
+ * ```
+ *
+ * ### Chunked Merge
+ * ```kotlin
+ * val left = StatAccumulator().apply { addAll(data, 0, half) }
+ * val right = StatAccumulator().apply { addAll(data, half, data.size - half) }
+ * left.merge(right)   // same statistics as one pass over data
+ * ```
+ *
+ * ## Absolute Deviation
+ *
+ * The mean absolute deviation about the data's *own* mean needs that mean
+ * before the first element is seen, so it cannot be computed in one pass.
+ * The accumulator instead sums `|x - center|` for a center fixed at
+ * construction — typically the mean of a previous batch in streaming
+ * normalization. For the exact two-pass value use
+ * [StatOps.meanAbsoluteDeviation] with `mean = acc.mean.toFloat()`.
+ *
+ * ## Precision
+ *
+ * State is kept in Double, so sums over billions of Float values do not
+ * stall the way a Float running sum does.
+ *
+ * @property center Reference point for [meanAbsoluteDeviation]
+ * @since 0.1.0
+ */
+class StatAccumulator(val center: Float = 0.0f) {
+    /** Number of values seen. */
+    var count: Long = 0
+        private set
+
+    /** Running mean (0.0 when empty). */
+    var mean: Double = 0.0
+        private set
+
+    /** Sum of squared deviations from [mean]. */
+    var m2: Double = 0.0
+        private set
+
+    /** Sum of `|x - center|`. */
+    var absDeviationSum: Double = 0.0
+        private set
+
+    /** Smallest value seen ([Float.POSITIVE_INFINITY] when empty). */
+    var min: Float = Float.POSITIVE_INFINITY
+        private set
+
+    /** Largest value seen ([Float.NEGATIVE_INFINITY] when empty). */
+    var max: Float = Float.NEGATIVE_INFINITY
+        private set
+
+    /** Population variance `M2 / n` (0.0 when empty). */
+    val variance: Double get() = if (count == 0L) 0.0 else m2 / count
+
+    /** Sample variance `M2 / (n - 1)` (0.0 for fewer than two values). */
+    val sampleVariance: Double get() = if (count < 2L) 0.0 else m2 / (count - 1)
+
+    /** Population standard deviation. */
+    val standardDeviation: Double get() = sqrt(variance)
+
+    /** Mean of `|x - center|` (0.0 when empty). */
+    val meanAbsoluteDeviation: Double get() = if (count == 0L) 0.0 else absDeviationSum / count
+
+    /** Add one value. */
+    fun add(value: Float) {
+        val x = value.toDouble()
+        count++
+        val delta = x - mean
+        mean += delta / count
+        m2 += delta * (x - mean)
+        absDeviationSum += abs(value - center).toDouble()
+        min = minOf(min, value)
+        max = maxOf(max, value)
+    }
+
+    /**
+     * Add `values[offset until offset + length]` in one pass.
+     *
+     * Same result as calling [add] per element; state is held in locals for
+     * the duration of the loop.
+     */
+    fun addAll(values: FloatArray, offset: Int = 0, length: Int = values.size - offset) {
+        require(offset >= 0 && length >= 0 && offset + length <= values.size)
+        var n = count
+        var mu = mean
+        var sq = m2
+        var absSum = absDeviationSum
+        var lo = min
+        var hi = max
+        val c = center
+        for (i in offset until offset + length) {
+            val v = values[i]
+            val x = v.toDouble()
+            n++
+            val delta = x - mu
+            mu += delta / n
+            sq += delta * (x - mu)
+            absSum += abs(v - c).toDouble()
+            lo = minOf(lo, v)
+            hi = maxOf(hi, v)
+        }
+        count = n
+        mean = mu
+        m2 = sq
+        absDeviationSum = absSum
+        min = lo
+        max = hi
+    }
+
+    /**
+     * Fold [other] into this accumulator (Chan et al. pairwise update).
+     *
+     * ```
+     * n     = nA + nB
+     * delta = meanB - meanA
+     * mean  = meanA + delta * nB / n
+     * M2    = M2A + M2B + delta² * nA * nB / n
+     * ```
+     *
+     * Merging in a fixed order gives a deterministic result regardless of
+     * how the chunks were scheduled.
+     *
+     * @throws IllegalArgumentException if the two accumulators use different centers
+     */
+    fun merge(other: StatAccumulator) {
+        require(center == other.center || center.isNaN() && other.center.isNaN()) {
+            "Cannot merge absolute deviations about different centers ($center vs ${other.center})"
+        }
+        if (other.count == 0L) return
+        if (count == 0L) {
+            count = other.count
+            mean = other.mean
+            m2 = other.m2
+            absDeviationSum = other.absDeviationSum
+            min = other.min
+            max = other.max
+            return
+        }
+        val nA = count.toDouble()
+        val nB = other.count.toDouble()
+        val n = nA + nB
+        val delta = other.mean - mean
+        mean += delta * (nB / n)
+        m2 += other.m2 + delta * delta * (nA * nB / n)
+        count += other.count
+        absDeviationSum += other.absDeviationSum
+        min = minOf(min, other.min)
+        max = maxOf(max, other.max)
+    }
+
+    /** Clear all state, keeping [center]. */
+    fun reset() {
+        count = 0
+        mean = 0.0
+        m2 = 0.0
+        absDeviationSum = 0.0
+        min = Float.POSITIVE_INFINITY
+        max = Float.NEGATIVE_INFINITY
+    }
+
+    override fun toString(): String =
+        "StatAccumulator(count=$count, mean=$mean, variance=$variance, min=$min, max=$max, mad@$center=$meanAbsoluteDeviation)"
+}
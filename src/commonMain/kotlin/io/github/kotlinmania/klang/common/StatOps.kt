@@ -1,5 +1,9 @@
 package io.github.kotlinmania.klang.common
 
+import kotlinx.coroutines.CoroutineDispatcher
+import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.coroutineScope
+import kotlinx.coroutines.launch
 import kotlin.math.abs
 import kotlin.random.Random
 
@@ -25,6 +29,7 @@ import kotlin.random.Random
  * | Mean | Σx / n | O(n) |
  * | Variance | Σ(x-μ)² / n | O(n) |
  * | MAD | Σ\|x-μ\| / n | O(n) |
+ * | Describe | count, mean, M2, min, max, Σ\|x-c\| | O(n) |
  * | Uniform Random | min + u*(max-min) | O(1) |
  *
  * ## Usage Example
@@ -58,6 +63,15 @@ import kotlin.random.Random
  * }
  * ```
  *
+ * ### One-Pass Summary
+ * ```kotlin
+ * val stats = StatOps.describe(data)             // StatAccumulator
+ * val (mu, sigma) = stats.mean to stats.standardDeviation
+ *
+ * // Large arrays: reduce chunks on coroutines, merge in chunk order
+ * val big = StatOps.describeParallel(samples, parallelism = 8)
+ * ```
+ *
  * ### Random Initialization
  * ```kotlin
  * val random = Random(42)
@@ -68,14 +82,23 @@ import kotlin.random.Random
  *
  * ## Performance
  *
- * All operations are single-pass (except when mean must be computed first):
  * - **Mean**: 1 pass through data
- * - **Variance**: 2 passes (1 for mean, 1 for variance) or 1 if mean provided
- * - **MAD**: 2 passes (1 for mean, 1 for MAD) or 1 if mean provided
+ * - **Variance**: 1 pass (Welford via [StatAccumulator]), or 1 pass about a provided mean
+ * - **MAD**: 2 passes (1 for mean, 1 for MAD) or 1 if mean provided; the
+ *   deviation about the data's own mean is not computable in one pass
+ * - **Describe**: 1 pass for count/mean/variance/min/max and the absolute
+ *   deviation about a fixed center; [describeParallel] splits that pass
+ *   across [parallelDispatcher] and merges with [StatAccumulator.merge]
  *
  * @since 0.1.0
  */
 object StatOps {
+    // Heuristics for parallel fanout (same as ArrayBitShifts)
+    private const val MIN_PAR_CHUNK: Int = 8192
+
+    // Coroutines (multiplatform)
+    var parallelDispatcher: CoroutineDispatcher = Dispatchers.Default
+
     /**
      * Compute the arithmetic mean (average) of values.
      *
@@ -123,22 +146,25 @@ object StatOps {
      * ```
      *
      * ## Performance Tip
-     * If you already computed the mean, pass it to avoid recomputation:
+     * Without [mean] the variance is computed in a single Welford pass
+     * (Double state, see [StatAccumulator]). With [mean] it is a single pass
+     * of squared deviations about that value:
      * ```kotlin
      * val m = StatOps.mean(data)
-     * val v = StatOps.variance(data, mean = m)  // Saves one pass
+     * val v = StatOps.variance(data, mean = m)
      * ```
      *
      * @param values Array of Float values
      * @param offset Starting index (default: 0)
      * @param length Number of elements (default: values.size - offset)
-     * @param mean Pre-computed mean (default: computed automatically)
+     * @param mean Pre-computed mean (default: null, one-pass Welford)
      * @return Variance, or 0.0 if length is 0
      * @throws IllegalArgumentException if offset/length invalid
      */
-    fun variance(values: FloatArray, offset: Int = 0, length: Int = values.size - offset, mean: Float = mean(values, offset, length)): Float {
+    fun variance(values: FloatArray, offset: Int = 0, length: Int = values.size - offset, mean: Float? = null): Float {
         require(offset >= 0 && length >= 0 && offset + length <= values.size)
         if (length == 0) return 0.0f
+        if (mean == null) return describe(values, offset, length).variance.toFloat()
         var acc = 0.0f
         for (i in 0 until length) {
             val delta = values[offset + i] - mean
@@ -189,6 +215,76 @@ object StatOps {
         return acc / length
     }
 
+    /**
+     * One-pass descriptive statistics of `values[offset until offset + length]`.
+     *
+     * ## Example
+     * ```kotlin
+     * val s = StatOps.describe(floatArrayOf(1.0f, 2.0f, 3.0f, 4.0f, 5.0f), center = 3.0f)
+     * // s.mean = 3.0, s.variance = 2.0, s.min = 1.0, s.max = 5.0, s.meanAbsoluteDeviation = 1.2
+     * ```
+     *
+     * @param values Array of Float values
+     * @param offset Starting index (default: 0)
+     * @param length Number of elements (default: values.size - offset)
+     * @param center Reference point for the absolute deviation (default: 0.0)
+     * @return Accumulator holding the statistics; further data may be added or merged
+     * @throws IllegalArgumentException if offset/length invalid
+     */
+    fun describe(values: FloatArray, offset: Int = 0, length: Int = values.size - offset, center: Float = 0.0f): StatAccumulator {
+        val acc = StatAccumulator(center)
+        acc.addAll(values, offset, length)
+        return acc
+    }
+
+    /**
+     * Parallel [describe] using coroutines. Works best for large arrays (len >= ~64K).
+     *
+     * Each chunk is reduced into its own [StatAccumulator] on [parallelDispatcher];
+     * the partials are then merged in chunk order, so the result depends only on
+     * the chunk count, never on scheduling. Falls back to [describe] below
+     * 8192 elements.
+     *
+     * @param parallelism Requested chunk count (default: 0 → 4, capped at 8)
+     * @throws IllegalArgumentException if offset/length invalid
+     */
+    suspend fun describeParallel(
+        values: FloatArray,
+        offset: Int = 0,
+        length: Int = values.size - offset,
+        center: Float = 0.0f,
+        parallelism: Int = 0,
+    ): StatAccumulator {
+        require(offset >= 0 && length >= 0 && offset + length <= values.size)
+
+        fun decideChunks(n: Int): Int {
+            if (n < MIN_PAR_CHUNK) return 1
+            val target = if (parallelism > 0) parallelism else 4
+            val maxChunks = target.coerceAtMost(8)
+            val bySize = (n / MIN_PAR_CHUNK).coerceAtLeast(1)
+            return bySize.coerceAtMost(maxChunks)
+        }
+
+        val chunks = decideChunks(length)
+        if (chunks == 1) return describe(values, offset, length, center)
+
+        val partials = Array(chunks) { StatAccumulator(center) }
+        val chunkSize = (length + chunks - 1) / chunks
+        coroutineScope {
+            for (ck in 0 until chunks) {
+                val start = ck * chunkSize
+                val end = minOf(length, start + chunkSize)
+                if (start >= end) continue
+                launch(context = parallelDispatcher) {
+                    partials[ck].addAll(values, offset + start, end - start)
+                }
+            }
+        }
+        val result = partials[0]
+        for (ck in 1 until chunks) result.merge(partials[ck])
+        return result
+    }
+
     /**
      * Generate a random Float uniformly distributed in [min, max].
      *
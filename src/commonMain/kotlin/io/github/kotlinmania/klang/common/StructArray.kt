@@ -0,0 +1,350 @@
+package io.github.kotlinmania.klang.common
+
+import io.github.kotlinmania.klang.mem.GlobalHeap
+
+/**
+ * How a [StructArray] places its records in memory.
+ *
+ * ```
+ * AOS        x0 y0 m0 | x1 y1 m1 | x2 y2 m2 | x3 y3 m3        (C array of structs)
+ * SOA        x0 x1 x2 x3 | y0 y1 y2 y3 | m0 m1 m2 m3          (one column per field)
+ * AOSOA(2)   x0 x1 y0 y1 m0 m1 | x2 x3 y2 y3 m2 m3            (columns per block)
+ * ```
+ */
+sealed interface StructArrayMode {
+    /** Array of structs: record `i` is `layout.size` bytes at `base + i * size`. */
+    data object AOS : StructArrayMode
+
+    /** Struct of arrays: each field is one contiguous column. */
+    data object SOA : StructArrayMode
+
+    /**
+     * Array of struct-of-arrays: [block] records (a power of two) per
+     * block, each block laid out as SOA.
+     */
+    data class AOSOA(val block: Int) : StructArrayMode {
+        init {
+            require(block > 0 && (block and (block - 1)) == 0) { "AOSOA block must be a power of two, was $block" }
+        }
+    }
+}
+
+/**
+ * StructArray: [count] records of one [StructLayout.Layout] on [GlobalHeap],
+ * laid out as AOS, SOA or AOSOA.
+ *
+ * Every mode resolves a field address with the same strength-reduced form:
+ *
+ * ```
+ * addr(i, f) = base + (i >>> shift) * blockStride + fieldBase[f] + (i & mask) * step[f]
+ * ```
+ *
+ * AOS is one record per block, SOA is a single block holding the whole
+ * array, and AOSOA(B) has `shift = log2(B)`. All the tables are computed at
+ * construction, so [fieldAddr] is a shift, a mask and two multiply-adds, and
+ * [cursor] / [forEachField] walk a field with one add per element (plus a
+ * jump per block).
+ *
+ * Code ported from C keeps addressing fields by index; only the
+ * [StructArrayMode] passed at allocation changes, and [copyTo] / [convert]
+ * move existing data between modes.
+ *
+ * ## Column Runs
+ *
+ * In SOA and AOSOA a field's elements are contiguous within a block, so
+ * [readFloats] / [writeFloats] (and the Int / Double variants) move whole
+ * runs with one bulk [GlobalHeap] transfer per block. In AOS they fall back
+ * to a strided loop.
+ *
+ * @property base Heap address of the first byte
+ * @property layout Record layout
+ * @property count Number of records
+ * @property mode Placement of records
+ * @see StructLayout.arrayOf For allocation
+ */
+class StructArray(
+    val base: Int,
+    val layout: StructLayout.Layout,
+    val count: Int,
+    val mode: StructArrayMode,
+) {
+    init {
+        require(count >= 0) { "count must be non-negative" }
+        require(layout.fieldSizes.size == layout.offsets.size) { "Layout needs one size per field" }
+    }
+
+    /** Number of fields per record. */
+    val fieldCount: Int get() = layout.offsets.size
+
+    private val shift: Int
+    private val blockStride: Int
+    private val fieldBase = IntArray(fieldCount)
+    private val step = IntArray(fieldCount)
+
+    /** `index and mask` is the position inside the block. */
+    @PublishedApi
+    internal val mask: Int
+
+    /** Records per block ([Int.MAX_VALUE] when the array is one block). */
+    @PublishedApi
+    internal val blockLen: Int
+
+    init {
+        val sizes = layout.fieldSizes
+        when (mode) {
+            StructArrayMode.AOS -> {
+                shift = 0
+                mask = 0
+                blockLen = 1
+                blockStride = layout.size
+                layout.offsets.copyInto(fieldBase)
+            }
+            StructArrayMode.SOA -> {
+                shift = 31
+                mask = Int.MAX_VALUE
+                blockLen = Int.MAX_VALUE
+                blockStride = 0
+                columns(count, sizes)
+            }
+            is StructArrayMode.AOSOA -> {
+                shift = mode.block.countTrailingZeroBits()
+                mask = mode.block - 1
+                blockLen = mode.block
+                blockStride = columns(mode.block, sizes)
+            }
+        }
+    }
+
+    /** Lay out one column per field for [n] records; returns the block size. */
+    private fun columns(n: Int, sizes: IntArray): Int {
+        var at = 0
+        for (f in 0 until fieldCount) {
+            fieldBase[f] = at
+            step[f] = sizes[f]
+            at = alignUp(at + n * sizes[f], layout.align)
+        }
+        return at
+    }
+
+    /** Total bytes spanned by the array. */
+    val byteSize: Int get() = byteSize(layout, count, mode)
+
+    /** Heap address of field [field] of record [index]. */
+    fun fieldAddr(index: Int, field: Int): Int =
+        base + (index ushr shift) * blockStride + fieldBase[field] + (index and mask) * step[field]
+
+    // ========== Typed Field Access ==========
+
+    fun getByte(index: Int, field: Int): Byte = GlobalHeap.lb(fieldAddr(index, field))
+    fun setByte(index: Int, field: Int, value: Byte) = GlobalHeap.sb(fieldAddr(index, field), value)
+    fun getShort(index: Int, field: Int): Short = GlobalHeap.lh(fieldAddr(index, field))
+    fun setShort(index: Int, field: Int, value: Short) = GlobalHeap.sh(fieldAddr(index, field), value)
+    fun getInt(index: Int, field: Int): Int = GlobalHeap.lw(fieldAddr(index, field))
+    fun setInt(index: Int, field: Int, value: Int) = GlobalHeap.sw(fieldAddr(index, field), value)
+    fun getLong(index: Int, field: Int): Long = GlobalHeap.ld(fieldAddr(index, field))
+    fun setLong(index: Int, field: Int, value: Long) = GlobalHeap.sd(fieldAddr(index, field), value)
+    fun getFloat(index: Int, field: Int): Float = GlobalHeap.lwf(fieldAddr(index, field))
+    fun setFloat(index: Int, field: Int, value: Float) = GlobalHeap.swf(fieldAddr(index, field), value)
+    fun getDouble(index: Int, field: Int): Double = GlobalHeap.ldf(fieldAddr(index, field))
+    fun setDouble(index: Int, field: Int, value: Double) = GlobalHeap.sdf(fieldAddr(index, field), value)
+
+    // ========== Iteration ==========
+
+    /**
+     * FieldCursor: walks one field of consecutive records, one add per step.
+     *
+     * ```kotlin
+     * val c = arr.cursor(field = 1)
+     * repeat(arr.count) { sum += GlobalHeap.lwf(c.addr); c.advance() }
+     * ```
+     */
+    inner class FieldCursor internal constructor(field: Int, start: Int) {
+        private val elemStep = step[field]
+        private val blockJump = blockStride - (blockLen - 1) * elemStep
+        private var inBlock = start and mask
+
+        /** Address of the field in the current record. */
+        var addr: Int = fieldAddr(start, field)
+            private set
+
+        /** Move to the next record. */
+        fun advance() {
+            if (++inBlock == blockLen) {
+                inBlock = 0
+                addr += blockJump
+            } else {
+                addr += elemStep
+            }
+        }
+    }
+
+    /** Cursor on [field], positioned at record [start]. */
+    fun cursor(field: Int, start: Int = 0): FieldCursor = FieldCursor(field, start)
+
+    /** Call [action] with each record index in `[from, to)` and the address of its [field]. */
+    inline fun forEachField(field: Int, from: Int = 0, to: Int = count, action: (index: Int, addr: Int) -> Unit) {
+        require(from in 0..to && to <= count) { "Range [$from, $to) out of bounds for $count records" }
+        forEachRun(field, from, to) { start, addr, n, stride ->
+            var a = addr
+            for (i in start until start + n) {
+                action(i, a)
+                a += stride
+            }
+        }
+    }
+
+    /**
+     * Split `[from, to)` into runs inside one block and call [run] with the
+     * first index, its field address, the run length and the element stride.
+     */
+    @PublishedApi
+    internal inline fun forEachRun(field: Int, from: Int, to: Int, run: (start: Int, addr: Int, n: Int, stride: Int) -> Unit) {
+        if (mode == StructArrayMode.AOS) {
+            if (to > from) run(from, fieldAddr(from, field), to - from, layout.size)
+            return
+        }
+        val stride = fieldStep(field)
+        var i = from
+        while (i < to) {
+            val n = minOf(to - i, blockLen - (i and mask))
+            run(i, fieldAddr(i, field), n, stride)
+            i += n
+        }
+    }
+
+    @PublishedApi
+    internal fun fieldStep(field: Int): Int = step[field]
+
+    // ========== Column Transfer ==========
+
+    /** Load [field] of records `[from, from + n)` into `dst[off, off + n)` as floats. */
+    fun readFloats(field: Int, dst: FloatArray, off: Int = 0, from: Int = 0, n: Int = count - from) {
+        checkColumn(field, 4, dst.size, off, from, n)
+        forEachRun(field, from, from + n) { start, addr, len, stride ->
+            val o = off + start - from
+            if (stride == 4) GlobalHeap.readFloats(addr, dst, o, len)
+            else for (k in 0 until len) dst[o + k] = GlobalHeap.lwf(addr + k * stride)
+        }
+    }
+
+    /** Store `src[off, off + n)` into [field] of records `[from, from + n)` as floats. */
+    fun writeFloats(field: Int, src: FloatArray, off: Int = 0, from: Int = 0, n: Int = count - from) {
+        checkColumn(field, 4, src.size, off, from, n)
+        forEachRun(field, from, from + n) { start, addr, len, stride ->
+            val o = off + start - from
+            if (stride == 4) GlobalHeap.writeFloats(addr, src, o, len)
+            else for (k in 0 until len) GlobalHeap.swf(addr + k * stride, src[o + k])
+        }
+    }
+
+    /** Load [field] of records `[from, from + n)` into `dst[off, off + n)` as ints. */
+    fun readInts(field: Int, dst: IntArray, off: Int = 0, from: Int = 0, n: Int = count - from) {
+        checkColumn(field, 4, dst.size, off, from, n)
+        forEachRun(field, from, from + n) { start, addr, len, stride ->
+            val o = off + start - from
+            if (stride == 4) GlobalHeap.readInts(addr, dst, o, len)
+            else for (k in 0 until len) dst[o + k] = GlobalHeap.lw(addr + k * stride)
+        }
+    }
+
+    /** Store `src[off, off + n)` into [field] of records `[from, from + n)` as ints. */
+    fun writeInts(field: Int, src: IntArray, off: Int = 0, from: Int = 0, n: Int = count - from) {
+        checkColumn(field, 4, src.size, off, from, n)
+        forEachRun(field, from, from + n) { start, addr, len, stride ->
+            val o = off + start - from
+            if (stride == 4) GlobalHeap.writeInts(addr, src, o, len)
+            else for (k in 0 until len) GlobalHeap.sw(addr + k * stride, src[o + k])
+        }
+    }
+
+    /** Load [field] of records `[from, from + n)` into `dst[off, off + n)` as doubles. */
+    fun readDoubles(field: Int, dst: DoubleArray, off: Int = 0, from: Int = 0, n: Int = count - from) {
+        checkColumn(field, 8, dst.size, off, from, n)
+        forEachRun(field, from, from + n) { start, addr, len, stride ->
+            val o = off + start - from
+            if (stride == 8) GlobalHeap.readDoubles(addr, dst, o, len)
+            else for (k in 0 until len) dst[o + k] = GlobalHeap.ldf(addr + k * stride)
+        }
+    }
+
+    /** Store `src[off, off + n)` into [field] of records `[from, from + n)` as doubles. */
+    fun writeDoubles(field: Int, src: DoubleArray, off: Int = 0, from: Int = 0, n: Int = count - from) {
+        checkColumn(field, 8, src.size, off, from, n)
+        forEachRun(field, from, from + n) { start, addr, len, stride ->
+            val o = off + start - from
+            if (stride == 8) GlobalHeap.writeDoubles(addr, src, o, len)
+            else for (k in 0 until len) GlobalHeap.sdf(addr + k * stride, src[o + k])
+        }
+    }
+
+    private fun checkColumn(field: Int, width: Int, arraySize: Int, off: Int, from: Int, n: Int) {
+        require(field in 0 until fieldCount) { "No field $field" }
+        require(layout.fieldSizes[field] >= width) { "Field $field is ${layout.fieldSizes[field]} bytes, need $width" }
+        require(n >= 0 && from >= 0 && from <= count - n) { "Records [$from, ${from + n}) out of bounds for $count" }
+        require(off >= 0 && off <= arraySize - n) { "Array slice out of bounds: off=$off, n=$n, size=$arraySize" }
+    }
+
+    // ========== Layout Conversion ==========
+
+    /**
+     * Copy every record into [dst], which must have the same field sizes and
+     * count; its mode may differ. Wherever both sides hold a field
+     * contiguously (SOA / AOSOA) the copy is one `memcpy` per overlapping
+     * run; otherwise fields move with one typed load/store each.
+     */
+    fun copyTo(dst: StructArray) {
+        require(dst.count == count && dst.layout.fieldSizes.contentEquals(layout.fieldSizes)) {
+            "Destination must hold the same fields and record count"
+        }
+        if (dst.mode == mode && dst.layout.offsets.contentEquals(layout.offsets) && dst.layout.size == layout.size) {
+            GlobalHeap.memmove(dst.base, base, byteSize)
+            return
+        }
+        for (f in 0 until fieldCount) {
+            val size = layout.fieldSizes[f]
+            forEachRun(f, 0, count) { start, srcAddr, n, srcStride ->
+                dst.forEachRun(f, start, start + n) { dStart, dstAddr, m, dstStride ->
+                    val s = srcAddr + (dStart - start) * srcStride
+                    if (srcStride == size && dstStride == size) {
+                        GlobalHeap.memmove(dstAddr, s, m * size)
+                    } else {
+                        for (k in 0 until m) copyField(dstAddr + k * dstStride, s + k * srcStride, size)
+                    }
+                }
+            }
+        }
+    }
+
+    /** New array of the same records in [mode], allocated like [StructLayout.arrayOf]. */
+    fun convert(mode: StructArrayMode): StructArray =
+        StructLayout.arrayOf(layout, count, mode).also { copyTo(it) }
+
+    private fun copyField(dst: Int, src: Int, size: Int) {
+        when (size) {
+            1 -> GlobalHeap.sb(dst, GlobalHeap.lb(src))
+            2 -> GlobalHeap.sh(dst, GlobalHeap.lh(src))
+            4 -> GlobalHeap.sw(dst, GlobalHeap.lw(src))
+            8 -> GlobalHeap.sd(dst, GlobalHeap.ld(src))
+            else -> GlobalHeap.memmove(dst, src, size)
+        }
+    }
+
+    companion object {
+        /** Bytes needed for [count] records of [layout] in [mode]. */
+        fun byteSize(layout: StructLayout.Layout, count: Int, mode: StructArrayMode): Int {
+            val sizes = layout.fieldSizes
+            fun columnBytes(n: Int): Int {
+                var at = 0
+                for (s in sizes) at = alignUp(at + n * s, layout.align)
+                return at
+            }
+            return when (mode) {
+                StructArrayMode.AOS -> count * layout.size
+                StructArrayMode.SOA -> columnBytes(count)
+                is StructArrayMode.AOSOA -> ((count + mode.block - 1) / mode.block) * columnBytes(mode.block)
+            }
+        }
+
+        private fun alignUp(x: Int, align: Int): Int = ((x + (align - 1)) / align) * align
+    }
+}
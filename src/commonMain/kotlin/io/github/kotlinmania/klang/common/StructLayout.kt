@@ -1,6 +1,7 @@
 package io.github.kotlinmania.klang.common
 
 import io.github.kotlinmania.klang.mem.GlobalHeap
+import io.github.kotlinmania.klang.mem.KRegion
 
 /**
  * StructLayout: C-style struct/union layout computation with natural alignment.
@@ -141,8 +142,16 @@ object StructLayout {
      * @property offsets Array of byte offsets for each field
      * @property size Total size in bytes (including padding)
      * @property align Overall alignment requirement in bytes
+     * @property fieldSizes Byte size of each field. [layoutStruct] and
+     *   [layoutUnion] record the declared sizes; a hand-built layout defaults
+     *   to the distance to the next field (or the end), padding included.
      */
-    data class Layout(val offsets: IntArray, val size: Int, val align: Int)
+    data class Layout(
+        val offsets: IntArray,
+        val size: Int,
+        val align: Int,
+        val fieldSizes: IntArray = gapSizes(offsets, size),
+    )
 
     /**
      * Compute natural-aligned struct layout.
@@ -176,7 +185,7 @@ object StructLayout {
             offset = aligned + f.size
         }
         val total = ((offset + (maxAlign - 1)) / maxAlign) * maxAlign
-        return Layout(offsets, total, maxAlign)
+        return Layout(offsets, total, maxAlign, IntArray(fields.size) { fields[it].size })
     }
 
     /**
@@ -203,14 +212,16 @@ object StructLayout {
         var align = 1
         for (f in fields) { size = maxOf(size, f.size); align = maxOf(align, f.align) }
         val total = ((size + (align - 1)) / align) * align
-        return Layout(IntArray(fields.size) { 0 }, total, align)
+        return Layout(IntArray(fields.size) { 0 }, total, align, IntArray(fields.size) { fields[it].size })
     }
 
     /**
      * Allocate memory for a struct/union on the global heap.
      *
      * Allocates [layout.size] bytes on [GlobalHeap] and returns
-     * the base address. Caller is responsible for initialization.
+     * the base address, or bumps them from the bound [KRegion] (aligned
+     * to [Layout.align]) inside a [KRegion.withRegion] scope. Caller is
+     * responsible for initialization.
      *
      * ## Example
      * ```kotlin
@@ -223,5 +234,38 @@ object StructLayout {
      * @return Base address of allocated memory
      * @see GlobalHeap.malloc
      */
-    fun alloc(layout: Layout): Int = GlobalHeap.malloc(layout.size)
+    fun alloc(layout: Layout): Int = KRegion.current()?.alloc(layout.size, layout.align) ?: GlobalHeap.malloc(layout.size)
+
+    /**
+     * Allocate an array of [count] [layout] records in [mode] and return its
+     * accessor.
+     *
+     * Memory comes from the bound [KRegion] inside a [KRegion.withRegion]
+     * scope, otherwise from [GlobalHeap], aligned to [Layout.align] either way.
+     * Contents are uninitialized.
+     *
+     * ## Example
+     * ```kotlin
+     * val particle = layoutStruct(listOf(Field(4, 4), Field(4, 4), Field(8, 8)))  // x, y, mass
+     * val ps = arrayOf(particle, n, StructArrayMode.SOA)
+     * ps.writeFloats(0, xs)                  // one column copy
+     * ps.forEachField(2) { i, a -> GlobalHeap.sdf(a, masses[i]) }
+     * ```
+     *
+     * @see StructArray For addressing, cursors and layout conversion
+     */
+    fun arrayOf(layout: Layout, count: Int, mode: StructArrayMode = StructArrayMode.AOS): StructArray {
+        val bytes = StructArray.byteSize(layout, count, mode)
+        val a = layout.align
+        val base = KRegion.current()?.alloc(bytes, a)
+            ?: ((GlobalHeap.malloc(bytes + a - 1) + (a - 1)) / a) * a
+        return StructArray(base, layout, count, mode)
+    }
+}
+
+/** For each field, bytes from its offset to the next higher field offset (or [size]). */
+private fun gapSizes(offsets: IntArray, size: Int): IntArray = IntArray(offsets.size) { f ->
+    var next = size
+    for (o in offsets) if (o > offsets[f] && o < next) next = o
+    next - offsets[f]
 }
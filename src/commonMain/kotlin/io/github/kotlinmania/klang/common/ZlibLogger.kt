@@ -1,7 +1,16 @@
 @file:Suppress("ktlint:standard:property-naming")
 
+@file:OptIn(ExperimentalAtomicApi::class)
+
 package io.github.kotlinmania.klang.common
 
+import kotlinx.coroutines.channels.Channel
+import kotlinx.coroutines.flow.MutableStateFlow
+import kotlinx.coroutines.flow.first
+import kotlin.concurrent.Volatile
+import kotlin.concurrent.atomics.AtomicInt
+import kotlin.concurrent.atomics.ExperimentalAtomicApi
+
 /**
  * ZlibLogger: Cross-platform configurable logging system for KLang internals.
  *
@@ -34,32 +43,131 @@ package io.github.kotlinmania.klang.common
  * - **Checksums**: `logAdler32()`, `logCRC32()`
  * - **Bitwise**: `logBitwise()`, `logBitwiseOp()`
  *
+ * Each category has its own level bits (INFO, DEBUG, TRACE) packed into one
+ * `Long`, so "is this category at this level on?" is a single shift-and-test.
+ * The legacy flags are presets over those bits; [setCategoryLevel] refines
+ * them per category.
+ *
  * ## Usage Example
  *
  * ```kotlin
  * ZlibLogger.logInflate("Starting decompression", "decompress")
  * ZlibLogger.logBitwiseOp("shl", input=0x1234, shift=4, result=0x12340, "shiftLeft")
  * ZlibLogger.logAdler32Calc(s1=1, s2=0, byte=0x42, index=0, "updateChecksum")
+ *
+ * // Lazy form for inner loops: the lambda only runs when the category is on
+ * ZlibLogger.logHuffman("buildTree") { "symbol=$sym len=$len" }
+ * ZlibLogger.log(ZlibLogger.INF_CODES, ZlibLogger.LEVEL_TRACE, "inflateFast") { "lit=$lit" }
  * ```
  *
  * ## Performance
  *
- * When logging is disabled (default), all log calls are no-ops after a single
- * flag check. This makes it safe to leave logging calls in production code.
+ * - **Disabled**: The lazy overloads are `inline`; a disabled call is one
+ *   field load, a shift and a branch, with no lambda object, timestamp or
+ *   string built. The eager `String` overloads still pay for building their
+ *   argument at the call site.
+ * - **Enabled**: Lines are appended to a block buffer and written
+ *   [blockSize] characters at a time. On targets with threads (JVM, Android,
+ *   Native) full blocks are queued, in line order, to a writer coroutine on
+ *   its own thread; a producer that gets more than [queueBlocks] blocks
+ *   ahead of the writer parks (outside the buffer lock) until it catches
+ *   up, so lines are never dropped or reordered, and a failing [logToFile]
+ *   is skipped without stopping the writer. WASI writes each block
+ *   synchronously, and the JS targets keep writing line by line to the
+ *   console. Call [flush] before reading the log or exiting (JVM and Android
+ *   also flush from a shutdown hook).
  *
  * @see logToFile Platform-specific file output
  */
 object ZlibLogger {
-    // Logging flags (configurable via CLI/env)
+    // ===== Categories =====
+
+    const val GENERAL: Int = 0
+    const val INFLATE: Int = 1
+    const val DEFLATE: Int = 2
+    const val ZSTREAM: Int = 3
+    const val INF_BLOCKS: Int = 4
+    const val INF_CODES: Int = 5
+    const val INF_TREE: Int = 6
+    const val BITWISE: Int = 7
+    const val ADLER32: Int = 8
+    const val HUFFMAN: Int = 9
+    const val TREE: Int = 10
+    const val CRC32: Int = 11
+
+    /** Number of categories (16 level-bit slots are available). */
+    const val CATEGORY_COUNT: Int = 12
+
+    // ===== Levels (bit offset inside a category's 4-bit slot) =====
+
+    const val LEVEL_INFO: Int = 0
+    const val LEVEL_DEBUG: Int = 1
+    const val LEVEL_TRACE: Int = 2
+
+    private val CATEGORY_NAMES = arrayOf(
+        "", "Inflate", "Deflate", "ZStream", "InfBlocks", "InfCodes", "InfTree",
+        "BitwiseOps", "Adler32", "Huffman", "Tree", "CRC32",
+    )
+
+    /** Bit `category * 4 + level` set iff that category logs at that level. */
+    @PublishedApi
+    @Volatile
+    internal var enabledBits: Long = 0L
+
+    // Logging flags (configurable via CLI/env); each assignment re-applies the preset
     var ENABLE_LOGGING: Boolean = false
+        set(value) {
+            field = value
+            applyPreset()
+        }
     var DEBUG_ENABLED: Boolean = false
+        set(value) {
+            field = value
+            applyPreset()
+        }
     var BITWISE_VERBOSE: Boolean = false
+        set(value) {
+            field = value
+            applyPreset()
+        }
+
+    /** Characters buffered before a block is handed to the writer. */
+    @Volatile
+    var blockSize: Int = 64 * 1024
+        set(value) {
+            require(value > 0) { "blockSize must be positive" }
+            field = value
+        }
 
-    private var initialized = false
+    /** Full blocks the background writer may fall behind by before producers wait. */
+    var queueBlocks: Int = 16
+        set(value) {
+            require(value > 0) { "queueBlocks must be positive" }
+            field = value
+        }
+
+    private val pending = StringBuilder()
+    private val pendingLock = AtomicInt(0)
+
+    /** Background writer queue, in ticket order; null until first use. */
+    private var queue: Channel<String>? = null
+
+    /** Ticket of the last block handed to [queue] (guarded by the pending lock). */
+    private var ticket = 0L
+
+    /** Ticket of the last block the writer has finished; producers and [flush] park on it. */
+    private val writtenTicket = MutableStateFlow(0L)
+
+    /** Where finished blocks go; tests swap in a capturing sink. */
+    @Volatile
+    internal var blockSink: (String) -> Unit = ::logToFile
+
+    init {
+        initFromEnv()
+        installLogFlushHook { flush() }
+    }
 
     private fun initFromEnv() {
-        if (initialized) return
-        initialized = true
         try {
             getEnv("ZLIB_LOG_ENABLE")?.let { ENABLE_LOGGING = it == "1" || it.equals("true", true) }
             getEnv("ZLIB_LOG_DEBUG")?.let { DEBUG_ENABLED = it == "1" || it.equals("true", true) }
@@ -69,6 +177,54 @@ object ZlibLogger {
         }
     }
 
+    /**
+     * Rebuild [enabledBits] from the legacy flags:
+     * - ENABLE_LOGGING: INFO on every category except BITWISE
+     * - DEBUG_ENABLED: adds DEBUG (the `[DEBUG_LOG]` lines)
+     * - BITWISE_VERBOSE: turns BITWISE on at the same levels
+     */
+    private fun applyPreset() {
+        var levels = 0L
+        if (ENABLE_LOGGING) {
+            levels = 1L shl LEVEL_INFO
+            if (DEBUG_ENABLED) levels = levels or (1L shl LEVEL_DEBUG)
+        }
+        var bits = 0L
+        for (c in 0 until CATEGORY_COUNT) {
+            if (c == BITWISE && !BITWISE_VERBOSE) continue
+            bits = bits or (levels shl (c * 4))
+        }
+        enabledBits = bits
+    }
+
+    /** True if [category] logs at [level]: one shift and test. */
+    @Suppress("NOTHING_TO_INLINE")
+    inline fun isEnabled(category: Int, level: Int = LEVEL_INFO): Boolean =
+        (enabledBits ushr ((category shl 2) + level)) and 1L != 0L
+
+    /**
+     * Enable [category] at [level] and every lower level (INFO ≤ DEBUG ≤ TRACE);
+     * a negative level disables the category.
+     */
+    fun setCategoryLevel(category: Int, level: Int) {
+        require(category in 0 until CATEGORY_COUNT) { "unknown category $category" }
+        require(level <= LEVEL_TRACE) { "unknown level $level" }
+        val slot = 0xFL shl (category * 4)
+        val on = if (level < 0) 0L else ((1L shl (level + 1)) - 1) shl (category * 4)
+        enabledBits = (enabledBits and slot.inv()) or on
+    }
+
+    /**
+     * Lazily logs a message: [message] runs only if [category] is enabled at [level].
+     *
+     * @param category One of the category constants
+     * @param level LEVEL_INFO, LEVEL_DEBUG or LEVEL_TRACE
+     * @param functionName The originating function name (optional)
+     */
+    inline fun log(category: Int, level: Int = LEVEL_INFO, functionName: String = "", message: () -> String) {
+        if (isEnabled(category, level)) emit(category, functionName, message())
+    }
+
     /**
      * Logs a debug message (requires DEBUG_ENABLED).
      *
@@ -85,6 +241,8 @@ object ZlibLogger {
     /**
      * Logs a message with optional class and function context.
      *
+     * Messages starting with `[DEBUG_LOG]` are logged at DEBUG level.
+     *
      * @param message The log message.
      * @param className The originating class name (optional).
      * @param functionName The originating function name (optional).
@@ -94,91 +252,112 @@ object ZlibLogger {
         className: String = "",
         functionName: String = "",
     ) {
-        initFromEnv()
-        // Global logging gate
-        if (!ENABLE_LOGGING) return
-        // Suppress verbose debug logs unless explicitly enabled
-        if (!DEBUG_ENABLED && message.startsWith("[DEBUG_LOG]")) return
+        if (!isEnabled(GENERAL, levelOf(message))) return
+        writeLine(className, functionName, message)
+    }
 
-        val timestamp = currentTimestamp()
-        val location =
-            if (className.isNotEmpty() || functionName.isNotEmpty()) {
-                val cls = className.ifEmpty { "Unknown" }
-                val func = functionName.ifEmpty { "unknown" }
-                "[$cls::$func] "
-            } else {
-                ""
-            }
-        val line = "[$timestamp] $location$message\n"
+    /**
+     * Write any buffered lines and wait until the background writer has
+     * written every block queued before this call.
+     */
+    fun flush() {
+        var block: String? = null
+        var last = 0L
+        lockPending()
         try {
-            logToFile(line)
-        } catch (_: Exception) {
-            // Ignore logging errors
+            if (pending.isNotEmpty()) block = takePending()
+            last = if (block != null) handOff(block) else ticket
+        } finally {
+            unlockPending()
         }
+        if (logWriterMode != LogWriterMode.BACKGROUND) {
+            if (block != null) writeBlock(block)
+            return
+        }
+        awaitWritten(last)
     }
 
     // Convenience methods for specific classes to make logging easier
     fun logInflate(
         message: String,
         functionName: String = "",
-    ) = log(message, "Inflate", functionName)
+    ) = logString(INFLATE, message, functionName)
 
     fun logDeflate(
         message: String,
         functionName: String = "",
-    ) = log(message, "Deflate", functionName)
+    ) = logString(DEFLATE, message, functionName)
 
     fun logZStream(
         message: String,
         functionName: String = "",
-    ) = log(message, "ZStream", functionName)
+    ) = logString(ZSTREAM, message, functionName)
 
     fun logInfBlocks(
         message: String,
         functionName: String = "",
-    ) = log(message, "InfBlocks", functionName)
+    ) = logString(INF_BLOCKS, message, functionName)
 
     fun logInfCodes(
         message: String,
         functionName: String = "",
-    ) = log(message, "InfCodes", functionName)
+    ) = logString(INF_CODES, message, functionName)
 
     fun logInfTree(
         message: String,
         functionName: String = "",
-    ) = log(message, "InfTree", functionName)
+    ) = logString(INF_TREE, message, functionName)
 
     // Mathematical algorithm specific loggers
     fun logBitwise(
         message: String,
         functionName: String = "",
-    ) {
-        // Check both ENABLE_LOGGING and BITWISE_VERBOSE
-        if (!ENABLE_LOGGING || !BITWISE_VERBOSE) return
-        log(message, "BitwiseOps", functionName)
-    }
+    ) = logString(BITWISE, message, functionName)
 
     fun logAdler32(
         message: String,
         functionName: String = "",
-    ) = log(message, "Adler32", functionName)
+    ) = logString(ADLER32, message, functionName)
 
     fun logHuffman(
         message: String,
         functionName: String = "",
-    ) = log(message, "Huffman", functionName)
+    ) = logString(HUFFMAN, message, functionName)
 
     fun logTree(
         message: String,
         functionName: String = "",
-    ) = log(message, "Tree", functionName)
+    ) = logString(TREE, message, functionName)
 
     fun logCRC32(
         message: String,
         functionName: String = "",
-    ) = log(message, "CRC32", functionName)
+    ) = logString(CRC32, message, functionName)
+
+    // Lazy variants: the message lambda is inlined and skipped when the category is off
+    inline fun logInflate(functionName: String = "", message: () -> String) = log(INFLATE, LEVEL_INFO, functionName, message)
+
+    inline fun logDeflate(functionName: String = "", message: () -> String) = log(DEFLATE, LEVEL_INFO, functionName, message)
+
+    inline fun logZStream(functionName: String = "", message: () -> String) = log(ZSTREAM, LEVEL_INFO, functionName, message)
 
-    // Detailed mathematical operation loggers
+    inline fun logInfBlocks(functionName: String = "", message: () -> String) = log(INF_BLOCKS, LEVEL_INFO, functionName, message)
+
+    inline fun logInfCodes(functionName: String = "", message: () -> String) = log(INF_CODES, LEVEL_INFO, functionName, message)
+
+    inline fun logInfTree(functionName: String = "", message: () -> String) = log(INF_TREE, LEVEL_INFO, functionName, message)
+
+    inline fun logBitwise(functionName: String = "", message: () -> String) = log(BITWISE, LEVEL_INFO, functionName, message)
+
+    inline fun logAdler32(functionName: String = "", message: () -> String) = log(ADLER32, LEVEL_INFO, functionName, message)
+
+    inline fun logHuffman(functionName: String = "", message: () -> String) = log(HUFFMAN, LEVEL_INFO, functionName, message)
+
+    inline fun logTree(functionName: String = "", message: () -> String) = log(TREE, LEVEL_INFO, functionName, message)
+
+    inline fun logCRC32(functionName: String = "", message: () -> String) = log(CRC32, LEVEL_INFO, functionName, message)
+
+    // Detailed mathematical operation loggers (gated before formatting)
     fun logBitwiseOp(
         operation: String,
         input: Any,
@@ -186,8 +365,9 @@ object ZlibLogger {
         result: Any,
         functionName: String = "",
     ) {
+        if (!isEnabled(BITWISE)) return
         val shiftStr = if (shift != null) ", shift=$shift" else ""
-        logBitwise("$operation(input=$input$shiftStr) -> $result", functionName)
+        emit(BITWISE, functionName, "$operation(input=$input$shiftStr) -> $result")
     }
 
     fun logAdler32Calc(
@@ -197,9 +377,10 @@ object ZlibLogger {
         index: Int? = null,
         functionName: String = "",
     ) {
+        if (!isEnabled(ADLER32)) return
         val byteStr = if (byte != null) ", byte=$byte" else ""
         val indexStr = if (index != null) ", index=$index" else ""
-        logAdler32("s1=$s1, s2=$s2$byteStr$indexStr", functionName)
+        emit(ADLER32, functionName, "s1=$s1, s2=$s2$byteStr$indexStr")
     }
 
     fun logHuffmanCode(
@@ -208,7 +389,8 @@ object ZlibLogger {
         bits: Int,
         functionName: String = "",
     ) {
-        logHuffman("symbol=$symbol -> code=$code ($bits bits) [0x${code.toString(16)}]", functionName)
+        if (!isEnabled(HUFFMAN)) return
+        emit(HUFFMAN, functionName, "symbol=$symbol -> code=$code ($bits bits) [0x${code.toString(16)}]")
     }
 
     // Runtime configuration helpers (to be called from CLI)
@@ -225,12 +407,148 @@ object ZlibLogger {
     }
 
     fun setLogFilePath(path: String?) {
+        flush()
         LOG_FILE_PATH = path
     }
+
+    // ===== Internals =====
+
+    /** Format and write one line for an already-enabled [category]. */
+    @PublishedApi
+    internal fun emit(category: Int, functionName: String, message: String) {
+        writeLine(CATEGORY_NAMES[category], functionName, message)
+    }
+
+    private fun logString(category: Int, message: String, functionName: String) {
+        if (!isEnabled(category, levelOf(message))) return
+        writeLine(CATEGORY_NAMES[category], functionName, message)
+    }
+
+    private fun levelOf(message: String): Int =
+        if (message.startsWith("[DEBUG_LOG]")) LEVEL_DEBUG else LEVEL_INFO
+
+    private fun writeLine(className: String, functionName: String, message: String) {
+        val timestamp = currentTimestamp()
+        val location =
+            if (className.isNotEmpty() || functionName.isNotEmpty()) {
+                val cls = className.ifEmpty { "Unknown" }
+                val func = functionName.ifEmpty { "unknown" }
+                "[$cls::$func] "
+            } else {
+                ""
+            }
+        val line = "[$timestamp] $location$message\n"
+        if (logWriterMode == LogWriterMode.IMMEDIATE) {
+            writeBlock(line)
+            return
+        }
+        var block: String? = null
+        var t = 0L
+        lockPending()
+        try {
+            pending.append(line)
+            if (pending.length >= blockSize) {
+                block = takePending()
+                t = handOff(block)
+            }
+        } finally {
+            unlockPending()
+        }
+        if (block == null) return
+        // Outside the lock: other producers keep appending while this one writes or waits
+        if (logWriterMode != LogWriterMode.BACKGROUND) writeBlock(block) else awaitWritten(t - queueBlocks)
+    }
+
+    private fun takePending(): String {
+        val block = pending.toString()
+        pending.clear()
+        return block
+    }
+
+    /**
+     * Queue [block] for the background writer and return its ticket. Called
+     * with the pending lock held, so tickets and queue order match line
+     * order; the queue is unbounded, so this never waits. Without a
+     * background writer the caller writes the block itself after unlocking
+     * (those targets are single-threaded, so order is kept) and gets 0.
+     */
+    private fun handOff(block: String): Long {
+        if (logWriterMode != LogWriterMode.BACKGROUND) return 0L
+        val ch = queue ?: startWriter()
+        ch.trySend(block)
+        return ++ticket
+    }
+
+    /**
+     * Park until the writer has finished the block with ticket [t]. The
+     * writer runs on its own thread, so the wait always ends.
+     */
+    private fun awaitWritten(t: Long) {
+        if (writtenTicket.value >= t) return
+        blockOnLogWriter { writtenTicket.first { it >= t } }
+    }
+
+    private fun startWriter(): Channel<String> {
+        val ch = Channel<String>(Channel.UNLIMITED)
+        queue = ch
+        launchLogWriter {
+            for (block in ch) {
+                try {
+                    blockSink(block)
+                } catch (_: Throwable) {
+                    // A failing sink loses this block, never the writer (and with it every later flush)
+                }
+                writtenTicket.value += 1
+            }
+        }
+        return ch
+    }
+
+    private fun writeBlock(block: String) {
+        try {
+            blockSink(block)
+        } catch (_: Exception) {
+            // Ignore logging errors
+        }
+    }
+
+    private fun lockPending() {
+        while (!pendingLock.compareAndSet(0, 1)) {
+            // Spin: the critical section is an append and a non-blocking queue handoff
+        }
+    }
+
+    private fun unlockPending() {
+        pendingLock.store(0)
+    }
 }
 
+/** How [ZlibLogger] hands lines to [logToFile] on this target. */
+internal enum class LogWriterMode {
+    /** One [logToFile] call per line (console targets). */
+    IMMEDIATE,
+
+    /** Lines batched into blocks, written synchronously by the producer. */
+    BLOCKING_BATCH,
+
+    /** Lines batched into blocks, written by a coroutine on a dedicated thread. */
+    BACKGROUND,
+}
+
+internal expect val logWriterMode: LogWriterMode
+
+/** Start [body] on a dedicated writer thread (BACKGROUND targets only). */
+internal expect fun launchLogWriter(body: suspend () -> Unit)
+
+/** Block the calling thread until [body] completes (BACKGROUND targets only). */
+internal expect fun <T> blockOnLogWriter(body: suspend () -> T): T
+
+/** Run [flush] at process exit where the platform offers a hook (no-op elsewhere). */
+internal expect fun installLogFlushHook(flush: () -> Unit)
+
 /**
- * Platform-specific file append implementation
+ * Platform-specific file append implementation. [line] may be a block of
+ * several newline-terminated lines.
  */
 expect fun logToFile(line: String)
 
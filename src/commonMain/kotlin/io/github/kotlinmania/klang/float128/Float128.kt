@@ -106,22 +106,25 @@ class Float128 private constructor(
             val parts = value.split('.')
             val integerPart = parts.getOrNull(0)?.takeIf { it.isNotEmpty() } ?: "0"
             val fractionalPart = parts.getOrNull(1) ?: ""
-            var mantissa = HeapUInt128.zero()
+            // One owned result; every digit step rewrites it in place
+            val mantissa = HeapUInt128.zero()
 
             val temp = IntArray(SwAR128.LIMB_COUNT)
             val buffer = IntArray(SwAR128.LIMB_COUNT)
+            val limbs = IntArray(SwAR128.LIMB_COUNT)
             for (ch in integerPart) {
                 val digit = ch - '0'
-                SwAR128.multiplyBySmall(mantissa.toIntArray(), 10, temp)
+                SwAR128.multiplyBySmall(limbs, 10, temp)
                 SwAR128.addSmall(temp, digit, buffer)
-                mantissa = HeapUInt128.fromLimbsUnsafe(buffer)
+                buffer.copyInto(limbs)
             }
+            mantissa.assignLimbs(limbs)
 
             var exponent = 0
             if (fractionalPart.isNotEmpty()) {
                 val fractionalValue = ("0.$fractionalPart").toDouble()
                 val fractional128 = fromDouble(fractionalValue)
-                mantissa = mantissa + fractional128.mantissa
+                mantissa.addAssign(fractional128.mantissa)
                 exponent = fractional128.exponent
             }
             return Parsed(mantissa, exponent + EXP_BIAS, false)
@@ -24,42 +24,42 @@ class CFloat32 private constructor(private val bits: Int) {
     operator fun plus(other: CFloat32): CFloat32 {
         val resBits = Float32Math.addBits(this.bits, other.bits)
         val wrapped = fromBits(resBits)
-        CFloatTrace.log("plus", bits, other.bits, wrapped.bits)
+        CFloatTrace.log(CFloatTrace.OP_PLUS, bits, other.bits, wrapped.bits)
         return wrapped
     }
 
     operator fun plus(other: Float): CFloat32 {
         val resBits = Float32Math.addBits(this.bits, other.toRawBits())
         val wrapped = fromBits(resBits)
-        CFloatTrace.log("plusF", bits, other.toRawBits(), wrapped.bits)
+        CFloatTrace.log(CFloatTrace.OP_PLUS_F, bits, other.toRawBits(), wrapped.bits)
         return wrapped
     }
 
     operator fun minus(other: CFloat32): CFloat32 {
         val resBits = Float32Math.subBits(this.bits, other.bits)
         val wrapped = fromBits(resBits)
-        CFloatTrace.log("minus", bits, other.bits, wrapped.bits)
+        CFloatTrace.log(CFloatTrace.OP_MINUS, bits, other.bits, wrapped.bits)
         return wrapped
     }
 
     operator fun minus(other: Float): CFloat32 {
         val resBits = Float32Math.subBits(this.bits, other.toRawBits())
         val wrapped = fromBits(resBits)
-        CFloatTrace.log("minusF", bits, other.toRawBits(), wrapped.bits)
+        CFloatTrace.log(CFloatTrace.OP_MINUS_F, bits, other.toRawBits(), wrapped.bits)
         return wrapped
     }
 
     operator fun times(other: CFloat32): CFloat32 {
         val resBits = Float32Math.mulBits(this.bits, other.bits)
         val wrapped = fromBits(resBits)
-        CFloatTrace.log("times", bits, other.bits, wrapped.bits)
+        CFloatTrace.log(CFloatTrace.OP_TIMES, bits, other.bits, wrapped.bits)
         return wrapped
     }
 
     operator fun times(other: Float): CFloat32 {
         val resBits = Float32Math.mulBits(this.bits, other.toRawBits())
         val wrapped = fromBits(resBits)
-        CFloatTrace.log("timesF", bits, other.toRawBits(), wrapped.bits)
+        CFloatTrace.log(CFloatTrace.OP_TIMES_F, bits, other.toRawBits(), wrapped.bits)
         return wrapped
     }
 
@@ -67,46 +67,50 @@ class CFloat32 private constructor(private val bits: Int) {
     fun timesExact(other: CFloat32): CFloat32 {
         val resBits = Float32Math.mulBits(this.bits, other.bits)
         val wrapped = fromBits(resBits)
-        CFloatTrace.log("timesExact", bits, other.bits, wrapped.bits)
+        CFloatTrace.log(CFloatTrace.OP_TIMES_EXACT, bits, other.bits, wrapped.bits)
         return wrapped
     }
 
     fun timesExact(other: Float): CFloat32 {
         val resBits = Float32Math.mulBits(this.bits, other.toRawBits())
         val wrapped = fromBits(resBits)
-        CFloatTrace.log("timesExactF", bits, other.toRawBits(), wrapped.bits)
+        CFloatTrace.log(CFloatTrace.OP_TIMES_EXACT_F, bits, other.toRawBits(), wrapped.bits)
         return wrapped
     }
 
     fun plusExact(other: CFloat32): CFloat32 {
         val res = Float32Math.addPos(this.value, other.value)
         val wrapped = fromFloat(res)
-        CFloatTrace.log("plusExact", bits, other.bits, wrapped.bits)
+        CFloatTrace.log(CFloatTrace.OP_PLUS_EXACT, bits, other.bits, wrapped.bits)
         return wrapped
     }
 
     fun plusExact(other: Float): CFloat32 {
         val res = Float32Math.addPos(this.value, other)
         val wrapped = fromFloat(res)
-        CFloatTrace.log("plusExactF", bits, other.toRawBits(), wrapped.bits)
+        CFloatTrace.log(CFloatTrace.OP_PLUS_EXACT_F, bits, other.toRawBits(), wrapped.bits)
         return wrapped
     }
 
     operator fun div(other: CFloat32): CFloat32 {
         val resBits = Float32Math.divBits(this.bits, other.bits)
         val wrapped = fromBits(resBits)
-        CFloatTrace.log("div", bits, other.bits, wrapped.bits)
+        CFloatTrace.log(CFloatTrace.OP_DIV, bits, other.bits, wrapped.bits)
         return wrapped
     }
 
     operator fun div(other: Float): CFloat32 {
         val resBits = Float32Math.divBits(this.bits, other.toRawBits())
         val wrapped = fromBits(resBits)
-        CFloatTrace.log("divF", bits, other.toRawBits(), wrapped.bits)
+        CFloatTrace.log(CFloatTrace.OP_DIV_F, bits, other.toRawBits(), wrapped.bits)
         return wrapped
     }
 
-    fun abs(): CFloat32 = unary("abs", null) { a, _ -> abs(a) }
+    fun abs(): CFloat32 {
+        val wrapped = fromFloat(abs(value))
+        CFloatTrace.logUnary(CFloatTrace.OP_ABS, bits, wrapped.bits)
+        return wrapped
+    }
 
     // ===== Basic math: sqrt, rounding, FP utilities =====
 
@@ -143,14 +147,14 @@ class CFloat32 private constructor(private val bits: Int) {
     fun fma(multiplier: CFloat32, addend: CFloat32): CFloat32 {
         val result = (value.toDouble() + multiplier.value.toDouble() * addend.value.toDouble()).toFloat()
         val wrapped = fromFloat(result)
-        CFloatTrace.log("fma", bits, multiplier.bits, wrapped.bits)
+        CFloatTrace.log(CFloatTrace.OP_FMA, bits, multiplier.bits, wrapped.bits)
         return wrapped
     }
 
     fun fma(multiplier: Float, addend: Float): CFloat32 {
         val result = (value.toDouble() + multiplier.toDouble() * addend.toDouble()).toFloat()
         val wrapped = fromFloat(result)
-        CFloatTrace.log("fmaF", bits, multiplier.toRawBits(), wrapped.bits)
+        CFloatTrace.log(CFloatTrace.OP_FMA_F, bits, multiplier.toRawBits(), wrapped.bits)
         return wrapped
     }
 
@@ -79,6 +79,10 @@ package io.github.kotlinmania.klang.fp
  * - Extended80 and IEEE128 are approximations (using double-double)
  * - Requires explicit flavor management
  *
+ * For C's exact bits on Kotlin/Native, batch the work through
+ * [HostLongDouble] (Strict-C mode), which runs on the host `long double`
+ * and `__float128` directly.
+ *
  * ## Usage Example
  *
  * ```kotlin
@@ -166,6 +170,7 @@ package io.github.kotlinmania.klang.fp
  * @constructor Private; use companion object factory methods
  * @see CFloat64 For standard 64-bit precision
  * @see CFloat128 For true double-double arithmetic
+ * @see HostLongDouble For host-exact batched arithmetic (Strict-C mode)
  * @since 0.1.0
  */
 class CLongDouble private constructor(
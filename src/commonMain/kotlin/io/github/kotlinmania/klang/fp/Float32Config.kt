@@ -0,0 +1,94 @@
+package io.github.kotlinmania.klang.fp
+
+/**
+ * Float32Mode: Execution strategy for the [Float32Math] Float-level API.
+ *
+ * - **AUTO**: NATIVE if the host passes the startup conformance check, else SOFT
+ * - **NATIVE**: Hardware `Float` operators (fast; only bit-exact on conformant hosts)
+ * - **SOFT**: Integer soft-float kernels (`addBits`, `mulBits`, ...) everywhere
+ *
+ * Both strategies produce identical bits on a conformant host, NaN payloads
+ * included: a native result that is NaN is recomputed in soft-float.
+ *
+ * @see Float32Config For selecting the mode
+ * @since 0.1.0
+ */
+enum class Float32Mode {
+    /** Resolve to NATIVE or SOFT with [Float32Config.resolveMode]. */
+    AUTO,
+
+    /** Use hardware binary32 arithmetic. */
+    NATIVE,
+
+    /** Use the bit-level software kernels. */
+    SOFT,
+}
+
+/**
+ * Global configuration for [Float32Math] execution.
+ *
+ * The `*Bits` kernels are always soft-float; only `add`/`sub`/`mul`/`div`/`fma`
+ * on `Float` dispatch. AUTO trusts the hardware only when both hold:
+ * 1. The target is classified as binary32-exact ([float32HostIsBinary32]).
+ *    Kotlin/JS is not: `Float` is a JS number and `a * b` is never rounded to
+ *    binary32.
+ * 2. The native operators reproduce every [Float32Conformance] vector
+ *    (subnormals, ties, overflow, fma cancellation), run once per process.
+ */
+object Float32Config {
+    /** Outcome of the startup host check (computed once). Declared first: [useNative] reads it during init. */
+    val hostConformant: Boolean by lazy { detectConformance() }
+
+    @kotlin.concurrent.Volatile
+    var defaultMode: Float32Mode = Float32Mode.AUTO
+        set(value) {
+            field = value
+            useNative = resolveMode(value) == Float32Mode.NATIVE
+        }
+
+    /** Hot-path flag read by [Float32Math]; follows [defaultMode]. */
+    @kotlin.concurrent.Volatile
+    internal var useNative: Boolean = resolveMode(Float32Mode.AUTO) == Float32Mode.NATIVE
+        private set
+
+    fun withMode(mode: Float32Mode, block: () -> Unit) {
+        val prev = defaultMode
+        try {
+            defaultMode = mode
+            block()
+        } finally {
+            defaultMode = prev
+        }
+    }
+
+    /**
+     * Resolve [requested] to NATIVE or SOFT.
+     *
+     * Forcing NATIVE on a non-conformant host is allowed (benchmarking,
+     * diagnostics) but gives up cross-platform bit-exactness.
+     */
+    fun resolveMode(requested: Float32Mode = defaultMode): Float32Mode = when (requested) {
+        Float32Mode.NATIVE,
+        Float32Mode.SOFT,
+        -> requested
+
+        Float32Mode.AUTO -> if (hostConformant) Float32Mode.NATIVE else Float32Mode.SOFT
+    }
+
+    private fun detectConformance(): Boolean {
+        if (!float32HostIsBinary32) return false
+        return Float32Conformance.hostMatches(
+            add = { a, b -> a + b },
+            sub = { a, b -> a - b },
+            mul = { a, b -> a * b },
+            div = { a, b -> a / b },
+            fma = { a, b, c -> Float32Math.fmaNative(a, b, c) },
+        )
+    }
+}
+
+/**
+ * Whether native `Float` operators on this target are IEEE binary32
+ * round-to-nearest-even (before the runtime vector check).
+ */
+internal expect val float32HostIsBinary32: Boolean
@@ -0,0 +1,143 @@
+package io.github.kotlinmania.klang.fp
+
+/**
+ * Reference binary32 vectors for the [Float32Config] host check.
+ *
+ * Generated by `tools/float32_spotcheck.c --kotlin` (GCC, SSE, -ffp-contract=off).
+ * Each row is [ROW] ints: a, b, c, then the correctly rounded bits of
+ * a+b, a-b, a*b, a/b and fma(a, b, c). Rows cover ties, subnormal inputs and
+ * outputs, overflow, signed zeros and fma cancellation; none has a NaN result.
+ */
+internal object Float32Conformance {
+    const val ROW = 8
+
+    val VECTORS: IntArray by lazy {
+        intArrayOf(
+            0x3F800000.toInt(), 0x40000000.toInt(), 0x40400000.toInt(), 0x40400000.toInt(), 0xBF800000.toInt(), 0x40000000.toInt(), 0x3F000000.toInt(), 0x40A00000.toInt(),
+            0x3DCCCCCD.toInt(), 0x3E4CCCCD.toInt(), 0x3E99999A.toInt(), 0x3E99999A.toInt(), 0xBDCCCCCD.toInt(), 0x3CA3D70B.toInt(), 0x3F000000.toInt(), 0x3EA3D70B.toInt(),
+            0xC0490FDB.toInt(), 0x402DF854.toInt(), 0x3F000000.toInt(), 0xBED8BC38.toInt(), 0xC0BB8418.toInt(), 0xC108A2C0.toInt(), 0xBF93EEE0.toInt(), 0xC100A2C0.toInt(),
+            0x3F800000.toInt(), 0x33800000.toInt(), 0x00000000.toInt(), 0x3F800000.toInt(), 0x3F7FFFFF.toInt(), 0x33800000.toInt(), 0x4B800000.toInt(), 0x33800000.toInt(),
+            0x3F800001.toInt(), 0x33800000.toInt(), 0x00000000.toInt(), 0x3F800002.toInt(), 0x3F800000.toInt(), 0x33800001.toInt(), 0x4B800001.toInt(), 0x33800001.toInt(),
+            0x3F800000.toInt(), 0x34400000.toInt(), 0x00000000.toInt(), 0x3F800002.toInt(), 0x3F7FFFFD.toInt(), 0x34400000.toInt(), 0x4AAAAAAB.toInt(), 0x34400000.toInt(),
+            0x3F800001.toInt(), 0x3F800001.toInt(), 0xBF800000.toInt(), 0x40000001.toInt(), 0x00000000.toInt(), 0x3F800002.toInt(), 0x3F800000.toInt(), 0x34800000.toInt(),
+            0x3FFFFFFF.toInt(), 0x3FFFFFFF.toInt(), 0xC0800000.toInt(), 0x407FFFFF.toInt(), 0x00000000.toInt(), 0x407FFFFE.toInt(), 0x3F800000.toInt(), 0xB5000000.toInt(),
+            0x3F7FFFFF.toInt(), 0x3F800001.toInt(), 0xBF800000.toInt(), 0x40000000.toInt(), 0xB4400000.toInt(), 0x3F800000.toInt(), 0x3F7FFFFD.toInt(), 0x337FFFFE.toInt(),
+            0x00000001.toInt(), 0x00000001.toInt(), 0x00000000.toInt(), 0x00000002.toInt(), 0x00000000.toInt(), 0x00000000.toInt(), 0x3F800000.toInt(), 0x00000000.toInt(),
+            0x00400000.toInt(), 0x3F000000.toInt(), 0x00000001.toInt(), 0x3F000000.toInt(), 0xBF000000.toInt(), 0x00200000.toInt(), 0x00800000.toInt(), 0x00200001.toInt(),
+            0x00800000.toInt(), 0x3F000000.toInt(), 0x80000001.toInt(), 0x3F000000.toInt(), 0xBF000000.toInt(), 0x00400000.toInt(), 0x01000000.toInt(), 0x003FFFFF.toInt(),
+            0x007FFFFF.toInt(), 0x00000001.toInt(), 0x00800000.toInt(), 0x00800000.toInt(), 0x007FFFFE.toInt(), 0x00000000.toInt(), 0x4AFFFFFE.toInt(), 0x00800000.toInt(),
+            0x00800000.toInt(), 0xBF7FFFFF.toInt(), 0x00000000.toInt(), 0xBF7FFFFF.toInt(), 0x3F7FFFFF.toInt(), 0x80800000.toInt(), 0x80800001.toInt(), 0x80800000.toInt(),
+            0x1E3CE508.toInt(), 0x1E3CE508.toInt(), 0x00000003.toInt(), 0x1EBCE508.toInt(), 0x00000000.toInt(), 0x000116C2.toInt(), 0x3F800000.toInt(), 0x000116C5.toInt(),
+            0x00000003.toInt(), 0x40400000.toInt(), 0x80000009.toInt(), 0x40400000.toInt(), 0xC0400000.toInt(), 0x00000009.toInt(), 0x00000001.toInt(), 0x00000000.toInt(),
+            0x80800001.toInt(), 0x00800000.toInt(), 0x3F800000.toInt(), 0x80000001.toInt(), 0x81000000.toInt(), 0x80000000.toInt(), 0xBF800001.toInt(), 0x3F800000.toInt(),
+            0x7F7FFFFF.toInt(), 0x7F7FFFFF.toInt(), 0xFF7FFFFF.toInt(), 0x7F800000.toInt(), 0x00000000.toInt(), 0x7F800000.toInt(), 0x3F800000.toInt(), 0x7F800000.toInt(),
+            0x7F7FFFFF.toInt(), 0x3F800001.toInt(), 0x00000000.toInt(), 0x7F7FFFFF.toInt(), 0x7F7FFFFF.toInt(), 0x7F800000.toInt(), 0x7F7FFFFD.toInt(), 0x7F800000.toInt(),
+            0x7F7FFFFF.toInt(), 0x40000000.toInt(), 0xFF7FFFFF.toInt(), 0x7F7FFFFF.toInt(), 0x7F7FFFFF.toInt(), 0x7F800000.toInt(), 0x7EFFFFFF.toInt(), 0x7F7FFFFF.toInt(),
+            0x7F000000.toInt(), 0x00000001.toInt(), 0x7F7FFFFF.toInt(), 0x7F000000.toInt(), 0x7F000000.toInt(), 0x34800000.toInt(), 0x7F800000.toInt(), 0x7F7FFFFF.toInt(),
+            0x3F800000.toInt(), 0xBF800000.toInt(), 0x80000000.toInt(), 0x00000000.toInt(), 0x40000000.toInt(), 0xBF800000.toInt(), 0xBF800000.toInt(), 0xBF800000.toInt(),
+            0x80000000.toInt(), 0x3F800000.toInt(), 0x80000000.toInt(), 0x3F800000.toInt(), 0xBF800000.toInt(), 0x80000000.toInt(), 0x80000000.toInt(), 0x80000000.toInt(),
+            0x7F800000.toInt(), 0x3F800000.toInt(), 0x3F800000.toInt(), 0x7F800000.toInt(), 0x7F800000.toInt(), 0x7F800000.toInt(), 0x7F800000.toInt(), 0x7F800000.toInt(),
+            0xFF800000.toInt(), 0x40000000.toInt(), 0xC0000000.toInt(), 0xFF800000.toInt(), 0xFF800000.toInt(), 0xFF800000.toInt(), 0xFF800000.toInt(), 0xFF800000.toInt(),
+            0x3F800000.toInt(), 0x7F800000.toInt(), 0x00000000.toInt(), 0x7F800000.toInt(), 0xFF800000.toInt(), 0x7F800000.toInt(), 0x00000000.toInt(), 0x7F800000.toInt(),
+            0x3F800001.toInt(), 0x3F7FFFFF.toInt(), 0xBF800000.toInt(), 0x40000000.toInt(), 0x34400000.toInt(), 0x3F800000.toInt(), 0x3F800002.toInt(), 0x337FFFFE.toInt(),
+            0x3DCCCCCD.toInt(), 0x41200000.toInt(), 0xBF800000.toInt(), 0x4121999A.toInt(), 0xC11E6666.toInt(), 0x3F800000.toInt(), 0x3C23D70A.toInt(), 0x32800000.toInt(),
+            0x3EAAAAAB.toInt(), 0x40400000.toInt(), 0xBF800000.toInt(), 0x40555555.toInt(), 0xC02AAAAB.toInt(), 0x3F800000.toInt(), 0x3DE38E39.toInt(), 0x33000000.toInt(),
+            0x4B7FFFFF.toInt(), 0x4B7FFFFF.toInt(), 0xD77FFFFE.toInt(), 0x4BFFFFFF.toInt(), 0x00000000.toInt(), 0x577FFFFE.toInt(), 0x3F800000.toInt(), 0x3F800000.toInt(),
+            0x3F800000.toInt(), 0x40400000.toInt(), 0x00000000.toInt(), 0x40800000.toInt(), 0xC0000000.toInt(), 0x40400000.toInt(), 0x3EAAAAAB.toInt(), 0x40400000.toInt(),
+            0x00000001.toInt(), 0x40000000.toInt(), 0x00000000.toInt(), 0x40000000.toInt(), 0xC0000000.toInt(), 0x00000002.toInt(), 0x00000000.toInt(), 0x00000002.toInt(),
+            0x00000003.toInt(), 0x40000000.toInt(), 0x00000000.toInt(), 0x40000000.toInt(), 0xC0000000.toInt(), 0x00000006.toInt(), 0x00000002.toInt(), 0x00000006.toInt(),
+            0x7F7FFFFF.toInt(), 0x00000001.toInt(), 0x00000000.toInt(), 0x7F7FFFFF.toInt(), 0x7F7FFFFF.toInt(), 0x34FFFFFF.toInt(), 0x7F800000.toInt(), 0x34FFFFFF.toInt(),
+            0x3F800000.toInt(), 0x00000000.toInt(), 0x00000000.toInt(), 0x3F800000.toInt(), 0x3F800000.toInt(), 0x00000000.toInt(), 0x7F800000.toInt(), 0x00000000.toInt(),
+            0x37AE0BF3.toInt(), 0x8E91E590.toInt(), 0x16E0A1C5.toInt(), 0x37AE0BF3.toInt(), 0x37AE0BF3.toInt(), 0x86C661AE.toInt(), 0xE898B266.toInt(), 0x16E0A1C5.toInt(),
+            0xA144D6E8.toInt(), 0x0085B0D6.toInt(), 0x00000000.toInt(), 0xA144D6E8.toInt(), 0xA144D6E8.toInt(), 0x80000000.toInt(), 0xE03C75EF.toInt(), 0x80000000.toInt(),
+            0x34FFB8E8.toInt(), 0x39F8ADA7.toInt(), 0x99E83F5A.toInt(), 0x39F8ED95.toInt(), 0xB9F86DB9.toInt(), 0x2F786898.toInt(), 0x3A83A02C.toInt(), 0x2F786898.toInt(),
+            0xBC387DFA.toInt(), 0x39B16B71.toInt(), 0x367FB910.toInt(), 0xBC32F29E.toInt(), 0xBC3E0956.toInt(), 0xB67FB910.toInt(), 0xC2051A37.toInt(), 0x28EE6A60.toInt(),
+            0x3F876D00.toInt(), 0x10D59C0A.toInt(), 0x8082ED7C.toInt(), 0x3F876D00.toInt(), 0x3F876D00.toInt(), 0x10E20079.toInt(), 0x6E224D02.toInt(), 0x10E20079.toInt(),
+            0xB3D3CDBD.toInt(), 0x9A7F6993.toInt(), 0x8ED35148.toInt(), 0xB3D3CDBD.toInt(), 0xB3D3CDBD.toInt(), 0x0ED35148.toInt(), 0x58D44A7B.toInt(), 0x0209510E.toInt(),
+            0x001E6CED.toInt(), 0x80FA7886.toInt(), 0x0C36D0DB.toInt(), 0x80DC0B99.toInt(), 0x010C72BA.toInt(), 0x80000000.toInt(), 0xBDF8C6F2.toInt(), 0x0C36D0DB.toInt(),
+            0x8FB373FF.toInt(), 0x9BA126CD.toInt(), 0x80000000.toInt(), 0x9BA126CE.toInt(), 0x1BA126CC.toInt(), 0x00000000.toInt(), 0x338E895F.toInt(), 0x00000000.toInt(),
+            0xA28856D2.toInt(), 0x00C99417.toInt(), 0x8EAB2F9A.toInt(), 0xA28856D2.toInt(), 0xA28856D2.toInt(), 0x80000000.toInt(), 0xE12D25C6.toInt(), 0x8EAB2F9A.toInt(),
+            0x0014C47C.toInt(), 0x007841EE.toInt(), 0x80000000.toInt(), 0x008D066A.toInt(), 0x80637D72.toInt(), 0x00000000.toInt(), 0x3E30D62D.toInt(), 0x00000000.toInt(),
+            0xBFAE1EA5.toInt(), 0x23E93829.toInt(), 0x978E2A2F.toInt(), 0xBFAE1EA5.toInt(), 0xBFAE1EA5.toInt(), 0xA41EA017.toInt(), 0xDB3F20A6.toInt(), 0xA41EA017.toInt(),
+            0x807EFDA6.toInt(), 0x273B10A6.toInt(), 0x00000000.toInt(), 0x273B10A6.toInt(), 0xA73B10A6.toInt(), 0x80000000.toInt(), 0x98ADC9B7.toInt(), 0x80000000.toInt(),
+            0x00AD6D01.toInt(), 0x805DA0EB.toInt(), 0x0B16630D.toInt(), 0x004FCC16.toInt(), 0x010586F6.toInt(), 0x80000000.toInt(), 0xBFED1751.toInt(), 0x0B16630D.toInt(),
+            0x14BC79E2.toInt(), 0x0014FAE8.toInt(), 0x80000000.toInt(), 0x14BC79E2.toInt(), 0x14BC79E2.toInt(), 0x00000000.toInt(), 0x550FBCAE.toInt(), 0x00000000.toInt(),
+            0x002BFB80.toInt(), 0x393E9E8A.toInt(), 0x1D57FF03.toInt(), 0x393E9E8A.toInt(), 0xB93E9E8A.toInt(), 0x0000020C.toInt(), 0x05EC45A1.toInt(), 0x1D57FF03.toInt(),
+            0x2C76AD45.toInt(), 0x3F871886.toInt(), 0xAC822D01.toInt(), 0x3F871886.toInt(), 0xBF871886.toInt(), 0x2C822D01.toInt(), 0x2C69B868.toInt(), 0x9FFF5788.toInt(),
+            0x31B6D9EF.toInt(), 0x0016351A.toInt(), 0x80D52D7C.toInt(), 0x31B6D9EF.toInt(), 0x31B6D9EF.toInt(), 0x00000000.toInt(), 0x7203BD9B.toInt(), 0x80D52D7C.toInt(),
+            0x38D4F456.toInt(), 0xBF49868F.toInt(), 0x38A7A3C6.toInt(), 0xBF497FE7.toInt(), 0x3F498D37.toInt(), 0xB8A7A3C6.toInt(), 0xB9074252.toInt(), 0xAC3F0014.toInt(),
+            0x073CA7E2.toInt(), 0xBF8AB7E1.toInt(), 0x8C3FCE8A.toInt(), 0xBF8AB7E1.toInt(), 0x3F8AB7E1.toInt(), 0x874C7403.toInt(), 0x872E143B.toInt(), 0x8C4001A7.toInt(),
+            0x37BDBB04.toInt(), 0x9C4037D1.toInt(), 0x148E75A1.toInt(), 0x37BDBB04.toInt(), 0x37BDBB04.toInt(), 0x948E75A1.toInt(), 0xDAFCAFE5.toInt(), 0x871C5220.toInt(),
+            0xB970F61E.toInt(), 0x3FAAEBB9.toInt(), 0x11557B1E.toInt(), 0x3FAAE431.toInt(), 0xBFAAF341.toInt(), 0xB9A0E150.toInt(), 0xB93473CD.toInt(), 0xB9A0E150.toInt(),
+            0xB56CC3FE.toInt(), 0xB09C7699.toInt(), 0xA690B51F.toInt(), 0xB56D1239.toInt(), 0xB56C75C3.toInt(), 0x2690B51F.toInt(), 0x4441B1AA.toInt(), 0x9A3F9264.toInt(),
+            0x136A3934.toInt(), 0xA04B5365.toInt(), 0xAF48DE09.toInt(), 0xA04B5365.toInt(), 0x204B5365.toInt(), 0x80000000.toInt(), 0xB293737A.toInt(), 0xAF48DE09.toInt(),
+            0x0CFD5E7E.toInt(), 0x9BBF218E.toInt(), 0x00000000.toInt(), 0x9BBF218E.toInt(), 0x1BBF218E.toInt(), 0x80000000.toInt(), 0xB0A9AE40.toInt(), 0x80000000.toInt(),
+            0x80EA42CE.toInt(), 0x865F060E.toInt(), 0x9C22E6EC.toInt(), 0x865F2356.toInt(), 0x065EE8C6.toInt(), 0x00000000.toInt(), 0x3A06730E.toInt(), 0x9C22E6EC.toInt(),
+            0x2175BE7D.toInt(), 0x220EFEE2.toInt(), 0x84094455.toInt(), 0x224C6E81.toInt(), 0xA1A31E86.toInt(), 0x04094455.toInt(), 0x3EDBF934.toInt(), 0x00000024.toInt(),
+            0x00D0B83A.toInt(), 0xBFAAB71E.toInt(), 0x804CFDF7.toInt(), 0xBFAAB71E.toInt(), 0x3FAAB71E.toInt(), 0x810B2FA3.toInt(), 0x809C7EC1.toInt(), 0x8131AE9E.toInt(),
+            0x2DCE235D.toInt(), 0x3FB7EEDC.toInt(), 0xAE141B9E.toInt(), 0x3FB7EEDC.toInt(), 0xBFB7EEDC.toInt(), 0x2E141B9E.toInt(), 0x2D8F73E1.toInt(), 0xA1FC4C28.toInt(),
+            0x8AFFB024.toInt(), 0x1012DDDD.toInt(), 0x97B6E7E3.toInt(), 0x1012BDE7.toInt(), 0x9012FDD3.toInt(), 0x80000000.toInt(), 0xBA5ED792.toInt(), 0x97B6E7E3.toInt(),
+            0xA3DB8471.toInt(), 0x80F52D13.toInt(), 0x80000000.toInt(), 0xA3DB8471.toInt(), 0xA3DB8471.toInt(), 0x00000000.toInt(), 0x62653561.toInt(), 0x00000000.toInt(),
+            0x8052E585.toInt(), 0xBFA8330D.toInt(), 0x1B827533.toInt(), 0xBFA8330D.toInt(), 0x3FA8330D.toInt(), 0x006CEE4E.toInt(), 0x003F159B.toInt(), 0x1B827533.toInt(),
+            0xBDEA5375.toInt(), 0x228EE7B1.toInt(), 0x2102CE5E.toInt(), 0xBDEA5375.toInt(), 0xBDEA5375.toInt(), 0xA102CE5E.toInt(), 0xDAD1E2BF.toInt(), 0x94611B94.toInt(),
+            0x00EB4195.toInt(), 0x095915AD.toInt(), 0x9FF13576.toInt(), 0x09591623.toInt(), 0x89591537.toInt(), 0x00000000.toInt(), 0x370AB6E9.toInt(), 0x9FF13576.toInt(),
+            0x977110B8.toInt(), 0x806CAA02.toInt(), 0x80000000.toInt(), 0x977110B8.toInt(), 0x977110B8.toInt(), 0x00000000.toInt(), 0x568DFB00.toInt(), 0x00000000.toInt(),
+            0x00A47697.toInt(), 0x230ADAEF.toInt(), 0x88A9EDED.toInt(), 0x230ADAEF.toInt(), 0xA30ADAEF.toInt(), 0x00000000.toInt(), 0x1D179B29.toInt(), 0x88A9EDED.toInt(),
+            0x0713A9B8.toInt(), 0x2267673F.toInt(), 0x80000000.toInt(), 0x2267673F.toInt(), 0xA267673F.toInt(), 0x00000000.toInt(), 0x24235BCD.toInt(), 0x00000000.toInt(),
+            0x00819671.toInt(), 0xB3CA3BA2.toInt(), 0x1374ADDC.toInt(), 0xB3CA3BA2.toInt(), 0x33CA3BA2.toInt(), 0x80000001.toInt(), 0x8C240A6E.toInt(), 0x1374ADDC.toInt(),
+            0xBFB2BAD2.toInt(), 0xAA9167C9.toInt(), 0xAACB088D.toInt(), 0xBFB2BAD2.toInt(), 0xBFB2BAD2.toInt(), 0x2ACB088D.toInt(), 0x549D55D9.toInt(), 0x9D6D31E0.toInt(),
+            0x2E3E83C4.toInt(), 0x318091B5.toInt(), 0x009B3390.toInt(), 0x31820EBD.toInt(), 0xB17E295B.toInt(), 0x203F5CA3.toInt(), 0x3C3DABDB.toInt(), 0x203F5CA3.toInt(),
+            0x86A67D00.toInt(), 0x068DBB57.toInt(), 0x00000000.toInt(), 0x85460D48.toInt(), 0x871A1C2C.toInt(), 0x80000000.toInt(), 0xBF965BA2.toInt(), 0x80000000.toInt(),
+            0x1D39F25C.toInt(), 0x008AB05D.toInt(), 0x0071C0B1.toInt(), 0x1D39F25C.toInt(), 0x1D39F25C.toInt(), 0x00000000.toInt(), 0x5C2B9D97.toInt(), 0x0071C0B1.toInt(),
+            0x8836D721.toInt(), 0xBF9382B7.toInt(), 0x8852B5C8.toInt(), 0xBF9382B7.toInt(), 0x3F9382B7.toInt(), 0x0852B5C8.toInt(), 0x081EA826.toInt(), 0x80001A75.toInt(),
+            0xA96337A6.toInt(), 0x1CDF019A.toInt(), 0xA29935C2.toInt(), 0xA96337A6.toInt(), 0xA96337A6.toInt(), 0x86C5EEE6.toInt(), 0xCC026AC6.toInt(), 0xA29935C2.toInt(),
+            0xBFB00DE2.toInt(), 0x9DF66499.toInt(), 0x9E297286.toInt(), 0xBFB00DE2.toInt(), 0xBFB00DE2.toInt(), 0x1E297286.toInt(), 0x6136EB31.toInt(), 0x913DAFB8.toInt(),
+            0xA401094F.toInt(), 0x0070A6E4.toInt(), 0x033781C1.toInt(), 0xA401094F.toInt(), 0xA401094F.toInt(), 0x80000000.toInt(), 0xE3129DE1.toInt(), 0x033781C1.toInt(),
+            0x00082A0B.toInt(), 0x3D0343E9.toInt(), 0x800042FB.toInt(), 0x3D0343E9.toInt(), 0xBD0343E9.toInt(), 0x000042FB.toInt(), 0x00FEC1AD.toInt(), 0x80000000.toInt(),
+            0x802D55A9.toInt(), 0x25F826BC.toInt(), 0x00679E1E.toInt(), 0x25F826BC.toInt(), 0xA5F826BC.toInt(), 0x80000000.toInt(), 0x993B12ED.toInt(), 0x00679E1E.toInt(),
+            0x3C4CA731.toInt(), 0x8D6C7D2C.toInt(), 0x0A3D0E32.toInt(), 0x3C4CA731.toInt(), 0x3C4CA731.toInt(), 0x8A3D0E32.toInt(), 0xEE5D899F.toInt(), 0x000022B5.toInt(),
+            0x33D1F1CD.toInt(), 0x80259189.toInt(), 0xAC1C8AFB.toInt(), 0x33D1F1CD.toInt(), 0x33D1F1CD.toInt(), 0x80000000.toInt(), 0xF3B2D377.toInt(), 0xAC1C8AFB.toInt(),
+            0x870966A1.toInt(), 0xB30DD057.toInt(), 0x80000984.toInt(), 0xB30DD057.toInt(), 0x330DD057.toInt(), 0x00000984.toInt(), 0x137808AA.toInt(), 0x80000000.toInt(),
+            0x276D7387.toInt(), 0x12F506AF.toInt(), 0x28CB1CC5.toInt(), 0x276D7387.toInt(), 0x276D7387.toInt(), 0x00000E34.toInt(), 0x53F815FF.toInt(), 0x28CB1CC5.toInt(),
+            0x0E2FD8CE.toInt(), 0xBFB40F95.toInt(), 0x0E775E4A.toInt(), 0xBFB40F95.toInt(), 0x3FB40F95.toInt(), 0x8E775E4A.toInt(), 0x8DFA0242.toInt(), 0x0155F0D0.toInt(),
+            0x005D160D.toInt(), 0xBFBE400D.toInt(), 0x273C7F84.toInt(), 0xBFBE400D.toInt(), 0x3FBE400D.toInt(), 0x808A5B50.toInt(), 0x803EA0D1.toInt(), 0x273C7F84.toInt(),
+            0xAF88F83F.toInt(), 0x1237F307.toInt(), 0x0244D6F9.toInt(), 0xAF88F83F.toInt(), 0xAF88F83F.toInt(), 0x8244D6F9.toInt(), 0xDCBE9E7A.toInt(), 0x00000001.toInt(),
+            0xB3CAB644.toInt(), 0x33A9EE28.toInt(), 0x1D9D7B53.toInt(), 0xB2832070.toInt(), 0xB43A5236.toInt(), 0xA8068EE8.toInt(), 0xBF98B15B.toInt(), 0xA8068EE3.toInt(),
+            0x97F0AAB2.toInt(), 0x0192CDB3.toInt(), 0x00000000.toInt(), 0x97F0AAB2.toInt(), 0x97F0AAB2.toInt(), 0x80000000.toInt(), 0xD5D1D736.toInt(), 0x80000000.toInt(),
+            0x83A43562.toInt(), 0x3FA6D48C.toInt(), 0x86AB5062.toInt(), 0x3FA6D48C.toInt(), 0xBFA6D48C.toInt(), 0x83D605E7.toInt(), 0x837BFA1A.toInt(), 0x86AEA87A.toInt(),
+            0x00981CA7.toInt(), 0x9EBC8C3B.toInt(), 0x00000000.toInt(), 0x9EBC8C3B.toInt(), 0x1EBC8C3B.toInt(), 0x80000000.toInt(), 0xA14E8784.toInt(), 0x80000000.toInt(),
+            0x3FA427FE.toInt(), 0x13635FD8.toInt(), 0x3783D8C3.toInt(), 0x3FA427FE.toInt(), 0x3FA427FE.toInt(), 0x1391CCEC.toInt(), 0x6BB8D2A9.toInt(), 0x3783D8C3.toInt(),
+            0x009D499E.toInt(), 0xBF9BCAE8.toInt(), 0x00BF707B.toInt(), 0xBF9BCAE8.toInt(), 0x3F9BCAE8.toInt(), 0x80BF707B.toInt(), 0x80813A70.toInt(), 0x00000000.toInt(),
+            0x0001E78F.toInt(), 0x00E093A7.toInt(), 0x2E7E77F7.toInt(), 0x00E27B36.toInt(), 0x80DEAC18.toInt(), 0x00000000.toInt(), 0x3C0AF1D7.toInt(), 0x2E7E77F7.toInt(),
+        )
+    }
+
+    /**
+     * True when the host's native Float operators reproduce every row.
+     *
+     * The ops are passed in so the check exercises exactly the code the fast
+     * path will run (including the `Double -> Float` narrowing used by fma).
+     */
+    fun hostMatches(
+        add: (Float, Float) -> Float,
+        sub: (Float, Float) -> Float,
+        mul: (Float, Float) -> Float,
+        div: (Float, Float) -> Float,
+        fma: (Float, Float, Float) -> Float,
+    ): Boolean {
+        val v = VECTORS
+        var i = 0
+        while (i < v.size) {
+            val a = Float.fromBits(v[i])
+            val b = Float.fromBits(v[i + 1])
+            val c = Float.fromBits(v[i + 2])
+            if (add(a, b).toRawBits() != v[i + 3]) return false
+            if (sub(a, b).toRawBits() != v[i + 4]) return false
+            if (mul(a, b).toRawBits() != v[i + 5]) return false
+            if (div(a, b).toRawBits() != v[i + 6]) return false
+            if (fma(a, b, c).toRawBits() != v[i + 7]) return false
+            i += ROW
+        }
+        return true
+    }
+}
@@ -8,6 +8,10 @@ import kotlin.math.floor
 /**
  * Software IEEE-754 float32 multiply using integer bit manipulation and
  * round-to-nearest, ties-to-even. Handles zeros, subnormals, infinities, NaNs.
+ *
+ * The `*Bits` kernels are always soft-float. The Float-level `add`/`sub`/
+ * `mul`/`div`/`fma` use hardware operators when [Float32Config] has verified
+ * the host is binary32-exact, and return the same bits either way.
  */
 object Float32Math {
     private const val SIGN_MASK = 0x80000000.toInt()
@@ -20,20 +24,99 @@ object Float32Math {
     private const val CANONICAL_NAN = 0x7FC00000.toInt()
     private val SHIFT64 = BitShiftEngine(BitShiftMode.NATIVE, 64)
 
-    fun mul(a: Float, b: Float): Float = Float.fromBits(mulBits(a.toRawBits(), b.toRawBits()))
+    // Float-level ops dispatch on Float32Config.useNative. A native result is
+    // only trusted when it is not NaN; NaNs are recomputed in soft-float so the
+    // payload matches the *Bits kernels on every target.
 
-    fun add(a: Float, b: Float): Float = Float.fromBits(addBits(a.toRawBits(), b.toRawBits()))
+    fun mul(a: Float, b: Float): Float {
+        if (Float32Config.useNative) {
+            val r = a * b
+            if (!r.isNaN()) return r
+        }
+        return Float.fromBits(mulBits(a.toRawBits(), b.toRawBits()))
+    }
 
-    fun sub(a: Float, b: Float): Float = Float.fromBits(subBits(a.toRawBits(), b.toRawBits()))
+    fun add(a: Float, b: Float): Float {
+        if (Float32Config.useNative) {
+            val r = a + b
+            if (!r.isNaN()) return r
+        }
+        return Float.fromBits(addBits(a.toRawBits(), b.toRawBits()))
+    }
 
-    fun fma(a: Float, b: Float, c: Float): Float = add(mul(a, b), c)
+    fun sub(a: Float, b: Float): Float {
+        if (Float32Config.useNative) {
+            val r = a - b
+            if (!r.isNaN()) return r
+        }
+        return Float.fromBits(subBits(a.toRawBits(), b.toRawBits()))
+    }
+
+    /** Fused multiply-add `a * b + c` with a single rounding. */
+    fun fma(a: Float, b: Float, c: Float): Float {
+        if (Float32Config.useNative) {
+            val r = fmaNative(a, b, c)
+            if (!r.isNaN()) return r
+        }
+        return Float.fromBits(fmaBits(a.toRawBits(), b.toRawBits(), c.toRawBits()))
+    }
 
     fun lrint(value: Float): Long = roundToNearestEven(value.toDouble()).toLong()
     fun lrint(value: Double): Long = roundToNearestEven(value).toLong()
 
     fun nearbyint(value: Float): Float = roundToNearestEven(value.toDouble()).toFloat()
 
-    fun div(a: Float, b: Float): Float = Float.fromBits(divBits(a.toRawBits(), b.toRawBits()))
+    fun div(a: Float, b: Float): Float {
+        if (Float32Config.useNative) {
+            val r = a / b
+            if (!r.isNaN()) return r
+        }
+        return Float.fromBits(divBits(a.toRawBits(), b.toRawBits()))
+    }
+
+    /**
+     * Single-rounding binary32 fused multiply-add on bit patterns.
+     *
+     * The product of two binary32 values is exact in binary64, so
+     * `p + c` is the only inexact step. It is rounded to odd in binary64
+     * (RNE sum, TwoSum error, then force the last bit odd when inexact);
+     * round-to-odd at 53 bits followed by one RNE rounding to 24 bits is
+     * correctly rounded (Boldo & Melquiond, 2008). The final narrowing is
+     * [doubleToFloatBits], so no step depends on host binary32 behavior.
+     *
+     * NaN inputs propagate quieted in a, b, c order; invalid operations
+     * (inf * 0, inf - inf) return the canonical quiet NaN.
+     */
+    fun fmaBits(aBits: Int, bBits: Int, cBits: Int): Int {
+        if (isNaNBits(aBits)) return aBits or 0x00400000
+        if (isNaNBits(bBits)) return bBits or 0x00400000
+        if (isNaNBits(cBits)) return cBits or 0x00400000
+        val s = productSumRoundToOdd(
+            Double.fromBits(floatToDoubleBits(aBits)),
+            Double.fromBits(floatToDoubleBits(bBits)),
+            Double.fromBits(floatToDoubleBits(cBits)),
+        )
+        if (s.isNaN()) return CANONICAL_NAN
+        return doubleToFloatBits(s.toRawBits())
+    }
+
+    /** [fmaBits] with hardware widening and narrowing; only valid when binary32 is native. */
+    internal fun fmaNative(a: Float, b: Float, c: Float): Float =
+        productSumRoundToOdd(a.toDouble(), b.toDouble(), c.toDouble()).toFloat()
+
+    /** `a * b + c` rounded to odd in binary64, for a, b, c widened from binary32. */
+    private fun productSumRoundToOdd(a: Double, b: Double, c: Double): Double {
+        val p = a * b // exact: 24 × 24 significand bits
+        val s = p + c
+        if (!s.isFinite()) return s
+        val bb = s - p
+        val err = (p - (s - bb)) + (c - bb)
+        if (err == 0.0) return s
+        val bits = s.toRawBits()
+        if (bits and 1L != 0L) return s
+        // Step one ulp toward the exact value: away from zero iff err has s's sign
+        return Double.fromBits(if ((err > 0.0) == (s > 0.0)) bits + 1 else bits - 1)
+    }
 
     // Integer conversions (compiler-rt style, nearest-even rounding where applicable)
     fun intToFloat(a: Int): Float = Float.fromBits(intToFloatBits(a))
@@ -228,7 +311,8 @@ object Float32Math {
         // Subnormal or underflow
         // shift = 30 - E (see derivation); E <= 0
         val shift = 30 - E
-        if (shift >= 53) return sign // underflow to zero
+        // shift == 53: |value| in [2^-150, 2^-149), guard is the implicit bit
+        if (shift > 53) return sign // underflow to zero
         var mant = (m ushr (shift)).toInt()
         val rem = m and ((1L shl shift) - 1)
         val guard = (rem ushr (shift - 1)) and 1L
@@ -480,8 +564,8 @@ object Float32Math {
         val aAbs = aRep and 0x7FFFFFFF.toInt()
         val bAbs = bRep and 0x7FFFFFFF.toInt()
 
-        // Detect zero/inf/NaN ranges quickly like LLVM (abs - 1 >= inf - 1)
-        if ((aAbs - 1 >= EXP_MASK - 1) || (bAbs - 1 >= EXP_MASK - 1)) {
+        // Detect zero/inf/NaN ranges quickly like LLVM (abs - 1 >= inf - 1, unsigned)
+        if ((aAbs - 1).toUInt() >= (EXP_MASK - 1).toUInt() || (bAbs - 1).toUInt() >= (EXP_MASK - 1).toUInt()) {
             // NaNs
             if (aAbs > EXP_MASK) return aRep or 0x00400000 // quietBit
             if (bAbs > EXP_MASK) return bRep or 0x00400000
@@ -533,7 +617,8 @@ object Float32Math {
         val align = aExp - bExp
         if (align != 0) {
             if (align < TYPE_WIDTH) {
-                val sticky = (SHIFT64.leftShift(bSig, TYPE_WIDTH - align).value != 0L)
+                // Sticky = any bit shifted out (compiler-rt gets this from a 32-bit rep_t wrap)
+                val sticky = (bSig and ((1L shl align) - 1)) != 0L
                 bSig = SHIFT64.rightShift(bSig, align).value or if (sticky) 1L else 0L
             } else {
                 bSig = 1 // sticky only
@@ -564,7 +649,7 @@ object Float32Math {
         // Subnormal before rounding
         if (aExp <= 0) {
             val shift = 1 - aExp
-            val sticky = if (shift < TYPE_WIDTH) (SHIFT64.leftShift(aSig, TYPE_WIDTH - shift).value != 0L) else (aSig != 0L)
+            val sticky = if (shift < TYPE_WIDTH) (aSig and ((1L shl shift) - 1)) != 0L else (aSig != 0L)
             aSig = SHIFT64.rightShift(aSig, shift).value or (if (sticky) 1L else 0L)
             aExp = 0
         }
@@ -679,7 +764,8 @@ object Float32Math {
         // Subnormal pack before rounding
         if (exp <= 0) {
             val shift = 1 - exp
-            val sticky = SHIFT64.leftShift(quo, shift).value != 0L || rem != 0L
+            val dropped = if (shift < 64) quo and ((1L shl shift) - 1) else quo
+            val sticky = dropped != 0L || rem != 0L
             quo = SHIFT64.rightShift(quo, shift).value or if (sticky) 1L else 0L
             exp = 0
         }
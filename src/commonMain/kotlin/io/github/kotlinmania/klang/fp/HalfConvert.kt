@@ -0,0 +1,102 @@
+package io.github.kotlinmania.klang.fp
+
+import io.github.kotlinmania.klang.bitwise.HalfPrecisionMath
+
+/**
+ * HalfConvert: bulk binary16 / bfloat16 ⇄ binary32 conversion.
+ *
+ * Array and heap counterparts of [CFloat16.fromFloat] / [CFloat16.toFloat]
+ * and [CBF16.fromFloat] / [CBF16.toFloat], bit-identical to them element by
+ * element, without an object per value. Encoding rounds to nearest even;
+ * see [HalfPrecisionMath] for the exact special-value rules.
+ *
+ * ## Usage Example
+ * ```kotlin
+ * // Load an fp16 checkpoint tensor that was read into the heap at addr
+ * val weights = FloatArray(count)
+ * HalfConvert.convertF16ToF32(addr, weights, 0, count)
+ *
+ * // Or decode heap to heap into a separate f32 region
+ * HalfConvert.convertF16ToF32(addr, f32Addr, count)
+ * ```
+ *
+ * ## Layouts
+ *
+ * - `ShortArray` overloads: one half per element (raw bits).
+ * - Heap overloads: little-endian 16-bit halves and 32-bit floats at byte
+ *   addresses. Heap-to-heap regions must not overlap. When both addresses
+ *   are 8-byte aligned the loop works on whole [io.github.kotlinmania.klang.mem.PackedBuffer]
+ *   words; otherwise it stages 256 elements at a time.
+ *
+ * ## Performance
+ *
+ * - **decode**: one table lookup pair per fp16 element, a shift per bf16 element
+ * - **encode**: a fixed sequence of integer ops per element, no data-dependent branches
+ */
+object HalfConvert {
+    /** Decode `src[srcOffset, srcOffset + n)` fp16 bits into `dst[dstOffset, dstOffset + n)`. */
+    fun convertF16ToF32(src: ShortArray, srcOffset: Int, dst: FloatArray, dstOffset: Int, n: Int) {
+        requireRange(n, srcOffset, src.size, dstOffset, dst.size)
+        for (i in 0 until n) dst[dstOffset + i] = Float.fromBits(HalfPrecisionMath.f16ToF32Bits(src[srcOffset + i].toInt()))
+    }
+
+    /** Encode `src[srcOffset, srcOffset + n)` to fp16 bits in `dst[dstOffset, dstOffset + n)`. */
+    fun convertF32ToF16(src: FloatArray, srcOffset: Int, dst: ShortArray, dstOffset: Int, n: Int) {
+        requireRange(n, srcOffset, src.size, dstOffset, dst.size)
+        for (i in 0 until n) dst[dstOffset + i] = HalfPrecisionMath.f32ToF16Bits(src[srcOffset + i].toRawBits()).toShort()
+    }
+
+    /** Decode `src[srcOffset, srcOffset + n)` bf16 bits into `dst[dstOffset, dstOffset + n)`. */
+    fun convertBF16ToF32(src: ShortArray, srcOffset: Int, dst: FloatArray, dstOffset: Int, n: Int) {
+        requireRange(n, srcOffset, src.size, dstOffset, dst.size)
+        for (i in 0 until n) dst[dstOffset + i] = Float.fromBits(HalfPrecisionMath.bf16ToF32Bits(src[srcOffset + i].toInt()))
+    }
+
+    /** Encode `src[srcOffset, srcOffset + n)` to bf16 bits in `dst[dstOffset, dstOffset + n)`. */
+    fun convertF32ToBF16(src: FloatArray, srcOffset: Int, dst: ShortArray, dstOffset: Int, n: Int) {
+        requireRange(n, srcOffset, src.size, dstOffset, dst.size)
+        for (i in 0 until n) dst[dstOffset + i] = HalfPrecisionMath.f32ToBf16Bits(src[srcOffset + i].toRawBits()).toShort()
+    }
+
+    /** Decode [n] fp16 values at heap address [srcAddr] into `dst[dstOffset, dstOffset + n)`. */
+    fun convertF16ToF32(srcAddr: Int, dst: FloatArray, dstOffset: Int, n: Int) {
+        requireRange(n, 0, n, dstOffset, dst.size)
+        HalfPrecisionMath.f16ToF32(srcAddr, dst, dstOffset, n)
+    }
+
+    /** Decode [n] bf16 values at heap address [srcAddr] into `dst[dstOffset, dstOffset + n)`. */
+    fun convertBF16ToF32(srcAddr: Int, dst: FloatArray, dstOffset: Int, n: Int) {
+        requireRange(n, 0, n, dstOffset, dst.size)
+        HalfPrecisionMath.bf16ToF32(srcAddr, dst, dstOffset, n)
+    }
+
+    /** Decode [n] fp16 values at [srcAddr] to binary32 at [dstAddr] (heap to heap). */
+    fun convertF16ToF32(srcAddr: Int, dstAddr: Int, n: Int) {
+        require(n >= 0)
+        HalfPrecisionMath.f16ToF32(srcAddr, dstAddr, n)
+    }
+
+    /** Encode [n] binary32 values at [srcAddr] to fp16 at [dstAddr] (heap to heap). */
+    fun convertF32ToF16(srcAddr: Int, dstAddr: Int, n: Int) {
+        require(n >= 0)
+        HalfPrecisionMath.f32ToF16(srcAddr, dstAddr, n)
+    }
+
+    /** Decode [n] bf16 values at [srcAddr] to binary32 at [dstAddr] (heap to heap). */
+    fun convertBF16ToF32(srcAddr: Int, dstAddr: Int, n: Int) {
+        require(n >= 0)
+        HalfPrecisionMath.bf16ToF32(srcAddr, dstAddr, n)
+    }
+
+    /** Encode [n] binary32 values at [srcAddr] to bf16 at [dstAddr] (heap to heap). */
+    fun convertF32ToBF16(srcAddr: Int, dstAddr: Int, n: Int) {
+        require(n >= 0)
+        HalfPrecisionMath.f32ToBf16(srcAddr, dstAddr, n)
+    }
+
+    private fun requireRange(n: Int, srcOffset: Int, srcSize: Int, dstOffset: Int, dstSize: Int) {
+        require(n >= 0)
+        require(srcOffset >= 0 && srcOffset + n <= srcSize)
+        require(dstOffset >= 0 && dstOffset + n <= dstSize)
+    }
+}
@@ -0,0 +1,167 @@
+package io.github.kotlinmania.klang.fp
+
+/**
+ * HostLongDouble: Strict-C mode for [CLongDouble]. Batched arithmetic is
+ * performed by the host C toolchain's own `long double` and `__float128`,
+ * so the results carry exactly the bits C would produce.
+ *
+ * [CLongDouble] models EXTENDED80 and IEEE128 with [CFloat128]
+ * double-double, which keeps about 106 bits and rounds differently from
+ * both. On Kotlin/Native this object reaches the real types through a
+ * cinterop over `tools/klang_longdouble.h`, the same header the C reference
+ * tools build. Elsewhere (JVM, Android, JS, Wasm) there is no backend, and
+ * [isAvailable] is false.
+ *
+ * ## Encoding
+ *
+ * Each value is two `Long`s, `[2 * i]` and `[2 * i + 1]`: the
+ * little-endian 16-byte memory image of the C object.
+ *
+ * | Format | Host type | Word 0 | Word 1 |
+ * |--------|-----------|--------|--------|
+ * | LONG_DOUBLE, 53 bits | `double` | IEEE binary64 bits | 0 |
+ * | LONG_DOUBLE, 64 bits | x87 extended | 64-bit significand (explicit leading 1) | sign + exponent (low 16 bits) |
+ * | LONG_DOUBLE, 113 bits / FLOAT128 | binary128 | low 64 bits | sign, exponent, top 48 fraction bits |
+ *
+ * ## Batching
+ *
+ * Every call processes whole arrays, so a block of `n` operations costs
+ * one foreign call rather than `n`. [fromDoubleDouble] / [toDoubleDouble]
+ * convert to and from the [CFloat128] `(hi, lo)` pair, rounding once into
+ * the target format.
+ *
+ * ```kotlin
+ * if (HostLongDouble.isSupported(Format.FLOAT128)) {
+ *     val a = LongArray(2 * n); val out = LongArray(2 * n)
+ *     HostLongDouble.fromDoubleDouble(Format.FLOAT128, his, los, a)
+ *     HostLongDouble.sqrt(Format.FLOAT128, a, out)
+ * }
+ * ```
+ *
+ * Calling an operation on a format that [isSupported] rejects throws
+ * [UnsupportedOperationException].
+ *
+ * @see CLongDouble For the portable emulation
+ */
+object HostLongDouble {
+    /** Value format of a batch. */
+    enum class Format {
+        /** The target's C `long double`, whatever it is ([longDoubleFlavor]). */
+        LONG_DOUBLE,
+
+        /** IEEE-754 binary128 (`__float128`, or `long double` where that is binary128). */
+        FLOAT128,
+    }
+
+    private val backend: HostLongDoubleBackend? = hostLongDoubleBackend
+
+    /** Whether this target has a Strict-C backend at all. */
+    val isAvailable: Boolean get() = backend != null
+
+    /** `LDBL_MANT_DIG` of the host `long double` (53, 64 or 113), or 0 without a backend. */
+    val longDoubleMantissaBits: Int = backend?.longDoubleMantissaBits ?: 0
+
+    /** The [CLongDouble.Flavor] matching the host `long double`, or null without a backend. */
+    val longDoubleFlavor: CLongDouble.Flavor? = when (longDoubleMantissaBits) {
+        53 -> CLongDouble.Flavor.DOUBLE64
+        64 -> CLongDouble.Flavor.EXTENDED80
+        113 -> CLongDouble.Flavor.IEEE128
+        else -> null
+    }
+
+    fun isSupported(format: Format): Boolean {
+        val b = backend ?: return false
+        return when (format) {
+            Format.LONG_DOUBLE -> true
+            Format.FLOAT128 -> b.hasFloat128
+        }
+    }
+
+    /** `out[i] = a[i] + b[i]` for the first [n] values. */
+    fun add(format: Format, a: LongArray, b: LongArray, out: LongArray, n: Int = out.size / 2) =
+        binary(format, OP_ADD, a, b, out, n)
+
+    /** `out[i] = a[i] - b[i]` for the first [n] values. */
+    fun sub(format: Format, a: LongArray, b: LongArray, out: LongArray, n: Int = out.size / 2) =
+        binary(format, OP_SUB, a, b, out, n)
+
+    /** `out[i] = a[i] * b[i]` for the first [n] values. */
+    fun mul(format: Format, a: LongArray, b: LongArray, out: LongArray, n: Int = out.size / 2) =
+        binary(format, OP_MUL, a, b, out, n)
+
+    /** `out[i] = a[i] / b[i]` for the first [n] values. */
+    fun div(format: Format, a: LongArray, b: LongArray, out: LongArray, n: Int = out.size / 2) =
+        binary(format, OP_DIV, a, b, out, n)
+
+    /** `out[i] = sqrt(a[i])`, correctly rounded, for the first [n] values. [out] may be [a]. */
+    fun sqrt(format: Format, a: LongArray, out: LongArray, n: Int = out.size / 2) {
+        checkWords(a, n)
+        checkWords(out, n)
+        if (n == 0) return
+        status(format, backendFor(format).sqrt(format.ordinal, a, out, n))
+    }
+
+    /** Round each `hi[i] + lo[i]` once into [format], writing `out[2 * i]`, `out[2 * i + 1]`. */
+    fun fromDoubleDouble(format: Format, hi: DoubleArray, lo: DoubleArray, out: LongArray, n: Int = hi.size) {
+        require(n >= 0 && n <= hi.size && n <= lo.size) { "n=$n exceeds the double-double inputs" }
+        checkWords(out, n)
+        if (n == 0) return
+        status(format, backendFor(format).fromDoubleDouble(format.ordinal, hi, lo, out, n))
+    }
+
+    /** Split each encoded value into `hi[i] = (double) x`, `lo[i] = (double) (x - hi[i])`. */
+    fun toDoubleDouble(format: Format, src: LongArray, hi: DoubleArray, lo: DoubleArray, n: Int = hi.size) {
+        require(n >= 0 && n <= hi.size && n <= lo.size) { "n=$n exceeds the double-double outputs" }
+        checkWords(src, n)
+        if (n == 0) return
+        status(format, backendFor(format).toDoubleDouble(format.ordinal, src, hi, lo, n))
+    }
+
+    private const val OP_ADD = 0
+    private const val OP_SUB = 1
+    private const val OP_MUL = 2
+    private const val OP_DIV = 3
+
+    private fun binary(format: Format, op: Int, a: LongArray, b: LongArray, out: LongArray, n: Int) {
+        checkWords(a, n)
+        checkWords(b, n)
+        checkWords(out, n)
+        if (n == 0) return
+        status(format, backendFor(format).binary(format.ordinal, op, a, b, out, n))
+    }
+
+    private fun backendFor(format: Format): HostLongDoubleBackend {
+        if (!isSupported(format)) throw UnsupportedOperationException("Host $format arithmetic is not available on this target")
+        return backend!!
+    }
+
+    private fun checkWords(words: LongArray, n: Int) {
+        require(n >= 0 && n <= words.size / 2) { "n=$n values need ${2L * n} words, array has ${words.size}" }
+    }
+
+    private fun status(format: Format, rc: Int) {
+        if (rc != 0) throw UnsupportedOperationException("Host $format kernel failed ($rc)")
+    }
+}
+
+/**
+ * Platform bridge behind [HostLongDouble]. Formats and ops are passed as
+ * the `KLD_FMT_*` / `KLD_*` codes of `tools/klang_longdouble.h`; every call
+ * returns that header's status (0, or -1 for an unavailable format).
+ * [HostLongDouble] has already checked the array sizes and that n > 0.
+ */
+internal interface HostLongDoubleBackend {
+    val longDoubleMantissaBits: Int
+    val hasFloat128: Boolean
+
+    fun binary(format: Int, op: Int, a: LongArray, b: LongArray, out: LongArray, n: Int): Int
+
+    fun sqrt(format: Int, a: LongArray, out: LongArray, n: Int): Int
+
+    fun fromDoubleDouble(format: Int, hi: DoubleArray, lo: DoubleArray, out: LongArray, n: Int): Int
+
+    fun toDoubleDouble(format: Int, src: LongArray, hi: DoubleArray, lo: DoubleArray, n: Int): Int
+}
+
+/** The Strict-C backend of this target, or null where C `long double` is out of reach. */
+internal expect val hostLongDoubleBackend: HostLongDoubleBackend?
@@ -0,0 +1,326 @@
+package io.github.kotlinmania.klang.fp
+
+import io.github.kotlinmania.klang.bitwise.CE8M0Math
+import io.github.kotlinmania.klang.bitwise.MxElementMath
+import io.github.kotlinmania.klang.mem.GlobalHeap
+
+/** Element encodings supported by [MxCodec]. */
+enum class MxElementFormat(
+    /** Storage bits per element. */
+    val bitsPerElement: Int,
+    /** Unbiased exponent of the format's top binade, used to pick the block scale. */
+    val emax: Int,
+) {
+    /** OCP MXFP8: signed E4M3, one byte per element, max 448. */
+    E4M3(8, MxElementMath.E4M3_EMAX),
+
+    /** OCP MXFP4: signed E2M1, two elements per byte (even index in the low nibble), max 6. */
+    E2M1(4, MxElementMath.E2M1_EMAX),
+}
+
+/**
+ * MxCodec: array-level microscaling (MX) block quantization.
+ *
+ * An MX tensor is split into blocks of [BLOCK_SIZE] consecutive elements.
+ * Each block stores one [CE8M0] scale byte `k + 127` (value `2^k`) and its
+ * elements encoded as `x × 2^(−k)` in an [MxElementFormat]. The last block
+ * may be shorter. Scales and elements live in separate `ByteArray`s (or heap
+ * regions), so a row of `n` values takes [scaleCount]`(n)` scale bytes and
+ * [elementBytes]`(n, format)` element bytes.
+ *
+ * ## Usage Example
+ * ```kotlin
+ * val w = FloatArray(4096) { ... }
+ * val scales = ByteArray(MxCodec.scaleCount(w.size))
+ * val elems = ByteArray(MxCodec.elementBytes(w.size, MxElementFormat.E2M1))
+ * MxCodec.quantize(w.size, w, 0, MxElementFormat.E2M1, scales, 0, elems, 0)
+ *
+ * val y = MxCodec.dot(w.size, MxElementFormat.E2M1, scales, 0, elems, 0, x, 0)
+ * ```
+ *
+ * ## Scale Selection
+ *
+ * `k = floor(log2(max |x|)) − emax`, the OCP MX v1.0 rule, clamped to the
+ * CE8M0 range; NaN and infinities are ignored when taking the maximum. An
+ * all-zero block gets scale byte 0x00.
+ *
+ * ## Determinism
+ *
+ * Encoding works on Float bit patterns in [MxElementMath] (round to nearest
+ * even, saturating), so it involves no float arithmetic at all. Decoding is
+ * a 256-entry table lookup (512 entries for E2M1, indexed by byte and
+ * nibble) and one [Float32Math.mul] by the power-of-two scale.
+ *
+ * [dot] decodes each block unscaled, takes [VectorOps.dotBlocked] against
+ * the matching slice of `x`, multiplies the partial by the block scale and
+ * accumulates the partials in block order. Multiplying by a power of two is
+ * exact, so the result equals the same per-block sum over [dequantize]d
+ * values unless a product over- or underflows.
+ *
+ * ## Performance
+ *
+ * - **quantize**: one integer pass for the block maximum, one for encoding
+ * - **dequantize / dot**: table lookups, no branches per element
+ * - **dot / gemv**: no dequantized copy of the weights; one 32-float scratch
+ *   per call
+ *
+ * @see CE8M0 For the scale format
+ * @see CUE4M3 For the unsigned scalar E4M3 variant
+ */
+object MxCodec {
+    /** Elements per shared scale. */
+    const val BLOCK_SIZE = 32
+
+    private const val SCALE_BIAS = 127
+
+    private val E4M3_DECODE = FloatArray(256) { Float.fromBits(MxElementMath.decodeE4M3Bits(it)) }
+
+    /** Entry `2 * byte + nibble`: both E2M1 elements of every storage byte. */
+    private val E2M1_DECODE = FloatArray(512) {
+        Float.fromBits(MxElementMath.decodeE2M1Bits(MxElementMath.unpackE2M1(it / 2, it % 2)))
+    }
+
+    /** Number of scale bytes for [length] elements. */
+    fun scaleCount(length: Int): Int = (length + BLOCK_SIZE - 1) / BLOCK_SIZE
+
+    /** Number of element bytes for [length] elements in [format]. */
+    fun elementBytes(length: Int, format: MxElementFormat): Int = when (format) {
+        MxElementFormat.E4M3 -> length
+        MxElementFormat.E2M1 -> (length + 1) / 2
+    }
+
+    /** Decode one element code to its unscaled value. */
+    fun decodeElement(format: MxElementFormat, code: Int): Float = when (format) {
+        MxElementFormat.E4M3 -> E4M3_DECODE[code and 0xFF]
+        MxElementFormat.E2M1 -> E2M1_DECODE[(code and 0xF) * 2]
+    }
+
+    /**
+     * Quantize `src[srcOffset until srcOffset + length]` into MX blocks.
+     *
+     * @param length Number of elements
+     * @param src Input values
+     * @param srcOffset Starting offset in src
+     * @param format Element encoding
+     * @param scales Output CE8M0 scale bytes, [scaleCount] of them
+     * @param scalesOffset Starting offset in scales
+     * @param elements Output element bytes, [elementBytes] of them
+     * @param elementsOffset Starting offset in elements
+     * @throws IllegalArgumentException if offsets/length are out of bounds
+     */
+    fun quantize(
+        length: Int, src: FloatArray, srcOffset: Int, format: MxElementFormat,
+        scales: ByteArray, scalesOffset: Int, elements: ByteArray, elementsOffset: Int,
+    ) {
+        require(length >= 0)
+        require(srcOffset >= 0 && srcOffset + length <= src.size)
+        requireBlocks(length, format, scalesOffset, scales.size, elementsOffset, elements.size)
+        var i = 0
+        var block = scalesOffset
+        while (i < length) {
+            val n = minOf(BLOCK_SIZE, length - i)
+            scales[block++] = encodeBlock(src, srcOffset + i, n, format, elements, elementsOffset + elementBytes(i, format))
+            i += n
+        }
+    }
+
+    /**
+     * Dequantize MX blocks into `dst[dstOffset until dstOffset + length]`.
+     *
+     * @throws IllegalArgumentException if offsets/length are out of bounds
+     */
+    fun dequantize(
+        length: Int, format: MxElementFormat, scales: ByteArray, scalesOffset: Int,
+        elements: ByteArray, elementsOffset: Int, dst: FloatArray, dstOffset: Int,
+    ) {
+        require(length >= 0)
+        require(dstOffset >= 0 && dstOffset + length <= dst.size)
+        requireBlocks(length, format, scalesOffset, scales.size, elementsOffset, elements.size)
+        var i = 0
+        var block = scalesOffset
+        while (i < length) {
+            val n = minOf(BLOCK_SIZE, length - i)
+            decodeBlock(format, elements, elementsOffset + elementBytes(i, format), n, dst, dstOffset + i)
+            val scale = scaleOf(scales[block++].toInt())
+            for (j in dstOffset + i until dstOffset + i + n) dst[j] = Float32Math.mul(dst[j], scale)
+            i += n
+        }
+    }
+
+    /**
+     * Fused dequantize + dot: `sum(dequantize(w)[i] * x[xOffset + i])`
+     * without materializing the dequantized vector.
+     *
+     * Each block's partial is `dotBlocked` over the unscaled values, then
+     * scaled; partials are accumulated with [Float32Math.add] in block order.
+     *
+     * @return Dot product (deterministic across platforms)
+     * @throws IllegalArgumentException if offsets/length are out of bounds
+     */
+    fun dot(
+        length: Int, format: MxElementFormat, scales: ByteArray, scalesOffset: Int,
+        elements: ByteArray, elementsOffset: Int, x: FloatArray, xOffset: Int,
+    ): Float {
+        require(length >= 0)
+        require(xOffset >= 0 && xOffset + length <= x.size)
+        requireBlocks(length, format, scalesOffset, scales.size, elementsOffset, elements.size)
+        return dotBlocks(length, format, scales, scalesOffset, elements, elementsOffset, x, xOffset, FloatArray(BLOCK_SIZE))
+    }
+
+    /**
+     * Matrix-vector product `y = W · x` over an MX-quantized `m × k` matrix.
+     *
+     * Each row is quantized on its own (as by [quantize] with length k), so
+     * row `i` starts at scale byte `scalesOffset + i * scaleCount(k)` and
+     * element byte `elementsOffset + i * elementBytes(k, format)`. Each
+     * `y[i]` is exactly the [dot] of row i with x.
+     *
+     * @throws IllegalArgumentException if dimensions/offsets are out of bounds
+     */
+    fun gemv(
+        m: Int, k: Int, format: MxElementFormat, scales: ByteArray, scalesOffset: Int,
+        elements: ByteArray, elementsOffset: Int, x: FloatArray, xOffset: Int, y: FloatArray, yOffset: Int,
+    ) {
+        require(m >= 0 && k >= 0)
+        require(xOffset >= 0 && xOffset + k <= x.size)
+        require(yOffset >= 0 && yOffset + m <= y.size)
+        val rowScales = scaleCount(k)
+        val rowBytes = elementBytes(k, format)
+        require(scalesOffset >= 0 && scalesOffset + m * rowScales <= scales.size)
+        require(elementsOffset >= 0 && elementsOffset + m * rowBytes <= elements.size)
+        val scratch = FloatArray(BLOCK_SIZE)
+        for (i in 0 until m) {
+            y[yOffset + i] = dotBlocks(
+                k, format, scales, scalesOffset + i * rowScales,
+                elements, elementsOffset + i * rowBytes, x, xOffset, scratch,
+            )
+        }
+    }
+
+    /**
+     * [quantize] into heap regions: [scaleCount] bytes at [scalesAddr] and
+     * [elementBytes] bytes at [elementsAddr].
+     */
+    fun quantizeToHeap(
+        length: Int, src: FloatArray, srcOffset: Int, format: MxElementFormat, scalesAddr: Int, elementsAddr: Int,
+    ) {
+        require(length >= 0)
+        require(srcOffset >= 0 && srcOffset + length <= src.size)
+        val codes = ByteArray(BLOCK_SIZE)
+        var i = 0
+        var block = scalesAddr
+        while (i < length) {
+            val n = minOf(BLOCK_SIZE, length - i)
+            GlobalHeap.sb(block++, encodeBlock(src, srcOffset + i, n, format, codes, 0))
+            val base = elementsAddr + elementBytes(i, format)
+            for (j in 0 until elementBytes(n, format)) GlobalHeap.sb(base + j, codes[j])
+            i += n
+        }
+    }
+
+    /** [dequantize] from heap regions written by [quantizeToHeap]. */
+    fun dequantizeFromHeap(
+        length: Int, format: MxElementFormat, scalesAddr: Int, elementsAddr: Int, dst: FloatArray, dstOffset: Int,
+    ) {
+        require(length >= 0)
+        require(dstOffset >= 0 && dstOffset + length <= dst.size)
+        val codes = ByteArray(BLOCK_SIZE)
+        var i = 0
+        var block = scalesAddr
+        while (i < length) {
+            val n = minOf(BLOCK_SIZE, length - i)
+            loadCodes(elementsAddr + elementBytes(i, format), elementBytes(n, format), codes)
+            decodeBlock(format, codes, 0, n, dst, dstOffset + i)
+            val scale = scaleOf(GlobalHeap.lbu(block++))
+            for (j in dstOffset + i until dstOffset + i + n) dst[j] = Float32Math.mul(dst[j], scale)
+            i += n
+        }
+    }
+
+    /** [dot] over heap regions written by [quantizeToHeap]; bit-identical to the `ByteArray` overload. */
+    fun dotHeap(length: Int, format: MxElementFormat, scalesAddr: Int, elementsAddr: Int, x: FloatArray, xOffset: Int): Float {
+        require(length >= 0)
+        require(xOffset >= 0 && xOffset + length <= x.size)
+        val codes = ByteArray(BLOCK_SIZE)
+        val scratch = FloatArray(BLOCK_SIZE)
+        var acc = 0.0f
+        var i = 0
+        var block = scalesAddr
+        while (i < length) {
+            val n = minOf(BLOCK_SIZE, length - i)
+            loadCodes(elementsAddr + elementBytes(i, format), elementBytes(n, format), codes)
+            decodeBlock(format, codes, 0, n, scratch, 0)
+            val part = VectorOps.dotBlocked(n, scratch, 0, x, xOffset + i)
+            acc = Float32Math.add(acc, Float32Math.mul(part, scaleOf(GlobalHeap.lbu(block++))))
+            i += n
+        }
+        return acc
+    }
+
+    // ---- block kernels ----
+
+    /** Encode [n] values into [out] at [outOffset]; returns the CE8M0 scale byte. */
+    private fun encodeBlock(src: FloatArray, srcOffset: Int, n: Int, format: MxElementFormat, out: ByteArray, outOffset: Int): Byte {
+        var maxAbs = 0
+        for (j in srcOffset until srcOffset + n) {
+            val a = MxElementMath.finiteMagnitudeBits(src[j].toRawBits())
+            if (a > maxAbs) maxAbs = a
+        }
+        val k = MxElementMath.sharedExponent(maxAbs, format.emax)
+        when (format) {
+            MxElementFormat.E4M3 -> for (j in 0 until n) {
+                out[outOffset + j] = MxElementMath.encodeE4M3(src[srcOffset + j].toRawBits(), k).toByte()
+            }
+            MxElementFormat.E2M1 -> {
+                var j = 0
+                while (j < n) {
+                    val even = MxElementMath.encodeE2M1(src[srcOffset + j].toRawBits(), k)
+                    val odd = if (j + 1 < n) MxElementMath.encodeE2M1(src[srcOffset + j + 1].toRawBits(), k) else 0
+                    out[outOffset + j / 2] = MxElementMath.packE2M1Pair(even, odd).toByte()
+                    j += 2
+                }
+            }
+        }
+        return (k + SCALE_BIAS).toByte()
+    }
+
+    /** Decode [n] unscaled values from [codes] at [codesOffset] into [dst]. */
+    private fun decodeBlock(format: MxElementFormat, codes: ByteArray, codesOffset: Int, n: Int, dst: FloatArray, dstOffset: Int) {
+        when (format) {
+            MxElementFormat.E4M3 -> for (j in 0 until n) {
+                dst[dstOffset + j] = E4M3_DECODE[codes[codesOffset + j].toInt() and 0xFF]
+            }
+            MxElementFormat.E2M1 -> for (j in 0 until n) {
+                dst[dstOffset + j] = E2M1_DECODE[(codes[codesOffset + j / 2].toInt() and 0xFF) * 2 + j % 2]
+            }
+        }
+    }
+
+    private fun dotBlocks(
+        length: Int, format: MxElementFormat, scales: ByteArray, scalesOffset: Int,
+        elements: ByteArray, elementsOffset: Int, x: FloatArray, xOffset: Int, scratch: FloatArray,
+    ): Float {
+        var acc = 0.0f
+        var i = 0
+        var block = scalesOffset
+        while (i < length) {
+            val n = minOf(BLOCK_SIZE, length - i)
+            decodeBlock(format, elements, elementsOffset + elementBytes(i, format), n, scratch, 0)
+            val part = VectorOps.dotBlocked(n, scratch, 0, x, xOffset + i)
+            acc = Float32Math.add(acc, Float32Math.mul(part, scaleOf(scales[block++].toInt())))
+            i += n
+        }
+        return acc
+    }
+
+    private fun scaleOf(scaleByte: Int): Float = Float.fromBits(CE8M0Math.toFp32Bits(scaleByte))
+
+    private fun loadCodes(addr: Int, count: Int, codes: ByteArray) {
+        for (j in 0 until count) codes[j] = GlobalHeap.lb(addr + j)
+    }
+
+    private fun requireBlocks(length: Int, format: MxElementFormat, scalesOffset: Int, scalesSize: Int, elementsOffset: Int, elementsSize: Int) {
+        require(scalesOffset >= 0 && scalesOffset + scaleCount(length) <= scalesSize)
+        require(elementsOffset >= 0 && elementsOffset + elementBytes(length, format) <= elementsSize)
+    }
+}
@@ -1,5 +1,8 @@
 package io.github.kotlinmania.klang.fp
 
+import io.github.kotlinmania.klang.mem.GlobalHeap
+import io.github.kotlinmania.klang.mem.U32View
+
 /**
  * VectorOps: Deterministic floating-point vector operations.
  *
@@ -48,6 +51,25 @@ package io.github.kotlinmania.klang.fp
  * ```
  * Computes `out[i] = alpha * x[i] + y[i]` (BLAS Level 1 operation).
  *
+ * ### Blocked Dot / GEMV / GEMM
+ * ```kotlin
+ * dotBlocked(length, x, xOffset, y, yOffset)
+ * gemv(m, k, a, aOffset, lda, x, xOffset, y, yOffset)
+ * gemm(m, n, k, a, aOffset, lda, b, bOffset, ldb, c, cOffset, ldc)
+ * ```
+ * [dotAccumulate] is one dependency chain: every add waits for the previous
+ * one. The blocked kernels split the sum into [BLOCK_LANES] independent
+ * partial sums (element `i` goes to lane `i % BLOCK_LANES`, in ascending
+ * order) and combine them with a fixed pairwise tree:
+ * ```
+ * ((l0 + l1) + (l2 + l3)) + ((l4 + l5) + (l6 + l7))
+ * ```
+ * The order is part of the contract, so results are still bit-identical on
+ * every target; they differ from [dotAccumulate] only because the
+ * association differs. [gemv] and [gemm] define every output element as
+ * exactly the [dotBlocked] of a row of A with x (or a column of B), and are
+ * available over `FloatArray` and heap [U32View] (Float bit patterns).
+ *
  * ## Determinism Guarantee
  *
  * All operations use [Float32Math] which guarantees:
@@ -105,6 +127,9 @@ package io.github.kotlinmania.klang.fp
  *
  * - **dotAccumulate**: O(n) with ~2-3× slowdown vs native (worth it for determinism)
  * - **axpy**: O(n) with ~2-3× slowdown vs native
+ * - **dotBlocked**: same work as dotAccumulate, 8 independent chains the CPU can overlap
+ * - **gemm**: packs B into column panels once per [GEMM_PANEL] columns so every
+ *   inner product runs over contiguous memory
  * - **Trade-off**: Sacrifice speed for reproducibility
  *
  * **Benchmark** (10K element dot product):
@@ -137,7 +162,6 @@ package io.github.kotlinmania.klang.fp
  * ## Future Enhancements
  *
  * Planned operations:
- * - ⚠️ Matrix multiplication (GEMM)
  * - ⚠️ Norm calculations (L1, L2, Linf)
  * - ⚠️ Vector scaling and addition (SCAL, AXPBY)
  * - ⚠️ Dot product with double accumulator (mixed precision)
@@ -263,4 +287,311 @@ object VectorOps {
             out[outOffset + i] = Float32Math.add(scaled, y[yOffset + i])
         }
     }
+
+    /** Number of independent partial sums in the blocked kernels. Part of the result contract. */
+    const val BLOCK_LANES = 8
+
+    /** Columns of B packed per panel in [gemm]. Does not affect results. */
+    const val GEMM_PANEL = 64
+
+    /**
+     * Deterministic blocked dot product.
+     *
+     * Same inputs as [dotAccumulate], but accumulated in [BLOCK_LANES]
+     * independent [Float32Math] partial sums combined by a fixed tree (see the
+     * class docs). Bit-identical across platforms; generally *not*
+     * bit-identical to [dotAccumulate].
+     *
+     * ## Example
+     * ```kotlin
+     * val x = FloatArray(4096) { 0.5f }
+     * val dot = VectorOps.dotBlocked(4096, x, 0, x, 0)   // 1024.0
+     * ```
+     *
+     * @param length Number of elements to process
+     * @param lhs Left-hand side array
+     * @param lhsOffset Starting offset in lhs (default: 0)
+     * @param rhs Right-hand side array
+     * @param rhsOffset Starting offset in rhs (default: 0)
+     * @return Dot product (deterministic across platforms)
+     * @throws IllegalArgumentException if offsets/length are out of bounds
+     */
+    fun dotBlocked(length: Int, lhs: FloatArray, lhsOffset: Int = 0, rhs: FloatArray, rhsOffset: Int = 0): Float {
+        require(length >= 0)
+        require(lhsOffset >= 0 && lhsOffset + length <= lhs.size)
+        require(rhsOffset >= 0 && rhsOffset + length <= rhs.size)
+        var l0 = 0.0f; var l1 = 0.0f; var l2 = 0.0f; var l3 = 0.0f
+        var l4 = 0.0f; var l5 = 0.0f; var l6 = 0.0f; var l7 = 0.0f
+        val blocked = length - length % BLOCK_LANES
+        var i = 0
+        while (i < blocked) {
+            val a = lhsOffset + i
+            val b = rhsOffset + i
+            l0 = Float32Math.add(l0, Float32Math.mul(lhs[a], rhs[b]))
+            l1 = Float32Math.add(l1, Float32Math.mul(lhs[a + 1], rhs[b + 1]))
+            l2 = Float32Math.add(l2, Float32Math.mul(lhs[a + 2], rhs[b + 2]))
+            l3 = Float32Math.add(l3, Float32Math.mul(lhs[a + 3], rhs[b + 3]))
+            l4 = Float32Math.add(l4, Float32Math.mul(lhs[a + 4], rhs[b + 4]))
+            l5 = Float32Math.add(l5, Float32Math.mul(lhs[a + 5], rhs[b + 5]))
+            l6 = Float32Math.add(l6, Float32Math.mul(lhs[a + 6], rhs[b + 6]))
+            l7 = Float32Math.add(l7, Float32Math.mul(lhs[a + 7], rhs[b + 7]))
+            i += BLOCK_LANES
+        }
+        // Tail: element i still lands in lane i % BLOCK_LANES
+        val rem = length - blocked
+        val a = lhsOffset + blocked
+        val b = rhsOffset + blocked
+        if (rem > 0) l0 = Float32Math.add(l0, Float32Math.mul(lhs[a], rhs[b]))
+        if (rem > 1) l1 = Float32Math.add(l1, Float32Math.mul(lhs[a + 1], rhs[b + 1]))
+        if (rem > 2) l2 = Float32Math.add(l2, Float32Math.mul(lhs[a + 2], rhs[b + 2]))
+        if (rem > 3) l3 = Float32Math.add(l3, Float32Math.mul(lhs[a + 3], rhs[b + 3]))
+        if (rem > 4) l4 = Float32Math.add(l4, Float32Math.mul(lhs[a + 4], rhs[b + 4]))
+        if (rem > 5) l5 = Float32Math.add(l5, Float32Math.mul(lhs[a + 5], rhs[b + 5]))
+        if (rem > 6) l6 = Float32Math.add(l6, Float32Math.mul(lhs[a + 6], rhs[b + 6]))
+        return combineLanes(l0, l1, l2, l3, l4, l5, l6, l7)
+    }
+
+    /**
+     * Deterministic blocked dot product over heap Float32 words.
+     *
+     * Both views hold Float bit patterns; the result is bit-identical to the
+     * `FloatArray` overload on the same values.
+     *
+     * @param length Number of elements to process
+     * @param lhs Left-hand side view
+     * @param lhsOffset Starting word offset in lhs (default: 0)
+     * @param rhs Right-hand side view
+     * @param rhsOffset Starting word offset in rhs (default: 0)
+     * @return Dot product (deterministic across platforms)
+     * @throws IllegalArgumentException if offsets/length are out of bounds
+     */
+    fun dotBlocked(length: Int, lhs: U32View, lhsOffset: Int = 0, rhs: U32View, rhsOffset: Int = 0): Float {
+        require(length >= 0)
+        require(lhsOffset >= 0 && lhsOffset + length <= lhs.wordCount)
+        require(rhsOffset >= 0 && rhsOffset + length <= rhs.wordCount)
+        return dotBlockedHeap(length, lhs.base + lhsOffset * 4, rhs.base + rhsOffset * 4)
+    }
+
+    /**
+     * Deterministic matrix-vector product `y = A · x` (BLAS Level 2, no alpha/beta).
+     *
+     * A is `m × k`, row-major with leading dimension [lda]. Each `y[i]` is
+     * exactly `dotBlocked(k, a, aOffset + i * lda, x, xOffset)`.
+     *
+     * ## Example
+     * ```kotlin
+     * val a = floatArrayOf(1f, 2f, 3f,
+     *                      4f, 5f, 6f)
+     * val y = FloatArray(2)
+     * VectorOps.gemv(2, 3, a, 0, 3, floatArrayOf(1f, 1f, 1f), 0, y, 0)
+     * // y = [6.0, 15.0]
+     * ```
+     *
+     * @param m Rows of A (length of y)
+     * @param k Columns of A (length of x)
+     * @param a Matrix A
+     * @param aOffset Offset of A[0][0]
+     * @param lda Row stride of A (≥ k)
+     * @param x Input vector
+     * @param xOffset Starting offset in x
+     * @param y Output vector (overwritten; must not overlap A or x)
+     * @param yOffset Starting offset in y
+     * @throws IllegalArgumentException if dimensions/offsets are out of bounds
+     */
+    fun gemv(m: Int, k: Int, a: FloatArray, aOffset: Int, lda: Int, x: FloatArray, xOffset: Int, y: FloatArray, yOffset: Int) {
+        requireMatrix(m, k, aOffset, lda, a.size)
+        require(xOffset >= 0 && xOffset + k <= x.size)
+        require(yOffset >= 0 && yOffset + m <= y.size)
+        for (i in 0 until m) {
+            y[yOffset + i] = dotBlocked(k, a, aOffset + i * lda, x, xOffset)
+        }
+    }
+
+    /**
+     * Deterministic matrix-vector product over heap Float32 words.
+     *
+     * Same contract as the `FloatArray` overload; offsets and [lda] are in words.
+     */
+    fun gemv(m: Int, k: Int, a: U32View, aOffset: Int, lda: Int, x: U32View, xOffset: Int, y: U32View, yOffset: Int) {
+        requireMatrix(m, k, aOffset, lda, a.wordCount)
+        require(xOffset >= 0 && xOffset + k <= x.wordCount)
+        require(yOffset >= 0 && yOffset + m <= y.wordCount)
+        val xAddr = x.base + xOffset * 4
+        for (i in 0 until m) {
+            val row = a.base + (aOffset + i * lda) * 4
+            GlobalHeap.swf(y.base + (yOffset + i) * 4, dotBlockedHeap(k, row, xAddr))
+        }
+    }
+
+    /**
+     * Deterministic matrix product `C = A · B` (BLAS Level 3, no alpha/beta).
+     *
+     * A is `m × k`, B is `k × n`, C is `m × n`, all row-major with leading
+     * dimensions [lda], [ldb], [ldc]. Each `C[i][j]` is exactly the
+     * [dotBlocked] of row i of A with column j of B, so the result does not
+     * depend on the tiling.
+     *
+     * ## Algorithm
+     * ```
+     * for each panel of GEMM_PANEL columns of B:
+     *     pack the panel transposed (column j contiguous)
+     *     for each row i of A:
+     *         pack row i once
+     *         C[i][j] = blocked dot(row i, column j) for j in panel
+     * ```
+     * Packing turns the strided column walk into contiguous reads and keeps
+     * the current A row and B panel hot in cache across the inner loop.
+     *
+     * @param m Rows of A and C
+     * @param n Columns of B and C
+     * @param k Columns of A / rows of B
+     * @param a Matrix A
+     * @param aOffset Offset of A[0][0]
+     * @param lda Row stride of A (≥ k)
+     * @param b Matrix B
+     * @param bOffset Offset of B[0][0]
+     * @param ldb Row stride of B (≥ n)
+     * @param c Output matrix C (overwritten; must not overlap A or B)
+     * @param cOffset Offset of C[0][0]
+     * @param ldc Row stride of C (≥ n)
+     * @throws IllegalArgumentException if dimensions/offsets are out of bounds
+     */
+    fun gemm(
+        m: Int, n: Int, k: Int,
+        a: FloatArray, aOffset: Int, lda: Int,
+        b: FloatArray, bOffset: Int, ldb: Int,
+        c: FloatArray, cOffset: Int, ldc: Int,
+    ) {
+        requireMatrix(m, k, aOffset, lda, a.size)
+        requireMatrix(k, n, bOffset, ldb, b.size)
+        requireMatrix(m, n, cOffset, ldc, c.size)
+        if (m == 0 || n == 0) return
+        val row = FloatArray(k)
+        val panel = FloatArray(minOf(n, GEMM_PANEL) * k)
+        for (jc in 0 until n step GEMM_PANEL) {
+            val nc = minOf(GEMM_PANEL, n - jc)
+            for (j in 0 until nc) {
+                for (p in 0 until k) panel[j * k + p] = b[bOffset + p * ldb + jc + j]
+            }
+            for (i in 0 until m) {
+                val rowStart = aOffset + i * lda
+                a.copyInto(row, 0, rowStart, rowStart + k)
+                val cRow = cOffset + i * ldc + jc
+                for (j in 0 until nc) {
+                    c[cRow + j] = dotBlockedPacked(k, row, panel, j * k)
+                }
+            }
+        }
+    }
+
+    /**
+     * Deterministic matrix product over heap Float32 words.
+     *
+     * Same contract as the `FloatArray` overload; offsets and leading
+     * dimensions are in words. Panels are packed into Kotlin arrays, so the
+     * inner loop runs without heap loads.
+     */
+    fun gemm(
+        m: Int, n: Int, k: Int,
+        a: U32View, aOffset: Int, lda: Int,
+        b: U32View, bOffset: Int, ldb: Int,
+        c: U32View, cOffset: Int, ldc: Int,
+    ) {
+        requireMatrix(m, k, aOffset, lda, a.wordCount)
+        requireMatrix(k, n, bOffset, ldb, b.wordCount)
+        requireMatrix(m, n, cOffset, ldc, c.wordCount)
+        if (m == 0 || n == 0) return
+        val row = FloatArray(k)
+        val panel = FloatArray(minOf(n, GEMM_PANEL) * k)
+        for (jc in 0 until n step GEMM_PANEL) {
+            val nc = minOf(GEMM_PANEL, n - jc)
+            for (j in 0 until nc) {
+                for (p in 0 until k) panel[j * k + p] = GlobalHeap.lwf(b.base + (bOffset + p * ldb + jc + j) * 4)
+            }
+            for (i in 0 until m) {
+                GlobalHeap.readFloats(a.base + (aOffset + i * lda) * 4, row, 0, k)
+                val cRow = c.base + (cOffset + i * ldc + jc) * 4
+                for (j in 0 until nc) {
+                    GlobalHeap.swf(cRow + j * 4, dotBlockedPacked(k, row, panel, j * k))
+                }
+            }
+        }
+    }
+
+    /** Fixed combine tree for the [BLOCK_LANES] partial sums. */
+    private fun combineLanes(l0: Float, l1: Float, l2: Float, l3: Float, l4: Float, l5: Float, l6: Float, l7: Float): Float {
+        val s01 = Float32Math.add(l0, l1)
+        val s23 = Float32Math.add(l2, l3)
+        val s45 = Float32Math.add(l4, l5)
+        val s67 = Float32Math.add(l6, l7)
+        return Float32Math.add(Float32Math.add(s01, s23), Float32Math.add(s45, s67))
+    }
+
+    /** Blocked dot of `row[0 until length]` with `col[colOffset until colOffset + length]`. */
+    private fun dotBlockedPacked(length: Int, row: FloatArray, col: FloatArray, colOffset: Int): Float {
+        var l0 = 0.0f; var l1 = 0.0f; var l2 = 0.0f; var l3 = 0.0f
+        var l4 = 0.0f; var l5 = 0.0f; var l6 = 0.0f; var l7 = 0.0f
+        val blocked = length - length % BLOCK_LANES
+        var i = 0
+        while (i < blocked) {
+            val b = colOffset + i
+            l0 = Float32Math.add(l0, Float32Math.mul(row[i], col[b]))
+            l1 = Float32Math.add(l1, Float32Math.mul(row[i + 1], col[b + 1]))
+            l2 = Float32Math.add(l2, Float32Math.mul(row[i + 2], col[b + 2]))
+            l3 = Float32Math.add(l3, Float32Math.mul(row[i + 3], col[b + 3]))
+            l4 = Float32Math.add(l4, Float32Math.mul(row[i + 4], col[b + 4]))
+            l5 = Float32Math.add(l5, Float32Math.mul(row[i + 5], col[b + 5]))
+            l6 = Float32Math.add(l6, Float32Math.mul(row[i + 6], col[b + 6]))
+            l7 = Float32Math.add(l7, Float32Math.mul(row[i + 7], col[b + 7]))
+            i += BLOCK_LANES
+        }
+        val rem = length - blocked
+        val b = colOffset + blocked
+        if (rem > 0) l0 = Float32Math.add(l0, Float32Math.mul(row[blocked], col[b]))
+        if (rem > 1) l1 = Float32Math.add(l1, Float32Math.mul(row[blocked + 1], col[b + 1]))
+        if (rem > 2) l2 = Float32Math.add(l2, Float32Math.mul(row[blocked + 2], col[b + 2]))
+        if (rem > 3) l3 = Float32Math.add(l3, Float32Math.mul(row[blocked + 3], col[b + 3]))
+        if (rem > 4) l4 = Float32Math.add(l4, Float32Math.mul(row[blocked + 4], col[b + 4]))
+        if (rem > 5) l5 = Float32Math.add(l5, Float32Math.mul(row[blocked + 5], col[b + 5]))
+        if (rem > 6) l6 = Float32Math.add(l6, Float32Math.mul(row[blocked + 6], col[b + 6]))
+        return combineLanes(l0, l1, l2, l3, l4, l5, l6, l7)
+    }
+
+    /** Blocked dot over consecutive heap Float32 words at byte addresses [lhsAddr] / [rhsAddr]. */
+    private fun dotBlockedHeap(length: Int, lhsAddr: Int, rhsAddr: Int): Float {
+        var l0 = 0.0f; var l1 = 0.0f; var l2 = 0.0f; var l3 = 0.0f
+        var l4 = 0.0f; var l5 = 0.0f; var l6 = 0.0f; var l7 = 0.0f
+        val blocked = length - length % BLOCK_LANES
+        var pa = lhsAddr
+        var pb = rhsAddr
+        var i = 0
+        while (i < blocked) {
+            l0 = Float32Math.add(l0, Float32Math.mul(GlobalHeap.lwf(pa), GlobalHeap.lwf(pb)))
+            l1 = Float32Math.add(l1, Float32Math.mul(GlobalHeap.lwf(pa + 4), GlobalHeap.lwf(pb + 4)))
+            l2 = Float32Math.add(l2, Float32Math.mul(GlobalHeap.lwf(pa + 8), GlobalHeap.lwf(pb + 8)))
+            l3 = Float32Math.add(l3, Float32Math.mul(GlobalHeap.lwf(pa + 12), GlobalHeap.lwf(pb + 12)))
+            l4 = Float32Math.add(l4, Float32Math.mul(GlobalHeap.lwf(pa + 16), GlobalHeap.lwf(pb + 16)))
+            l5 = Float32Math.add(l5, Float32Math.mul(GlobalHeap.lwf(pa + 20), GlobalHeap.lwf(pb + 20)))
+            l6 = Float32Math.add(l6, Float32Math.mul(GlobalHeap.lwf(pa + 24), GlobalHeap.lwf(pb + 24)))
+            l7 = Float32Math.add(l7, Float32Math.mul(GlobalHeap.lwf(pa + 28), GlobalHeap.lwf(pb + 28)))
+            pa += BLOCK_LANES * 4
+            pb += BLOCK_LANES * 4
+            i += BLOCK_LANES
+        }
+        val rem = length - blocked
+        if (rem > 0) l0 = Float32Math.add(l0, Float32Math.mul(GlobalHeap.lwf(pa), GlobalHeap.lwf(pb)))
+        if (rem > 1) l1 = Float32Math.add(l1, Float32Math.mul(GlobalHeap.lwf(pa + 4), GlobalHeap.lwf(pb + 4)))
+        if (rem > 2) l2 = Float32Math.add(l2, Float32Math.mul(GlobalHeap.lwf(pa + 8), GlobalHeap.lwf(pb + 8)))
+        if (rem > 3) l3 = Float32Math.add(l3, Float32Math.mul(GlobalHeap.lwf(pa + 12), GlobalHeap.lwf(pb + 12)))
+        if (rem > 4) l4 = Float32Math.add(l4, Float32Math.mul(GlobalHeap.lwf(pa + 16), GlobalHeap.lwf(pb + 16)))
+        if (rem > 5) l5 = Float32Math.add(l5, Float32Math.mul(GlobalHeap.lwf(pa + 20), GlobalHeap.lwf(pb + 20)))
+        if (rem > 6) l6 = Float32Math.add(l6, Float32Math.mul(GlobalHeap.lwf(pa + 24), GlobalHeap.lwf(pb + 24)))
+        return combineLanes(l0, l1, l2, l3, l4, l5, l6, l7)
+    }
+
+    private fun requireMatrix(rows: Int, cols: Int, offset: Int, ld: Int, size: Int) {
+        require(rows >= 0 && cols >= 0)
+        require(ld >= cols)
+        require(offset >= 0 && (rows == 0 || cols == 0 || offset + (rows - 1) * ld + cols <= size))
+    }
 }
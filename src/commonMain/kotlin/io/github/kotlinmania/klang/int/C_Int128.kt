@@ -1,6 +1,5 @@
 package io.github.kotlinmania.klang.int
 
-import io.github.kotlinmania.klang.bitwise.ArithmeticBitwiseOps
 import io.github.kotlinmania.klang.bitwise.BitShiftEngine
 import io.github.kotlinmania.klang.bitwise.BitShiftMode
 import io.github.kotlinmania.klang.mem.GlobalHeap
@@ -134,8 +133,10 @@ import io.github.kotlinmania.klang.mem.KMalloc
  *
  * ## Implementation
  *
- * Delegates to [SwAR128] for unsigned operations, applies two's complement
- * transformations for signed semantics.
+ * Arithmetic runs on [UInt128] loaded with two 8-byte heap reads: add, sub
+ * and negate are plain two's complement on the `hi:lo` pair, and signed
+ * comparison / sign extension read the sign from `hi`. [toUInt128] and
+ * [fromUInt128] expose that form to callers chaining many operations.
  *
  * @property addr Heap address of the 16-byte value
  * @constructor Private; use companion factory methods
@@ -158,11 +159,14 @@ class C_Int128 private constructor(val addr: Int) : Comparable<C_Int128> {
      * println(neg.isNegative())  // true
      * ```
      */
-    fun isNegative(): Boolean {
-        val msb = GlobalHeap.lbu(addr + 15)  // Last byte contains sign bit
-        val ops = ArithmeticBitwiseOps.BITS_8
-        return ops.and(msb.toLong(), 0x80L) != 0L
-    }
+    fun isNegative(): Boolean = GlobalHeap.ld(addr + 8) < 0L
+
+    /**
+     * Load the two's complement bits into a register-resident [UInt128].
+     *
+     * @return The raw 128-bit pattern as a `hi:lo` pair
+     */
+    fun toUInt128(): UInt128 = UInt128.load(addr)
     
     /**
      * Convert to hexadecimal string (two's complement).
@@ -193,7 +197,7 @@ class C_Int128 private constructor(val addr: Int) : Comparable<C_Int128> {
     override fun equals(other: Any?): Boolean {
         if (this === other) return true
         if (other !is C_Int128) return false
-        return SwAR128.compareHeap(this.addr, other.addr) == 0
+        return toUInt128() == other.toUInt128()
     }
 
     /**
@@ -225,21 +229,7 @@ class C_Int128 private constructor(val addr: Int) : Comparable<C_Int128> {
      * println(neg < pos)  // true
      * ```
      */
-    override fun compareTo(other: C_Int128): Int {
-        val thisNeg = this.isNegative()
-        val otherNeg = other.isNegative()
-        
-        // Different signs: negative is always less
-        if (thisNeg != otherNeg) {
-            return if (thisNeg) -1 else 1
-        }
-        
-        // Same sign: compare as unsigned
-        val cmp = SwAR128.compareHeap(this.addr, other.addr)
-        
-        // If both negative, reverse the comparison
-        return if (thisNeg) -cmp else cmp
-    }
+    override fun compareTo(other: C_Int128): Int = toUInt128().compareSigned(other.toUInt128())
 
     /**
      * Addition operator (zero-copy).
@@ -258,20 +248,17 @@ class C_Int128 private constructor(val addr: Int) : Comparable<C_Int128> {
      * ```
      */
     operator fun plus(other: C_Int128): C_Int128 {
-        val res = alloc()
-        SwAR128.addHeap(this.addr, other.addr, res.addr)
+        val a = toUInt128()
+        val b = other.toUInt128()
+        val sum = a + b
         
         // Check for overflow: sign of operands same, result sign different
-        val thisNeg = this.isNegative()
-        val otherNeg = other.isNegative()
-        val resNeg = res.isNegative()
-        
-        if (thisNeg == otherNeg && thisNeg != resNeg) {
-            KMalloc.free(res.addr)
+        val thisNeg = a.hi < 0L
+        if (thisNeg == (b.hi < 0L) && thisNeg != (sum.hi < 0L)) {
             error("C_Int128 addition overflow")
         }
         
-        return res
+        return fromUInt128(sum)
     }
 
     /**
@@ -291,20 +278,17 @@ class C_Int128 private constructor(val addr: Int) : Comparable<C_Int128> {
      * ```
      */
     operator fun minus(other: C_Int128): C_Int128 {
-        val res = alloc()
-        SwAR128.subHeap(this.addr, other.addr, res.addr)
+        val a = toUInt128()
+        val b = other.toUInt128()
+        val diff = a - b
         
         // Check for overflow: different signs, result has wrong sign
-        val thisNeg = this.isNegative()
-        val otherNeg = other.isNegative()
-        val resNeg = res.isNegative()
-        
-        if (thisNeg != otherNeg && thisNeg != resNeg) {
-            KMalloc.free(res.addr)
+        val thisNeg = a.hi < 0L
+        if (thisNeg != (b.hi < 0L) && thisNeg != (diff.hi < 0L)) {
             error("C_Int128 subtraction overflow")
         }
         
-        return res
+        return fromUInt128(diff)
     }
 
     /**
@@ -320,24 +304,7 @@ class C_Int128 private constructor(val addr: Int) : Comparable<C_Int128> {
      * val negX = x.negate()  // -100
      * ```
      */
-    fun negate(): C_Int128 {
-        val res = alloc()
-        val ops = ArithmeticBitwiseOps.BITS_8
-        
-        // Two's complement negation: flip all bits, then add 1
-        for (i in 0 until 16) {
-            val byte = GlobalHeap.lbu(addr + i)
-            val inverted = ops.not(byte.toLong())
-            GlobalHeap.sb(res.addr + i, inverted.toByte())
-        }
-        
-        // Add 1
-        val one = C_UInt128.one()
-        SwAR128.addHeap(res.addr, one.addr, res.addr)
-        KMalloc.free(one.addr)
-        
-        return res
-    }
+    fun negate(): C_Int128 = fromUInt128(toUInt128().negate())
 
     /**
      * Absolute value.
@@ -383,34 +350,9 @@ class C_Int128 private constructor(val addr: Int) : Comparable<C_Int128> {
      * ```
      */
     fun shiftRight(bits: Int): C_Int128 {
-        val res = alloc()
-        val negative = isNegative()
-        
-        SwAR128.shiftRightHeap(this.addr, res.addr, bits)
-        
-        // If negative, fill shifted-in bits with 1s (sign extension)
-        if (negative && bits > 0) {
-            val fullBytes = bits / 8
-            val remainingBits = bits % 8
-            
-            // Fill full bytes with 0xFF from the left
-            for (i in 15 downTo 16 - fullBytes) {
-                GlobalHeap.sb(res.addr + i, 0xFF.toByte())
-            }
-            
-            // Handle remaining bits
-            if (remainingBits > 0 && fullBytes < 16) {
-                val ops = ArithmeticBitwiseOps.BITS_8
-                val byteIdx = 15 - fullBytes
-                val currentByte = GlobalHeap.lbu(res.addr + byteIdx)
-                val maskValue = byteShifter.leftShift(0xFFL, 8 - remainingBits).value
-                val maskedByte = ops.and(maskValue, 0xFFL)
-                val result = ops.or(currentByte.toLong(), maskedByte)
-                GlobalHeap.sb(res.addr + byteIdx, result.toByte())
-            }
-        }
-        
-        return res
+        require(bits >= 0)
+        // Counts of 128 and above leave only copies of the sign bit
+        return fromUInt128(toUInt128() sar bits.coerceAtMost(127))
     }
 
     /**
@@ -429,10 +371,11 @@ class C_Int128 private constructor(val addr: Int) : Comparable<C_Int128> {
      * ```
      */
     fun shiftLeft(bits: Int): C_Int128 {
-        val res = alloc()
-        val spill = SwAR128.shiftLeftHeap(this.addr, res.addr, bits)
-        require(spill == 0uL) { "C_Int128 shift left overflow beyond 128 bits" }
-        return res
+        require(bits >= 0)
+        val v = toUInt128()
+        val spilled = if (bits >= 128) !v.isZero() else bits > 0 && !(v shr (128 - bits)).isZero()
+        require(!spilled) { "C_Int128 shift left overflow beyond 128 bits" }
+        return fromUInt128(if (bits >= 128) UInt128.ZERO else v shl bits)
     }
 
     companion object {
@@ -474,31 +417,14 @@ class C_Int128 private constructor(val addr: Int) : Comparable<C_Int128> {
          * val x = C_Int128.fromLong(-12345L)
          * ```
          */
-        fun fromLong(value: Long): C_Int128 {
-            val res = alloc()
-            
-            if (value >= 0) {
-                // Positive: zero-extend
-                SwAR128.writeULongToHeap(res.addr, value.toULong())
-            } else {
-                // Negative: sign-extend
-                val ops = ArithmeticBitwiseOps.BITS_8
-                val absValue = (-value).toULong()
-                SwAR128.writeULongToHeap(res.addr, absValue)
-                
-                // Two's complement: flip all bits and add 1
-                for (i in 0 until 16) {
-                    val byte = GlobalHeap.lbu(res.addr + i)
-                    val inverted = ops.not(byte.toLong())
-                    GlobalHeap.sb(res.addr + i, inverted.toByte())
-                }
-                
-                val one = C_UInt128.one()
-                SwAR128.addHeap(res.addr, one.addr, res.addr)
-                KMalloc.free(one.addr)
-            }
-            
-            return res
-        }
+        fun fromLong(value: Long): C_Int128 = fromUInt128(UInt128.fromLong(value))
+
+        /**
+         * Store a two's complement [UInt128] bit pattern into a newly allocated C_Int128.
+         *
+         * @param value 128-bit pattern (bit 127 is the sign)
+         * @return C_Int128 holding [value]
+         */
+        fun fromUInt128(value: UInt128): C_Int128 = alloc().also { value.store(it.addr) }
     }
 }
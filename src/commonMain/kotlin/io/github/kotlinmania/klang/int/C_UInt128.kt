@@ -128,12 +128,11 @@ import io.github.kotlinmania.klang.mem.KMalloc
  *
  * ## Implementation
  *
- * Delegates to [SwAR128] for low-level arithmetic operations:
- * - `SwAR128.addHeap`: Addition with carry propagation
- * - `SwAR128.subHeap`: Subtraction with borrow propagation
- * - `SwAR128.shiftLeftHeap`: Left shift with overflow detection
- * - `SwAR128.shiftRightHeap`: Right shift (zero-fill)
- * - `SwAR128.compareHeap`: Lexicographic comparison
+ * Arithmetic loads both operands as [UInt128] (two 8-byte heap reads each),
+ * computes in registers with 64-bit carries, and stores the result with two
+ * 8-byte writes; [toUInt128] / [fromUInt128] expose that form directly for
+ * code that chains many operations. The heap layout is the [SwAR128] limb
+ * layout, so values stay interchangeable with limb-based code.
  *
  * @property addr Heap address of the 16-byte value
  * @constructor Private; use companion factory methods
@@ -175,7 +174,7 @@ class C_UInt128 private constructor(val addr: Int) : Comparable<C_UInt128> {
     override fun equals(other: Any?): Boolean {
         if (this === other) return true
         if (other !is C_UInt128) return false
-        return SwAR128.compareHeap(this.addr, other.addr) == 0
+        return toUInt128() == other.toUInt128()
     }
 
     /**
@@ -211,7 +210,14 @@ class C_UInt128 private constructor(val addr: Int) : Comparable<C_UInt128> {
      * println(a < b)  // true
      * ```
      */
-    override fun compareTo(other: C_UInt128): Int = SwAR128.compareHeap(this.addr, other.addr)
+    override fun compareTo(other: C_UInt128): Int = toUInt128().compareTo(other.toUInt128())
+
+    /**
+     * Load the value into a register-resident [UInt128].
+     *
+     * @return The same 128-bit value as a `hi:lo` pair
+     */
+    fun toUInt128(): UInt128 = UInt128.load(addr)
 
     /**
      * Addition operator (zero-copy).
@@ -231,10 +237,10 @@ class C_UInt128 private constructor(val addr: Int) : Comparable<C_UInt128> {
      * ```
      */
     operator fun plus(other: C_UInt128): C_UInt128 {
-        val res = alloc()
-        val carry = SwAR128.addHeap(this.addr, other.addr, res.addr)
-        require(carry == 0) { "C_UInt128 addition overflow" }
-        return res
+        val a = toUInt128()
+        val sum = a + other.toUInt128()
+        require(sum >= a) { "C_UInt128 addition overflow" }
+        return fromUInt128(sum)
     }
 
     /**
@@ -255,10 +261,10 @@ class C_UInt128 private constructor(val addr: Int) : Comparable<C_UInt128> {
      * ```
      */
     operator fun minus(other: C_UInt128): C_UInt128 {
-        val res = alloc()
-        val borrow = SwAR128.subHeap(this.addr, other.addr, res.addr)
-        require(borrow == 0) { "C_UInt128 subtraction underflow" }
-        return res
+        val a = toUInt128()
+        val b = other.toUInt128()
+        require(a >= b) { "C_UInt128 subtraction underflow" }
+        return fromUInt128(a - b)
     }
 
     /**
@@ -278,10 +284,11 @@ class C_UInt128 private constructor(val addr: Int) : Comparable<C_UInt128> {
      * ```
      */
     fun shiftLeft(bits: Int): C_UInt128 {
-        val res = alloc()
-        val spill = SwAR128.shiftLeftHeap(this.addr, res.addr, bits)
-        require(spill == 0uL) { "C_UInt128 shift left overflow beyond 128 bits" }
-        return res
+        require(bits >= 0)
+        val v = toUInt128()
+        val spilled = if (bits >= 128) !v.isZero() else bits > 0 && !(v shr (128 - bits)).isZero()
+        require(!spilled) { "C_UInt128 shift left overflow beyond 128 bits" }
+        return fromUInt128(if (bits >= 128) UInt128.ZERO else v shl bits)
     }
 
     /**
@@ -300,9 +307,8 @@ class C_UInt128 private constructor(val addr: Int) : Comparable<C_UInt128> {
      * ```
      */
     fun shiftRight(bits: Int): C_UInt128 {
-        val res = alloc()
-        SwAR128.shiftRightHeap(this.addr, res.addr, bits)
-        return res
+        require(bits >= 0)
+        return fromUInt128(if (bits >= 128) UInt128.ZERO else toUInt128() shr bits)
     }
 
     companion object {
@@ -365,5 +371,13 @@ class C_UInt128 private constructor(val addr: Int) : Comparable<C_UInt128> {
         fun fromULong(value: ULong): C_UInt128 = alloc().also {
             SwAR128.writeULongToHeap(it.addr, value)
         }
+
+        /**
+         * Store a register-resident [UInt128] into a newly allocated C_UInt128.
+         *
+         * @param value 128-bit value
+         * @return C_UInt128 holding [value]
+         */
+        fun fromUInt128(value: UInt128): C_UInt128 = alloc().also { value.store(it.addr) }
     }
 }
@@ -231,9 +231,11 @@ object SwAR128 {
         }
         
         if (bits >= LIMB_COUNT * LIMB_BITS) {
-            // Everything shifts out, result is zero
+            // Everything shifts out, result is zero. Read the spill before clearing dest,
+            // which may be src.
+            val spill = accumulateSpillHeap(srcAddr)
             io.github.kotlinmania.klang.mem.GlobalHeap.memset(destAddr, 0, LIMB_COUNT * 2)
-            return accumulateSpillHeap(srcAddr)
+            return spill
         }
         
         val wordShift = bits / LIMB_BITS
@@ -304,8 +306,9 @@ object SwAR128 {
         }
         
         if (bits >= LIMB_COUNT * LIMB_BITS) {
+            val spill = accumulateSpillHeap(srcAddr)
             io.github.kotlinmania.klang.mem.GlobalHeap.memset(destAddr, 0, LIMB_COUNT * 2)
-            return accumulateSpillHeap(srcAddr)
+            return spill
         }
         
         val wordShift = bits / LIMB_BITS
@@ -0,0 +1,414 @@
+package io.github.kotlinmania.klang.int
+
+import io.github.kotlinmania.klang.bitwise.BitShiftConfig
+import io.github.kotlinmania.klang.bitwise.BitShiftMode
+import io.github.kotlinmania.klang.mem.GlobalHeap
+import io.github.kotlinmania.klang.mem.ViewKernels
+
+/**
+ * SwARArrays: array-wide SWAR lane kernels, the [SwAR] averages widened to
+ * whole buffers and joined by saturating add/sub, min/max and the sum of
+ * absolute differences (SAD).
+ *
+ * Lanes are unsigned u8 (8 per `Long`) or u16 (4 per `Long`), packed
+ * little-endian exactly as [io.github.kotlinmania.klang.mem.PackedBuffer]
+ * stores them, so every step handles one 64-bit word. Two storage forms:
+ *
+ * - `LongArray` overloads take packed words; [n] counts lanes, and lanes of
+ *   a partial last `dst` word past [n] are left untouched.
+ * - `Int` overloads take [GlobalHeap] byte addresses. Each range is checked
+ *   once, `dst` is brought to word alignment with scalar lanes, and whole
+ *   words stream through [io.github.kotlinmania.klang.mem.PackedBuffer.data]
+ *   when all three addresses share that alignment (unaligned word loads
+ *   otherwise). `dst` may be `a` or `b`; partially overlapping ranges are not
+ *   supported.
+ *
+ * The word strategy follows [BitShiftConfig.resolveMode] for 64 bits:
+ *
+ * | Mode | Word step |
+ * |------|-----------|
+ * | NATIVE (and AUTO) | lane masks: the carry/borrow out of each lane's top bit becomes a 0/all-ones lane mask |
+ * | ARITHMETIC | per-lane decomposition by division by 256 or 65536, like the `*Arith` forms of [SwAR] |
+ *
+ * Both produce identical results.
+ *
+ * @native-bitshift-allowed Kernel layer for SWAR lanes; raw shifts permitted.
+ */
+object SwARArrays {
+    private const val H8 = -0x7F7F7F7F7F7F7F80L // 0x8080808080808080
+    private const val L8 = 0x0101010101010101L
+    private const val H16 = -0x7FFF7FFF7FFF8000L // 0x8000800080008000
+    private const val L16 = 0x0001000100010001L
+    private const val PAIRS8 = 0x00FF00FF00FF00FFL
+    private const val PAIRS16 = 0x0000FFFF0000FFFFL
+
+    // u8 lanes --------------------------------------------------------------------------
+
+    /** `dst[i] = (a[i] + b[i] + r) / 2` over [n] u8 lanes, r = 1 when [round] (ties up). */
+    fun avgU8(a: LongArray, b: LongArray, dst: LongArray, n: Int, round: Boolean = true, mode: BitShiftMode = BitShiftConfig.defaultMode) {
+        val r = if (round) 1 else 0
+        if (native(mode)) words(a, b, dst, n, 8) { x, y -> avgWord(x, y, L8, round) }
+        else words(a, b, dst, n, 8) { x, y -> arithLanes(x, y, 256uL, 8) { p, q -> (p + q + r) / 2 } }
+    }
+
+    /** Heap form of [avgU8]: [n] bytes at [aAddr] and [bAddr] into [dstAddr]. */
+    fun avgU8(aAddr: Int, bAddr: Int, dstAddr: Int, n: Int, round: Boolean = true, mode: BitShiftMode = BitShiftConfig.defaultMode) {
+        val r = if (round) 1 else 0
+        if (native(mode)) heap(aAddr, bAddr, dstAddr, n, 1, { p, q -> (p + q + r) ushr 1 }) { x, y -> avgWord(x, y, L8, round) }
+        else heap(aAddr, bAddr, dstAddr, n, 1, { p, q -> (p + q + r) ushr 1 }) { x, y -> arithLanes(x, y, 256uL, 8) { p, q -> (p + q + r) / 2 } }
+    }
+
+    /** `dst[i] = min(a[i] + b[i], 255)` over [n] u8 lanes. */
+    fun addSatU8(a: LongArray, b: LongArray, dst: LongArray, n: Int, mode: BitShiftMode = BitShiftConfig.defaultMode) {
+        if (native(mode)) words(a, b, dst, n, 8) { x, y -> addSatWord(x, y, H8, 8, 0xFF) }
+        else words(a, b, dst, n, 8) { x, y -> arithLanes(x, y, 256uL, 8, ::addSat8) }
+    }
+
+    /** Heap form of [addSatU8]. */
+    fun addSatU8(aAddr: Int, bAddr: Int, dstAddr: Int, n: Int, mode: BitShiftMode = BitShiftConfig.defaultMode) {
+        if (native(mode)) heap(aAddr, bAddr, dstAddr, n, 1, ::addSat8) { x, y -> addSatWord(x, y, H8, 8, 0xFF) }
+        else heap(aAddr, bAddr, dstAddr, n, 1, ::addSat8) { x, y -> arithLanes(x, y, 256uL, 8, ::addSat8) }
+    }
+
+    /** `dst[i] = max(a[i] - b[i], 0)` over [n] u8 lanes. */
+    fun subSatU8(a: LongArray, b: LongArray, dst: LongArray, n: Int, mode: BitShiftMode = BitShiftConfig.defaultMode) {
+        if (native(mode)) words(a, b, dst, n, 8) { x, y -> subSatWord(x, y, H8, 8, 0xFF) }
+        else words(a, b, dst, n, 8) { x, y -> arithLanes(x, y, 256uL, 8, ::subSat) }
+    }
+
+    /** Heap form of [subSatU8]. */
+    fun subSatU8(aAddr: Int, bAddr: Int, dstAddr: Int, n: Int, mode: BitShiftMode = BitShiftConfig.defaultMode) {
+        if (native(mode)) heap(aAddr, bAddr, dstAddr, n, 1, ::subSat) { x, y -> subSatWord(x, y, H8, 8, 0xFF) }
+        else heap(aAddr, bAddr, dstAddr, n, 1, ::subSat) { x, y -> arithLanes(x, y, 256uL, 8, ::subSat) }
+    }
+
+    /** `dst[i] = min(a[i], b[i])` over [n] u8 lanes. */
+    fun minU8(a: LongArray, b: LongArray, dst: LongArray, n: Int, mode: BitShiftMode = BitShiftConfig.defaultMode) {
+        if (native(mode)) words(a, b, dst, n, 8) { x, y -> minWord(x, y, H8, 8, 0xFF) }
+        else words(a, b, dst, n, 8) { x, y -> arithLanes(x, y, 256uL, 8, ::minLane) }
+    }
+
+    /** Heap form of [minU8]. */
+    fun minU8(aAddr: Int, bAddr: Int, dstAddr: Int, n: Int, mode: BitShiftMode = BitShiftConfig.defaultMode) {
+        if (native(mode)) heap(aAddr, bAddr, dstAddr, n, 1, ::minLane) { x, y -> minWord(x, y, H8, 8, 0xFF) }
+        else heap(aAddr, bAddr, dstAddr, n, 1, ::minLane) { x, y -> arithLanes(x, y, 256uL, 8, ::minLane) }
+    }
+
+    /** `dst[i] = max(a[i], b[i])` over [n] u8 lanes. */
+    fun maxU8(a: LongArray, b: LongArray, dst: LongArray, n: Int, mode: BitShiftMode = BitShiftConfig.defaultMode) {
+        if (native(mode)) words(a, b, dst, n, 8) { x, y -> maxWord(x, y, H8, 8, 0xFF) }
+        else words(a, b, dst, n, 8) { x, y -> arithLanes(x, y, 256uL, 8, ::maxLane) }
+    }
+
+    /** Heap form of [maxU8]. */
+    fun maxU8(aAddr: Int, bAddr: Int, dstAddr: Int, n: Int, mode: BitShiftMode = BitShiftConfig.defaultMode) {
+        if (native(mode)) heap(aAddr, bAddr, dstAddr, n, 1, ::maxLane) { x, y -> maxWord(x, y, H8, 8, 0xFF) }
+        else heap(aAddr, bAddr, dstAddr, n, 1, ::maxLane) { x, y -> arithLanes(x, y, 256uL, 8, ::maxLane) }
+    }
+
+    /** Sum of `|a[i] - b[i]|` over [n] u8 lanes (SAD). */
+    fun absDiffSumU8(a: LongArray, b: LongArray, n: Int, mode: BitShiftMode = BitShiftConfig.defaultMode): Long =
+        if (native(mode)) wordSum(a, b, n, 8) { x, y -> sadWord8(x, y) }
+        else wordSum(a, b, n, 8) { x, y -> arithSum(x, y, 256uL, 8) }
+
+    /** Heap form of [absDiffSumU8]. */
+    fun absDiffSumU8(aAddr: Int, bAddr: Int, n: Int, mode: BitShiftMode = BitShiftConfig.defaultMode): Long =
+        if (native(mode)) heapSum(aAddr, bAddr, n, 1) { x, y -> sadWord8(x, y) }
+        else heapSum(aAddr, bAddr, n, 1) { x, y -> arithSum(x, y, 256uL, 8) }
+
+    // u16 lanes -------------------------------------------------------------------------
+
+    /** `dst[i] = (a[i] + b[i] + r) / 2` over [n] u16 lanes, r = 1 when [round] (ties up). */
+    fun avgU16(a: LongArray, b: LongArray, dst: LongArray, n: Int, round: Boolean = true, mode: BitShiftMode = BitShiftConfig.defaultMode) {
+        val r = if (round) 1 else 0
+        if (native(mode)) words(a, b, dst, n, 16) { x, y -> avgWord(x, y, L16, round) }
+        else words(a, b, dst, n, 16) { x, y -> arithLanes(x, y, 65536uL, 4) { p, q -> (p + q + r) / 2 } }
+    }
+
+    /** Heap form of [avgU16]: [n] halfwords at [aAddr] and [bAddr] into [dstAddr]. */
+    fun avgU16(aAddr: Int, bAddr: Int, dstAddr: Int, n: Int, round: Boolean = true, mode: BitShiftMode = BitShiftConfig.defaultMode) {
+        val r = if (round) 1 else 0
+        if (native(mode)) heap(aAddr, bAddr, dstAddr, n, 2, { p, q -> (p + q + r) ushr 1 }) { x, y -> avgWord(x, y, L16, round) }
+        else heap(aAddr, bAddr, dstAddr, n, 2, { p, q -> (p + q + r) ushr 1 }) { x, y -> arithLanes(x, y, 65536uL, 4) { p, q -> (p + q + r) / 2 } }
+    }
+
+    /** `dst[i] = min(a[i] + b[i], 65535)` over [n] u16 lanes. */
+    fun addSatU16(a: LongArray, b: LongArray, dst: LongArray, n: Int, mode: BitShiftMode = BitShiftConfig.defaultMode) {
+        if (native(mode)) words(a, b, dst, n, 16) { x, y -> addSatWord(x, y, H16, 16, 0xFFFF) }
+        else words(a, b, dst, n, 16) { x, y -> arithLanes(x, y, 65536uL, 4, ::addSat16) }
+    }
+
+    /** Heap form of [addSatU16]. */
+    fun addSatU16(aAddr: Int, bAddr: Int, dstAddr: Int, n: Int, mode: BitShiftMode = BitShiftConfig.defaultMode) {
+        if (native(mode)) heap(aAddr, bAddr, dstAddr, n, 2, ::addSat16) { x, y -> addSatWord(x, y, H16, 16, 0xFFFF) }
+        else heap(aAddr, bAddr, dstAddr, n, 2, ::addSat16) { x, y -> arithLanes(x, y, 65536uL, 4, ::addSat16) }
+    }
+
+    /** `dst[i] = max(a[i] - b[i], 0)` over [n] u16 lanes. */
+    fun subSatU16(a: LongArray, b: LongArray, dst: LongArray, n: Int, mode: BitShiftMode = BitShiftConfig.defaultMode) {
+        if (native(mode)) words(a, b, dst, n, 16) { x, y -> subSatWord(x, y, H16, 16, 0xFFFF) }
+        else words(a, b, dst, n, 16) { x, y -> arithLanes(x, y, 65536uL, 4, ::subSat) }
+    }
+
+    /** Heap form of [subSatU16]. */
+    fun subSatU16(aAddr: Int, bAddr: Int, dstAddr: Int, n: Int, mode: BitShiftMode = BitShiftConfig.defaultMode) {
+        if (native(mode)) heap(aAddr, bAddr, dstAddr, n, 2, ::subSat) { x, y -> subSatWord(x, y, H16, 16, 0xFFFF) }
+        else heap(aAddr, bAddr, dstAddr, n, 2, ::subSat) { x, y -> arithLanes(x, y, 65536uL, 4, ::subSat) }
+    }
+
+    /** `dst[i] = min(a[i], b[i])` over [n] u16 lanes. */
+    fun minU16(a: LongArray, b: LongArray, dst: LongArray, n: Int, mode: BitShiftMode = BitShiftConfig.defaultMode) {
+        if (native(mode)) words(a, b, dst, n, 16) { x, y -> minWord(x, y, H16, 16, 0xFFFF) }
+        else words(a, b, dst, n, 16) { x, y -> arithLanes(x, y, 65536uL, 4, ::minLane) }
+    }
+
+    /** Heap form of [minU16]. */
+    fun minU16(aAddr: Int, bAddr: Int, dstAddr: Int, n: Int, mode: BitShiftMode = BitShiftConfig.defaultMode) {
+        if (native(mode)) heap(aAddr, bAddr, dstAddr, n, 2, ::minLane) { x, y -> minWord(x, y, H16, 16, 0xFFFF) }
+        else heap(aAddr, bAddr, dstAddr, n, 2, ::minLane) { x, y -> arithLanes(x, y, 65536uL, 4, ::minLane) }
+    }
+
+    /** `dst[i] = max(a[i], b[i])` over [n] u16 lanes. */
+    fun maxU16(a: LongArray, b: LongArray, dst: LongArray, n: Int, mode: BitShiftMode = BitShiftConfig.defaultMode) {
+        if (native(mode)) words(a, b, dst, n, 16) { x, y -> maxWord(x, y, H16, 16, 0xFFFF) }
+        else words(a, b, dst, n, 16) { x, y -> arithLanes(x, y, 65536uL, 4, ::maxLane) }
+    }
+
+    /** Heap form of [maxU16]. */
+    fun maxU16(aAddr: Int, bAddr: Int, dstAddr: Int, n: Int, mode: BitShiftMode = BitShiftConfig.defaultMode) {
+        if (native(mode)) heap(aAddr, bAddr, dstAddr, n, 2, ::maxLane) { x, y -> maxWord(x, y, H16, 16, 0xFFFF) }
+        else heap(aAddr, bAddr, dstAddr, n, 2, ::maxLane) { x, y -> arithLanes(x, y, 65536uL, 4, ::maxLane) }
+    }
+
+    /** Sum of `|a[i] - b[i]|` over [n] u16 lanes (SAD). */
+    fun absDiffSumU16(a: LongArray, b: LongArray, n: Int, mode: BitShiftMode = BitShiftConfig.defaultMode): Long =
+        if (native(mode)) wordSum(a, b, n, 16) { x, y -> sadWord16(x, y) }
+        else wordSum(a, b, n, 16) { x, y -> arithSum(x, y, 65536uL, 4) }
+
+    /** Heap form of [absDiffSumU16]. */
+    fun absDiffSumU16(aAddr: Int, bAddr: Int, n: Int, mode: BitShiftMode = BitShiftConfig.defaultMode): Long =
+        if (native(mode)) heapSum(aAddr, bAddr, n, 2) { x, y -> sadWord16(x, y) }
+        else heapSum(aAddr, bAddr, n, 2) { x, y -> arithSum(x, y, 65536uL, 4) }
+
+    // Strategy ---------------------------------------------------------------------------
+
+    private fun native(mode: BitShiftMode): Boolean =
+        BitShiftConfig.resolveMode(64, mode) != BitShiftMode.ARITHMETIC
+
+    // Scalar lanes (heads, tails, unaligned halfwords) -----------------------------------
+
+    private fun addSat8(x: Int, y: Int): Int = minOf(x + y, 0xFF)
+    private fun addSat16(x: Int, y: Int): Int = minOf(x + y, 0xFFFF)
+    private fun subSat(x: Int, y: Int): Int = maxOf(x - y, 0)
+    private fun minLane(x: Int, y: Int): Int = if (x < y) x else y
+    private fun maxLane(x: Int, y: Int): Int = if (x < y) y else x
+
+    // NATIVE word kernels; h = lane top bits, lsb = lane low bits ---------------------------
+
+    /** Same identities as [SwAR.avgU8Trunc] / [SwAR.avgU8Round], 64 bits wide. */
+    private inline fun avgWord(a: Long, b: Long, lsb: Long, round: Boolean): Long {
+        val half = ((a xor b) and lsb.inv()) ushr 1
+        return if (round) (a or b) - half else (a and b) + half
+    }
+
+    /** Lane-wise wrapping a + b: add the low bits, then fix each top bit without carrying out. */
+    private inline fun addWord(a: Long, b: Long, h: Long): Long =
+        ((a and h.inv()) + (b and h.inv())) xor ((a xor b) and h)
+
+    /** Lane-wise wrapping a - b: each top bit is pre-set so no lane borrows from its neighbour. */
+    private inline fun subWord(a: Long, b: Long, h: Long): Long =
+        ((a or h) - (b and h.inv())) xor ((a xor b.inv()) and h)
+
+    /** Spread each lane's top bit of [flags] over the whole lane. */
+    private inline fun laneMask(flags: Long, bits: Int, laneMax: Int): Long =
+        (flags ushr (bits - 1)) * laneMax.toLong()
+
+    /** All-ones lanes where a < b (the borrow out of a - b). */
+    private inline fun lessMask(a: Long, b: Long, h: Long, bits: Int, laneMax: Int): Long {
+        val d = subWord(a, b, h)
+        return laneMask(((a.inv() and b) or ((a.inv() or b) and d)) and h, bits, laneMax)
+    }
+
+    private inline fun addSatWord(a: Long, b: Long, h: Long, bits: Int, laneMax: Int): Long {
+        val s = addWord(a, b, h)
+        val carry = ((a and b) or ((a or b) and s.inv())) and h
+        return s or laneMask(carry, bits, laneMax)
+    }
+
+    private inline fun subSatWord(a: Long, b: Long, h: Long, bits: Int, laneMax: Int): Long =
+        subWord(a, b, h) and lessMask(a, b, h, bits, laneMax).inv()
+
+    private inline fun minWord(a: Long, b: Long, h: Long, bits: Int, laneMax: Int): Long {
+        val lt = lessMask(a, b, h, bits, laneMax)
+        return (a and lt) or (b and lt.inv())
+    }
+
+    private inline fun maxWord(a: Long, b: Long, h: Long, bits: Int, laneMax: Int): Long {
+        val lt = lessMask(a, b, h, bits, laneMax)
+        return (b and lt) or (a and lt.inv())
+    }
+
+    /** |a - b| per u8 lane, then folded: byte pairs into u16 lanes, and one multiply sums those into the top lane. */
+    private inline fun sadWord8(a: Long, b: Long): Long {
+        val lt = lessMask(a, b, H8, 8, 0xFF)
+        val d = ((b and lt) or (a and lt.inv())) - ((a and lt) or (b and lt.inv()))
+        val pairs = (d and PAIRS8) + ((d ushr 8) and PAIRS8)
+        return (pairs * L16) ushr 48
+    }
+
+    private inline fun sadWord16(a: Long, b: Long): Long {
+        val lt = lessMask(a, b, H16, 16, 0xFFFF)
+        val d = ((b and lt) or (a and lt.inv())) - ((a and lt) or (b and lt.inv()))
+        val pairs = (d and PAIRS16) + ((d ushr 16) and PAIRS16)
+        return (pairs and 0xFFFFFFFFL) + (pairs ushr 32)
+    }
+
+    // ARITHMETIC word kernels -------------------------------------------------------------
+
+    /** Apply [op] to each of [lanes] base-[base] digits of a and b, and reassemble. */
+    private inline fun arithLanes(a: Long, b: Long, base: ULong, lanes: Int, op: (Int, Int) -> Int): Long {
+        var ua = a.toULong()
+        var ub = b.toULong()
+        var out = 0uL
+        var scale = 1uL
+        repeat(lanes) {
+            val qa = ua / base
+            val qb = ub / base
+            out += op((ua - qa * base).toInt(), (ub - qb * base).toInt()).toULong() * scale
+            ua = qa
+            ub = qb
+            scale *= base
+        }
+        return out.toLong()
+    }
+
+    private fun arithSum(a: Long, b: Long, base: ULong, lanes: Int): Long {
+        var ua = a.toULong()
+        var ub = b.toULong()
+        var s = 0L
+        repeat(lanes) {
+            val qa = ua / base
+            val qb = ub / base
+            val x = (ua - qa * base).toLong()
+            val y = (ub - qb * base).toLong()
+            s += if (x >= y) x - y else y - x
+            ua = qa
+            ub = qb
+        }
+        return s
+    }
+
+    // Drivers -----------------------------------------------------------------------------
+
+    private fun checkWords(arr: LongArray, what: String, n: Int, laneBits: Int) {
+        val need = (n.toLong() * laneBits + 63) / 64
+        require(need <= arr.size) { "$n lanes need $need words, $what has ${arr.size}" }
+    }
+
+    private inline fun words(a: LongArray, b: LongArray, dst: LongArray, n: Int, laneBits: Int, word: (Long, Long) -> Long) {
+        require(n >= 0) { "lane count $n < 0" }
+        checkWords(a, "a", n, laneBits)
+        checkWords(b, "b", n, laneBits)
+        checkWords(dst, "dst", n, laneBits)
+        val lanes = 64 / laneBits
+        val full = n / lanes
+        for (w in 0 until full) dst[w] = word(a[w], b[w])
+        val rem = n - full * lanes
+        if (rem != 0) {
+            val m = (1L shl (rem * laneBits)) - 1
+            dst[full] = (word(a[full], b[full]) and m) or (dst[full] and m.inv())
+        }
+    }
+
+    private inline fun wordSum(a: LongArray, b: LongArray, n: Int, laneBits: Int, word: (Long, Long) -> Long): Long {
+        require(n >= 0) { "lane count $n < 0" }
+        checkWords(a, "a", n, laneBits)
+        checkWords(b, "b", n, laneBits)
+        val lanes = 64 / laneBits
+        val full = n / lanes
+        var s = 0L
+        for (w in 0 until full) s += word(a[w], b[w])
+        val rem = n - full * lanes
+        if (rem != 0) {
+            // Lanes past n are zero in both operands, so they add nothing
+            val m = (1L shl (rem * laneBits)) - 1
+            s += word(a[full] and m, b[full] and m)
+        }
+        return s
+    }
+
+    private fun checkHeap(n: Int, laneBytes: Int, vararg addrs: Int) {
+        require(n >= 0 && n <= Int.MAX_VALUE / laneBytes) { "lane count $n out of range" }
+        for (addr in addrs) ViewKernels.checkSpan(addr, n * laneBytes)
+    }
+
+    private inline fun heap(
+        aAddr: Int, bAddr: Int, dstAddr: Int, n: Int, laneBytes: Int,
+        lane: (Int, Int) -> Int, word: (Long, Long) -> Long,
+    ) {
+        checkHeap(n, laneBytes, aAddr, bAddr, dstAddr)
+        val buf = GlobalHeap.packed
+        val lanes = 8 / laneBytes
+        var i = 0
+        var a = aAddr
+        var b = bAddr
+        var d = dstAddr
+        if ((d and (laneBytes - 1)) == 0) {
+            while (i < n && (d and 7) != 0) {
+                ViewKernels.store(buf, d, laneBytes, lane(ViewKernels.load(buf, a, laneBytes), ViewKernels.load(buf, b, laneBytes)))
+                i++; a += laneBytes; b += laneBytes; d += laneBytes
+            }
+        }
+        if (((a or b or d) and 7) == 0) {
+            val data = buf.data
+            while (n - i >= lanes) {
+                data[d ushr 3] = word(data[a ushr 3], data[b ushr 3])
+                i += lanes; a += 8; b += 8; d += 8
+            }
+        } else {
+            while (n - i >= lanes) {
+                buf.setLong(d, word(buf.getLong(a), buf.getLong(b)))
+                i += lanes; a += 8; b += 8; d += 8
+            }
+        }
+        while (i < n) {
+            ViewKernels.store(buf, d, laneBytes, lane(ViewKernels.load(buf, a, laneBytes), ViewKernels.load(buf, b, laneBytes)))
+            i++; a += laneBytes; b += laneBytes; d += laneBytes
+        }
+    }
+
+    private inline fun heapSum(aAddr: Int, bAddr: Int, n: Int, laneBytes: Int, word: (Long, Long) -> Long): Long {
+        checkHeap(n, laneBytes, aAddr, bAddr)
+        val buf = GlobalHeap.packed
+        val lanes = 8 / laneBytes
+        var s = 0L
+        var i = 0
+        var a = aAddr
+        var b = bAddr
+        if ((a and (laneBytes - 1)) == 0) {
+            while (i < n && (a and 7) != 0) {
+                s += absDiff(ViewKernels.load(buf, a, laneBytes), ViewKernels.load(buf, b, laneBytes))
+                i++; a += laneBytes; b += laneBytes
+            }
+        }
+        if (((a or b) and 7) == 0) {
+            val data = buf.data
+            while (n - i >= lanes) {
+                s += word(data[a ushr 3], data[b ushr 3])
+                i += lanes; a += 8; b += 8
+            }
+        } else {
+            while (n - i >= lanes) {
+                s += word(buf.getLong(a), buf.getLong(b))
+                i += lanes; a += 8; b += 8
+            }
+        }
+        while (i < n) {
+            s += absDiff(ViewKernels.load(buf, a, laneBytes), ViewKernels.load(buf, b, laneBytes))
+            i++; a += laneBytes; b += laneBytes
+        }
+        return s
+    }
+
+    private fun absDiff(x: Int, y: Int): Int = if (x >= y) x - y else y - x
+}
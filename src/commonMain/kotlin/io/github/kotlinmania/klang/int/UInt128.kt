@@ -0,0 +1,255 @@
+package io.github.kotlinmania.klang.int
+
+import io.github.kotlinmania.klang.mem.GlobalHeap
+
+/**
+ * UInt128: register-resident unsigned 128-bit integer held as two [Long] limbs.
+ *
+ * The heap-based types ([C_UInt128], [io.github.kotlinmania.klang.int.hpc.HeapUInt128])
+ * keep their value in [GlobalHeap] as eight 16-bit limbs, which costs eight
+ * carry steps and a heap round-trip per limb for every operation. UInt128 is
+ * the arithmetic core behind them: an immutable `hi:lo` pair that the JIT and
+ * native backends keep in registers, with 64-bit carries.
+ *
+ * ## Representation
+ *
+ * ```
+ * ┌─────────────── hi ───────────────┬─────────────── lo ───────────────┐
+ * │ bits 127..64                     │ bits 63..0                       │
+ * └──────────────────────────────────┴──────────────────────────────────┘
+ * ```
+ *
+ * [load] and [store] move a value between this form and the 16-byte
+ * little-endian heap layout shared by [SwAR128], [C_UInt128] and `HeapUInt128`
+ * (two 8-byte heap accesses instead of sixteen byte accesses).
+ *
+ * ## Semantics
+ *
+ * Arithmetic wraps modulo 2^128, exactly like C's `unsigned __int128`.
+ * Shift counts use their low 7 bits, mirroring Kotlin's `Long.shl` masking.
+ * Division by zero throws [ArithmeticException].
+ *
+ * | Operation | Method | Cost |
+ * |-----------|--------|------|
+ * | Add / Sub | `a + b`, `a - b` | 2 adds + carry |
+ * | Multiply | `a * b` | 1 unsigned multiply-high + 3 multiplies |
+ * | Div / Rem | `a / b`, `a % b`, `a.divRem(b)` | 1 ULong division when both fit in 64 bits, else ≤128 shift-subtract steps |
+ * | Shifts | `a shl n`, `a shr n` | 2-3 shifts |
+ *
+ * The 64×64→128 product uses `Math.multiplyHigh` on the JVM and a portable
+ * 32-bit-split fallback on every other target ([multiplyHighUnsigned]).
+ *
+ * ## Usage Example
+ *
+ * ```kotlin
+ * val a = UInt128.fromULong(ULong.MAX_VALUE)
+ * val b = a * a                          // 0xfffffffffffffffe0000000000000001
+ * val (q, r) = b.divRem(UInt128.fromULong(10uL))
+ * b.store(KMalloc.malloc(16))           // into the heap layout
+ * ```
+ *
+ * @property hi Bits 127..64
+ * @property lo Bits 63..0
+ * @see C_UInt128 Heap-resident C `unsigned __int128`
+ * @see SwAR128 Limb-based heap arithmetic
+ * @since 0.8.1
+ */
+class UInt128(val hi: Long, val lo: Long) : Comparable<UInt128> {
+
+    /** True when the value is zero. */
+    fun isZero(): Boolean = (hi or lo) == 0L
+
+    /** Low 64 bits. */
+    fun toULong(): ULong = lo.toULong()
+
+    operator fun plus(other: UInt128): UInt128 {
+        val l = lo + other.lo
+        val carry = if (ulessThan(l, lo)) 1L else 0L
+        return UInt128(hi + other.hi + carry, l)
+    }
+
+    operator fun minus(other: UInt128): UInt128 {
+        val l = lo - other.lo
+        val borrow = if (ulessThan(lo, other.lo)) 1L else 0L
+        return UInt128(hi - other.hi - borrow, l)
+    }
+
+    operator fun times(other: UInt128): UInt128 {
+        val h = multiplyHighUnsigned(lo, other.lo) + hi * other.lo + lo * other.hi
+        return UInt128(h, lo * other.lo)
+    }
+
+    operator fun div(other: UInt128): UInt128 = divRem(other).first
+
+    operator fun rem(other: UInt128): UInt128 = divRem(other).second
+
+    /**
+     * Quotient and remainder of `this / divisor` in one pass.
+     *
+     * @throws ArithmeticException if [divisor] is zero
+     */
+    fun divRem(divisor: UInt128): Pair<UInt128, UInt128> {
+        if (divisor.isZero()) throw ArithmeticException("Division by zero")
+        if (hi == 0L && divisor.hi == 0L) {
+            val n = lo.toULong()
+            val d = divisor.lo.toULong()
+            return UInt128(0L, (n / d).toLong()) to UInt128(0L, (n % d).toLong())
+        }
+        if (this < divisor) return ZERO to this
+        // Restoring division, starting at the first quotient bit that can be set
+        val shift = divisor.leadingZeroBits() - leadingZeroBits()
+        var d = divisor shl shift
+        var qHi = 0L
+        var qLo = 0L
+        var rHi = hi
+        var rLo = lo
+        for (i in shift downTo 0) {
+            // r >= d ?
+            val ge = if (rHi != d.hi) ulessThan(d.hi, rHi) else !ulessThan(rLo, d.lo)
+            if (ge) {
+                val l = rLo - d.lo
+                rHi = rHi - d.hi - (if (ulessThan(rLo, d.lo)) 1L else 0L)
+                rLo = l
+                if (i >= 64) qHi = qHi or (1L shl (i - 64)) else qLo = qLo or (1L shl i)
+            }
+            d = d shr 1
+        }
+        return UInt128(qHi, qLo) to UInt128(rHi, rLo)
+    }
+
+    infix fun shl(bits: Int): UInt128 {
+        val n = bits and 127
+        return when {
+            n == 0 -> this
+            n < 64 -> UInt128((hi shl n) or (lo ushr (64 - n)), lo shl n)
+            else -> UInt128(lo shl (n - 64), 0L)
+        }
+    }
+
+    /** Logical right shift (zero-fill). */
+    infix fun shr(bits: Int): UInt128 {
+        val n = bits and 127
+        return when {
+            n == 0 -> this
+            n < 64 -> UInt128(hi ushr n, (lo ushr n) or (hi shl (64 - n)))
+            else -> UInt128(0L, hi ushr (n - 64))
+        }
+    }
+
+    /** Arithmetic right shift treating bit 127 as the sign (for [C_Int128]). */
+    infix fun sar(bits: Int): UInt128 {
+        val n = bits and 127
+        return when {
+            n == 0 -> this
+            n < 64 -> UInt128(hi shr n, (lo ushr n) or (hi shl (64 - n)))
+            else -> UInt128(hi shr 63, hi shr (n - 64))
+        }
+    }
+
+    infix fun and(other: UInt128): UInt128 = UInt128(hi and other.hi, lo and other.lo)
+    infix fun or(other: UInt128): UInt128 = UInt128(hi or other.hi, lo or other.lo)
+    infix fun xor(other: UInt128): UInt128 = UInt128(hi xor other.hi, lo xor other.lo)
+    fun inv(): UInt128 = UInt128(hi.inv(), lo.inv())
+
+    /** Two's complement negation (`0 - this`). */
+    fun negate(): UInt128 = if (lo == 0L) UInt128(-hi, 0L) else UInt128(hi.inv(), -lo)
+
+    fun leadingZeroBits(): Int = if (hi != 0L) hi.countLeadingZeroBits() else 64 + lo.countLeadingZeroBits()
+
+    fun trailingZeroBits(): Int = if (lo != 0L) lo.countTrailingZeroBits() else 64 + hi.countTrailingZeroBits()
+
+    /** Unsigned comparison. */
+    override fun compareTo(other: UInt128): Int {
+        if (hi != other.hi) return if (ulessThan(hi, other.hi)) -1 else 1
+        if (lo != other.lo) return if (ulessThan(lo, other.lo)) -1 else 1
+        return 0
+    }
+
+    /** Signed (two's complement) comparison, for [C_Int128]. */
+    fun compareSigned(other: UInt128): Int {
+        if (hi != other.hi) return if (hi < other.hi) -1 else 1
+        if (lo != other.lo) return if (ulessThan(lo, other.lo)) -1 else 1
+        return 0
+    }
+
+    /** Write this value to 16 bytes of heap at [addr] in the little-endian limb layout. */
+    fun store(addr: Int) {
+        GlobalHeap.sd(addr, lo)
+        GlobalHeap.sd(addr + 8, hi)
+    }
+
+    /** Big-endian hex without leading zeros, in the same format as [SwAR128.toBigEndianHexHeap]. */
+    fun toHexString(): String =
+        if (hi == 0L) lo.toULong().toString(16)
+        else hi.toULong().toString(16) + lo.toULong().toString(16).padStart(16, '0')
+
+    /** Decimal representation. */
+    override fun toString(): String {
+        if (hi == 0L) return lo.toULong().toString()
+        // Peel 19 decimal digits (10^19 < 2^64) per division
+        val parts = ArrayList<ULong>(3)
+        var v = this
+        while (v.hi != 0L) {
+            val (q, r) = v.divRem(TEN_POW_19)
+            parts.add(r.lo.toULong())
+            v = q
+        }
+        return buildString {
+            append(v.lo.toULong().toString())
+            for (i in parts.indices.reversed()) append(parts[i].toString().padStart(19, '0'))
+        }
+    }
+
+    override fun equals(other: Any?): Boolean =
+        this === other || (other is UInt128 && hi == other.hi && lo == other.lo)
+
+    override fun hashCode(): Int = 31 * hi.hashCode() + lo.hashCode()
+
+    operator fun component1(): Long = hi
+    operator fun component2(): Long = lo
+
+    companion object {
+        val ZERO = UInt128(0L, 0L)
+        val ONE = UInt128(0L, 1L)
+        val MAX_VALUE = UInt128(-1L, -1L)
+
+        private val TEN_POW_19 = UInt128(0L, -8446744073709551616L) // 10^19
+
+        /** Zero-extend [value] to 128 bits. */
+        fun fromULong(value: ULong): UInt128 = UInt128(0L, value.toLong())
+
+        /** Sign-extend [value] to 128 bits (two's complement). */
+        fun fromLong(value: Long): UInt128 = UInt128(value shr 63, value)
+
+        /** Read 16 bytes of heap at [addr] in the little-endian limb layout. */
+        fun load(addr: Int): UInt128 = UInt128(GlobalHeap.ld(addr + 8), GlobalHeap.ld(addr))
+
+        /** Full 64×64→128 unsigned product. */
+        fun multiplyFull(a: Long, b: Long): UInt128 = UInt128(multiplyHighUnsigned(a, b), a * b)
+
+        private fun ulessThan(a: Long, b: Long): Boolean = (a xor Long.MIN_VALUE) < (b xor Long.MIN_VALUE)
+    }
+}
+
+/**
+ * High 64 bits of the unsigned 128-bit product `a * b`.
+ *
+ * JVM uses the `Math.multiplyHigh` intrinsic (one `mul`/`umulh`); other
+ * targets fall back to [multiplyHighUnsignedPortable].
+ */
+internal expect fun multiplyHighUnsigned(a: Long, b: Long): Long
+
+/** Portable [multiplyHighUnsigned]: schoolbook product of 32-bit halves. */
+internal fun multiplyHighUnsignedPortable(a: Long, b: Long): Long {
+    val mask = 0xFFFF_FFFFL
+    val aLo = a and mask
+    val aHi = a ushr 32
+    val bLo = b and mask
+    val bHi = b ushr 32
+    val ll = aLo * bLo
+    val lh = aLo * bHi
+    val hl = aHi * bLo
+    val hh = aHi * bHi
+    val mid = (ll ushr 32) + (lh and mask) + (hl and mask)
+    return hh + (lh ushr 32) + (hl ushr 32) + (mid ushr 32)
+}
@@ -4,8 +4,10 @@ import io.github.kotlinmania.klang.bitwise.ArithmeticBitwiseOps
 import io.github.kotlinmania.klang.bitwise.BitShiftEngine
 import io.github.kotlinmania.klang.bitwise.BitShiftMode
 import io.github.kotlinmania.klang.int.SwAR128
+import io.github.kotlinmania.klang.int.UInt128
 import io.github.kotlinmania.klang.mem.GlobalHeap
 import io.github.kotlinmania.klang.mem.KMalloc
+import io.github.kotlinmania.klang.mem.KRegion
 
 /**
  * HeapUInt128: Zero-copy 128-bit unsigned integer with direct heap manipulation.
@@ -152,15 +154,26 @@ import io.github.kotlinmania.klang.mem.KMalloc
  * }
  * ```
  *
- * ### Scope-based Management (Future)
+ * ### In-Place Arithmetic (Recommended for Loops)
+ *
+ * The operators above allocate a fresh 16-byte result on every call. Hot loops
+ * should mutate an accumulator instead, and take temporaries from a scoped
+ * [HeapUInt128Scratch] pool that is released in one `free` at scope end:
  * ```kotlin
- * heapScope {
- *     val a = HeapUInt128.fromULong(100uL)
- *     val b = HeapUInt128.fromULong(200uL)
- *     a + b  // Automatically freed at scope end
+ * val acc = HeapUInt128.zero()
+ * HeapUInt128.withScratch { s ->
+ *     val step = s.fromULong(3uL)
+ *     repeat(1_000_000) { acc.addAssign(step) }  // no allocation per iteration
  * }
  * ```
  *
+ * | Mutating | Into destination | Allocating |
+ * |----------|------------------|------------|
+ * | `addAssign(b)` | `addInto(b, dest)` | `a + b` |
+ * | `subAssign(b)` | `subInto(b, dest)` | `a - b` |
+ * | `shlAssign(n)` | `shlInto(n, dest)` | `a.shiftLeft(n)` |
+ * | `shrAssign(n)` | `shrInto(n, dest)` | `a.shiftRight(n)` |
+ *
  * ## Overflow Behavior
  *
  * Operations throw exceptions on overflow/underflow:
@@ -169,6 +182,9 @@ import io.github.kotlinmania.klang.mem.KMalloc
  * val tooBig = max.shiftLeft(65)  // Throws: "Shift left overflow beyond 128 bits"
  * ```
  *
+ * The in-place and `...Into` variants throw the same exceptions, but only after
+ * the destination has been written: it then holds the value wrapped modulo 2^128.
+ *
  * Future: Wrapping arithmetic variants could be added.
  *
  * ## Thread Safety
@@ -387,6 +403,105 @@ class HeapUInt128 private constructor(val addr: Int) : Comparable<HeapUInt128> {
         return res
     }
 
+    // ========== In-Place Arithmetic ==========
+
+    /**
+     * In-place addition: `this = this + other`.
+     *
+     * Writes straight back into this value's 16 bytes; nothing is allocated.
+     * [other] may be `this` (doubling).
+     *
+     * @throws IllegalArgumentException if the sum overflows 128 bits (this then holds the wrapped sum)
+     */
+    fun addAssign(other: HeapUInt128) {
+        val carry = SwAR128.addHeap(this.addr, other.addr, this.addr)
+        require(carry == 0) { "UInt128 addition overflow" }
+    }
+
+    /**
+     * In-place subtraction: `this = this - other`.
+     *
+     * @throws IllegalArgumentException if this < other (this then holds the wrapped difference)
+     */
+    fun subAssign(other: HeapUInt128) {
+        val borrow = SwAR128.subHeap(this.addr, other.addr, this.addr)
+        require(borrow == 0) { "UInt128 subtraction underflow" }
+    }
+
+    /**
+     * In-place logical left shift: `this = this << bits`.
+     *
+     * @throws IllegalArgumentException if set bits are shifted out (this then holds the truncated value)
+     */
+    fun shlAssign(bits: Int) {
+        val spill = SwAR128.shiftLeftHeap(this.addr, this.addr, bits)
+        require(spill == 0uL) { "Shift left overflow beyond 128 bits" }
+    }
+
+    /** In-place logical right shift: `this = this >>> bits` (zero-fill). */
+    fun shrAssign(bits: Int) {
+        SwAR128.shiftRightHeap(this.addr, this.addr, bits)
+    }
+
+    /**
+     * Store `this + other` into [dest] and return it. [dest] may alias either operand.
+     *
+     * @throws IllegalArgumentException if the sum overflows 128 bits (dest then holds the wrapped sum)
+     */
+    fun addInto(other: HeapUInt128, dest: HeapUInt128): HeapUInt128 {
+        val carry = SwAR128.addHeap(this.addr, other.addr, dest.addr)
+        require(carry == 0) { "UInt128 addition overflow" }
+        return dest
+    }
+
+    /**
+     * Store `this - other` into [dest] and return it. [dest] may alias either operand.
+     *
+     * @throws IllegalArgumentException if this < other (dest then holds the wrapped difference)
+     */
+    fun subInto(other: HeapUInt128, dest: HeapUInt128): HeapUInt128 {
+        val borrow = SwAR128.subHeap(this.addr, other.addr, dest.addr)
+        require(borrow == 0) { "UInt128 subtraction underflow" }
+        return dest
+    }
+
+    /**
+     * Store `this << bits` into [dest] and return it. [dest] may be `this`.
+     *
+     * @throws IllegalArgumentException if set bits are shifted out (dest then holds the truncated value)
+     */
+    fun shlInto(bits: Int, dest: HeapUInt128): HeapUInt128 {
+        val spill = SwAR128.shiftLeftHeap(this.addr, dest.addr, bits)
+        require(spill == 0uL) { "Shift left overflow beyond 128 bits" }
+        return dest
+    }
+
+    /** Store `this >>> bits` into [dest] and return it. [dest] may be `this`. */
+    fun shrInto(bits: Int, dest: HeapUInt128): HeapUInt128 {
+        SwAR128.shiftRightHeap(this.addr, dest.addr, bits)
+        return dest
+    }
+
+    /** Overwrite this value with [other]'s 16 bytes. */
+    fun assign(other: HeapUInt128) {
+        if (other.addr != addr) GlobalHeap.memcpy(addr, other.addr, SwAR128.LIMB_COUNT * 2)
+    }
+
+    /** Overwrite this value with [value], zero-extended. */
+    fun assign(value: ULong) = SwAR128.writeULongToHeap(addr, value)
+
+    /** Overwrite this value with a register-resident [UInt128] (two 8-byte stores). */
+    fun assign(value: UInt128) = value.store(addr)
+
+    /** Load this value into a register-resident [UInt128] (two 8-byte loads). */
+    fun toUInt128(): UInt128 = UInt128.load(addr)
+
+    /** Overwrite this value with zero. */
+    fun setZero() = SwAR128.zeroHeap(addr)
+
+    /** Overwrite this value from 8 little-endian 16-bit limbs. */
+    internal fun assignLimbs(limbs: IntArray) = writeLimbs(addr, limbs)
+
     companion object {
         /** BitShiftEngine for 8-bit byte operations (reading limbs from heap). */
         private val byteShifter = BitShiftEngine(BitShiftMode.NATIVE, 8)
@@ -394,7 +509,9 @@ class HeapUInt128 private constructor(val addr: Int) : Comparable<HeapUInt128> {
         /**
          * Allocate a new uninitialized HeapUInt128.
          *
-         * Allocates 16 bytes on the heap via [KMalloc].
+         * Allocates 16 bytes on the heap via [KMalloc], or from the bound
+         * [KRegion] inside a [KRegion.withRegion] scope (such values are
+         * released with the region and must not be passed to [KMalloc.free]).
          * Contents are undefined (may contain garbage).
          *
          * @return A new HeapUInt128 pointing to allocated memory
@@ -402,7 +519,8 @@ class HeapUInt128 private constructor(val addr: Int) : Comparable<HeapUInt128> {
          * ## Usage
          * Typically used internally. Users should prefer [zero], [one], or [fromULong].
          */
-        fun alloc(): HeapUInt128 = HeapUInt128(KMalloc.malloc(SwAR128.LIMB_COUNT * 2))
+        fun alloc(): HeapUInt128 =
+            HeapUInt128(KRegion.current()?.alloc(SwAR128.LIMB_COUNT * 2) ?: KMalloc.malloc(SwAR128.LIMB_COUNT * 2))
         
         /**
          * Create a zero-initialized 128-bit integer.
@@ -480,6 +598,41 @@ class HeapUInt128 private constructor(val addr: Int) : Comparable<HeapUInt128> {
          * @return A new HeapUInt128
          */
         internal fun fromLimbsUnsafe(limbs: IntArray): HeapUInt128 = fromIntArray(limbs)
+
+        /** View [addr] as a HeapUInt128 without allocating; used by [HeapUInt128Scratch]. */
+        internal fun wrap(addr: Int): HeapUInt128 = HeapUInt128(addr)
+
+        /**
+         * Run [block] with a scoped pool of [slots] 16-byte temporaries.
+         *
+         * The pool is one [KMalloc] block, freed when [block] returns or throws,
+         * so any number of temporaries costs a single malloc/free pair. Values
+         * taken from the pool must not escape the block; copy the result into
+         * an owned value ([copyOf] or [assign]) first.
+         *
+         * ## Example
+         * ```kotlin
+         * val bits = HeapUInt128.withScratch { s ->
+         *     val t = s.fromULong(1uL)
+         *     t.shlAssign(100)
+         *     t.toHexString()
+         * }
+         * ```
+         */
+        inline fun <T> withScratch(slots: Int = HeapUInt128Scratch.DEFAULT_SLOTS, block: (HeapUInt128Scratch) -> T): T {
+            val scratch = HeapUInt128Scratch.open(slots)
+            try {
+                return block(scratch)
+            } finally {
+                scratch.close()
+            }
+        }
+
+        /** Allocate a HeapUInt128 holding a register-resident [UInt128]. */
+        fun fromUInt128(value: UInt128): HeapUInt128 = alloc().also { value.store(it.addr) }
+
+        /** Allocate an owned copy of [value]. */
+        fun copyOf(value: HeapUInt128): HeapUInt128 = alloc().also { it.assign(value) }
     }
 }
 
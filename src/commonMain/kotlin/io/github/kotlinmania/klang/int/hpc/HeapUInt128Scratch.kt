@@ -0,0 +1,86 @@
+package io.github.kotlinmania.klang.int.hpc
+
+import io.github.kotlinmania.klang.int.SwAR128
+import io.github.kotlinmania.klang.mem.KMalloc
+
+/**
+ * HeapUInt128Scratch: a scoped bump pool of 16-byte [HeapUInt128] temporaries.
+ *
+ * Obtained through [HeapUInt128.withScratch]; the whole pool is a single
+ * [KMalloc] block that is released when the scope ends. Inside the scope,
+ * [take] is a pointer bump, so temporaries in tight loops cost nothing once
+ * the pool is open.
+ *
+ * ```
+ * base                                              base + slots × 16
+ * ┌──────────┬──────────┬──────────┬──────────────────┐
+ * │ take() 0 │ take() 1 │ take() 2 │      unused      │
+ * └──────────┴──────────┴──────────┴──────────────────┘
+ * ```
+ *
+ * Values handed out are views onto the pool and become invalid at scope
+ * end, exactly like [io.github.kotlinmania.klang.mem.KStack.alloca] memory.
+ *
+ * @see HeapUInt128.withScratch
+ * @since 0.8.1
+ */
+class HeapUInt128Scratch private constructor(
+    private val base: Int,
+    /** Number of 16-byte slots in this pool. */
+    val slots: Int,
+) {
+    private var used = 0
+    private var closed = false
+
+    /** Slots handed out so far. */
+    val usedSlots: Int get() = used
+
+    /**
+     * Take an uninitialized temporary from the pool.
+     *
+     * @throws IllegalStateException if the pool is exhausted or already closed
+     */
+    fun take(): HeapUInt128 {
+        check(!closed) { "Scratch pool used after its scope ended" }
+        check(used < slots) { "Scratch pool exhausted: slots=$slots" }
+        return HeapUInt128.wrap(base + SLOT_BYTES * used++)
+    }
+
+    /** Take a temporary holding zero. */
+    fun zero(): HeapUInt128 = take().also { it.setZero() }
+
+    /** Take a temporary holding [value]. */
+    fun fromULong(value: ULong): HeapUInt128 = take().also { it.assign(value) }
+
+    /** Take a temporary holding a copy of [value]. */
+    fun copyOf(value: HeapUInt128): HeapUInt128 = take().also { it.assign(value) }
+
+    /** Current fill level, for [release]. */
+    fun mark(): Int = used
+
+    /** Return every slot taken since [marker] to the pool (LIFO, like a stack frame). */
+    fun release(marker: Int) {
+        check(marker in 0..used) { "Invalid scratch marker" }
+        used = marker
+    }
+
+    @PublishedApi
+    internal fun close() {
+        if (closed) return
+        closed = true
+        KMalloc.free(base)
+    }
+
+    companion object {
+        /** Slot count used by [HeapUInt128.withScratch] when none is given. */
+        const val DEFAULT_SLOTS = 8
+
+        private const val SLOT_BYTES = SwAR128.LIMB_COUNT * 2
+
+        @PublishedApi
+        internal fun open(slots: Int): HeapUInt128Scratch {
+            require(slots > 0) { "slots must be positive" }
+            return HeapUInt128Scratch(KMalloc.malloc(slots * SLOT_BYTES), slots)
+        }
+    }
+}
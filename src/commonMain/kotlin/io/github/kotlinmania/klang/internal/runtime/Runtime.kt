@@ -39,7 +39,8 @@ package io.github.kotlinmania.klang.internal.runtime
  * - Automatic allocation/deallocation via pointer arithmetic
  *
  * ### Allocation
- * - KMalloc integration (kmalloc, kcalloc, krealloc, kfree)
+ * - KMalloc integration (kmalloc, kcalloc, krealloc, kfree), routed to the
+ *   calling thread's KArena (kwithArena)
  * - Compatible with C's malloc family
  *
  * ## Usage Example
@@ -108,6 +109,8 @@ public/*!*/ abstract class AbstractRuntime(val REQUESTED_HEAP_SIZE: Int = 0, val
     fun krealloc(ptr: CPointer<Unit>, newSize: Int): CPointer<Unit> = CPointer(io.github.kotlinmania.klang.mem.KMalloc.realloc(ptr.ptr, newSize))
     fun kfree(ptr: CPointer<Unit>) { io.github.kotlinmania.klang.mem.KMalloc.free(ptr.ptr) }
     fun kdispose() { io.github.kotlinmania.klang.mem.KMalloc.dispose() }
+    // Arena routing: every k* shim above allocates from the calling thread's current arena.
+    fun <T> kwithArena(arena: io.github.kotlinmania.klang.mem.KArena, block: () -> T): T = io.github.kotlinmania.klang.mem.KMalloc.withArena(arena, block)
 
     // Unsigned narrow loads. The narrow type's bit width drives normalization, so
     // ArithmeticBitwiseOps(N).normalize() replaces hardcoded 0xFF / 0xFFFF / 0xFFFFFFFFL masks.
@@ -1,7 +1,6 @@
 package io.github.kotlinmania.klang.mem
 
-import io.github.kotlinmania.klang.bitwise.BitShiftEngine
-import io.github.kotlinmania.klang.bitwise.BitShiftMode
+import io.github.kotlinmania.klang.bitwise.NativeShift8
 
 /**
  * CLib: Standard C library string and memory functions for [GlobalHeap].
@@ -78,7 +77,9 @@ import io.github.kotlinmania.klang.bitwise.BitShiftMode
  *
  * ### String Search
  * - [strchr]: Find character in string
- * - [memchr]: Find byte in memory region
+ * - [memchr] / [memrchr]: Find first / last byte in memory region
+ * - [strstr] / [memmem]: Find substring / byte sequence
+ * - [strspn] / [strcspn]: Length of prefix inside / outside a byte set
  *
  * ### Memory Comparison
  * - [memcmp]: Compare two memory regions
@@ -89,7 +90,9 @@ import io.github.kotlinmania.klang.bitwise.BitShiftMode
  * - **strlen**: O(n) - scans until NUL
  * - **strcmp**: O(min(n, m)) - early exit on difference
  * - **strcpy**: O(n) - copies until NUL
- * - **memcmp**: O(n) - compares byte by byte
+ * - **memcmp**: O(n) - compares a word at a time
+ * - **strstr/memmem**: O(n) candidate filter 8 positions per step, full compare on first+last byte match
+ * - **strspn/strcspn**: O(n + m) with a 256-bit byte-class bitmap
  *
  * ## Thread Safety
  *
@@ -128,9 +131,6 @@ import io.github.kotlinmania.klang.bitwise.BitShiftMode
  * @since 0.1.0
  */
 object CLib {
-    // Use 8-bit shifter for byte operations
-    private val shifter = BitShiftEngine(BitShiftMode.NATIVE, 8)
-    
     /**
      * Calculate length of null-terminated string.
      *
@@ -249,7 +249,7 @@ object CLib {
         var i = 0
         while (true) {
             val b = GlobalHeap.lbu(src + i)
-            GlobalHeap.sb(dst + i, shifter.bitwiseAnd(b.toLong(), 0xFF).toByte())
+            GlobalHeap.sb(dst + i, NativeShift8.and(b.toLong(), 0xFF).toByte())
             if (b == 0) return dst
             i++
         }
@@ -288,7 +288,7 @@ object CLib {
         var i = 0
         while (i < n) {
             val b = GlobalHeap.lbu(src + i)
-            GlobalHeap.sb(dst + i, shifter.bitwiseAnd(b.toLong(), 0xFF).toByte())
+            GlobalHeap.sb(dst + i, NativeShift8.and(b.toLong(), 0xFF).toByte())
             i++
             if (b == 0) {
                 // pad the rest with NULs
@@ -387,16 +387,107 @@ object CLib {
      * O(n) where n = strlen(addr)
      */
     fun strchr(addr: Int, c: Int): Int {
-        val needle = shifter.bitwiseAnd(c.toLong(), 0xFF).toInt()
-        var i = 0
-        while (true) {
-            val b = GlobalHeap.lbu(addr + i)
-            if (b == needle) return addr + i
-            if (b == 0) return 0
-            i++
-        }
+        val needle = NativeShift8.and(c.toLong(), 0xFF).toInt()
+        val p = FastStringMem.strchrnul(addr, needle)
+        return if (GlobalHeap.lbu(p) == needle) p else 0
     }
 
+    /**
+     * Search backwards for byte [c] in first [n] bytes of memory.
+     *
+     * @param addr Pointer to memory region
+     * @param c Byte value to search for (0-255)
+     * @param n Number of bytes to search
+     * @return Pointer to last occurrence of [c], or 0 if not found
+     *
+     * ## C Equivalent
+     * ```c
+     * void *memrchr(const void *s, int c, size_t n);  // GNU extension
+     * ```
+     *
+     * ## Complexity
+     * O(n)
+     */
+    fun memrchr(addr: Int, c: Int, n: Int): Int = FastStringMem.memrchr(addr, c, n)
+
+    /**
+     * Find first occurrence of null-terminated [needle] in null-terminated [haystack].
+     *
+     * @param haystack Pointer to string to search
+     * @param needle Pointer to string to find
+     * @return Pointer to the match in [haystack] ([haystack] if needle is empty), or 0 if not found
+     *
+     * ## Example
+     * ```kotlin
+     * val s = createHeapString("key=value")
+     * val eq = CLib.strstr(s, createHeapString("="))  // s + 3
+     * ```
+     *
+     * ## C Equivalent
+     * ```c
+     * char *strstr(const char *haystack, const char *needle);
+     * ```
+     *
+     * ## Complexity
+     * O(n) average; O(n * m) worst case
+     */
+    fun strstr(haystack: Int, needle: Int): Int = FastStringMem.strstr(haystack, needle)
+
+    /**
+     * Find first occurrence of a byte sequence in a memory region.
+     *
+     * @param haystack Pointer to memory region
+     * @param haystackLen Length of region in bytes
+     * @param needle Pointer to byte sequence
+     * @param needleLen Length of byte sequence
+     * @return Pointer to the match ([haystack] if needleLen is 0), or 0 if not found
+     *
+     * ## C Equivalent
+     * ```c
+     * void *memmem(const void *haystack, size_t haystacklen,
+     *              const void *needle, size_t needlelen);  // GNU/BSD extension
+     * ```
+     *
+     * ## Complexity
+     * O(n) average; O(n * m) worst case
+     */
+    fun memmem(haystack: Int, haystackLen: Int, needle: Int, needleLen: Int): Int =
+        FastStringMem.memmem(haystack, haystackLen, needle, needleLen)
+
+    /**
+     * Length of the initial segment of [s] made only of bytes in [accept].
+     *
+     * @param s Pointer to null-terminated string
+     * @param accept Pointer to null-terminated set of bytes
+     * @return Number of leading bytes of [s] found in [accept]
+     *
+     * ## C Equivalent
+     * ```c
+     * size_t strspn(const char *s, const char *accept);
+     * ```
+     *
+     * ## Complexity
+     * O(n + m)
+     */
+    fun strspn(s: Int, accept: Int): Int = FastStringMem.strspn(s, accept)
+
+    /**
+     * Length of the initial segment of [s] containing no byte from [reject].
+     *
+     * @param s Pointer to null-terminated string
+     * @param reject Pointer to null-terminated set of bytes
+     * @return Number of leading bytes of [s] not found in [reject]
+     *
+     * ## C Equivalent
+     * ```c
+     * size_t strcspn(const char *s, const char *reject);
+     * ```
+     *
+     * ## Complexity
+     * O(n + m)
+     */
+    fun strcspn(s: Int, reject: Int): Int = FastStringMem.strcspn(s, reject)
+
     /**
      * Compare two memory regions lexicographically.
      *
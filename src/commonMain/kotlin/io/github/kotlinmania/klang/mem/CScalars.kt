@@ -587,8 +587,9 @@ class CUE4M3Var(override val addr: Int) : CVar {
  *
  * ## Performance
  *
- * - **Allocation**: O(1) via [KStack.alloca]
- * - **Deallocation**: O(1) via frame pop (bulk free)
+ * - **Allocation**: O(1) via [KStack.alloca], or [KRegion.alloc] inside a
+ *   [KRegion.withRegion] scope
+ * - **Deallocation**: O(1) via frame pop or region release (bulk free)
  * - **Access**: Direct heap access (no indirection)
  *
  * ## Alignment
@@ -605,6 +606,9 @@ class CUE4M3Var(override val addr: Int) : CVar {
  * @since 0.1.0
  */
 object CAutos {
+    /** Storage for one automatic: the bound [KRegion] if any, else the current [KStack] frame. */
+    private fun auto(bytes: Int, align: Int): Int = KRegion.current()?.alloc(bytes, align) ?: KStack.alloca(bytes, align)
+
     /**
      * Allocate a byte on the stack.
      *
@@ -613,7 +617,7 @@ object CAutos {
      * @return CByteVar pointing to stack memory
      */
     fun byte(init: Byte = 0, align: Int = 1): CByteVar {
-        val p = KStack.alloca(1, align)
+        val p = auto(1, align)
         GlobalHeap.sb(p, init)
         return CByteVar(p)
     }
@@ -626,7 +630,7 @@ object CAutos {
      * @return CShortVar pointing to stack memory
      */
     fun short(init: Short = 0, align: Int = 2): CShortVar {
-        val p = KStack.alloca(2, align)
+        val p = auto(2, align)
         GlobalHeap.sh(p, init)
         return CShortVar(p)
     }
@@ -639,7 +643,7 @@ object CAutos {
      * @return CIntVar pointing to stack memory
      */
     fun int(init: Int = 0, align: Int = 4): CIntVar {
-        val p = KStack.alloca(4, align)
+        val p = auto(4, align)
         GlobalHeap.sw(p, init)
         return CIntVar(p)
     }
@@ -652,7 +656,7 @@ object CAutos {
      * @return CLongVar pointing to stack memory
      */
     fun long(init: Long = 0L, align: Int = 8): CLongVar {
-        val p = KStack.alloca(8, align)
+        val p = auto(8, align)
         GlobalHeap.sd(p, init)
         return CLongVar(p)
     }
@@ -665,7 +669,7 @@ object CAutos {
      * @return CFloatVar pointing to stack memory
      */
     fun float(init: Float = 0f, align: Int = 4): CFloatVar {
-        val p = KStack.alloca(4, align)
+        val p = auto(4, align)
         GlobalHeap.swf(p, init)
         return CFloatVar(p)
     }
@@ -679,7 +683,7 @@ object CAutos {
      * @see io.github.kotlinmania.klang.fp.CFloat32 For bit-exact arithmetic
      */
     fun float32(init: io.github.kotlinmania.klang.fp.CFloat32 = io.github.kotlinmania.klang.fp.CFloat32.fromFloat(0f), align: Int = 4): CFloat32Var {
-        val p = KStack.alloca(4, align)
+        val p = auto(4, align)
         GlobalHeap.sw(p, init.toBits())
         return CFloat32Var(p)
     }
@@ -692,7 +696,7 @@ object CAutos {
      * @return CFloat64Var pointing to stack memory
      */
     fun double(init: Double = 0.0, align: Int = 8): CFloat64Var {
-        val p = KStack.alloca(8, align)
+        val p = auto(8, align)
         GlobalHeap.sdf(p, init)
         return CFloat64Var(p)
     }
@@ -709,7 +713,7 @@ object CAutos {
      * @see io.github.kotlinmania.klang.fp.CFloat128
      */
     fun float128(init: io.github.kotlinmania.klang.fp.CFloat128 = io.github.kotlinmania.klang.fp.CFloat128.ZERO, align: Int = 16): CFloat128Var {
-        val p = KStack.alloca(16, align)
+        val p = auto(16, align)
         GlobalHeap.sdf(p, init.hi)
         GlobalHeap.sdf(p + 8, init.lo)
         return CFloat128Var(p)
@@ -724,7 +728,7 @@ object CAutos {
      * @see io.github.kotlinmania.klang.fp.CLongDouble
      */
     fun longdouble(init: io.github.kotlinmania.klang.fp.CLongDouble = io.github.kotlinmania.klang.fp.CLongDouble.ofDouble(0.0), align: Int = 16): CLongDoubleVar {
-        val p = KStack.alloca(16, align)
+        val p = auto(16, align)
         val f128 = init.toCFloat128()
         GlobalHeap.sdf(p, f128.hi)
         GlobalHeap.sdf(p + 8, f128.lo)
@@ -743,7 +747,7 @@ object CAutos {
      * @see io.github.kotlinmania.klang.fp.CFloat16
      */
     fun float16(init: io.github.kotlinmania.klang.fp.CFloat16 = io.github.kotlinmania.klang.fp.CFloat16.Companion.ZERO, align: Int = 2): CFloat16Var {
-        val p = KStack.alloca(2, align)
+        val p = auto(2, align)
         GlobalHeap.sh(p, init.toBits().toShort())
         return CFloat16Var(p)
     }
@@ -760,7 +764,7 @@ object CAutos {
      * @see io.github.kotlinmania.klang.fp.CBF16
      */
     fun bfloat16(init: io.github.kotlinmania.klang.fp.CBF16 = io.github.kotlinmania.klang.fp.CBF16.fromFloat(0f), align: Int = 2): CBF16Var {
-        val p = KStack.alloca(2, align)
+        val p = auto(2, align)
         GlobalHeap.sh(p, init.toBits())
         return CBF16Var(p)
     }
@@ -774,7 +778,7 @@ object CAutos {
      * @see io.github.kotlinmania.klang.fp.CE8M0
      */
     fun e8m0(init: io.github.kotlinmania.klang.fp.CE8M0 = io.github.kotlinmania.klang.fp.CE8M0.ZERO, align: Int = 1): CE8M0Var {
-        val p = KStack.alloca(1, align)
+        val p = auto(1, align)
         GlobalHeap.sb(p, init.toBits().toByte())
         return CE8M0Var(p)
     }
@@ -788,7 +792,7 @@ object CAutos {
      * @see io.github.kotlinmania.klang.fp.CUE4M3
      */
     fun ue4m3(init: io.github.kotlinmania.klang.fp.CUE4M3 = io.github.kotlinmania.klang.fp.CUE4M3.ZERO, align: Int = 1): CUE4M3Var {
-        val p = KStack.alloca(1, align)
+        val p = auto(1, align)
         GlobalHeap.sb(p, init.toBits().toByte())
         return CUE4M3Var(p)
     }
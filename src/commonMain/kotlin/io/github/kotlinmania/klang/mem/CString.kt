@@ -1,12 +1,9 @@
 package io.github.kotlinmania.klang.mem
 
-import io.github.kotlinmania.klang.bitwise.BitShiftEngine
-import io.github.kotlinmania.klang.bitwise.BitShiftMode
+import io.github.kotlinmania.klang.bitwise.NativeShift8
 
 /** CString helpers on top of GlobalHeap (addresses are Int byte offsets). */
 object CString {
-    private val shifter = BitShiftEngine(BitShiftMode.NATIVE, 8)
-    
     fun strlenz(addr: Int): Int {
         var i = 0
         while (true) {
@@ -31,7 +28,7 @@ object CString {
     fun write(addr: Int, s: String): Int {
         var i = 0
         while (i < s.length) {
-            val masked = shifter.bitwiseAnd(s[i].code.toLong(), 0xFF)
+            val masked = NativeShift8.and(s[i].code.toLong(), 0xFF)
             GlobalHeap.sb(addr + i, masked.toByte())
             i++
         }
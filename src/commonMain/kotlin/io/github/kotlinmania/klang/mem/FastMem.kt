@@ -1,8 +1,5 @@
 package io.github.kotlinmania.klang.mem
 
-import io.github.kotlinmania.klang.bitwise.BitShiftEngine
-import io.github.kotlinmania.klang.bitwise.BitShiftMode
-
 /**
  * FastMem: High-performance word-at-a-time memory operations.
  *
@@ -13,9 +10,11 @@ import io.github.kotlinmania.klang.bitwise.BitShiftMode
  *
  * ## Optimization Strategy
  *
- * 1. **Head alignment**: Process leading bytes until word-aligned
- * 2. **Word bulk**: Process 8-byte words in the aligned region
- * 3. **Tail remainder**: Handle trailing bytes that don't form a complete word
+ * 1. **Head alignment**: Merge leading bytes into the first destination word
+ * 2. **Word bulk**: Move whole backing Longs of [PackedBuffer.data] — one
+ *    `LongArray.copyInto` when source and destination share alignment, a
+ *    two-word shift-merge per Long otherwise
+ * 3. **Tail remainder**: Merge trailing bytes into the last destination word
  *
  * ## Performance
  *
@@ -35,129 +34,29 @@ import io.github.kotlinmania.klang.bitwise.BitShiftMode
  * This is an internal object used by [GlobalHeap]. Applications should use the
  * higher-level GlobalHeap API rather than calling FastMem directly.
  *
- * All bitwise operations use [BitShiftEngine] to ensure correct behavior across
- * all platforms and to avoid Kotlin's type promotion issues.
+ * The word kernels live on [PackedBuffer] ([PackedBuffer.copyWords],
+ * [PackedBuffer.fillWords]) so that [GlobalHeap] and FastMem share one path.
+ * Nothing here allocates per word.
  *
  * @see GlobalHeap.memset
  * @see GlobalHeap.memcpy
  * @see GlobalHeap.memmove
  */
 internal object FastMem {
-    private const val WORD_BYTES = 8
-    private const val WORD_MASK = WORD_BYTES - 1
-    
-    // Use 64-bit shifter for word operations
-    private val shifter = BitShiftEngine(BitShiftMode.NATIVE, 64)
-
-    /**
-     * Replicate a byte value across all 8 bytes of a word.
-     * Uses BitShiftEngine for proper bit manipulation.
-     */
-    private fun repeatByte(b: Int): Long {
-        return shifter.repeatByteToWord(b)
-    }
-
-    /**
-     * Store a 64-bit word as 8 bytes in memory (little-endian).
-     * Uses BitShiftEngine for byte extraction.
-     */
-    private fun storeWord(addr: Int, w: Long) {
-        for (i in 0 until WORD_BYTES) {
-            val byte = shifter.extractByte(w, i)
-            GlobalHeap.sb(addr + i, byte.toByte())
-        }
-    }
-
-    /**
-     * Load 8 bytes from memory into a 64-bit word (little-endian).
-     * Uses BitShiftEngine for byte composition.
-     */
-    private fun loadWord(addr: Int): Long {
-        val bytes = LongArray(WORD_BYTES) { i ->
-            shifter.bitwiseAnd(GlobalHeap.lbu(addr + i).toLong(), 0xFFL)
-        }
-        return shifter.composeBytes(bytes)
-    }
-
     fun memset(addr: Int, value: Int, bytes: Int) {
         if (bytes <= 0) return
-        var p = addr
-        var n = bytes
-        val byteVal = shifter.bitwiseAnd(value.toLong(), 0xFFL).toInt()
-        
-        // Align to word
-        while (n > 0 && shifter.bitwiseAnd(p.toLong(), WORD_MASK.toLong()) != 0L) {
-            GlobalHeap.sb(p++, byteVal.toByte())
-            n--
-        }
-        if (n >= WORD_BYTES) {
-            val w = repeatByte(byteVal)
-            while (n >= WORD_BYTES) {
-                storeWord(p, w)
-                p += WORD_BYTES
-                n -= WORD_BYTES
-            }
-        }
-        while (n-- > 0) {
-            GlobalHeap.sb(p++, byteVal.toByte())
-        }
+        GlobalHeap.packed.fillWords(addr, value, bytes)
     }
 
     /** memcpy: undefined behavior for overlap. */
     fun memcpy(dst: Int, src: Int, bytes: Int) {
         if (bytes <= 0 || dst == src) return
-        var d = dst
-        var s = src
-        var n = bytes
-        // Align destination; copy bytes
-        while (n > 0 && shifter.bitwiseAnd(d.toLong(), WORD_MASK.toLong()) != 0L) {
-            GlobalHeap.sb(d++, GlobalHeap.lb(s++))
-            n--
-        }
-        // Bulk words
-        while (n >= WORD_BYTES) {
-            val w = loadWord(s)
-            storeWord(d, w)
-            d += WORD_BYTES
-            s += WORD_BYTES
-            n -= WORD_BYTES
-        }
-        // Tail
-        while (n-- > 0) {
-            GlobalHeap.sb(d++, GlobalHeap.lb(s++))
-        }
+        GlobalHeap.packed.copyWords(dst, src, bytes)
     }
 
     /** memmove: overlap-safe; chooses direction. */
     fun memmove(dst: Int, src: Int, bytes: Int) {
         if (bytes <= 0 || dst == src) return
-        if (dst > src && dst < src + bytes) {
-            // Copy backwards
-            var d = dst + bytes
-            var s = src + bytes
-            var n = bytes
-            // Align backward
-            while (n > 0 && shifter.bitwiseAnd(d.toLong(), WORD_MASK.toLong()) != 0L) {
-                d--
-                s--
-                GlobalHeap.sb(d, GlobalHeap.lb(s))
-                n--
-            }
-            while (n >= WORD_BYTES) {
-                d -= WORD_BYTES
-                s -= WORD_BYTES
-                val w = loadWord(s)
-                storeWord(d, w)
-                n -= WORD_BYTES
-            }
-            while (n-- > 0) {
-                d--
-                s--
-                GlobalHeap.sb(d, GlobalHeap.lb(s))
-            }
-        } else {
-            memcpy(dst, src, bytes)
-        }
+        GlobalHeap.packed.copyWords(dst, src, bytes)
     }
 }
-
@@ -1,17 +1,28 @@
 package io.github.kotlinmania.klang.mem
 
-import io.github.kotlinmania.klang.bitwise.BitShiftEngine
-import io.github.kotlinmania.klang.bitwise.BitShiftMode
-
 /**
  * FastStringMem: High-performance word-at-a-time string operations.
  *
- * Implements optimized string and memory comparison operations using word-level
- * access patterns inspired by musl libc. These implementations process 8 bytes at a
- * time when alignment permits.
+ * Implements optimized string and memory search/compare operations using
+ * word-level access patterns inspired by musl libc. Words are read straight
+ * from [PackedBuffer.data]: an aligned word is one `LongArray` load, an
+ * unaligned one is two loads and a funnel shift. Nothing here allocates.
+ *
+ * ## SWAR Byte Tests
+ *
+ * Little-endian words let one 64-bit operation test eight bytes:
+ *
+ * ```
+ * zeroBytes(x)          0x80 in each byte of x that is 0x00 (exact, no borrow)
+ * zeroBytes(x xor c8)   0x80 in each byte equal to c, with c8 = c repeated 8 times
+ * ctz(mask) / 8         index of the first such byte
+ * ```
+ *
+ * [memmem] filters candidate positions eight at a time by comparing the
+ * needle's first and last bytes against two words of the haystack, and
+ * only runs a full compare where both match.
  *
- * All bitwise operations use [BitShiftEngine] to ensure correct behavior across
- * all platforms and to avoid Kotlin's type promotion issues.
+ * @native-bitshift-allowed Kernel layer for CLib; raw shifts permitted.
  */
 internal object FastStringMem {
     private const val WORD_BYTES = 8
@@ -19,95 +30,134 @@ internal object FastStringMem {
     private const val BYTE_MASK = 0xFF
 
     private const val M1: Long = 0x0101010101010101L
-    // 0x8080808080808080 as signed Long literal:
-    private const val M2: Long = -0x7F7F7F7F7F7F7F80L
-    
-    // Use 64-bit shifter for word operations
-    private val shifter = BitShiftEngine(BitShiftMode.NATIVE, 64)
-
-    private inline fun hasZeroByte(x: Long): Boolean {
-        val sub = x - M1
-        val notX = shifter.bitwiseNot(x)
-        val and1 = shifter.bitwiseAnd(sub, notX)
-        val and2 = shifter.bitwiseAnd(and1, M2)
-        return and2 != 0L
-    }
+    private const val LOW7: Long = 0x7F7F7F7F7F7F7F7FL
 
-    private inline fun repeatByte(b: Int): Long {
-        return shifter.repeatByteToWord(b)
-    }
+    /** 0x80 in every byte of [x] that is zero; exact in every lane. */
+    private inline fun zeroBytes(x: Long): Long = (((x and LOW7) + LOW7) or x or LOW7).inv()
 
-    private inline fun loadWord(addr: Int): Long {
-        val bytes = LongArray(WORD_BYTES) { i ->
-            shifter.bitwiseAnd(GlobalHeap.lbu(addr + i).toLong(), 0xFFL)
-        }
-        return shifter.composeBytes(bytes)
+    private inline fun repeatByte(b: Int): Long = (b and BYTE_MASK).toLong() * M1
+
+    private inline fun byteAt(d: LongArray, addr: Int): Int =
+        (d[addr ushr 3] ushr ((addr and WORD_MASK) shl 3)).toInt() and BYTE_MASK
+
+    private inline fun laneOf(w: Long, lane: Int): Int = (w ushr (lane shl 3)).toInt() and BYTE_MASK
+
+    private inline fun firstLane(mask: Long): Int = mask.countTrailingZeroBits() ushr 3
+
+    private inline fun lastLane(mask: Long): Int = (63 - mask.countLeadingZeroBits()) ushr 3
+
+    /** Eight bytes at any address; bytes past the end of the heap read as 0. */
+    private inline fun loadAt(d: LongArray, addr: Int): Long {
+        val idx = addr ushr 3
+        val shift = (addr and WORD_MASK) shl 3
+        if (shift == 0) return d[idx]
+        val hi = if (idx + 1 < d.size) d[idx + 1] else 0L
+        return (d[idx] ushr shift) or (hi shl (64 - shift))
     }
 
     fun strlen(addr: Int): Int {
+        val d = GlobalHeap.packed.data
         var p = addr
         // Align to word
-        while (shifter.bitwiseAnd(p.toLong(), WORD_MASK.toLong()) != 0L) {
-            if (GlobalHeap.lbu(p) == 0) return p - addr
+        while ((p and WORD_MASK) != 0) {
+            if (byteAt(d, p) == 0) return p - addr
             p++
         }
         // Scan by words
         while (true) {
-            val w = loadWord(p)
-            if (hasZeroByte(w)) break
+            val z = zeroBytes(d[p ushr 3])
+            if (z != 0L) return p + firstLane(z) - addr
+            p += WORD_BYTES
+        }
+    }
+
+    /** First byte equal to [c] or NUL at or after [addr] (musl `strchrnul`). */
+    fun strchrnul(addr: Int, c: Int): Int {
+        val d = GlobalHeap.packed.data
+        val cb = c and BYTE_MASK
+        if (cb == 0) return addr + strlen(addr)
+        val cword = repeatByte(cb)
+        var p = addr
+        while ((p and WORD_MASK) != 0) {
+            val b = byteAt(d, p)
+            if (b == 0 || b == cb) return p
+            p++
+        }
+        while (true) {
+            val w = d[p ushr 3]
+            val hit = zeroBytes(w) or zeroBytes(w xor cword)
+            if (hit != 0L) return p + firstLane(hit)
             p += WORD_BYTES
         }
-        // Finish byte-wise
-        while (GlobalHeap.lbu(p) != 0) p++
-        return p - addr
     }
 
     fun memchr(addr: Int, c: Int, n: Int): Int {
         if (n <= 0) return 0
+        val d = GlobalHeap.packed.data
         var p = addr
         var rem = n
-        val cMasked = shifter.bitwiseAnd(c.toLong(), BYTE_MASK.toLong()).toInt()
+        val cMasked = c and BYTE_MASK
         val cword = repeatByte(cMasked)
 
         // Align
-        while (rem > 0 && shifter.bitwiseAnd(p.toLong(), WORD_MASK.toLong()) != 0L) {
-            if (GlobalHeap.lbu(p) == cMasked) return p
+        while (rem > 0 && (p and WORD_MASK) != 0) {
+            if (byteAt(d, p) == cMasked) return p
             p++
             rem--
         }
         // Words
         while (rem >= WORD_BYTES) {
-            val w = loadWord(p)
-            val x = shifter.bitwiseXor(w, cword)
-            if (hasZeroByte(x)) {
-                // Locate exact byte
-                var i = 0
-                while (i < WORD_BYTES) {
-                    if (GlobalHeap.lbu(p + i) == cMasked) return p + i
-                    i++
-                }
-            }
+            val hit = zeroBytes(d[p ushr 3] xor cword)
+            if (hit != 0L) return p + firstLane(hit)
             p += WORD_BYTES
             rem -= WORD_BYTES
         }
         // Tail
         while (rem > 0) {
-            if (GlobalHeap.lbu(p) == cMasked) return p
+            if (byteAt(d, p) == cMasked) return p
             p++
             rem--
         }
         return 0
     }
 
+    /** Last byte equal to [c] in `[addr, addr + n)`, or 0 (GNU `memrchr`). */
+    fun memrchr(addr: Int, c: Int, n: Int): Int {
+        if (n <= 0) return 0
+        val d = GlobalHeap.packed.data
+        val cMasked = c and BYTE_MASK
+        val cword = repeatByte(cMasked)
+        var end = addr + n // exclusive
+
+        // Tail down to a word boundary
+        while (end > addr && (end and WORD_MASK) != 0) {
+            end--
+            if (byteAt(d, end) == cMasked) return end
+        }
+        // Words, highest first
+        while (end - addr >= WORD_BYTES) {
+            end -= WORD_BYTES
+            val hit = zeroBytes(d[end ushr 3] xor cword)
+            if (hit != 0L) return end + lastLane(hit)
+        }
+        // Head
+        while (end > addr) {
+            end--
+            if (byteAt(d, end) == cMasked) return end
+        }
+        return 0
+    }
+
     fun memcmp(a: Int, b: Int, n: Int): Int {
         if (n <= 0) return 0
+        val d = GlobalHeap.packed.data
         var pa = a
         var pb = b
         var rem = n
-        // Align
-        while (rem > 0 && shifter.bitwiseAnd(shifter.bitwiseOr(pa.toLong(), pb.toLong()), WORD_MASK.toLong()) != 0L) {
-            val da = GlobalHeap.lbu(pa)
-            val db = GlobalHeap.lbu(pb)
+        // Align a; b is loaded unaligned if it does not share a's alignment
+        while (rem > 0 && (pa and WORD_MASK) != 0) {
+            val da = byteAt(d, pa)
+            val db = byteAt(d, pb)
             if (da != db) return da - db
             pa++
             pb++
@@ -115,17 +165,11 @@ internal object FastStringMem {
         }
         // Words
         while (rem >= WORD_BYTES) {
-            val wa = loadWord(pa)
-            val wb = loadWord(pb)
+            val wa = d[pa ushr 3]
+            val wb = loadAt(d, pb)
             if (wa != wb) {
-                // Find first differing byte in this word
-                var i = 0
-                while (i < WORD_BYTES) {
-                    val da = GlobalHeap.lbu(pa + i)
-                    val db = GlobalHeap.lbu(pb + i)
-                    if (da != db) return da - db
-                    i++
-                }
+                val lane = firstLane(wa xor wb)
+                return laneOf(wa, lane) - laneOf(wb, lane)
             }
             pa += WORD_BYTES
             pb += WORD_BYTES
@@ -133,8 +177,8 @@ internal object FastStringMem {
         }
         // Tail
         while (rem > 0) {
-            val da = GlobalHeap.lbu(pa)
-            val db = GlobalHeap.lbu(pb)
+            val da = byteAt(d, pa)
+            val db = byteAt(d, pb)
             if (da != db) return da - db
             pa++
             pb++
@@ -144,33 +188,149 @@ internal object FastStringMem {
     }
 
     fun strcmp(a: Int, b: Int): Int {
+        val d = GlobalHeap.packed.data
         var pa = a
         var pb = b
-        // Align
-        while (shifter.bitwiseAnd(shifter.bitwiseOr(pa.toLong(), pb.toLong()), WORD_MASK.toLong()) != 0L) {
-            val da = GlobalHeap.lbu(pa)
-            val db = GlobalHeap.lbu(pb)
+        // Align a
+        while ((pa and WORD_MASK) != 0) {
+            val da = byteAt(d, pa)
+            val db = byteAt(d, pb)
             if (da != db || da == 0) return da - db
             pa++
             pb++
         }
-        // Words
+        // Words: stop at the first byte that differs or is NUL in a
         while (true) {
-            val wa = loadWord(pa)
-            val wb = loadWord(pb)
-            if (wa != wb) {
-                // differ; locate exact byte
-                var i = 0
-                while (i < WORD_BYTES) {
-                    val da = GlobalHeap.lbu(pa + i)
-                    val db = GlobalHeap.lbu(pb + i)
-                    if (da != db || da == 0) return da - db
-                    i++
-                }
+            val wa = d[pa ushr 3]
+            val wb = loadAt(d, pb)
+            val stop = (wa xor wb) or zeroBytes(wa)
+            if (stop != 0L) {
+                val lane = firstLane(stop)
+                return laneOf(wa, lane) - laneOf(wb, lane)
             }
-            if (hasZeroByte(wa)) return 0 // equal up to NUL in this word
             pa += WORD_BYTES
             pb += WORD_BYTES
         }
     }
+
+    /**
+     * First occurrence of `needle[0 until needleLen]` in
+     * `haystack[0 until haystackLen]`, or 0. An empty needle matches at [haystack].
+     */
+    fun memmem(haystack: Int, haystackLen: Int, needle: Int, needleLen: Int): Int {
+        if (needleLen == 0) return haystack
+        if (needleLen > haystackLen) return 0
+        val d = GlobalHeap.packed.data
+        val first = byteAt(d, needle)
+        if (needleLen == 1) return memchr(haystack, first, haystackLen)
+        val last = byteAt(d, needle + needleLen - 1)
+        val firstWord = repeatByte(first)
+        val lastWord = repeatByte(last)
+        val lastStart = haystack + haystackLen - needleLen // last valid start position
+        var p = haystack
+        // Eight candidate start positions per step
+        while (p + WORD_MASK <= lastStart) {
+            var hits = zeroBytes(loadAt(d, p) xor firstWord) and
+                zeroBytes(loadAt(d, p + needleLen - 1) xor lastWord)
+            while (hits != 0L) {
+                val q = p + firstLane(hits)
+                if (needleLen == 2 || memcmp(q + 1, needle + 1, needleLen - 2) == 0) return q
+                hits = hits and (hits - 1)
+            }
+            p += WORD_BYTES
+        }
+        while (p <= lastStart) {
+            if (byteAt(d, p) == first && byteAt(d, p + needleLen - 1) == last &&
+                memcmp(p + 1, needle + 1, needleLen - 2) == 0
+            ) {
+                return p
+            }
+            p++
+        }
+        return 0
+    }
+
+    /** C `strstr`: [memmem] over the two NUL-terminated strings. */
+    fun strstr(haystack: Int, needle: Int): Int {
+        val d = GlobalHeap.packed.data
+        val first = byteAt(d, needle)
+        if (first == 0) return haystack
+        if (byteAt(d, needle + 1) == 0) {
+            val r = strchrnul(haystack, first)
+            return if (byteAt(d, r) == first) r else 0
+        }
+        return memmem(haystack, strlen(haystack), needle, strlen(needle))
+    }
+
+    /** Length of the initial run of bytes in the NUL-terminated set [accept]. */
+    fun strspn(s: Int, accept: Int): Int {
+        val d = GlobalHeap.packed.data
+        val a0 = byteAt(d, accept)
+        if (a0 == 0) return 0
+        if (byteAt(d, accept + 1) == 0) return spanOfByte(d, s, a0)
+        // 256-bit class bitmap in four words; NUL is never in the set
+        var m0 = 0L; var m1 = 0L; var m2 = 0L; var m3 = 0L
+        var q = accept
+        while (true) {
+            val b = byteAt(d, q++)
+            if (b == 0) break
+            val bit = 1L shl (b and 63)
+            when (b ushr 6) {
+                0 -> m0 = m0 or bit
+                1 -> m1 = m1 or bit
+                2 -> m2 = m2 or bit
+                else -> m3 = m3 or bit
+            }
+        }
+        var p = s
+        while (true) {
+            val b = byteAt(d, p)
+            val m = when (b ushr 6) { 0 -> m0; 1 -> m1; 2 -> m2; else -> m3 }
+            if ((m ushr (b and 63)) and 1L == 0L) return p - s
+            p++
+        }
+    }
+
+    /** Length of the initial run of bytes not in the NUL-terminated set [reject]. */
+    fun strcspn(s: Int, reject: Int): Int {
+        val d = GlobalHeap.packed.data
+        val r0 = byteAt(d, reject)
+        if (r0 == 0 || byteAt(d, reject + 1) == 0) return strchrnul(s, r0) - s
+        // 256-bit class bitmap; NUL always stops the scan
+        var m0 = 1L; var m1 = 0L; var m2 = 0L; var m3 = 0L
+        var q = reject
+        while (true) {
+            val b = byteAt(d, q++)
+            if (b == 0) break
+            val bit = 1L shl (b and 63)
+            when (b ushr 6) {
+                0 -> m0 = m0 or bit
+                1 -> m1 = m1 or bit
+                2 -> m2 = m2 or bit
+                else -> m3 = m3 or bit
+            }
+        }
+        var p = s
+        while (true) {
+            val b = byteAt(d, p)
+            val m = when (b ushr 6) { 0 -> m0; 1 -> m1; 2 -> m2; else -> m3 }
+            if ((m ushr (b and 63)) and 1L != 0L) return p - s
+            p++
+        }
+    }
+
+    /** Length of the initial run of byte [c] (non-zero), a word at a time. */
+    private fun spanOfByte(d: LongArray, s: Int, c: Int): Int {
+        val cword = repeatByte(c)
+        var p = s
+        while ((p and WORD_MASK) != 0) {
+            if (byteAt(d, p) != c) return p - s
+            p++
+        }
+        while (true) {
+            val diff = d[p ushr 3] xor cword
+            if (diff != 0L) return p + firstLane(diff) - s
+            p += WORD_BYTES
+        }
+    }
 }
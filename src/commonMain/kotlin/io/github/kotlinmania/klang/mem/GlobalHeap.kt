@@ -35,18 +35,51 @@ package io.github.kotlinmania.klang.mem
  * val value = GlobalHeap.lw(addr)  // returns 42
  * ```
  *
+ * ## Growth
+ *
+ * Growing past [size] allocates a 1.5× larger buffer and copies the old one
+ * with a single `copyInto`, so a large growth step briefly holds both
+ * buffers. Regions that are huge, or that must grow without pauses or past
+ * the 2 GB `Int` address space, belong in [PagedHeap] instead.
+ *
+ * ## Snapshots
+ *
+ * [snapshot] streams the heap words and the [KMalloc] main-arena metadata
+ * to a [HeapSink]; [restore] rebuilds both from a [HeapSource], so
+ * allocation after a restore proceeds exactly as it would have in the
+ * original process. [saveImage] / [loadImage] do the same against a file
+ * on targets with a file backend (Native: mmap on POSIX targets, stdio on
+ * mingwX64). Loading always copies the image into a fresh backing array;
+ * the heap never runs out of the file itself. See [HeapImage] for the format.
+ *
  * ## Thread Safety
  *
  * **Not thread-safe**. External synchronization required for concurrent access.
  *
+ * @see HeapImage For the snapshot image format
+ * @see PagedHeap For segment-backed, `Long`-addressed storage
  * @see KMalloc For free-list allocator with malloc/free semantics
  * @see CScalars For type-safe scalar variables on the heap
  * @since 0.1.0
  */
 object GlobalHeap {
+    /** Largest capacity a flat heap can grow to (the last 8-byte word below `Int.MAX_VALUE`). */
+    private const val MAX_HEAP_BYTES = Int.MAX_VALUE and 7.inv()
+
     private var buffer: PackedBuffer = PackedBuffer(0)
     private var hp: Int = 0
 
+    /**
+     * The live backing buffer. Bulk kernels inside klang ([FastMem],
+     * [FastStringMem], typed views) read and write `packed.data` directly
+     * instead of going through the per-element accessors below.
+     *
+     * Re-read after anything that may grow the heap: [ensureCapacity]
+     * swaps in a new buffer.
+     */
+    @PublishedApi
+    internal val packed: PackedBuffer get() = buffer
+
     /** Total heap size in bytes. */
     val size: Int get() = buffer.capacity
 
@@ -92,23 +125,116 @@ object GlobalHeap {
     fun free(ptr: Int) { /* no-op bump allocator */ }
 
     private fun ensure(minSize: Int) {
+        require(minSize in 0..MAX_HEAP_BYTES) { "Heap size $minSize is outside the Int address space; see PagedHeap" }
         if (minSize <= buffer.capacity) return
-        var newSize = buffer.capacity.coerceAtLeast(1024)
+        var newSize = buffer.capacity.coerceAtLeast(1024).toLong()
         while (newSize < minSize) {
-            newSize = newSize + (newSize ushr 1)  // 1.5x growth
-        }
-        val newBuffer = PackedBuffer(newSize)
-        for (i in 0 until (buffer.capacity ushr 3)) {
-            if (i < newBuffer.data.size && i < buffer.data.size) {
-                newBuffer.data[i] = buffer.data[i]
-            }
+            newSize += newSize ushr 1  // 1.5x growth
         }
+        // Clamp so the 1.5x step cannot wrap past the Int address space
+        val newBuffer = PackedBuffer(minOf(newSize, MAX_HEAP_BYTES.toLong()).toInt())
+        buffer.data.copyInto(newBuffer.data)
         buffer = newBuffer
     }
 
     /** Ensure heap capacity, growing if necessary. */
     fun ensureCapacity(minSize: Int) = ensure(minSize)
 
+    // ========== Snapshot / Restore ==========
+
+    /**
+     * Write the heap and allocator state to [sink] as a [HeapImage].
+     *
+     * The data section is handed to [sink] as slices of the live backing
+     * array, with no intermediate copy.
+     *
+     * @throws IllegalStateException if [KArena.create] sub-arenas are live;
+     *   their metadata lives outside the heap and cannot be captured
+     */
+    fun snapshot(sink: HeapSink) {
+        check(KArena.liveArenaCount() == 0) { "Cannot snapshot the heap while sub-arenas are live" }
+        val meta = KArena.main.exportState()
+        val data = buffer.data
+        sink.write(
+            longArrayOf(HeapImage.MAGIC, HeapImage.VERSION, buffer.capacity.toLong(), hp.toLong(), meta.size.toLong()),
+            0, HeapImage.HEADER_WORDS,
+        )
+        sink.write(meta, 0, meta.size)
+        var w = 0
+        while (w < data.size) {
+            val n = minOf(HeapImage.PAGE_WORDS, data.size - w)
+            sink.write(data, w, n)
+            w += n
+        }
+    }
+
+    /**
+     * Replace the heap and allocator state with an image read from [source].
+     *
+     * The image is read straight into a fresh backing array; the current
+     * heap is only replaced once the whole image has been read and checked,
+     * so a failed restore leaves it untouched. Pointers, [KMalloc] free
+     * lists and [used] are as they were at [snapshot] time; every
+     * sub-arena is dropped.
+     *
+     * @throws IllegalArgumentException if the image is malformed or from another format version
+     */
+    fun restore(source: HeapSource) {
+        val header = LongArray(HeapImage.HEADER_WORDS)
+        source.read(header, 0, header.size)
+        require(header[0] == HeapImage.MAGIC) { "Not a heap image" }
+        require(header[1] == HeapImage.VERSION) { "Unsupported heap image version ${header[1]}" }
+        val capacity = header[2]
+        val used = header[3]
+        require(capacity in 0..MAX_HEAP_BYTES.toLong() && (capacity and 7L) == 0L) { "Bad heap image capacity $capacity" }
+        require(used in 0..capacity) { "Bad heap image pointer $used" }
+        require(header[4] == KArena.STATE_WORDS.toLong()) { "Bad heap image metadata size ${header[4]}" }
+        val meta = LongArray(KArena.STATE_WORDS)
+        source.read(meta, 0, meta.size)
+        KArena.checkState(meta, capacity.toInt())
+        val next = PackedBuffer(capacity.toInt())
+        val data = next.data
+        var w = 0
+        while (w < data.size) {
+            val n = minOf(HeapImage.PAGE_WORDS, data.size - w)
+            source.read(data, w, n)
+            w += n
+        }
+        // Everything is checked: commit the allocator state and the heap together
+        KArena.resetAll()
+        KArena.main.importState(meta)
+        buffer = next
+        hp = used.toInt()
+    }
+
+    /**
+     * [snapshot] into the file at [path], written as raw little-endian words.
+     * The file is sized for the whole image up front; on POSIX targets it is
+     * mapped and heap pages are copied straight into the mapping.
+     *
+     * @throws UnsupportedOperationException if this target has no file backend
+     *   ([HeapImage.fileBackingSupported] is false)
+     */
+    fun saveImage(path: String) {
+        val words = HeapImage.HEADER_WORDS.toLong() + KArena.STATE_WORDS + buffer.data.size
+        val file = openHeapImageFile(path, write = true, imageWords = words)
+            ?: throw UnsupportedOperationException("Heap image files are not supported on this target")
+        file.use { snapshot(it) }
+    }
+
+    /**
+     * [restore] from a file written by [saveImage]. Heap words are copied
+     * from the file (a read-only mapping on POSIX targets) directly into the
+     * new backing array.
+     *
+     * @throws UnsupportedOperationException if this target has no file backend
+     */
+    fun loadImage(path: String) {
+        val file = openHeapImageFile(path, write = false, imageWords = 0L)
+            ?: throw UnsupportedOperationException("Heap image files are not supported on this target")
+        file.use { restore(it) }
+    }
+
     // ========== Typed Load/Store Operations (Little-Endian) ==========
 
     /** Load byte (signed). */
@@ -150,12 +276,84 @@ object GlobalHeap {
     /** Store double (64-bit). */
     fun sdf(addr: Int, value: Double) = buffer.setDouble(addr, value)
 
-    /** memcpy: undefined for overlap. */
-    fun memcpy(dst: Int, src: Int, bytes: Int) = buffer.copy(dst, src, bytes)
+    // ========== Bulk Typed Transfer (Little-Endian) ==========
+    //
+    // One call moves a whole Kotlin array slice to or from the heap. The array
+    // range is validated once; the element loop then runs directly over
+    // PackedBuffer words (two 32-bit lanes or four 16-bit lanes per Long).
+
+    /** Load `n` floats from [addr] into `dst[off until off+n]`. */
+    fun readFloats(addr: Int, dst: FloatArray, off: Int = 0, n: Int = dst.size - off) {
+        checkSlice(dst.size, off, n)
+        buffer.readFloats(addr, dst, off, n)
+    }
+
+    /** Store `src[off until off+n]` as consecutive floats at [addr]. */
+    fun writeFloats(addr: Int, src: FloatArray, off: Int = 0, n: Int = src.size - off) {
+        checkSlice(src.size, off, n)
+        buffer.writeFloats(addr, src, off, n)
+    }
+
+    /** Load `n` 32-bit ints from [addr] into `dst[off until off+n]`. */
+    fun readInts(addr: Int, dst: IntArray, off: Int = 0, n: Int = dst.size - off) {
+        checkSlice(dst.size, off, n)
+        buffer.readInts(addr, dst, off, n)
+    }
+
+    /** Store `src[off until off+n]` as consecutive 32-bit ints at [addr]. */
+    fun writeInts(addr: Int, src: IntArray, off: Int = 0, n: Int = src.size - off) {
+        checkSlice(src.size, off, n)
+        buffer.writeInts(addr, src, off, n)
+    }
+
+    /** Load `n` 64-bit longs from [addr] into `dst[off until off+n]`. */
+    fun readLongs(addr: Int, dst: LongArray, off: Int = 0, n: Int = dst.size - off) {
+        checkSlice(dst.size, off, n)
+        buffer.readLongs(addr, dst, off, n)
+    }
+
+    /** Store `src[off until off+n]` as consecutive 64-bit longs at [addr]. */
+    fun writeLongs(addr: Int, src: LongArray, off: Int = 0, n: Int = src.size - off) {
+        checkSlice(src.size, off, n)
+        buffer.writeLongs(addr, src, off, n)
+    }
+
+    /** Load `n` doubles from [addr] into `dst[off until off+n]`. */
+    fun readDoubles(addr: Int, dst: DoubleArray, off: Int = 0, n: Int = dst.size - off) {
+        checkSlice(dst.size, off, n)
+        buffer.readDoubles(addr, dst, off, n)
+    }
+
+    /** Store `src[off until off+n]` as consecutive doubles at [addr]. */
+    fun writeDoubles(addr: Int, src: DoubleArray, off: Int = 0, n: Int = src.size - off) {
+        checkSlice(src.size, off, n)
+        buffer.writeDoubles(addr, src, off, n)
+    }
+
+    /** Load `n` 16-bit shorts from [addr] into `dst[off until off+n]`. */
+    fun readShorts(addr: Int, dst: ShortArray, off: Int = 0, n: Int = dst.size - off) {
+        checkSlice(dst.size, off, n)
+        buffer.readShorts(addr, dst, off, n)
+    }
+
+    /** Store `src[off until off+n]` as consecutive 16-bit shorts at [addr]. */
+    fun writeShorts(addr: Int, src: ShortArray, off: Int = 0, n: Int = src.size - off) {
+        checkSlice(src.size, off, n)
+        buffer.writeShorts(addr, src, off, n)
+    }
+
+    private fun checkSlice(arraySize: Int, off: Int, n: Int) {
+        require(off >= 0 && n >= 0 && off <= arraySize - n) {
+            "Array slice out of bounds: off=$off, n=$n, size=$arraySize"
+        }
+    }
+
+    /** memcpy: undefined for overlap (the word path happens to be overlap-safe). */
+    fun memcpy(dst: Int, src: Int, bytes: Int) = buffer.copyWords(dst, src, bytes)
 
     /** memmove: overlap-safe. */
-    fun memmove(dst: Int, src: Int, bytes: Int) = buffer.move(dst, src, bytes)
+    fun memmove(dst: Int, src: Int, bytes: Int) = buffer.copyWords(dst, src, bytes)
 
     /** memset: fill memory with byte value. */
-    fun memset(addr: Int, value: Int, bytes: Int) = buffer.fill(addr, value, bytes)
+    fun memset(addr: Int, value: Int, bytes: Int) = buffer.fillWords(addr, value, bytes)
 }
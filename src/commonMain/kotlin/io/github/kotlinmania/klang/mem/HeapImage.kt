@@ -0,0 +1,68 @@
+package io.github.kotlinmania.klang.mem
+
+/**
+ * Receives heap image words from [GlobalHeap.snapshot].
+ *
+ * Each call hands over `words[offset, offset + count)`. During the data
+ * section [words] is the live heap array itself, so an implementation must
+ * consume (copy, write out) the range before returning and must not modify it.
+ */
+fun interface HeapSink {
+    fun write(words: LongArray, offset: Int, count: Int)
+}
+
+/**
+ * Supplies heap image words to [GlobalHeap.restore].
+ *
+ * Each call must fill exactly `words[offset, offset + count)` or throw;
+ * a short image is an error, not end-of-stream.
+ */
+fun interface HeapSource {
+    fun read(words: LongArray, offset: Int, count: Int)
+}
+
+/**
+ * Heap image format shared by [GlobalHeap.snapshot] and [GlobalHeap.restore].
+ *
+ * An image is a flat sequence of 64-bit little-endian words:
+ *
+ * ```
+ * [0] MAGIC ("KLHEAP01")   [1] VERSION   [2] capacity bytes   [3] hp
+ * [4] metadata word count  [5..] main-arena metadata (bins, brk, free-list heads)
+ * [..] capacity / 8 heap words, exactly as laid out in PackedBuffer.data
+ * ```
+ *
+ * Heap words are streamed in [PAGE_WORDS] slices of the live array, so
+ * nothing is re-encoded or staged on the way out or in.
+ */
+object HeapImage {
+    /** "KLHEAP01" as a little-endian word. */
+    const val MAGIC = 0x3130_5041_4548_4C4BL
+    const val VERSION = 1L
+
+    /** Words per [HeapSink.write] / [HeapSource.read] call in the data section (64 KB). */
+    const val PAGE_WORDS = 8192
+
+    internal const val HEADER_WORDS = 5
+
+    /** True when [GlobalHeap.saveImage] / [GlobalHeap.loadImage] have a file backend on this target. */
+    val fileBackingSupported: Boolean get() = heapImageFilesSupported
+}
+
+/** A heap image file opened by [openHeapImageFile]. */
+internal interface HeapImageFile : HeapSink, HeapSource, AutoCloseable
+
+internal expect val heapImageFilesSupported: Boolean
+
+/**
+ * Open [path] for writing an image of exactly [imageWords] words ([write] =
+ * true, truncating) or for reading a raw image ([imageWords] ignored); null
+ * when this target has no file backend.
+ */
+internal expect fun openHeapImageFile(path: String, write: Boolean, imageWords: Long): HeapImageFile?
+
+/** A path for a scratch image file named [name] in the platform temp directory. */
+internal expect fun heapImageTempPath(name: String): String
+
+/** Delete the image file at [path] if it exists (no-op without a file backend). */
+internal expect fun deleteHeapImageFile(path: String)
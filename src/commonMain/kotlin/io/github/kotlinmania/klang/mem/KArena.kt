@@ -0,0 +1,843 @@
+@file:OptIn(ExperimentalAtomicApi::class)
+
+package io.github.kotlinmania.klang.mem
+
+import kotlin.concurrent.Volatile
+import kotlin.concurrent.atomics.AtomicInt
+import kotlin.concurrent.atomics.AtomicReference
+import kotlin.concurrent.atomics.ExperimentalAtomicApi
+
+/**
+ * KArena: an independent KMalloc heap over a fixed slice of [GlobalHeap].
+ *
+ * Every arena carries its own segregated `bins`, large-block lists and bump
+ * pointer, so two threads allocating from two arenas never touch the same
+ * allocator metadata. [KMalloc] routes `malloc`/`free` to the calling
+ * thread's current arena; threads that never bind one use the growable
+ * main arena, which is exactly the pre-arena KMalloc.
+ *
+ * ## Address Space
+ *
+ * Pointers stay plain [Int] offsets into the single [GlobalHeap], so every
+ * existing `GlobalHeap.lw/sw`, [CLib] and view call keeps working on arena
+ * memory. An arena's region is carved out of the main arena once, at
+ * [create] time:
+ *
+ * ```
+ * GlobalHeap:
+ * ┌──────────────┬─────────────────────┬───────────┬─────────────────────┬──────┐
+ * │ main chunks  │  arena A [lo, hi)   │ main ...  │  arena B [lo, hi)   │ ...  │
+ * └──────────────┴─────────────────────┴───────────┴─────────────────────┴──────┘
+ * ```
+ *
+ * Region bounds are 16-byte aligned, so no backing `Long` of the
+ * [PackedBuffer] is shared between two arenas — concurrent byte stores in
+ * different arenas can never tear each other's words. Arena regions do not
+ * grow: running out throws [IllegalStateException], like a [KStack]
+ * overflow. Only the main arena grows the heap, and growth swaps the
+ * backing buffer, so size the heap with [KMalloc.init] and create arenas
+ * before starting workers.
+ *
+ * ## Cross-Thread Frees
+ *
+ * A pointer freed by a thread other than the owner's is queued on the
+ * owning arena and reclaimed by the owner on its next `malloc`. The queues
+ * are guarded by a fixed table of striped spin locks indexed by arena id,
+ * so unrelated arenas rarely contend. Arenas created with `shared = true`
+ * take their stripe lock on every operation instead and can be used from
+ * any thread directly.
+ *
+ * ## Usage Example
+ *
+ * ```kotlin
+ * KMalloc.init(64 shl 20)
+ * val scratch = KArena.create(4 shl 20)      // before spawning the worker
+ * // on the worker:
+ * KMalloc.withArena(scratch) {
+ *     val buf = KMalloc.malloc(4096)        // from scratch's bins
+ *     // ...
+ *     KMalloc.free(buf)
+ * }
+ * scratch.dispose()
+ * ```
+ *
+ * @see KMalloc For the thread-routed malloc/free entry points
+ * @since 0.8.1
+ */
+class KArena private constructor(
+    /** Region start (inclusive, 16-byte aligned). */
+    internal val lo: Int,
+    /** Region end (exclusive). [Int.MAX_VALUE] for the growable main arena. */
+    internal val limit: Int,
+    /** When true, every operation takes this arena's stripe lock. */
+    val shared: Boolean,
+    /** Raw main-arena pointer backing this region, or 0 for the main arena. */
+    private val rawBase: Int,
+) {
+    /** Registry id; selects the stripe lock. */
+    private val id: Int = nextId.fetchAndAdd(1)
+
+    /** Segregated free list bins for small allocations. Bin i holds chunks of [(i + 1) * 16, (i + 2) * 16) bytes. */
+    private val bins = IntArray(BIN_COUNT) { NONE }
+
+    /** Bit i set iff `bins[i]` is non-empty. */
+    private var binMask: Long = 0L
+
+    /**
+     * Size-ordered large free lists (>1024 bytes), TLSF layout: first level by
+     * `floor(log2(size))`, second level splits each power-of-two range into
+     * [SL_COUNT] equal slices. List `fl * SL_COUNT + sl`.
+     */
+    private val largeHeads = IntArray(FL_COUNT * SL_COUNT) { NONE }
+
+    /** Bit fl set iff any second-level list under first level fl is non-empty. */
+    private var flMask: Int = 0
+
+    /** Per first level: bit sl set iff list (fl, sl) is non-empty. */
+    private val slMask = IntArray(FL_COUNT)
+
+    /** Bump allocator pointer: next free address in this arena. */
+    private var brk: Int = lo
+
+    /** Pointers freed by other threads, awaiting reclamation by the owner. */
+    private var deferred = IntArray(0)
+    private var deferredCount = 0
+    private val pendingFrees = AtomicInt(0)
+
+    @Volatile
+    internal var disposed: Boolean = false
+        private set
+
+    /** Event counters, indexed by the `STAT_*` constants; maintained only while [statsOn]. */
+    private val counters = LongArray(STAT_COUNT)
+
+    /** Chunks handed out per size class: small bins, then one slot for all large sizes. */
+    private val classMallocs = LongArray(BIN_COUNT + 1)
+
+    /** Payload bytes of in-use chunks, and its peak, both counted while [statsOn]. */
+    private var liveBytes = 0L
+    private var peakLiveBytes = 0L
+
+    private val growable: Boolean get() = limit == Int.MAX_VALUE
+
+    /** Bytes reserved for this arena's chunks (region size; heap size for the main arena). */
+    val capacityBytes: Int get() = if (growable) GlobalHeap.size else limit - lo
+
+    /** Bytes consumed by the bump pointer (live and free chunks, including overhead). */
+    val usedBytes: Int get() = brk - lo
+
+    /** True if [ptr] lies inside this arena's region. */
+    fun owns(ptr: Int): Boolean = ptr >= lo && ptr < limit
+
+    // ========== Public Allocation API ==========
+
+    /** Allocate uninitialized memory from this arena (C malloc semantics). */
+    fun malloc(bytes: Int): Int {
+        if (shared) return withStripe { mallocUnlocked(bytes) }
+        drainDeferred()
+        return mallocUnlocked(bytes)
+    }
+
+    /** Allocate zero-initialized memory from this arena (C calloc semantics). */
+    fun calloc(count: Int, elemSize: Int): Int {
+        val bytes = count * elemSize
+        val p = malloc(bytes)
+        GlobalHeap.memset(p, 0, bytes)
+        return p
+    }
+
+    /**
+     * Free memory owned by this arena. Must be called by the owning thread
+     * for non-shared arenas; other threads go through [KMalloc.free], which
+     * queues the pointer instead.
+     */
+    fun free(ptr: Int) {
+        if (ptr <= 0) return
+        if (shared) withStripe { freeUnlocked(ptr) } else freeUnlocked(ptr)
+    }
+
+    /** Resize an allocation owned by this arena (C realloc semantics). */
+    fun realloc(ptr: Int, newSize: Int): Int =
+        if (shared) withStripe { reallocUnlocked(ptr, newSize) } else reallocUnlocked(ptr, newSize)
+
+    /**
+     * Release this arena's region back to the main arena. All pointers into
+     * the arena become invalid and threads still bound to it fall back to the
+     * main arena.
+     */
+    fun dispose() {
+        check(!growable) { "The main arena is disposed through KMalloc.dispose()" }
+        if (disposed) return
+        unregister(this)
+        disposed = true
+        KMalloc.free(rawBase)
+    }
+
+    // ========== Cross-Thread Free Queue ==========
+
+    /** Queue [ptr] for reclamation by the owning thread. */
+    internal fun deferFree(ptr: Int) {
+        withStripe {
+            if (deferredCount == deferred.size) {
+                deferred = deferred.copyOf((deferred.size * 2).coerceAtLeast(16))
+            }
+            deferred[deferredCount++] = ptr
+            pendingFrees.store(deferredCount)
+        }
+    }
+
+    private fun drainDeferred() {
+        if (pendingFrees.load() == 0) return
+        val batch = withStripe {
+            val taken = deferred.copyOf(deferredCount)
+            deferredCount = 0
+            pendingFrees.store(0)
+            taken
+        }
+        for (p in batch) freeUnlocked(p)
+    }
+
+    private inline fun <T> withStripe(block: () -> T): T {
+        val lock = STRIPE_LOCKS[id and (STRIPE_COUNT - 1)]
+        while (!lock.compareAndSet(0, 1)) { /* spin */ }
+        try {
+            return block()
+        } finally {
+            lock.store(0)
+        }
+    }
+
+    // ========== Allocator Core ==========
+
+    private fun mallocUnlocked(bytes: Int): Int {
+        val size = normalize(bytes)
+        val stats = statsOn
+        if (stats) countMalloc(size)
+        // Try to find a suitable free chunk
+        val fromBin = findAndPrepareChunk(size)
+        if (fromBin != NONE) {
+            if (stats) countLive(STAT_REUSE, readSize(fromBin).toLong())
+            return fromBin + HEADER_SIZE
+        }
+        // No free chunk found, allocate from top
+        val total = OVERHEAD + size
+        val chunk = brk
+        if (growable) {
+            if (chunk + total > GlobalHeap.size) GlobalHeap.ensureCapacity(chunk + total)
+        } else {
+            check(chunk + total <= limit) { "Arena exhausted: need=$bytes, used=${brk - lo}, capacity=${limit - lo}" }
+        }
+        writeHeaderFooter(chunk, size, inUse = true)
+        brk += total
+        if (stats) countLive(STAT_BUMP, size.toLong())
+        return chunk + HEADER_SIZE
+    }
+
+    private fun freeUnlocked(ptr: Int) {
+        if (ptr <= 0) return
+        var chunk = ptr - HEADER_SIZE
+        var size = readSize(chunk)
+        val stats = statsOn
+        if (stats) countLive(STAT_FREE, -size.toLong())
+        // Mark as free
+        writeHeaderFooter(chunk, size, inUse = false)
+        // Coalesce with next chunk if it's free
+        val next = nextChunk(chunk)
+        if (next in lo until brk && !isInUse(next)) {
+            removeFromFreeList(next)
+            if (stats) counters[STAT_COALESCE]++
+            val nextSize = readSize(next)
+            size = size + OVERHEAD + nextSize
+            writeHeaderFooter(chunk, size, inUse = false)
+        }
+        // Coalesce with previous chunk if it's free
+        val prev = prevChunk(chunk)
+        if (prev >= lo && !isInUse(prev)) {
+            removeFromFreeList(prev)
+            if (stats) counters[STAT_COALESCE]++
+            val prevSize = readSize(prev)
+            chunk = prev
+            size = prevSize + OVERHEAD + size
+            writeHeaderFooter(chunk, size, inUse = false)
+        }
+        pushFree(chunk)
+    }
+
+    private fun reallocUnlocked(ptr: Int, newSize: Int): Int {
+        if (ptr == 0) return mallocUnlocked(newSize)
+        val chunk = ptr - HEADER_SIZE
+        val oldSize = readSize(chunk)
+        val size = normalize(newSize)
+        if (statsOn) counters[STAT_REALLOC]++
+        if (size <= oldSize) {
+            // Shrinking: split off remainder if significant
+            maybeSplit(chunk, oldSize, size)
+            if (statsOn) liveBytes -= oldSize - readSize(chunk)
+            return ptr
+        }
+        // Growing: allocate new, copy, free old
+        if (statsOn) counters[STAT_REALLOC_MOVE]++
+        val np = mallocUnlocked(size)
+        GlobalHeap.memcpy(np, ptr, oldSize)
+        freeUnlocked(ptr)
+        return np
+    }
+
+    /** Discard every chunk and free list; the region itself is kept. */
+    internal fun resetState() {
+        bins.fill(NONE)
+        binMask = 0L
+        largeHeads.fill(NONE)
+        flMask = 0
+        slMask.fill(0)
+        brk = lo
+        deferred = IntArray(0)
+        deferredCount = 0
+        pendingFrees.store(0)
+        clearStats()
+    }
+
+    /**
+     * Allocator metadata as image words: brk, binMask, flMask, then bins,
+     * large list heads and second-level masks. Pending cross-thread frees
+     * are reclaimed first so the free lists are complete.
+     */
+    internal fun exportState(): LongArray {
+        drainDeferred()
+        val out = LongArray(STATE_WORDS)
+        out[0] = brk.toLong()
+        out[1] = binMask
+        out[2] = flMask.toLong()
+        var i = 3
+        for (b in bins) out[i++] = b.toLong()
+        for (h in largeHeads) out[i++] = h.toLong()
+        for (m in slMask) out[i++] = m.toLong()
+        return out
+    }
+
+    /** Replace this arena's metadata with [state] from [exportState]. */
+    internal fun importState(state: LongArray) {
+        require(state.size == STATE_WORDS) { "Arena state has ${state.size} words, expected $STATE_WORDS" }
+        resetState()
+        brk = state[0].toInt()
+        binMask = state[1]
+        flMask = state[2].toInt()
+        var i = 3
+        for (k in bins.indices) bins[k] = state[i++].toInt()
+        for (k in largeHeads.indices) largeHeads[k] = state[i++].toInt()
+        for (k in slMask.indices) slMask[k] = state[i++].toInt()
+        if (statsOn) clearStats()
+    }
+
+    // ========== Statistics ==========
+
+    private fun countMalloc(size: Int) {
+        counters[STAT_MALLOC]++
+        val b = binIndexOrMinus1(size)
+        classMallocs[if (b >= 0) b else BIN_COUNT]++
+    }
+
+    private fun countLive(event: Int, delta: Long) {
+        counters[event]++
+        liveBytes += delta
+        if (liveBytes > peakLiveBytes) peakLiveBytes = liveBytes
+    }
+
+    /** Zero the counters and seed [liveBytes] from a heap walk, so counting can start mid-run. */
+    internal fun clearStats() {
+        counters.fill(0L)
+        classMallocs.fill(0L)
+        var live = 0L
+        walkChunks { _, size, inUse -> if (inUse) live += size }
+        liveBytes = live
+        peakLiveBytes = live
+    }
+
+    /**
+     * Visit every chunk between [lo] and the bump pointer in address order
+     * with its payload size and in-use bit, following [nextChunk].
+     */
+    internal fun walkChunks(visit: (chunk: Int, size: Int, inUse: Boolean) -> Unit) {
+        var chunk = lo
+        while (chunk < brk) {
+            val size = readSize(chunk)
+            visit(chunk, size, isInUse(chunk))
+            chunk = nextChunk(chunk)
+        }
+    }
+
+    /** Counter and free-list snapshot; see [KMalloc.stats]. */
+    internal fun stats(): KMallocStats {
+        if (!shared) drainDeferred()
+        val occupancy = IntArray(BIN_COUNT)
+        for (b in 0 until BIN_COUNT) {
+            var c = bins[b]
+            while (c != NONE) { occupancy[b]++; c = readNext(c) }
+        }
+        var largeFree = 0
+        for (h in largeHeads) {
+            var c = h
+            while (c != NONE) { largeFree++; c = readNext(c) }
+        }
+        var liveChunks = 0
+        var freeChunks = 0
+        var walkedLive = 0L
+        var walkedFree = 0L
+        walkChunks { _, size, inUse ->
+            if (inUse) { liveChunks++; walkedLive += size } else { freeChunks++; walkedFree += size }
+        }
+        return KMallocStats(
+            enabled = statsOn,
+            mallocCount = counters[STAT_MALLOC],
+            freeCount = counters[STAT_FREE],
+            reallocCount = counters[STAT_REALLOC],
+            reallocMoves = counters[STAT_REALLOC_MOVE],
+            reuseCount = counters[STAT_REUSE],
+            bumpCount = counters[STAT_BUMP],
+            splitCount = counters[STAT_SPLIT],
+            coalesceCount = counters[STAT_COALESCE],
+            sizeClassMallocs = classMallocs.copyOf(),
+            peakLiveBytes = if (statsOn) peakLiveBytes else walkedLive,
+            binOccupancy = occupancy,
+            largeFreeChunks = largeFree,
+            liveChunks = liveChunks,
+            liveBytes = walkedLive,
+            freeChunks = freeChunks,
+            freeBytes = walkedFree,
+            overheadBytes = (liveChunks + freeChunks).toLong() * OVERHEAD,
+            brk = brk,
+            arenaUsedBytes = usedBytes,
+            arenaCapacityBytes = capacityBytes,
+            heapUsed = GlobalHeap.used,
+            heapSize = GlobalHeap.size,
+            stackUsedBytes = KStack.usedBytes(),
+            stackCapacityBytes = KStack.capacityBytes(),
+        )
+    }
+
+    /** Heap walk summary; see [KMalloc.dumpFragmentation]. */
+    internal fun fragmentation(): FragmentationReport {
+        if (!shared) drainDeferred()
+        val histogram = IntArray(32)
+        var chunks = 0
+        var freeChunks = 0
+        var freeBytes = 0L
+        var largestFree = 0
+        var freeRuns = 0
+        var lastFree = false
+        walkChunks { _, size, inUse ->
+            chunks++
+            if (!inUse) {
+                freeChunks++
+                freeBytes += size
+                if (size > largestFree) largestFree = size
+                histogram[floorLog2(size)]++
+                if (!lastFree) freeRuns++
+            }
+            lastFree = !inUse
+        }
+        return FragmentationReport(
+            regionStart = lo,
+            brk = brk,
+            chunks = chunks,
+            freeChunks = freeChunks,
+            freeBytes = freeBytes,
+            largestFreeBytes = largestFree,
+            freeRuns = freeRuns,
+            freeSizeLog2Histogram = histogram,
+        )
+    }
+
+    /** Payload size of the chunk backing [ptr]. */
+    internal fun payloadSize(ptr: Int): Int = readSize(ptr - HEADER_SIZE)
+
+    /**
+     * Get bin index for a given size, or -1 for large blocks.
+     *
+     * Small blocks (≤1024) use segregated bins, large blocks the two-level lists.
+     */
+    private fun binIndexOrMinus1(size: Int): Int = if (size <= SMALL_LIMIT) ((size ushr BIN_SHIFT) - 1) else -1
+
+    /**
+     * Write header and footer tags for a chunk.
+     *
+     * Both header and footer store the same tag: (size << 1) | inUse.
+     * The footer enables backward traversal for coalescing.
+     */
+    private fun writeHeaderFooter(chunk: Int, size: Int, inUse: Boolean) {
+        val tag = pack(size, inUse)
+        GlobalHeap.sw(chunk, tag)
+        GlobalHeap.sw(chunk + HEADER_SIZE + size, tag)
+    }
+    private fun pack(size: Int, inUse: Boolean): Int = (size shl 1) or (if (inUse) 1 else 0)
+    private fun readTag(chunk: Int): Int = GlobalHeap.lw(chunk)
+    private fun readSize(chunk: Int): Int = readTag(chunk) ushr 1
+    private fun isInUse(chunk: Int): Boolean = (readTag(chunk) and 1) != 0
+    private fun nextChunk(chunk: Int): Int = chunk + HEADER_SIZE + readSize(chunk) + FOOTER_SIZE
+    private fun prevChunk(chunk: Int): Int {
+        // The first chunk of a region has no predecessor; the word below it
+        // belongs to whoever owns the surrounding memory.
+        if (chunk - FOOTER_SIZE < lo) return -1
+        val prevTag = GlobalHeap.lw(chunk - FOOTER_SIZE)
+        val prevSize = prevTag ushr 1
+        val prevBase = chunk - (HEADER_SIZE + prevSize + FOOTER_SIZE)
+        return if (prevBase >= lo) prevBase else -1
+    }
+
+    // ---------- Free lists ----------
+    //
+    // Free chunks are doubly linked through their payload: next at +0, prev
+    // at +4 (MIN_CHUNK leaves room for both). Unlinking is O(1) from the
+    // chunk's size alone, and the bitmaps make "first non-empty list at or
+    // above class k" a single countTrailingZeroBits.
+
+    private fun readNext(chunk: Int): Int = GlobalHeap.lw(chunk + HEADER_SIZE)
+    private fun readPrev(chunk: Int): Int = GlobalHeap.lw(chunk + HEADER_SIZE + 4)
+    private fun writeNext(chunk: Int, next: Int) = GlobalHeap.sw(chunk + HEADER_SIZE, next)
+    private fun writePrev(chunk: Int, prev: Int) = GlobalHeap.sw(chunk + HEADER_SIZE + 4, prev)
+
+    private fun pushFree(chunk: Int) {
+        val size = readSize(chunk)
+        val binIdx = binIndexOrMinus1(size)
+        if (binIdx >= 0) {
+            val head = bins[binIdx]
+            writeNext(chunk, head)
+            writePrev(chunk, NONE)
+            if (head != NONE) writePrev(head, chunk)
+            bins[binIdx] = chunk
+            binMask = binMask or (1L shl binIdx)
+        } else {
+            val list = largeListFor(size)
+            val head = largeHeads[list]
+            writeNext(chunk, head)
+            writePrev(chunk, NONE)
+            if (head != NONE) writePrev(head, chunk)
+            largeHeads[list] = chunk
+            val fl = list ushr SL_SHIFT
+            flMask = flMask or (1 shl fl)
+            slMask[fl] = slMask[fl] or (1 shl (list and (SL_COUNT - 1)))
+        }
+    }
+
+    private fun removeFromFreeList(chunk: Int) {
+        val next = readNext(chunk)
+        val prev = readPrev(chunk)
+        if (next != NONE) writePrev(next, prev)
+        if (prev != NONE) {
+            writeNext(prev, next)
+            return
+        }
+        // chunk was a list head
+        val size = readSize(chunk)
+        val binIdx = binIndexOrMinus1(size)
+        if (binIdx >= 0) {
+            bins[binIdx] = next
+            if (next == NONE) binMask = binMask and (1L shl binIdx).inv()
+        } else {
+            val list = largeListFor(size)
+            largeHeads[list] = next
+            if (next == NONE) clearLargeBit(list)
+        }
+    }
+
+    private fun clearLargeBit(list: Int) {
+        val fl = list ushr SL_SHIFT
+        slMask[fl] = slMask[fl] and (1 shl (list and (SL_COUNT - 1))).inv()
+        if (slMask[fl] == 0) flMask = flMask and (1 shl fl).inv()
+    }
+
+    private fun maybeSplit(chunk: Int, curSize: Int, wantSize: Int) {
+        val remain = curSize - wantSize
+        if (remain >= MIN_CHUNK + OVERHEAD) {
+            // allocated front keeps wantSize; create a free tail
+            writeHeaderFooter(chunk, wantSize, inUse = true)
+            val tail = chunk + HEADER_SIZE + wantSize + FOOTER_SIZE
+            writeHeaderFooter(tail, remain - OVERHEAD, inUse = false)
+            pushFree(tail)
+            if (statsOn) counters[STAT_SPLIT]++
+        }
+    }
+
+    private fun findAndPrepareChunk(size: Int): Int {
+        val cur = findFreeChunk(size)
+        if (cur == NONE) return NONE
+        removeFromFreeList(cur)
+        val curSize = readSize(cur)
+        // split if needed
+        val remain = curSize - size
+        if (remain >= MIN_CHUNK + OVERHEAD) {
+            val tail = cur + HEADER_SIZE + size + FOOTER_SIZE
+            writeHeaderFooter(tail, remain - OVERHEAD, inUse = false)
+            pushFree(tail)
+            writeHeaderFooter(cur, size, inUse = true)
+            if (statsOn) counters[STAT_SPLIT]++
+        } else {
+            writeHeaderFooter(cur, curSize, inUse = true)
+        }
+        return cur
+    }
+
+    /**
+     * Locate a free chunk of at least [size] bytes without unlinking it.
+     *
+     * Small sizes: every chunk in bin ≥ the target bin fits, so the first set
+     * bit of the masked [binMask] answers directly. Large sizes: the request is
+     * rounded up to the next second-level boundary so every chunk in the
+     * selected list fits (TLSF mapping-search). Only when nothing at or above
+     * that boundary exists is the request's own list scanned first-fit, so big
+     * blocks that fall just short of the rounding are not left unused.
+     */
+    private fun findFreeChunk(size: Int): Int {
+        val binIdx = binIndexOrMinus1(size)
+        if (binIdx >= 0) {
+            val m = binMask and (-1L shl binIdx)
+            if (m != 0L) return bins[m.countTrailingZeroBits()]
+            // Any large chunk fits a small request
+            return if (flMask == 0) NONE else firstLargeFrom(0, 0)
+        }
+        val fl0 = floorLog2(size)
+        val step = 1 shl (fl0 - SL_SHIFT)
+        val rounded = size + step - 1
+        if (rounded > 0 && floorLog2(rounded) <= MAX_FL) {
+            val list = largeListFor(rounded)
+            val hit = firstLargeFrom(list ushr SL_SHIFT, list and (SL_COUNT - 1))
+            if (hit != NONE) return hit
+        }
+        // Fallback: first-fit within the request's own list
+        var cur = largeHeads[largeListFor(size)]
+        while (cur != NONE) {
+            if (readSize(cur) >= size) return cur
+            cur = readNext(cur)
+        }
+        return NONE
+    }
+
+    /** Head of the first non-empty large list at or above (fl, sl), or NONE. */
+    private fun firstLargeFrom(fl: Int, sl: Int): Int {
+        val slBits = slMask[fl] and (-1 shl sl)
+        if (slBits != 0) return largeHeads[(fl shl SL_SHIFT) + slBits.countTrailingZeroBits()]
+        val flBits = if (fl + 1 >= FL_COUNT) 0 else flMask and (-1 shl (fl + 1))
+        if (flBits == 0) return NONE
+        val f = flBits.countTrailingZeroBits()
+        return largeHeads[(f shl SL_SHIFT) + slMask[f].countTrailingZeroBits()]
+    }
+
+    companion object {
+        /** Alignment boundary: all allocations are multiples of 16 bytes. */
+        internal const val ALIGN = 16
+
+        /** Header size: 4-byte tag stores (size << 1 | inUse). */
+        internal const val HEADER_SIZE = 4
+
+        /** Footer size: 4-byte tag copy enables backward coalescing. */
+        internal const val FOOTER_SIZE = 4
+
+        /** Total overhead per allocation: 8 bytes. */
+        internal const val OVERHEAD = HEADER_SIZE + FOOTER_SIZE
+
+        /** Minimum payload size: 16 bytes (room for next pointer in free chunks). */
+        internal const val MIN_CHUNK = 16
+
+        /** Small allocation threshold: blocks ≤1024 use segregated bins. */
+        internal const val SMALL_LIMIT = 1024
+
+        /** Bin size class shift: 16-byte increments (1 << 4). */
+        internal const val BIN_SHIFT = 4
+
+        /** Number of segregated bins: 64 (for 16, 32, 48, ..., 1024 bytes). */
+        internal const val BIN_COUNT = (SMALL_LIMIT shr BIN_SHIFT)
+
+        /** Second-level subdivisions per power of two for large lists (log2). */
+        private const val SL_SHIFT = 3
+
+        /** Second-level lists per first level. */
+        private const val SL_COUNT = 1 shl SL_SHIFT
+
+        /** floor(log2) of the smallest large chunk (1040 → 10). */
+        private const val MIN_FL = 10
+
+        /** floor(log2) of the largest representable chunk (tag holds size << 1). */
+        private const val MAX_FL = 30
+
+        /** Number of first-level large classes. */
+        private const val FL_COUNT = MAX_FL - MIN_FL + 1
+
+        /**
+         * Single gate for the allocator counters ([KMalloc.statsEnabled]).
+         * Off, each counting site costs one plain field read and a not-taken
+         * branch; malloc and free read it once per call.
+         *
+         * Deliberately not `@Volatile`, which would put an acquire load on
+         * every malloc and free. The owning thread sees a change at once;
+         * other threads pick it up at their next synchronizing operation
+         * (stripe lock, deferred-free handoff), which is soon enough for
+         * counters.
+         */
+        internal var statsOn: Boolean = false
+
+        private const val STAT_MALLOC = 0
+        private const val STAT_FREE = 1
+        private const val STAT_REALLOC = 2
+        private const val STAT_REALLOC_MOVE = 3
+        private const val STAT_REUSE = 4
+        private const val STAT_BUMP = 5
+        private const val STAT_SPLIT = 6
+        private const val STAT_COALESCE = 7
+        private const val STAT_COUNT = 8
+
+        /** Every live arena: the main arena first, then the registry in address order. */
+        internal fun allArenas(): List<KArena> = listOf(main) + registry.load()
+
+        /** Words in [exportState]: brk, binMask, flMask, bins, largeHeads, slMask. */
+        internal const val STATE_WORDS = 3 + BIN_COUNT + FL_COUNT * SL_COUNT + FL_COUNT
+
+        /** Number of live non-main arenas. */
+        internal fun liveArenaCount(): Int = registry.load().size
+
+        /** Free-list terminator / "no chunk" sentinel. Address 0 is a valid chunk. */
+        private const val NONE = -1
+
+        /** Number of stripe locks shared by all arenas (power of two). */
+        private const val STRIPE_COUNT = 16
+
+        private val STRIPE_LOCKS = Array(STRIPE_COUNT) { AtomicInt(0) }
+
+        private val nextId = AtomicInt(0)
+
+        /** Live non-main arenas, sorted by [lo]. Copy-on-write. */
+        private val registry = AtomicReference(emptyArray<KArena>())
+
+        /** Growable arena spanning the whole heap from address 0. */
+        internal val main: KArena = KArena(lo = 0, limit = Int.MAX_VALUE, shared = false, rawBase = 0)
+
+        /**
+         * Reserve a [bytes]-byte region from the main arena and return a new
+         * arena over it.
+         *
+         * Must be called from the thread that owns the main arena (normally
+         * during setup, before workers start), since the reservation may grow
+         * the heap.
+         *
+         * @param bytes Region size; rounded up to a multiple of 16.
+         * @param shared When true every operation is serialized by the arena's
+         *   stripe lock, so any thread may malloc and free on it directly.
+         */
+        fun create(bytes: Int, shared: Boolean = false): KArena {
+            require(bytes > 0) { "Arena size must be positive" }
+            val size = alignUp(bytes, ALIGN)
+            val raw = main.malloc(size + ALIGN)
+            val lo = alignUp(raw, ALIGN)
+            val arena = KArena(lo = lo, limit = lo + size, shared = shared, rawBase = raw)
+            register(arena)
+            return arena
+        }
+
+        /** Arena whose region contains [ptr]; the main arena if none does. */
+        internal fun ownerOf(ptr: Int): KArena {
+            val arenas = registry.load()
+            var lo = 0
+            var hi = arenas.size - 1
+            while (lo <= hi) {
+                val mid = (lo + hi) ushr 1
+                val a = arenas[mid]
+                when {
+                    ptr < a.lo -> hi = mid - 1
+                    ptr >= a.limit -> lo = mid + 1
+                    else -> return a
+                }
+            }
+            return main
+        }
+
+        /**
+         * Check main-arena [state] from [exportState] against a [heapBytes]-byte
+         * heap before [importState] trusts it: brk inside the heap, every list
+         * head [NONE] or a chunk below brk, and each mask bit set exactly when
+         * its list is non-empty.
+         *
+         * @throws IllegalArgumentException on the first inconsistency
+         */
+        internal fun checkState(state: LongArray, heapBytes: Int) {
+            require(state.size == STATE_WORDS) { "Arena state has ${state.size} words, expected $STATE_WORDS" }
+            val brk = state[0]
+            require(brk in 0..heapBytes.toLong()) { "Arena brk $brk outside the ${heapBytes}-byte heap" }
+            fun head(i: Int): Boolean {
+                val h = state[i]
+                require(h == NONE.toLong() || h in 0 until brk) { "Arena list head $h outside [0, $brk)" }
+                return h != NONE.toLong()
+            }
+            val binMask = state[1]
+            for (b in 0 until BIN_COUNT) {
+                require(head(3 + b) == ((binMask ushr b) and 1L != 0L)) { "Arena bin mask disagrees with bin $b" }
+            }
+            val flMask = state[2]
+            require(flMask ushr FL_COUNT == 0L) { "Arena first-level mask $flMask out of range" }
+            val slBase = 3 + BIN_COUNT + FL_COUNT * SL_COUNT
+            for (fl in 0 until FL_COUNT) {
+                val sl = state[slBase + fl]
+                require(sl ushr SL_COUNT == 0L) { "Arena second-level mask $sl out of range" }
+                require((sl != 0L) == ((flMask ushr fl) and 1L != 0L)) { "Arena first-level mask disagrees with level $fl" }
+                for (k in 0 until SL_COUNT) {
+                    val nonEmpty = head(3 + BIN_COUNT + (fl shl SL_SHIFT) + k)
+                    require(nonEmpty == ((sl ushr k) and 1L != 0L)) { "Arena second-level mask disagrees with list ($fl, $k)" }
+                }
+            }
+        }
+
+        /** Drop every non-main arena and reset the main arena's metadata. */
+        internal fun resetAll() {
+            val arenas = registry.exchange(emptyArray())
+            for (a in arenas) a.disposed = true
+            main.resetState()
+        }
+
+        private fun register(arena: KArena) {
+            while (true) {
+                val cur = registry.load()
+                var at = 0
+                while (at < cur.size && cur[at].lo < arena.lo) at++
+                val next = Array(cur.size + 1) { i ->
+                    when {
+                        i < at -> cur[i]
+                        i == at -> arena
+                        else -> cur[i - 1]
+                    }
+                }
+                if (registry.compareAndSet(cur, next)) return
+            }
+        }
+
+        private fun unregister(arena: KArena) {
+            while (true) {
+                val cur = registry.load()
+                if (cur.none { it === arena }) return
+                val next = cur.filter { it !== arena }.toTypedArray()
+                if (registry.compareAndSet(cur, next)) return
+            }
+        }
+
+        /** Normalize size to 16-byte alignment with minimum of MIN_CHUNK. */
+        private fun normalize(n: Int): Int {
+            val v = if (n <= 0) MIN_CHUNK else n
+            val a = ((v + (ALIGN - 1)) / ALIGN) * ALIGN
+            return a.coerceAtLeast(MIN_CHUNK)
+        }
+
+        private fun alignUp(x: Int, align: Int): Int = (x + (align - 1)) and (align - 1).inv()
+
+        private fun floorLog2(x: Int): Int = 31 - x.countLeadingZeroBits()
+
+        /** Large list index `(fl - MIN_FL) * SL_COUNT + sl` for a chunk of [size] > SMALL_LIMIT. */
+        private fun largeListFor(size: Int): Int {
+            val fl = floorLog2(size)
+            val sl = (size ushr (fl - SL_SHIFT)) and (SL_COUNT - 1)
+            return ((fl - MIN_FL) shl SL_SHIFT) + sl
+        }
+    }
+}
+
+/** Arena bound to the calling thread by [KMalloc.withArena]/[KMalloc.bindArena], or null. */
+internal expect fun boundArena(): KArena?
+
+/** Bind [arena] to the calling thread (null unbinds). */
+internal expect fun bindArenaToThread(arena: KArena?)
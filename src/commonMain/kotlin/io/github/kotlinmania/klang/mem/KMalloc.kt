@@ -40,13 +40,22 @@ package io.github.kotlinmania.klang.mem
  * bins[0]: 16-byte chunks   ──┐
  * bins[1]: 32-byte chunks     │ Segregated by size class
  * ...                          │ (16-byte increments)
- * bins[63]: 1024-byte chunks ──┘
- * largeFreeHead: >1024 bytes (single linked list)
+ * bins[63]: 1024-byte chunks ──┘    binMask: Long, bit i = bins[i] non-empty
+ *
+ * large lists: >1024 bytes, two-level (TLSF) index
+ *   fl = floor(log2(size))          flMask: Int, bit fl = any list under fl
+ *   sl = next 3 bits below the MSB  slMask[fl]: Int, bit sl = list non-empty
  * ```
  *
+ * Free chunks are doubly linked through their payload (next at +0, prev at
+ * +4), so unlinking during coalescing is O(1).
+ *
  * ### Allocation Strategy
- * 1. **Small blocks (≤1024)**: Search appropriate bin (first-fit)
- * 2. **Large blocks (>1024)**: Search large list
+ * 1. **Small blocks (≤1024)**: Lowest non-empty bin at or above the request's
+ *    class, found with one `countTrailingZeroBits` on `binMask`
+ * 2. **Large blocks (>1024)**: Round the request up to the next second-level
+ *    boundary and take the first non-empty list at or above it (good fit);
+ *    first-fit within the request's own list only when nothing larger exists
  * 3. **Split if needed**: Create remainder chunk if found block is too large
  * 4. **Bump allocate**: Allocate from top if no suitable free block found
  *
@@ -87,7 +96,8 @@ package io.github.kotlinmania.klang.mem
  *
  * ## Performance Characteristics
  *
- * - **malloc**: O(n) worst case (search free list), O(1) best case (bump allocate)
+ * - **malloc**: O(1) bitmap lookup for bins and large lists; the first-fit
+ *   fallback scans a single size-class list
  * - **free**: O(1) with coalescing (at most 2 merges)
  * - **calloc**: O(n) where n = allocation size (memset overhead)
  * - **realloc**: O(n) worst case (copy old data if growing)
@@ -96,13 +106,26 @@ package io.github.kotlinmania.klang.mem
  *
  * - **Per allocation**: 8 bytes (4-byte header + 4-byte footer)
  * - **Alignment padding**: Up to 15 bytes per allocation (16-byte alignment)
- * - **Free list overhead**: 4 bytes per free chunk (next pointer)
+ * - **Free list overhead**: 8 bytes per free chunk (next/prev pointers, stored in the payload)
  * - **Total metadata**: ~5-15% depending on allocation patterns
  *
- * ## Thread Safety
+ * ## Thread Safety and Arenas
+ *
+ * The allocator state lives in [KArena]s. Each call is routed to the calling
+ * thread's current arena ([withArena] / [bindArena]); threads that never bind
+ * one share the growable main arena, which is **not thread-safe** on its own.
  *
- * **Not thread-safe**. External synchronization required for concurrent access.
- * Sharing the same heap across threads requires locking around all KMalloc operations.
+ * For concurrent workers, create one arena per worker up front and bind it on
+ * that worker: allocation then touches only that arena's bins. [free] looks up
+ * the owning arena by address, so a pointer can be freed from any thread —
+ * frees of another thread's memory are queued and reclaimed by the owner.
+ *
+ * ```kotlin
+ * KMalloc.init(64 shl 20)
+ * val arenas = List(workers) { KArena.create(8 shl 20) }
+ * // worker i:
+ * KMalloc.withArena(arenas[i]) { /* malloc/free as usual */ }
+ * ```
  *
  * ## Design Trade-offs
  *
@@ -113,8 +136,8 @@ package io.github.kotlinmania.klang.mem
  * - Cross-platform determinism (identical on all targets)
  *
  * **Trade-offs**:
- * - No thread-local caching (would require TLS)
- * - Single large lock required for thread safety
+ * - Only per-thread arenas give lock-free allocation; the main arena needs
+ *   external locking if shared
  * - Coalescing adds slight overhead to free()
  * - Realloc always copies on growth (no in-place expansion yet)
  *
@@ -126,56 +149,41 @@ package io.github.kotlinmania.klang.mem
  * - ✅ Automatic bidirectional coalescing
  * - ✅ calloc and realloc
  * - ✅ Chunk splitting when oversized
+ * - ✅ Per-thread arenas ([KArena]) with queued cross-thread frees
+ * - ✅ Bitmap-indexed bins and two-level segregated fit for large blocks
  *
  * **Phase 2 (Future)**:
  * - ⚠️ In-place realloc when possible
- * - ⚠️ Best-fit instead of first-fit for large blocks
  * - ⚠️ Memory defragmentation
- * - ⚠️ Statistics and debugging hooks
+ *
+ * ## Statistics
+ *
+ * Set [statsEnabled] to count mallocs, frees, reallocs, splits, coalesces
+ * and per-size-class traffic; [stats] returns those counters together with
+ * free-list occupancy, live/free totals, header/footer overhead, `brk`,
+ * [GlobalHeap.used] and [KStack.usedBytes]. [dumpFragmentation] walks the
+ * chunks in address order. The counters are always compiled in; with the
+ * flag off each counting site is a single not-taken branch.
+ *
+ * ```kotlin
+ * KMalloc.statsEnabled = true
+ * runWorkload()
+ * val s = KMalloc.stats()
+ * check(s.liveChunks == baseline) { "leaked ${s.liveChunks - baseline} chunks" }
+ * println(KMalloc.dumpFragmentation())
+ * ```
  *
  * @see GlobalHeap For the underlying byte array heap
  * @see CScalars For type-safe variables using KMalloc
  * @since 0.1.0
  */
 object KMalloc {
-    /** Alignment boundary: all allocations are multiples of 16 bytes. */
-    private const val ALIGN = 16
-    
-    /** Header size: 4-byte tag stores (size << 1 | inUse). */
-    private const val HEADER_SIZE = 4
-    
-    /** Footer size: 4-byte tag copy enables backward coalescing. */
-    private const val FOOTER_SIZE = 4
-    
-    /** Total overhead per allocation: 8 bytes. */
-    private const val OVERHEAD = HEADER_SIZE + FOOTER_SIZE
-    
-    /** Minimum payload size: 16 bytes (room for next pointer in free chunks). */
-    private const val MIN_CHUNK = 16
-    
-    /** Small allocation threshold: blocks ≤1024 use segregated bins. */
-    private const val SMALL_LIMIT = 1024
-    
-    /** Bin size class shift: 16-byte increments (1 << 4). */
-    private const val BIN_SHIFT = 4
-    
-    /** Number of segregated bins: 64 (for 16, 32, 48, ..., 1024 bytes). */
-    private const val BIN_COUNT = (SMALL_LIMIT shr BIN_SHIFT)
-
-    /** Segregated free list bins for small allocations. Each bin holds chunks of similar size. */
-    private val bins = IntArray(BIN_COUNT) { -1 }
-    
-    /** Head of large free block list (>1024 bytes). */
-    private var largeFreeHead: Int = -1
-
-    /** Bump allocator pointer: next free address in heap. */
-    private var brk: Int = 0
-
     /**
      * Initialize KMalloc and the underlying heap.
      *
      * Allocates a new [GlobalHeap] of the specified size and resets all free lists.
-     * Any existing heap data is discarded.
+     * Any existing heap data is discarded, and every [KArena] created so far is
+     * invalidated.
      *
      * @param bytes Heap size in bytes. Should be large enough for expected allocations.
      * @throws IllegalArgumentException if bytes < 0
@@ -187,9 +195,7 @@ object KMalloc {
      */
     fun init(bytes: Int) {
         GlobalHeap.init(bytes)
-        bins.fill(-1)
-        largeFreeHead = -1
-        brk = 0
+        KArena.resetAll()
     }
 
     /**
@@ -198,12 +204,10 @@ object KMalloc {
      * Clears all metadata and resets the bump pointer to 0.
      * The underlying heap capacity is retained.
      *
-     * **Warning**: All pointers become invalid after reset.
+     * **Warning**: All pointers and arenas become invalid after reset.
      */
     fun reset() {
-        bins.fill(-1)
-        largeFreeHead = -1
-        brk = 0
+        KArena.resetAll()
         GlobalHeap.reset()
     }
 
@@ -214,12 +218,74 @@ object KMalloc {
      * Call [init] to use the allocator again.
      */
     fun dispose() {
-        bins.fill(-1)
-        largeFreeHead = -1
-        brk = 0
+        KArena.resetAll()
         GlobalHeap.dispose()
     }
 
+    // ========== Statistics ==========
+
+    /**
+     * Gate for the allocator event counters, shared by every arena.
+     *
+     * Switching it on zeroes the counters of all live arenas and seeds their
+     * live-byte totals from a heap walk, so the counters describe the run from
+     * that point on. Off by default.
+     */
+    var statsEnabled: Boolean
+        get() = KArena.statsOn
+        set(value) {
+            if (value && !KArena.statsOn) for (a in KArena.allArenas()) a.clearStats()
+            KArena.statsOn = value
+        }
+
+    /**
+     * Snapshot of [arena]'s counters, free lists and chunk totals, plus the
+     * [GlobalHeap] and [KStack] usage figures.
+     *
+     * Walks the arena, so it costs O(chunks); call it from the arena's
+     * owning thread.
+     */
+    fun stats(arena: KArena = mainArena): KMallocStats = arena.stats()
+
+    /** Walk [arena]'s chunks via their boundary tags and summarize the free space. */
+    fun dumpFragmentation(arena: KArena = mainArena): FragmentationReport = arena.fragmentation()
+
+    // ========== Arena Routing ==========
+
+    /** The growable arena used by threads that have not bound their own. */
+    val mainArena: KArena get() = KArena.main
+
+    /** Arena that [malloc]/[calloc]/[realloc] on the calling thread allocate from. */
+    fun currentArena(): KArena {
+        val a = boundArena()
+        return if (a == null || a.disposed) KArena.main else a
+    }
+
+    /**
+     * Bind [arena] to the calling thread until [unbindArena] (or another bind).
+     * Returns the previously bound arena, or null.
+     */
+    fun bindArena(arena: KArena): KArena? {
+        val prev = boundArena()
+        bindArenaToThread(arena)
+        return prev
+    }
+
+    /** Return the calling thread to the main arena. */
+    fun unbindArena() = bindArenaToThread(null)
+
+    /** Run [block] with [arena] bound to the calling thread, restoring the previous binding after. */
+    inline fun <T> withArena(arena: KArena, block: () -> T): T {
+        val prev = bindArena(arena)
+        return try {
+            block()
+        } finally {
+            if (prev == null) unbindArena() else bindArena(prev)
+        }
+    }
+
+    // ========== C Allocation API ==========
+
     /**
      * Allocate uninitialized memory (C malloc semantics).
      *
@@ -231,7 +297,7 @@ object KMalloc {
      * 2. Search appropriate free list (bins or large list)
      * 3. Split chunk if found block is oversized
      * 4. Bump allocate from top if no free block available
-     * 5. Grow heap automatically if needed
+     * 5. Grow heap automatically if needed (main arena only)
      *
      * @param bytes Number of bytes to allocate. Will be rounded up to 16-byte multiple.
      * @return Pointer to allocated memory (address in GlobalHeap)
@@ -249,19 +315,7 @@ object KMalloc {
      *
      * @see calloc For zero-initialized allocation
      */
-    fun malloc(bytes: Int): Int {
-        val size = normalize(bytes)
-        // Try to find a suitable free chunk
-        val fromBin = findAndPrepareChunk(size)
-        if (fromBin != 0) return fromBin + HEADER_SIZE
-        // No free chunk found, allocate from top
-        val total = OVERHEAD + size
-        val chunk = brk
-        ensureCapacity(chunk + total)
-        writeHeaderFooter(chunk, size, inUse = true)
-        brk += total
-        return chunk + HEADER_SIZE
-    }
+    fun malloc(bytes: Int): Int = currentArena().malloc(bytes)
 
     /**
      * Allocate zero-initialized memory (C calloc semantics).
@@ -283,12 +337,7 @@ object KMalloc {
      *
      * @see malloc For uninitialized allocation
      */
-    fun calloc(count: Int, elemSize: Int): Int {
-        val bytes = count * elemSize
-        val p = malloc(bytes)
-        GlobalHeap.memset(p, 0, bytes)
-        return p
-    }
+    fun calloc(count: Int, elemSize: Int): Int = currentArena().calloc(count, elemSize)
 
     /**
      * Free allocated memory (C free semantics).
@@ -302,6 +351,10 @@ object KMalloc {
      * 3. Check previous chunk (using footer) - if free, merge backward
      * 4. Add merged chunk to appropriate free list
      *
+     * The owning arena is found from the address. If it is neither the
+     * caller's current arena nor a shared arena, the pointer is queued and
+     * the owner reclaims it on its next allocation.
+     *
      * @param ptr Pointer returned by [malloc], [calloc], or [realloc]. Zero/negative pointers are ignored.
      *
      * ## Example
@@ -321,28 +374,8 @@ object KMalloc {
      */
     fun free(ptr: Int) {
         if (ptr <= 0) return
-        var chunk = ptr - HEADER_SIZE
-        var size = readSize(chunk)
-        // Mark as free
-        writeHeaderFooter(chunk, size, inUse = false)
-        // Coalesce with next chunk if it's free
-        val next = nextChunk(chunk)
-        if (next in 0 until brk && !isInUse(next)) {
-            removeFromFreeList(next)
-            val nextSize = readSize(next)
-            size = size + OVERHEAD + nextSize
-            writeHeaderFooter(chunk, size, inUse = false)
-        }
-        // Coalesce with previous chunk if it's free
-        val prev = prevChunk(chunk)
-        if (prev >= 0 && !isInUse(prev)) {
-            removeFromFreeList(prev)
-            val prevSize = readSize(prev)
-            chunk = prev
-            size = prevSize + OVERHEAD + size
-            writeHeaderFooter(chunk, size, inUse = false)
-        }
-        pushFree(chunk)
+        val owner = KArena.ownerOf(ptr)
+        if (owner.shared || owner === currentArena()) owner.free(ptr) else owner.deferFree(ptr)
     }
 
     /**
@@ -356,6 +389,8 @@ object KMalloc {
      * - `realloc(ptr, 0)` → current implementation keeps minimum allocation
      * - Shrinking: Returns same pointer (may split remainder)
      * - Growing: Allocates new, copies old, frees old
+     * - Foreign pointer (owned by another thread's arena): the new block comes
+     *   from the caller's arena and the old one is queued for its owner
      *
      * @param ptr Existing pointer (or 0 for new allocation)
      * @param newSize New size in bytes
@@ -377,192 +412,14 @@ object KMalloc {
      * Could optimize by expanding in-place if next chunk is free and large enough.
      */
     fun realloc(ptr: Int, newSize: Int): Int {
-        if (ptr == 0) return malloc(newSize)
-        val chunk = ptr - HEADER_SIZE
-        val oldSize = readSize(chunk)
-        val size = normalize(newSize)
-        if (size <= oldSize) {
-            // Shrinking: split off remainder if significant
-            maybeSplit(chunk, oldSize, size)
-            return ptr
-        }
-        // Growing: allocate new, copy, free old
-        val np = malloc(size)
-        GlobalHeap.memcpy(np, ptr, oldSize)
-        free(ptr)
+        val cur = currentArena()
+        if (ptr == 0) return cur.malloc(newSize)
+        val owner = KArena.ownerOf(ptr)
+        if (owner.shared || owner === cur) return owner.realloc(ptr, newSize)
+        val oldSize = owner.payloadSize(ptr)
+        val np = cur.malloc(newSize)
+        GlobalHeap.memcpy(np, ptr, minOf(oldSize, newSize.coerceAtLeast(0)))
+        owner.deferFree(ptr)
         return np
     }
-
-    /**
-     * Ensure heap has at least the specified capacity.
-     *
-     * Delegates to [GlobalHeap.ensureCapacity] which grows the heap if needed.
-     *
-     * @param minSize Minimum required capacity in bytes
-     */
-    private fun ensureCapacity(minSize: Int) {
-        if (minSize <= GlobalHeap.size) return
-        GlobalHeap.ensureCapacity(minSize)
-    }
-
-    /**
-     * Get bin index for a given size, or -1 for large blocks.
-     *
-     * Small blocks (≤1024) use segregated bins, large blocks use a single list.
-     *
-     * @param size Allocation size (already normalized)
-     * @return Bin index (0-63) or -1 for large blocks
-     */
-    private fun binIndexOrMinus1(size: Int): Int = if (size <= SMALL_LIMIT) ((size ushr BIN_SHIFT) - 1) else -1
-
-    /**
-     * Normalize size to 16-byte alignment with minimum of MIN_CHUNK.
-     *
-     * @param n Requested size
-     * @return Normalized size (multiple of 16, >= 16)
-     */
-    private fun normalize(n: Int): Int {
-        val v = if (n <= 0) MIN_CHUNK else n
-        val a = ((v + (ALIGN - 1)) / ALIGN) * ALIGN
-        return a.coerceAtLeast(MIN_CHUNK)
-    }
-
-    /**
-     * Write header and footer tags for a chunk.
-     *
-     * Both header and footer store the same tag: (size << 1) | inUse.
-     * The footer enables backward traversal for coalescing.
-     *
-     * @param chunk Chunk address (start of header)
-     * @param size Payload size (not including overhead)
-     * @param inUse true if allocated, false if free
-     */
-    private fun writeHeaderFooter(chunk: Int, size: Int, inUse: Boolean) {
-        val tag = pack(size, inUse)
-        GlobalHeap.sw(chunk, tag)
-        GlobalHeap.sw(chunk + HEADER_SIZE + size, tag)
-    }
-    private fun pack(size: Int, inUse: Boolean): Int = (size shl 1) or (if (inUse) 1 else 0)
-    private fun readTag(chunk: Int): Int = GlobalHeap.lw(chunk)
-    private fun readSize(chunk: Int): Int = readTag(chunk) ushr 1
-    private fun isInUse(chunk: Int): Boolean = (readTag(chunk) and 1) != 0
-    private fun nextChunk(chunk: Int): Int = chunk + HEADER_SIZE + readSize(chunk) + FOOTER_SIZE
-    private fun prevChunk(chunk: Int): Int {
-        if (chunk < FOOTER_SIZE) return -1
-        val prevTag = GlobalHeap.lw(chunk - FOOTER_SIZE)
-        val prevSize = prevTag ushr 1
-        val prevBase = chunk - (HEADER_SIZE + prevSize + FOOTER_SIZE)
-        return if (prevBase >= 0) prevBase else -1
-    }
-
-    private fun pushFree(chunk: Int) {
-        val size = readSize(chunk)
-        val binIdx = binIndexOrMinus1(size)
-        if (binIdx >= 0) {
-            val head = bins[binIdx]
-            GlobalHeap.sw(chunk + HEADER_SIZE, head)
-            bins[binIdx] = chunk
-        } else {
-            // large list push front
-            GlobalHeap.sw(chunk + HEADER_SIZE, largeFreeHead)
-            largeFreeHead = chunk
-        }
-    }
-
-    private fun removeFromFreeList(chunk: Int) {
-        val size = readSize(chunk)
-        val binIdx = binIndexOrMinus1(size)
-        if (binIdx >= 0) {
-            var cur = bins[binIdx]
-            var prev = -1
-            while (cur != -1) {
-                if (cur == chunk) {
-                    val next = GlobalHeap.lw(cur + HEADER_SIZE)
-                    if (prev == -1) bins[binIdx] = next else GlobalHeap.sw(prev + HEADER_SIZE, next)
-                    return
-                }
-                prev = cur
-                cur = GlobalHeap.lw(cur + HEADER_SIZE)
-            }
-        } else {
-            var cur = largeFreeHead
-            var prev = -1
-            while (cur != -1) {
-                if (cur == chunk) {
-                    val next = GlobalHeap.lw(cur + HEADER_SIZE)
-                    if (prev == -1) largeFreeHead = next else GlobalHeap.sw(prev + HEADER_SIZE, next)
-                    return
-                }
-                prev = cur
-                cur = GlobalHeap.lw(cur + HEADER_SIZE)
-            }
-        }
-    }
-
-    private fun maybeSplit(chunk: Int, curSize: Int, wantSize: Int) {
-        val remain = curSize - wantSize
-        if (remain >= MIN_CHUNK + OVERHEAD) {
-            // allocated front keeps wantSize; create a free tail
-            writeHeaderFooter(chunk, wantSize, inUse = true)
-            val tail = chunk + HEADER_SIZE + wantSize + FOOTER_SIZE
-            writeHeaderFooter(tail, remain - OVERHEAD, inUse = false)
-            pushFree(tail)
-        }
-    }
-
-    private fun findAndPrepareChunk(size: Int): Int {
-        // Search bins from target bin upward
-        var idx = binIndexOrMinus1(size)
-        if (idx >= 0) {
-            while (idx < BIN_COUNT) {
-                var cur = bins[idx]
-                var prev = -1
-                while (cur != -1) {
-                    val curSize = readSize(cur)
-                    if (curSize >= size) {
-                        // remove from list
-                        val next = GlobalHeap.lw(cur + HEADER_SIZE)
-                        if (prev == -1) bins[idx] = next else GlobalHeap.sw(prev + HEADER_SIZE, next)
-                        // split if needed
-                        val remain = curSize - size
-                        if (remain >= MIN_CHUNK + OVERHEAD) {
-                            val tail = cur + HEADER_SIZE + size + FOOTER_SIZE
-                            writeHeaderFooter(tail, remain - OVERHEAD, inUse = false)
-                            pushFree(tail)
-                            writeHeaderFooter(cur, size, inUse = true)
-                        } else {
-                            writeHeaderFooter(cur, curSize, inUse = true)
-                        }
-                        return cur
-                    }
-                    prev = cur
-                    cur = GlobalHeap.lw(prev + HEADER_SIZE)
-                }
-                idx++
-            }
-        }
-        // Search large list first-fit
-        var cur = largeFreeHead
-        var prev = -1
-        while (cur != -1) {
-            val curSize = readSize(cur)
-            if (curSize >= size) {
-                val next = GlobalHeap.lw(cur + HEADER_SIZE)
-                if (prev == -1) largeFreeHead = next else GlobalHeap.sw(prev + HEADER_SIZE, next)
-                val remain = curSize - size
-                if (remain >= MIN_CHUNK + OVERHEAD) {
-                    val tail = cur + HEADER_SIZE + size + FOOTER_SIZE
-                    writeHeaderFooter(tail, remain - OVERHEAD, inUse = false)
-                    pushFree(tail)
-                    writeHeaderFooter(cur, size, inUse = true)
-                } else {
-                    writeHeaderFooter(cur, curSize, inUse = true)
-                }
-                return cur
-            }
-            prev = cur
-            cur = GlobalHeap.lw(cur + HEADER_SIZE)
-        }
-        return 0
-    }
 }
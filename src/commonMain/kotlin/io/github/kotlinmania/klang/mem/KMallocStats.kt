@@ -0,0 +1,115 @@
+package io.github.kotlinmania.klang.mem
+
+/**
+ * KMallocStats: point-in-time view of one [KArena], from [KMalloc.stats].
+ *
+ * Two kinds of figures:
+ *
+ * - **Event counters** (`*Count`, [reallocMoves], [sizeClassMallocs],
+ *   [peakLiveBytes]) run only while [KMalloc.statsEnabled] is set, and
+ *   restart from zero when it is switched on or the allocator is reset.
+ *   With the flag off they read 0 (and [peakLiveBytes] equals [liveBytes]).
+ * - **Walked figures** (free-list occupancy, chunk and byte totals) are
+ *   computed from the arena itself when the snapshot is taken, so they
+ *   are exact whether or not counting is on.
+ *
+ * A leak shows up as [liveChunks] / [liveBytes] that keep growing across
+ * iterations that should return to the same state.
+ *
+ * @property enabled Whether the event counters were running
+ * @property mallocCount Chunks handed out (including the new chunk of a moving realloc)
+ * @property freeCount Chunks released (including queued cross-thread frees once drained)
+ * @property reallocCount realloc calls on this arena
+ * @property reallocMoves reallocs that had to allocate, copy and free
+ * @property reuseCount mallocs served from a free list
+ * @property bumpCount mallocs served by advancing [brk]
+ * @property splitCount Free chunks split to fit a request or a shrink
+ * @property coalesceCount Neighbour merges performed by free
+ * @property sizeClassMallocs mallocs per size class: index i < 64 is the
+ *   small bin of `(i + 1) * 16`-byte payloads, the last slot counts every large request
+ * @property peakLiveBytes Highest [liveBytes] seen while counting
+ * @property binOccupancy Free chunks currently on each small bin
+ * @property largeFreeChunks Free chunks currently on the large (TLSF) lists
+ * @property liveChunks In-use chunks between the region start and [brk]
+ * @property liveBytes Payload bytes of in-use chunks
+ * @property freeChunks Free chunks between the region start and [brk]
+ * @property freeBytes Payload bytes of free chunks
+ * @property overheadBytes Header/footer bytes ([KArena.OVERHEAD] per chunk)
+ * @property brk Arena bump pointer (high-water mark of the region: chunks are never returned past it)
+ * @property heapUsed [GlobalHeap.used] (bump allocations made directly on the heap)
+ * @property stackUsedBytes [KStack.usedBytes]
+ */
+class KMallocStats internal constructor(
+    val enabled: Boolean,
+    val mallocCount: Long,
+    val freeCount: Long,
+    val reallocCount: Long,
+    val reallocMoves: Long,
+    val reuseCount: Long,
+    val bumpCount: Long,
+    val splitCount: Long,
+    val coalesceCount: Long,
+    val sizeClassMallocs: LongArray,
+    val peakLiveBytes: Long,
+    val binOccupancy: IntArray,
+    val largeFreeChunks: Int,
+    val liveChunks: Int,
+    val liveBytes: Long,
+    val freeChunks: Int,
+    val freeBytes: Long,
+    val overheadBytes: Long,
+    val brk: Int,
+    val arenaUsedBytes: Int,
+    val arenaCapacityBytes: Int,
+    val heapUsed: Int,
+    val heapSize: Int,
+    val stackUsedBytes: Int,
+    val stackCapacityBytes: Int,
+) {
+    override fun toString(): String =
+        "KMallocStats(live=$liveChunks/$liveBytes B, free=$freeChunks/$freeBytes B, overhead=$overheadBytes B, " +
+            "brk=$brk, peakLive=$peakLiveBytes, malloc=$mallocCount, free=$freeCount, realloc=$reallocCount, " +
+            "split=$splitCount, coalesce=$coalesceCount, heapUsed=$heapUsed/$heapSize, stack=$stackUsedBytes/$stackCapacityBytes)"
+}
+
+/**
+ * FragmentationReport: result of one address-order walk over an arena's
+ * chunks, from [KMalloc.dumpFragmentation].
+ *
+ * [externalFragmentation] is `1 − largestFree / freeBytes`: 0 when all free
+ * memory is one chunk, approaching 1 when it is scattered in pieces too
+ * small for large requests. [toString] renders the report as text.
+ *
+ * @property regionStart First chunk address walked
+ * @property brk End of the walk (the arena's bump pointer)
+ * @property chunks Chunks walked, in use or free
+ * @property freeRuns Maximal runs of adjacent free chunks. Free always
+ *   coalesces, so this equals [freeChunks] unless the tags are corrupt.
+ * @property freeSizeLog2Histogram Free chunks by `floor(log2(payload))`
+ */
+class FragmentationReport internal constructor(
+    val regionStart: Int,
+    val brk: Int,
+    val chunks: Int,
+    val freeChunks: Int,
+    val freeBytes: Long,
+    val largestFreeBytes: Int,
+    val freeRuns: Int,
+    val freeSizeLog2Histogram: IntArray,
+) {
+    val externalFragmentation: Double
+        get() = if (freeBytes == 0L) 0.0 else 1.0 - largestFreeBytes / freeBytes.toDouble()
+
+    override fun toString(): String = buildString {
+        append("region [").append(regionStart).append(", ").append(brk).append("): ")
+        append(chunks).append(" chunks, ").append(freeChunks).append(" free (")
+        append(freeBytes).append(" B, largest ").append(largestFreeBytes).append(" B, ")
+        append(freeRuns).append(" runs)\n")
+        append("external fragmentation: ").append((externalFragmentation * 1000).toInt() / 10.0).append("%\n")
+        for ((log2, n) in freeSizeLog2Histogram.withIndex()) {
+            if (n == 0) continue
+            append("  [").append(1L shl log2).append(", ").append(1L shl (log2 + 1)).append(") B: ")
+            append(n).append('\n')
+        }
+    }
+}
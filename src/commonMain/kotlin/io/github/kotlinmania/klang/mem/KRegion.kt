@@ -0,0 +1,208 @@
+package io.github.kotlinmania.klang.mem
+
+/**
+ * KRegion: a growable bump-pointer region with bulk release.
+ *
+ * A region hands out memory by bumping a pointer through a chain of blocks
+ * carved from a [KArena]. There is no per-allocation header, no free list
+ * and no `free`: memory comes back in bulk, by [release] to a [mark], by
+ * [reset], or at the end of a [withRegion] scope. When the current block is
+ * full the region moves on to the next block, allocating one only if no
+ * retained block is left, so a region that is reset between requests stops
+ * touching the allocator once it has reached its working size.
+ *
+ * ## Architecture
+ *
+ * ```
+ * block 0                block 1                block 2 (retained)
+ * ┌──────────────────┐   ┌──────────────────┐   ┌──────────────────┐
+ * │ used             │ → │ used   │  free   │ → │ free             │
+ * └──────────────────┘   └────────↑─────────┘   └──────────────────┘
+ *                                 top
+ * ```
+ *
+ * Unlike [KStack] the region grows instead of overflowing, and it can be
+ * bound to the calling thread so that [CAutos], [io.github.kotlinmania.klang.int.hpc.HeapUInt128.alloc]
+ * and [io.github.kotlinmania.klang.common.StructLayout.alloc] allocate from
+ * it for the duration of a [withRegion] block.
+ *
+ * ## Usage Example
+ *
+ * ```kotlin
+ * val scratch = KRegion(64 shl 10)
+ *
+ * fun handle(req: Request) = scratch.withRegion {
+ *     val acc = CAutos.long()                  // bumped from scratch
+ *     val big = HeapUInt128.fromULong(req.id)  // bumped from scratch
+ *     // ...
+ * }                                            // everything above released at once
+ * ```
+ *
+ * ## Rules
+ *
+ * - Memory from a region must never be passed to [KMalloc.free].
+ * - Pointers die at the [release] / [reset] that passes them, and every
+ *   block dies with [dispose] or with [KMalloc.init] / [KMalloc.reset].
+ * - Marks are LIFO, like [KStack] frames: releasing to an older mark
+ *   invalidates every younger one.
+ *
+ * ## Thread Safety
+ *
+ * **Not thread-safe**. Use one region per thread; the [withRegion] binding
+ * is per thread.
+ *
+ * @param blockBytes Minimum size of each block (rounded up to 16); larger
+ *   requests get a block of their own size
+ * @param arena Arena the blocks are carved from
+ * @see KStack For a fixed-size LIFO frame allocator
+ * @see KArena For allocators with per-pointer free
+ */
+class KRegion(
+    val blockBytes: Int = DEFAULT_BLOCK_BYTES,
+    private val arena: KArena = KMalloc.currentArena(),
+) {
+    init {
+        require(blockBytes > 0) { "Region block size must be positive" }
+    }
+
+    private var bases = IntArray(4)
+    private var sizes = IntArray(4)
+    private var count = 0
+
+    /** Index of the current block; -1 before the first allocation. */
+    private var cur = -1
+    private var top = 0
+    private var end = 0
+
+    /** Number of blocks owned by the region (including retained, currently unused ones). */
+    val blockCount: Int get() = count
+
+    /** Bytes owned by the region across all blocks. */
+    val capacityBytes: Long
+        get() {
+            var total = 0L
+            for (i in 0 until count) total += sizes[i]
+            return total
+        }
+
+    /**
+     * Allocate [bytes] uninitialized bytes aligned to [align] (a power of two).
+     *
+     * O(1): a pointer bump, plus a block switch when the current block is full.
+     */
+    fun alloc(bytes: Int, align: Int = 16): Int {
+        require(bytes >= 0) { "Cannot allocate negative bytes" }
+        require(align > 0 && (align and (align - 1)) == 0) { "Alignment must be power of two" }
+        val p = (top + (align - 1)) and (align - 1).inv()
+        if (bytes <= end - p) {
+            top = p + bytes
+            return p
+        }
+        return allocInNextBlock(bytes, align)
+    }
+
+    /** Allocate [count] × [elemSize] zeroed bytes. */
+    fun calloc(count: Int, elemSize: Int, align: Int = 16): Int {
+        require(count >= 0 && elemSize >= 0) { "Count and elemSize must be non-negative" }
+        val total = count * elemSize
+        val p = alloc(total, align)
+        GlobalHeap.memset(p, 0, total)
+        return p
+    }
+
+    private fun allocInNextBlock(bytes: Int, align: Int): Int {
+        val need = bytes + (align - 1)
+        require(need >= bytes) { "Region allocation of $bytes bytes is too large" }
+        var next = cur + 1
+        while (next < count && sizes[next] < need) next++
+        if (next == count) addBlock(maxOf(blockBytes, need))
+        cur = next
+        end = bases[next] + sizes[next]
+        val p = (bases[next] + (align - 1)) and (align - 1).inv()
+        top = p + bytes
+        return p
+    }
+
+    private fun addBlock(bytes: Int) {
+        val size = (bytes + 15) and 15.inv()
+        if (count == bases.size) {
+            bases = bases.copyOf(count * 2)
+            sizes = sizes.copyOf(count * 2)
+        }
+        bases[count] = arena.malloc(size)
+        sizes[count] = size
+        count++
+    }
+
+    /** Current position, for a later [release]. */
+    fun mark(): Long = ((cur + 1).toLong() shl 32) or (top.toLong() and 0xFFFFFFFFL)
+
+    /**
+     * Release everything allocated since [mark] was taken. Blocks are kept
+     * for reuse.
+     */
+    fun release(mark: Long) {
+        val block = (mark ushr 32).toInt() - 1
+        val at = mark.toInt()
+        if (block < 0) {
+            require(at == 0) { "Invalid region mark" }
+            cur = -1; top = 0; end = 0
+            return
+        }
+        require(block < count && at in bases[block]..bases[block] + sizes[block]) { "Invalid region mark" }
+        cur = block
+        top = at
+        end = bases[block] + sizes[block]
+    }
+
+    /** Release every allocation; blocks are kept for reuse. */
+    fun reset() {
+        cur = -1; top = 0; end = 0
+    }
+
+    /** Return every block to the arena. The region may be used again afterwards. */
+    fun dispose() {
+        for (i in 0 until count) arena.free(bases[i])
+        count = 0
+        reset()
+    }
+
+    /**
+     * Run [block] with this region bound to the calling thread, then release
+     * everything allocated during it and restore the previous binding.
+     *
+     * While bound, [CAutos], `HeapUInt128.alloc` and `StructLayout.alloc`
+     * allocate from this region. Nested scopes on the same or another region
+     * are fine.
+     */
+    inline fun <T> withRegion(block: () -> T): T {
+        val m = mark()
+        val prev = swapCurrent(this)
+        try {
+            return block()
+        } finally {
+            swapCurrent(prev)
+            release(m)
+        }
+    }
+
+    companion object {
+        const val DEFAULT_BLOCK_BYTES = 64 shl 10
+
+        /** Region bound to the calling thread by [withRegion], or null. */
+        fun current(): KRegion? = boundRegion()
+
+        @PublishedApi
+        internal fun swapCurrent(region: KRegion?): KRegion? {
+            val prev = boundRegion()
+            bindRegionToThread(region)
+            return prev
+        }
+    }
+}
+
+/** Region bound to the calling thread by [KRegion.withRegion], or null. */
+internal expect fun boundRegion(): KRegion?
+
+/** Bind [region] to the calling thread (null unbinds). */
+internal expect fun bindRegionToThread(region: KRegion?)
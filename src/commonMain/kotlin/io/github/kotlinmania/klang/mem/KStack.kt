@@ -169,6 +169,9 @@ package io.github.kotlinmania.klang.mem
  * **Not thread-safe**. KStack is a singleton with shared state.
  * Each thread should have its own stack (not yet implemented).
  *
+ * The stack region comes from the caller's current [KArena] (or the one passed
+ * to [init]), and [dispose] returns it to whichever arena owns it.
+ *
  * Future: Thread-local KStack via `expect`/`actual` mechanism.
  *
  * ## Comparison with Alternatives
@@ -210,6 +213,7 @@ package io.github.kotlinmania.klang.mem
  * ```
  *
  * @see KMalloc For heap-based allocation
+ * @see KRegion For a growable region with mark/release
  * @see CScalars For type-safe variables using KStack
  * @see GlobalHeap For underlying memory access
  * @since 0.1.0
@@ -237,6 +241,7 @@ object KStack {
      * The region is 16-byte aligned for optimal performance.
      *
      * @param bytes Size of stack region (default: 1MB)
+     * @param arena Arena the region is carved from (default: the calling thread's current arena)
      * @throws IllegalStateException if bytes <= 0
      *
      * ## Example
@@ -244,10 +249,10 @@ object KStack {
      * KStack.init(2 * 1024 * 1024)  // 2MB stack
      * ```
      */
-    fun init(bytes: Int = 1 shl 20) { // default 1 MiB stack region
+    fun init(bytes: Int = 1 shl 20, arena: KArena = KMalloc.currentArena()) { // default 1 MiB stack region
         check(bytes > 0) { "Stack size must be positive" }
         val total = bytes + 15
-        allocBase = KMalloc.calloc(total, 1)
+        allocBase = arena.calloc(total, 1)
         base = alignUp(allocBase, 16)
         size = bytes
         sp = size
@@ -234,67 +234,536 @@ class PackedBuffer(sizeBytes: Int) {
     /**
      * Fill region with byte value.
      */
-    fun fill(addr: Int, value: Int, count: Int) {
-        if (count <= 0) return
+    fun fill(addr: Int, value: Int, count: Int) = fillWords(addr, value, count)
+
+    /**
+     * Copy from src region to dst region (non-overlapping).
+     */
+    fun copy(dstAddr: Int, srcAddr: Int, count: Int) = copyWords(dstAddr, srcAddr, count)
+
+    /**
+     * Copy with overlap support.
+     */
+    fun move(dstAddr: Int, srcAddr: Int, count: Int) = copyWords(dstAddr, srcAddr, count)
 
+    // ========== Word-Granular Bulk Transfer ==========
+    //
+    // Bulk copies and fills work on whole backing Longs. Only the partial
+    // words at the head and tail of a range are read-modify-written; the
+    // aligned body is either a single `LongArray.copyInto` (source and
+    // destination share the same byte phase) or a shift-merge of adjacent
+    // source Longs (phases differ). No per-word allocation on any path.
+
+    /**
+     * Fill [count] bytes starting at [addr] with the low 8 bits of [value].
+     *
+     * The aligned body is a single `LongArray.fill` with the byte replicated
+     * across all 8 lanes.
+     */
+    fun fillWords(addr: Int, value: Int, count: Int) {
+        if (count <= 0) return
         val byteVal = value.toLong() and 0xFF
-        // Replicate byte across all 8 positions in a Long
-        val wordVal = byteVal or (byteVal shl 8) or (byteVal shl 16) or (byteVal shl 24) or
-                (byteVal shl 32) or (byteVal shl 40) or (byteVal shl 48) or (byteVal shl 56)
+        val wordVal = byteVal * 0x0101010101010101L
 
         var pos = addr
         var remaining = count
 
-        // Handle unaligned start
-        while (remaining > 0 && (pos and 7) != 0) {
-            setByte(pos++, value)
-            remaining--
+        // Unaligned head: bytes up to the next word boundary
+        val headOff = pos and 7
+        if (headOff != 0) {
+            val n = minOf(8 - headOff, remaining)
+            storePartial(pos, n, wordVal)
+            pos += n
+            remaining -= n
         }
 
-        // Bulk fill aligned Longs
-        val idx = pos ushr 3
+        // Aligned body
         val fullLongs = remaining ushr 3
-        for (i in 0 until fullLongs) {
-            data[idx + i] = wordVal
+        if (fullLongs > 0) {
+            val idx = pos ushr 3
+            data.fill(wordVal, idx, idx + fullLongs)
+            pos += fullLongs shl 3
+            remaining -= fullLongs shl 3
         }
-        pos += fullLongs shl 3
-        remaining -= fullLongs shl 3
 
-        // Handle unaligned tail
-        while (remaining-- > 0) {
-            setByte(pos++, value)
-        }
+        // Tail
+        if (remaining > 0) storePartial(pos, remaining, wordVal)
     }
 
     /**
-     * Copy from src region to dst region (non-overlapping).
+     * Copy [count] bytes from [srcAddr] to [dstAddr]. Overlap-safe (memmove
+     * semantics): the copy direction is chosen from the relative position
+     * of the two ranges.
+     *
+     * The destination is brought to a word boundary first. If the source is
+     * then also word-aligned the body is one `LongArray.copyInto`; otherwise
+     * each destination Long is funnel-merged from two adjacent source Longs.
      */
-    fun copy(dstAddr: Int, srcAddr: Int, count: Int) {
+    fun copyWords(dstAddr: Int, srcAddr: Int, count: Int) {
         if (count <= 0 || dstAddr == srcAddr) return
+        if (dstAddr < srcAddr || dstAddr >= srcAddr + count) {
+            copyWordsForward(dstAddr, srcAddr, count)
+        } else {
+            copyWordsBackward(dstAddr, srcAddr, count)
+        }
+    }
 
-        // Simple byte-by-byte for now (can optimize for aligned cases)
-        for (i in 0 until count) {
-            setByte(dstAddr + i, getByte(srcAddr + i))
+    private fun copyWordsForward(dstAddr: Int, srcAddr: Int, count: Int) {
+        var d = dstAddr
+        var s = srcAddr
+        var n = count
+
+        // Head: align destination
+        val headOff = d and 7
+        if (headOff != 0) {
+            val h = minOf(8 - headOff, n)
+            storePartial(d, h, loadPartial(s, h))
+            d += h
+            s += h
+            n -= h
         }
+
+        val words = n ushr 3
+        if (words > 0) {
+            val di = d ushr 3
+            val si = s ushr 3
+            val sh = (s and 7) shl 3
+            if (sh == 0) {
+                data.copyInto(data, di, si, si + words)
+            } else {
+                // Destination trails the source (di <= si), so the Long at
+                // si + k + 1 is always read before anything can overwrite it.
+                val back = 64 - sh
+                var cur = data[si]
+                for (k in 0 until words) {
+                    val next = data[si + k + 1]
+                    data[di + k] = (cur ushr sh) or (next shl back)
+                    cur = next
+                }
+            }
+            d += words shl 3
+            s += words shl 3
+            n -= words shl 3
+        }
+
+        // Tail
+        if (n > 0) storePartial(d, n, loadPartial(s, n))
     }
 
-    /**
-     * Copy with overlap support.
-     */
-    fun move(dstAddr: Int, srcAddr: Int, count: Int) {
-        if (count <= 0 || dstAddr == srcAddr) return
+    private fun copyWordsBackward(dstAddr: Int, srcAddr: Int, count: Int) {
+        var dEnd = dstAddr + count
+        var sEnd = srcAddr + count
+        var n = count
+
+        // Tail: align destination end
+        val tailLen = minOf(dEnd and 7, n)
+        if (tailLen != 0) {
+            dEnd -= tailLen
+            sEnd -= tailLen
+            storePartial(dEnd, tailLen, loadPartial(sEnd, tailLen))
+            n -= tailLen
+        }
 
-        if (dstAddr < srcAddr || dstAddr >= srcAddr + count) {
-            // No overlap or dst before src - copy forward
-            for (i in 0 until count) {
-                setByte(dstAddr + i, getByte(srcAddr + i))
+        val words = n ushr 3
+        if (words > 0) {
+            val di = (dEnd ushr 3) - words
+            val sFirst = sEnd - (words shl 3)
+            val si = sFirst ushr 3
+            val sh = (sFirst and 7) shl 3
+            if (sh == 0) {
+                data.copyInto(data, di, si, si + words)
+            } else {
+                // Walk high to low. The upper source Long is carried in a
+                // local so a write that lands on it (di == si + 1) is harmless.
+                val back = 64 - sh
+                var hi = data[si + words]
+                for (k in words - 1 downTo 0) {
+                    val lo = data[si + k]
+                    data[di + k] = (lo ushr sh) or (hi shl back)
+                    hi = lo
+                }
             }
-        } else {
-            // Overlap with dst after src - copy backward
-            for (i in count - 1 downTo 0) {
-                setByte(dstAddr + i, getByte(srcAddr + i))
+            n -= words shl 3
+        }
+
+        // Head: remaining bytes all sit in the first destination word
+        if (n > 0) storePartial(dstAddr, n, loadPartial(srcAddr, n))
+    }
+
+    // ========== Bulk Typed Transfer ==========
+    //
+    // Element streams between the buffer and Kotlin primitive arrays. Each
+    // kernel decodes whole backing Longs: two 32-bit lanes, four 16-bit lanes
+    // or one 64-bit lane per `data` load. Addresses aligned to the element
+    // size peel at most a few head/tail elements and then run the word loop;
+    // misaligned addresses funnel-merge adjacent Longs. Callers validate the
+    // array range; these loops do no per-element span checks.
+
+    /** Read [n] little-endian 64-bit values at [addr] into `dst[off until off+n]`. */
+    fun readLongs(addr: Int, dst: LongArray, off: Int, n: Int) {
+        if (n <= 0) return
+        val idx = addr ushr 3
+        val sh = (addr and 7) shl 3
+        if (sh == 0) {
+            data.copyInto(dst, off, idx, idx + n)
+            return
+        }
+        val back = 64 - sh
+        var cur = data[idx]
+        for (k in 0 until n) {
+            val next = data[idx + k + 1]
+            dst[off + k] = (cur ushr sh) or (next shl back)
+            cur = next
+        }
+    }
+
+    /** Write `src[off until off+n]` as little-endian 64-bit values at [addr]. */
+    fun writeLongs(addr: Int, src: LongArray, off: Int, n: Int) {
+        if (n <= 0) return
+        val idx = addr ushr 3
+        val sh = (addr and 7) shl 3
+        if (sh == 0) {
+            src.copyInto(data, idx, off, off + n)
+            return
+        }
+        val back = 64 - sh
+        var prev = src[off]
+        data[idx] = (data[idx] and ((1L shl sh) - 1)) or (prev shl sh)
+        for (k in 1 until n) {
+            val v = src[off + k]
+            data[idx + k] = (prev ushr back) or (v shl sh)
+            prev = v
+        }
+        data[idx + n] = (data[idx + n] and (-1L shl sh)) or (prev ushr back)
+    }
+
+    /** Read [n] IEEE-754 binary64 values at [addr] into `dst[off until off+n]`. */
+    fun readDoubles(addr: Int, dst: DoubleArray, off: Int, n: Int) {
+        if (n <= 0) return
+        val idx = addr ushr 3
+        val sh = (addr and 7) shl 3
+        if (sh == 0) {
+            for (k in 0 until n) dst[off + k] = Double.fromBits(data[idx + k])
+            return
+        }
+        val back = 64 - sh
+        var cur = data[idx]
+        for (k in 0 until n) {
+            val next = data[idx + k + 1]
+            dst[off + k] = Double.fromBits((cur ushr sh) or (next shl back))
+            cur = next
+        }
+    }
+
+    /** Write `src[off until off+n]` as IEEE-754 binary64 values at [addr]. */
+    fun writeDoubles(addr: Int, src: DoubleArray, off: Int, n: Int) {
+        if (n <= 0) return
+        val idx = addr ushr 3
+        val sh = (addr and 7) shl 3
+        if (sh == 0) {
+            for (k in 0 until n) data[idx + k] = src[off + k].toRawBits()
+            return
+        }
+        val back = 64 - sh
+        var prev = src[off].toRawBits()
+        data[idx] = (data[idx] and ((1L shl sh) - 1)) or (prev shl sh)
+        for (k in 1 until n) {
+            val v = src[off + k].toRawBits()
+            data[idx + k] = (prev ushr back) or (v shl sh)
+            prev = v
+        }
+        data[idx + n] = (data[idx + n] and (-1L shl sh)) or (prev ushr back)
+    }
+
+    /** Read [n] little-endian 32-bit values at [addr] into `dst[off until off+n]`. */
+    fun readInts(addr: Int, dst: IntArray, off: Int, n: Int) {
+        if (n <= 0) return
+        var a = addr
+        var o = off
+        var rem = n
+        if ((a and 3) == 0) {
+            // 4-aligned: peel one lane to reach an 8-byte boundary
+            if ((a and 7) != 0) {
+                dst[o++] = (data[a ushr 3] ushr 32).toInt()
+                a += 4
+                rem--
             }
+            val idx = a ushr 3
+            val pairs = rem ushr 1
+            for (k in 0 until pairs) {
+                val w = data[idx + k]
+                dst[o] = w.toInt()
+                dst[o + 1] = (w ushr 32).toInt()
+                o += 2
+            }
+            if ((rem and 1) != 0) dst[o] = data[idx + pairs].toInt()
+            return
+        }
+        // Misaligned: merge two Longs per lane pair
+        val idx = a ushr 3
+        val sh = (a and 7) shl 3
+        val back = 64 - sh
+        val pairs = rem ushr 1
+        if (pairs > 0) {
+            var cur = data[idx]
+            for (k in 0 until pairs) {
+                val next = data[idx + k + 1]
+                val w = (cur ushr sh) or (next shl back)
+                dst[o] = w.toInt()
+                dst[o + 1] = (w ushr 32).toInt()
+                o += 2
+                cur = next
+            }
+        }
+        if ((rem and 1) != 0) dst[o] = getInt(a + (pairs shl 3))
+    }
+
+    /** Write `src[off until off+n]` as little-endian 32-bit values at [addr]. */
+    fun writeInts(addr: Int, src: IntArray, off: Int, n: Int) {
+        if (n <= 0) return
+        var a = addr
+        var o = off
+        var rem = n
+        if ((a and 3) == 0) {
+            if ((a and 7) != 0) {
+                val i = a ushr 3
+                data[i] = (data[i] and 0xFFFFFFFFL) or (src[o++].toLong() shl 32)
+                a += 4
+                rem--
+            }
+            val idx = a ushr 3
+            val pairs = rem ushr 1
+            for (k in 0 until pairs) {
+                data[idx + k] = (src[o].toLong() and 0xFFFFFFFFL) or (src[o + 1].toLong() shl 32)
+                o += 2
+            }
+            if ((rem and 1) != 0) {
+                val i = idx + pairs
+                data[i] = (data[i] and -0x100000000L) or (src[o].toLong() and 0xFFFFFFFFL)
+            }
+            return
+        }
+        val idx = a ushr 3
+        val sh = (a and 7) shl 3
+        val back = 64 - sh
+        val pairs = rem ushr 1
+        if (pairs > 0) {
+            var prev = (src[o].toLong() and 0xFFFFFFFFL) or (src[o + 1].toLong() shl 32)
+            o += 2
+            data[idx] = (data[idx] and ((1L shl sh) - 1)) or (prev shl sh)
+            for (k in 1 until pairs) {
+                val v = (src[o].toLong() and 0xFFFFFFFFL) or (src[o + 1].toLong() shl 32)
+                o += 2
+                data[idx + k] = (prev ushr back) or (v shl sh)
+                prev = v
+            }
+            data[idx + pairs] = (data[idx + pairs] and (-1L shl sh)) or (prev ushr back)
+        }
+        if ((rem and 1) != 0) setInt(a + (pairs shl 3), src[o])
+    }
+
+    /** Read [n] IEEE-754 binary32 values at [addr] into `dst[off until off+n]`. */
+    fun readFloats(addr: Int, dst: FloatArray, off: Int, n: Int) {
+        if (n <= 0) return
+        var a = addr
+        var o = off
+        var rem = n
+        if ((a and 3) == 0) {
+            if ((a and 7) != 0) {
+                dst[o++] = Float.fromBits((data[a ushr 3] ushr 32).toInt())
+                a += 4
+                rem--
+            }
+            val idx = a ushr 3
+            val pairs = rem ushr 1
+            for (k in 0 until pairs) {
+                val w = data[idx + k]
+                dst[o] = Float.fromBits(w.toInt())
+                dst[o + 1] = Float.fromBits((w ushr 32).toInt())
+                o += 2
+            }
+            if ((rem and 1) != 0) dst[o] = Float.fromBits(data[idx + pairs].toInt())
+            return
+        }
+        val idx = a ushr 3
+        val sh = (a and 7) shl 3
+        val back = 64 - sh
+        val pairs = rem ushr 1
+        if (pairs > 0) {
+            var cur = data[idx]
+            for (k in 0 until pairs) {
+                val next = data[idx + k + 1]
+                val w = (cur ushr sh) or (next shl back)
+                dst[o] = Float.fromBits(w.toInt())
+                dst[o + 1] = Float.fromBits((w ushr 32).toInt())
+                o += 2
+                cur = next
+            }
+        }
+        if ((rem and 1) != 0) dst[o] = getFloat(a + (pairs shl 3))
+    }
+
+    /** Write `src[off until off+n]` as IEEE-754 binary32 values at [addr]. */
+    fun writeFloats(addr: Int, src: FloatArray, off: Int, n: Int) {
+        if (n <= 0) return
+        var a = addr
+        var o = off
+        var rem = n
+        if ((a and 3) == 0) {
+            if ((a and 7) != 0) {
+                val i = a ushr 3
+                data[i] = (data[i] and 0xFFFFFFFFL) or (src[o++].toRawBits().toLong() shl 32)
+                a += 4
+                rem--
+            }
+            val idx = a ushr 3
+            val pairs = rem ushr 1
+            for (k in 0 until pairs) {
+                data[idx + k] = (src[o].toRawBits().toLong() and 0xFFFFFFFFL) or
+                    (src[o + 1].toRawBits().toLong() shl 32)
+                o += 2
+            }
+            if ((rem and 1) != 0) {
+                val i = idx + pairs
+                data[i] = (data[i] and -0x100000000L) or (src[o].toRawBits().toLong() and 0xFFFFFFFFL)
+            }
+            return
+        }
+        val idx = a ushr 3
+        val sh = (a and 7) shl 3
+        val back = 64 - sh
+        val pairs = rem ushr 1
+        if (pairs > 0) {
+            var prev = (src[o].toRawBits().toLong() and 0xFFFFFFFFL) or (src[o + 1].toRawBits().toLong() shl 32)
+            o += 2
+            data[idx] = (data[idx] and ((1L shl sh) - 1)) or (prev shl sh)
+            for (k in 1 until pairs) {
+                val v = (src[o].toRawBits().toLong() and 0xFFFFFFFFL) or (src[o + 1].toRawBits().toLong() shl 32)
+                o += 2
+                data[idx + k] = (prev ushr back) or (v shl sh)
+                prev = v
+            }
+            data[idx + pairs] = (data[idx + pairs] and (-1L shl sh)) or (prev ushr back)
+        }
+        if ((rem and 1) != 0) setFloat(a + (pairs shl 3), src[o])
+    }
+
+    /** Read [n] little-endian 16-bit values at [addr] into `dst[off until off+n]`. */
+    fun readShorts(addr: Int, dst: ShortArray, off: Int, n: Int) {
+        if (n <= 0) return
+        var a = addr
+        var o = off
+        var rem = n
+        if ((a and 1) == 0) {
+            // 2-aligned: peel up to three lanes to reach an 8-byte boundary
+            while (rem > 0 && (a and 7) != 0) {
+                dst[o++] = ((data[a ushr 3] ushr ((a and 7) shl 3)) and 0xFFFF).toShort()
+                a += 2
+                rem--
+            }
+            val idx = a ushr 3
+            val quads = rem ushr 2
+            for (k in 0 until quads) {
+                val w = data[idx + k]
+                dst[o] = w.toShort()
+                dst[o + 1] = (w ushr 16).toShort()
+                dst[o + 2] = (w ushr 32).toShort()
+                dst[o + 3] = (w ushr 48).toShort()
+                o += 4
+            }
+            a += quads shl 3
+            rem -= quads shl 2
+            while (rem-- > 0) {
+                dst[o++] = ((data[a ushr 3] ushr ((a and 7) shl 3)) and 0xFFFF).toShort()
+                a += 2
+            }
+            return
+        }
+        // Odd address: merge two Longs per four lanes
+        val idx = a ushr 3
+        val sh = (a and 7) shl 3
+        val back = 64 - sh
+        val quads = rem ushr 2
+        if (quads > 0) {
+            var cur = data[idx]
+            for (k in 0 until quads) {
+                val next = data[idx + k + 1]
+                val w = (cur ushr sh) or (next shl back)
+                dst[o] = w.toShort()
+                dst[o + 1] = (w ushr 16).toShort()
+                dst[o + 2] = (w ushr 32).toShort()
+                dst[o + 3] = (w ushr 48).toShort()
+                o += 4
+                cur = next
+            }
+        }
+        a += quads shl 3
+        rem -= quads shl 2
+        while (rem-- > 0) {
+            dst[o++] = getShort(a)
+            a += 2
+        }
+    }
+
+    /** Write `src[off until off+n]` as little-endian 16-bit values at [addr]. */
+    fun writeShorts(addr: Int, src: ShortArray, off: Int, n: Int) {
+        if (n <= 0) return
+        var a = addr
+        var o = off
+        var rem = n
+        if ((a and 1) == 0) {
+            while (rem > 0 && (a and 7) != 0) {
+                storePartial(a, 2, src[o++].toLong())
+                a += 2
+                rem--
+            }
+            val idx = a ushr 3
+            val quads = rem ushr 2
+            for (k in 0 until quads) {
+                data[idx + k] = (src[o].toLong() and 0xFFFF) or
+                    ((src[o + 1].toLong() and 0xFFFF) shl 16) or
+                    ((src[o + 2].toLong() and 0xFFFF) shl 32) or
+                    (src[o + 3].toLong() shl 48)
+                o += 4
+            }
+            a += quads shl 3
+            rem -= quads shl 2
+            while (rem-- > 0) {
+                storePartial(a, 2, src[o++].toLong())
+                a += 2
+            }
+            return
         }
+        while (rem-- > 0) {
+            setShort(a, src[o++])
+            a += 2
+        }
+    }
+
+    /**
+     * Read [n] bytes (1..8) starting at [addr] into the low bytes of a Long.
+     * Touches the following backing Long only when the range actually spans it.
+     */
+    private fun loadPartial(addr: Int, n: Int): Long {
+        val idx = addr ushr 3
+        val shift = (addr and 7) shl 3
+        val bits = n shl 3
+        var v = data[idx] ushr shift
+        if (shift + bits > 64) v = v or (data[idx + 1] shl (64 - shift))
+        return if (bits == 64) v else v and ((1L shl bits) - 1)
+    }
+
+    /**
+     * Write the low [n] bytes of [value] at [addr]. The range must not cross a
+     * backing-Long boundary (`(addr and 7) + n <= 8`).
+     */
+    private fun storePartial(addr: Int, n: Int, value: Long) {
+        val idx = addr ushr 3
+        val shift = (addr and 7) shl 3
+        val bits = n shl 3
+        val lane = if (bits == 64) -1L else (1L shl bits) - 1
+        val mask = lane shl shift
+        data[idx] = (data[idx] and mask.inv()) or ((value and lane) shl shift)
     }
 
     /**
@@ -0,0 +1,149 @@
+package io.github.kotlinmania.klang.mem
+
+/**
+ * PagedHeap: a 64-bit, segment-backed bump heap for data that outgrows [GlobalHeap].
+ *
+ * [GlobalHeap] is one contiguous [PackedBuffer] addressed by `Int`: growth
+ * allocates a bigger buffer and copies the old one, and the address space
+ * stops at 2 GB. PagedHeap keeps the same load/store vocabulary over a
+ * [SegmentedBuffer] with `Long` pointers instead:
+ *
+ * - growth appends [SegmentedBuffer.segmentBytes]-sized segments and never
+ *   copies, so there is no O(heap) pause and no 2.5× transient footprint
+ * - pointers are `Long`, so the heap can exceed 2 GB (bounded by the
+ *   target's memory, not by `Int`)
+ *
+ * The flat [GlobalHeap] stays the address space for everything else in
+ * klang ([KMalloc], [CLib], typed views, the `packed.data` kernels);
+ * PagedHeap is for large, mostly bulk-accessed regions such as model
+ * weights, which are loaded with [writeFloats] / [writeLongs] and read per
+ * element or in bulk.
+ *
+ * ## Usage Example
+ *
+ * ```kotlin
+ * PagedHeap.init()                       // 1 MB segments
+ * val w: Long = PagedHeap.malloc(3L shl 30)   // 3 GB
+ * PagedHeap.writeFloats(w, chunk, 0, chunk.size)
+ * val x = PagedHeap.lwf(w + 4L * i)
+ * ```
+ *
+ * ## Thread Safety
+ *
+ * **Not thread-safe**. External synchronization required for concurrent access.
+ *
+ * @see SegmentedBuffer For the storage layout
+ * @see GlobalHeap For the flat `Int`-addressed heap
+ */
+object PagedHeap {
+    private var buffer: SegmentedBuffer = SegmentedBuffer()
+    private var hp: Long = 0L
+
+    /** Total heap size in bytes. */
+    val size: Long get() = buffer.capacity
+
+    /** Number of bytes currently allocated (used). */
+    val used: Long get() = hp
+
+    /** Number of backing segments. */
+    val segmentCount: Int get() = buffer.segmentCount
+
+    /** Initialize or reinitialize the heap, pre-reserving [bytes]. */
+    fun init(bytes: Long = 0L, segmentBytes: Int = SegmentedBuffer.DEFAULT_SEGMENT_BYTES) {
+        require(bytes >= 0) { "Heap size must be non-negative" }
+        buffer = SegmentedBuffer(segmentBytes)
+        buffer.ensure(bytes)
+        hp = 0L
+    }
+
+    /** Reset heap pointer to 0, effectively freeing all allocations. Segments are kept. */
+    fun reset() { hp = 0L }
+
+    /** Dispose of the heap, releasing every segment. */
+    fun dispose() {
+        buffer.clear()
+        hp = 0L
+    }
+
+    /** Allocate uninitialized memory (like C's malloc), 8-byte aligned. */
+    fun malloc(bytes: Long): Long {
+        require(bytes >= 0) { "Cannot allocate negative bytes" }
+        val base = (hp + 7) and 7L.inv()
+        val end = base + bytes
+        buffer.ensure(end)
+        hp = end
+        return base
+    }
+
+    /** Allocate zero-initialized memory (like C's calloc). */
+    fun calloc(count: Long, elemSize: Long): Long {
+        require(count >= 0 && elemSize >= 0) { "Count and elemSize must be non-negative" }
+        val total = count * elemSize
+        val p = malloc(total)
+        buffer.fill(p, 0, total)
+        return p
+    }
+
+    /** Free memory (no-op in bump allocator). */
+    fun free(ptr: Long) { /* no-op bump allocator */ }
+
+    /** Ensure heap capacity, appending segments if necessary. */
+    fun ensureCapacity(minSize: Long) = buffer.ensure(minSize)
+
+    // ========== Typed Load/Store Operations (Little-Endian) ==========
+
+    fun lb(addr: Long): Byte = buffer.getByte(addr).toByte()
+    fun sb(addr: Long, value: Byte) = buffer.setByte(addr, value.toInt())
+    fun lbu(addr: Long): Int = buffer.getByte(addr)
+    fun lh(addr: Long): Short = buffer.getShort(addr)
+    fun sh(addr: Long, value: Short) = buffer.setShort(addr, value)
+    fun lw(addr: Long): Int = buffer.getInt(addr)
+    fun sw(addr: Long, value: Int) = buffer.setInt(addr, value)
+    fun ld(addr: Long): Long = buffer.getLong(addr)
+    fun sd(addr: Long, value: Long) = buffer.setLong(addr, value)
+    fun lwf(addr: Long): Float = buffer.getFloat(addr)
+    fun swf(addr: Long, value: Float) = buffer.setFloat(addr, value)
+    fun ldf(addr: Long): Double = buffer.getDouble(addr)
+    fun sdf(addr: Long, value: Double) = buffer.setDouble(addr, value)
+
+    // ========== Bulk Transfer ==========
+
+    /** Load `n` floats from [addr] into `dst[off until off+n]`. */
+    fun readFloats(addr: Long, dst: FloatArray, off: Int = 0, n: Int = dst.size - off) {
+        checkSlice(dst.size, off, n)
+        buffer.readFloats(addr, dst, off, n)
+    }
+
+    /** Store `src[off until off+n]` as consecutive floats at [addr]. */
+    fun writeFloats(addr: Long, src: FloatArray, off: Int = 0, n: Int = src.size - off) {
+        checkSlice(src.size, off, n)
+        buffer.writeFloats(addr, src, off, n)
+    }
+
+    /** Load `n` 64-bit longs from [addr] into `dst[off until off+n]`. */
+    fun readLongs(addr: Long, dst: LongArray, off: Int = 0, n: Int = dst.size - off) {
+        checkSlice(dst.size, off, n)
+        buffer.readLongs(addr, dst, off, n)
+    }
+
+    /** Store `src[off until off+n]` as consecutive 64-bit longs at [addr]. */
+    fun writeLongs(addr: Long, src: LongArray, off: Int = 0, n: Int = src.size - off) {
+        checkSlice(src.size, off, n)
+        buffer.writeLongs(addr, src, off, n)
+    }
+
+    private fun checkSlice(arraySize: Int, off: Int, n: Int) {
+        require(off >= 0 && n >= 0 && off <= arraySize - n) {
+            "Array slice out of bounds: off=$off, n=$n, size=$arraySize"
+        }
+    }
+
+    /** memcpy within the paged heap (overlap-safe). */
+    fun memcpy(dst: Long, src: Long, bytes: Long) = buffer.copy(dst, src, bytes)
+
+    /** memmove within the paged heap. */
+    fun memmove(dst: Long, src: Long, bytes: Long) = buffer.copy(dst, src, bytes)
+
+    /** memset: fill memory with byte value. */
+    fun memset(addr: Long, value: Int, bytes: Long) = buffer.fill(addr, value, bytes)
+}
@@ -0,0 +1,308 @@
+package io.github.kotlinmania.klang.mem
+
+/**
+ * SegmentedBuffer: a paged, `Long`-addressed counterpart of [PackedBuffer].
+ *
+ * Storage is a list of fixed-size `LongArray` segments (1 MB by default).
+ * Growing appends segments and never copies or moves existing ones, so
+ * growth costs O(new bytes) and the peak footprint is the live size plus
+ * one segment. Addresses are `Long`, so a buffer can exceed the 2 GB that
+ * an `Int` byte offset (and a single `LongArray`) can reach.
+ *
+ * Byte layout is the same as [PackedBuffer]: little-endian within each
+ * Long, byte `a` in bits `(a % 8) * 8` of word `a / 8`.
+ *
+ * ## Addressing
+ *
+ * ```
+ * word  = addr >>> 3
+ * seg   = word >>> log2(segmentBytes / 8)
+ * slot  = word & (segmentBytes / 8 − 1)
+ * ```
+ *
+ * Segment size is a power of two and a multiple of 8, so a naturally
+ * aligned access never crosses a segment and costs one segment lookup plus
+ * the [PackedBuffer] shift/mask. Only a misaligned access spanning two
+ * words resolves a second word (possibly in the next segment).
+ *
+ * Bulk transfers ([readLongs], [writeLongs], [fill], [copy]) run
+ * `LongArray.copyInto` / `fill` per segment-sized run on the aligned path.
+ *
+ * @param segmentBytes Bytes per segment: a power of two in
+ *   [MIN_SEGMENT_BYTES]..[MAX_SEGMENT_BYTES]
+ * @see PagedHeap For the allocator built on this buffer
+ */
+class SegmentedBuffer(val segmentBytes: Int = DEFAULT_SEGMENT_BYTES) {
+    init {
+        require(segmentBytes in MIN_SEGMENT_BYTES..MAX_SEGMENT_BYTES && segmentBytes.countOneBits() == 1) {
+            "segmentBytes must be a power of two in $MIN_SEGMENT_BYTES..$MAX_SEGMENT_BYTES, was $segmentBytes"
+        }
+    }
+
+    private val segmentWords = segmentBytes ushr 3
+    private val wordShift = segmentWords.countTrailingZeroBits()
+    private val slotMask = (segmentWords - 1).toLong()
+    private var segs: Array<LongArray> = emptyArray()
+
+    /** Number of allocated segments. */
+    val segmentCount: Int get() = segs.size
+
+    /** Capacity in bytes (segmentCount × segmentBytes). */
+    val capacity: Long get() = segs.size.toLong() * segmentBytes
+
+    /**
+     * Grow to at least [minBytes] by appending zeroed segments. Existing
+     * segments, and so every previously written byte, stay where they are.
+     */
+    fun ensure(minBytes: Long) {
+        if (minBytes <= capacity) return
+        val needed = (minBytes + segmentBytes - 1) / segmentBytes
+        require(needed <= Int.MAX_VALUE) { "SegmentedBuffer cannot address $minBytes bytes" }
+        val old = segs
+        segs = Array(needed.toInt()) { if (it < old.size) old[it] else LongArray(segmentWords) }
+    }
+
+    /** Drop all segments. */
+    fun clear() {
+        segs = emptyArray()
+    }
+
+    /** Backing words of segment [index], for bulk kernels that walk one segment at a time. */
+    internal fun segment(index: Int): LongArray = segs[index]
+
+    private fun word(w: Long): Long = segs[(w ushr wordShift).toInt()][(w and slotMask).toInt()]
+
+    private fun setWord(w: Long, v: Long) {
+        segs[(w ushr wordShift).toInt()][(w and slotMask).toInt()] = v
+    }
+
+    /** [bits] (8, 16, 32, 64) little-endian bits at [addr], zero-extended. */
+    private fun load(addr: Long, bits: Int): Long {
+        val w = addr ushr 3
+        val shift = (addr and 7L).toInt() shl 3
+        val lo = word(w) ushr shift
+        val v = if (shift + bits <= 64) lo else lo or (word(w + 1) shl (64 - shift))
+        return if (bits == 64) v else v and ((1L shl bits) - 1)
+    }
+
+    private fun store(addr: Long, value: Long, bits: Int) {
+        val w = addr ushr 3
+        val shift = (addr and 7L).toInt() shl 3
+        val mask = if (bits == 64) -1L else (1L shl bits) - 1
+        val v = value and mask
+        setWord(w, (word(w) and (mask shl shift).inv()) or (v shl shift))
+        if (shift + bits > 64) {
+            val back = 64 - shift
+            setWord(w + 1, (word(w + 1) and (mask ushr back).inv()) or (v ushr back))
+        }
+    }
+
+    // ========== Scalar Access (Little-Endian) ==========
+
+    /** Unsigned byte at [addr] (0..255). */
+    fun getByte(addr: Long): Int = load(addr, 8).toInt()
+
+    /** Store the low 8 bits of [value] at [addr]. */
+    fun setByte(addr: Long, value: Int) = store(addr, value.toLong(), 8)
+
+    fun getShort(addr: Long): Short = load(addr, 16).toInt().toShort()
+
+    fun setShort(addr: Long, value: Short) = store(addr, value.toLong(), 16)
+
+    fun getInt(addr: Long): Int = load(addr, 32).toInt()
+
+    fun setInt(addr: Long, value: Int) = store(addr, value.toLong(), 32)
+
+    fun getLong(addr: Long): Long {
+        if ((addr and 7L) == 0L) return word(addr ushr 3)
+        return load(addr, 64)
+    }
+
+    fun setLong(addr: Long, value: Long) {
+        if ((addr and 7L) == 0L) setWord(addr ushr 3, value) else store(addr, value, 64)
+    }
+
+    fun getFloat(addr: Long): Float = Float.fromBits(getInt(addr))
+    fun setFloat(addr: Long, value: Float) = setInt(addr, value.toRawBits())
+
+    fun getDouble(addr: Long): Double = Double.fromBits(getLong(addr))
+    fun setDouble(addr: Long, value: Double) = setLong(addr, value.toRawBits())
+
+    // ========== Bulk Transfer ==========
+
+    /** Read [n] longs at [addr] into `dst[off until off+n]`. */
+    fun readLongs(addr: Long, dst: LongArray, off: Int, n: Int) {
+        if ((addr and 7L) != 0L) {
+            for (i in 0 until n) dst[off + i] = load(addr + (i.toLong() shl 3), 64)
+            return
+        }
+        var w = addr ushr 3
+        var o = off
+        var rem = n
+        while (rem > 0) {
+            val slot = (w and slotMask).toInt()
+            val run = minOf(rem, segmentWords - slot)
+            segs[(w ushr wordShift).toInt()].copyInto(dst, o, slot, slot + run)
+            w += run
+            o += run
+            rem -= run
+        }
+    }
+
+    /** Write `src[off until off+n]` as longs at [addr]. */
+    fun writeLongs(addr: Long, src: LongArray, off: Int, n: Int) {
+        if ((addr and 7L) != 0L) {
+            for (i in 0 until n) store(addr + (i.toLong() shl 3), src[off + i], 64)
+            return
+        }
+        var w = addr ushr 3
+        var o = off
+        var rem = n
+        while (rem > 0) {
+            val slot = (w and slotMask).toInt()
+            val run = minOf(rem, segmentWords - slot)
+            src.copyInto(segs[(w ushr wordShift).toInt()], slot, o, o + run)
+            w += run
+            o += run
+            rem -= run
+        }
+    }
+
+    /** Read [n] floats at [addr] into `dst[off until off+n]`; two per word when 8-aligned. */
+    fun readFloats(addr: Long, dst: FloatArray, off: Int, n: Int) {
+        var a = addr
+        var o = off
+        var rem = n
+        if ((a and 7L) == 0L) {
+            while (rem >= 2) {
+                val v = word(a ushr 3)
+                dst[o] = Float.fromBits(v.toInt())
+                dst[o + 1] = Float.fromBits((v ushr 32).toInt())
+                a += 8
+                o += 2
+                rem -= 2
+            }
+        }
+        while (rem > 0) {
+            dst[o++] = getFloat(a)
+            a += 4
+            rem--
+        }
+    }
+
+    /** Write `src[off until off+n]` as floats at [addr]; two per word when 8-aligned. */
+    fun writeFloats(addr: Long, src: FloatArray, off: Int, n: Int) {
+        var a = addr
+        var o = off
+        var rem = n
+        if ((a and 7L) == 0L) {
+            while (rem >= 2) {
+                setWord(a ushr 3, (src[o].toRawBits().toLong() and 0xFFFFFFFFL) or (src[o + 1].toRawBits().toLong() shl 32))
+                a += 8
+                o += 2
+                rem -= 2
+            }
+        }
+        while (rem > 0) {
+            setFloat(a, src[o++])
+            a += 4
+            rem--
+        }
+    }
+
+    /** Fill [count] bytes at [addr] with the low 8 bits of [value]. */
+    fun fill(addr: Long, value: Int, count: Long) {
+        var a = addr
+        var rem = count
+        while (rem > 0 && (a and 7L) != 0L) {
+            setByte(a++, value)
+            rem--
+        }
+        val wordVal = (value.toLong() and 0xFF) * 0x0101010101010101L
+        var w = a ushr 3
+        var words = rem ushr 3
+        while (words > 0) {
+            val slot = (w and slotMask).toInt()
+            val run = minOf(words, (segmentWords - slot).toLong()).toInt()
+            segs[(w ushr wordShift).toInt()].fill(wordVal, slot, slot + run)
+            w += run
+            words -= run
+        }
+        a = w shl 3
+        rem = rem and 7L
+        while (rem > 0) {
+            setByte(a++, value)
+            rem--
+        }
+    }
+
+    /**
+     * Copy [count] bytes from [src] to [dst], overlap-safe. When both
+     * addresses share their offset within a word the body moves whole
+     * words with `copyInto`, one segment-bounded run at a time.
+     */
+    fun copy(dst: Long, src: Long, count: Long) {
+        if (count <= 0 || dst == src) return
+        val forward = dst < src || dst >= src + count
+        if (((dst xor src) and 7L) != 0L) {
+            if (forward) {
+                for (i in 0 until count) setByte(dst + i, getByte(src + i))
+            } else {
+                for (i in count - 1 downTo 0) setByte(dst + i, getByte(src + i))
+            }
+            return
+        }
+        val head = minOf(count, (8 - (src and 7L)) and 7L)
+        val words = (count - head) ushr 3
+        val tail = count - head - (words shl 3)
+        if (forward) {
+            for (i in 0 until head) setByte(dst + i, getByte(src + i))
+            copyWordRuns((dst + head) ushr 3, (src + head) ushr 3, words, true)
+            val t = head + (words shl 3)
+            for (i in 0 until tail) setByte(dst + t + i, getByte(src + t + i))
+        } else {
+            val t = head + (words shl 3)
+            for (i in tail - 1 downTo 0) setByte(dst + t + i, getByte(src + t + i))
+            copyWordRuns((dst + head) ushr 3, (src + head) ushr 3, words, false)
+            for (i in head - 1 downTo 0) setByte(dst + i, getByte(src + i))
+        }
+    }
+
+    private fun copyWordRuns(dstWord: Long, srcWord: Long, words: Long, forward: Boolean) {
+        var rem = words
+        if (forward) {
+            var d = dstWord
+            var s = srcWord
+            while (rem > 0) {
+                val ds = (d and slotMask).toInt()
+                val ss = (s and slotMask).toInt()
+                val run = minOf(rem, (segmentWords - maxOf(ds, ss)).toLong()).toInt()
+                segs[(s ushr wordShift).toInt()].copyInto(segs[(d ushr wordShift).toInt()], ds, ss, ss + run)
+                d += run
+                s += run
+                rem -= run
+            }
+        } else {
+            // Walk down from the end; each run stays inside one source and one destination segment
+            var dEnd = dstWord + words
+            var sEnd = srcWord + words
+            while (rem > 0) {
+                val ds = ((dEnd - 1) and slotMask).toInt() + 1
+                val ss = ((sEnd - 1) and slotMask).toInt() + 1
+                val run = minOf(rem, minOf(ds, ss).toLong()).toInt()
+                segs[((sEnd - 1) ushr wordShift).toInt()].copyInto(
+                    segs[((dEnd - 1) ushr wordShift).toInt()], ds - run, ss - run, ss,
+                )
+                dEnd -= run
+                sEnd -= run
+                rem -= run
+            }
+        }
+    }
+
+    companion object {
+        const val DEFAULT_SEGMENT_BYTES = 1 shl 20
+        const val MIN_SEGMENT_BYTES = 1 shl 12
+        const val MAX_SEGMENT_BYTES = 1 shl 30
+    }
+}
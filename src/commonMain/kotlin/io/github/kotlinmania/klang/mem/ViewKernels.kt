@@ -0,0 +1,206 @@
+package io.github.kotlinmania.klang.mem
+
+/**
+ * ViewKernels: word-streaming loops behind the bulk [U8View] / [U16View] /
+ * [U32View] operations.
+ *
+ * Callers validate the element range once; the loops then read
+ * [PackedBuffer.data] directly, one `Long` per 8, 4 or 2 lanes, instead of a
+ * bounds check and an address decode per element. Heads and tails that do
+ * not fill a word, and views whose base is not lane-aligned, take the
+ * per-element [PackedBuffer] accessors.
+ *
+ * ```
+ * lane k of word w (width b bits) = (w >>> (k * b)) & ((1 << b) − 1)
+ * ```
+ *
+ * The checksums are zlib-compatible: [adler32] is RFC 1950 Adler-32 with the
+ * NMAX = 5552 deferred modulo, and [crc32] is the reflected CRC-32
+ * (polynomial 0xEDB88320) computed slice-by-8, one table step per byte of a
+ * whole word.
+ *
+ * @native-bitshift-allowed Kernel layer for heap views; raw shifts permitted.
+ */
+@PublishedApi
+internal object ViewKernels {
+    private const val ADLER_MOD = 65521
+    private const val ADLER_NMAX = 5552
+
+    /** Slice-by-8 CRC-32 tables, table t at [t * 256]. */
+    private val CRC_TABLE = IntArray(8 * 256).also { t ->
+        for (i in 0 until 256) {
+            var c = i
+            repeat(8) { c = if ((c and 1) != 0) (c ushr 1) xor 0xEDB88320.toInt() else c ushr 1 }
+            t[i] = c
+        }
+        for (k in 1 until 8) {
+            for (i in 0 until 256) {
+                val prev = t[(k - 1) * 256 + i]
+                t[k * 256 + i] = (prev ushr 8) xor t[prev and 0xFF]
+            }
+        }
+    }
+
+    /** Fail once, up front, if `[addr, addr + bytes)` is not inside the heap. */
+    @PublishedApi
+    internal fun checkSpan(addr: Int, bytes: Int) {
+        require(addr >= 0 && bytes >= 0 && addr <= GlobalHeap.size - bytes) {
+            "View [$addr, ${addr.toLong() + bytes}) is outside the heap (size ${GlobalHeap.size})"
+        }
+    }
+
+    @PublishedApi
+    internal fun load(buf: PackedBuffer, addr: Int, laneBytes: Int): Int = when (laneBytes) {
+        1 -> buf.getByte(addr)
+        2 -> buf.getShort(addr).toInt() and 0xFFFF
+        else -> buf.getInt(addr)
+    }
+
+    @PublishedApi
+    internal fun store(buf: PackedBuffer, addr: Int, laneBytes: Int, v: Int) = when (laneBytes) {
+        1 -> buf.setByte(addr, v)
+        2 -> buf.setShort(addr, v.toShort())
+        else -> buf.setInt(addr, v)
+    }
+
+    /**
+     * Call [action] with each lane index in `[0, count)` and its unsigned
+     * value (32-bit lanes as raw Int bits), streaming whole words.
+     */
+    @PublishedApi
+    internal inline fun forEachLane(addr: Int, count: Int, laneBytes: Int, action: (i: Int, v: Int) -> Unit) {
+        val buf = GlobalHeap.packed
+        var i = 0
+        var a = addr
+        if ((a and (laneBytes - 1)) == 0) {
+            while (i < count && (a and 7) != 0) {
+                action(i++, load(buf, a, laneBytes))
+                a += laneBytes
+            }
+            val d = buf.data
+            val bits = laneBytes shl 3
+            val lanes = 8 / laneBytes
+            val mask = if (laneBytes == 4) -1L else (1L shl bits) - 1
+            while (count - i >= lanes) {
+                val w = d[a ushr 3]
+                for (k in 0 until lanes) action(i + k, ((w ushr (k * bits)) and mask).toInt())
+                i += lanes
+                a += 8
+            }
+        }
+        while (i < count) {
+            action(i++, load(buf, a, laneBytes))
+            a += laneBytes
+        }
+    }
+
+    /** Replace each lane in `[0, count)` with [transform] of its index and value (low bits kept). */
+    @PublishedApi
+    internal inline fun mapLanes(addr: Int, count: Int, laneBytes: Int, transform: (i: Int, v: Int) -> Int) {
+        val buf = GlobalHeap.packed
+        var i = 0
+        var a = addr
+        if ((a and (laneBytes - 1)) == 0) {
+            while (i < count && (a and 7) != 0) {
+                store(buf, a, laneBytes, transform(i, load(buf, a, laneBytes)))
+                i++
+                a += laneBytes
+            }
+            val d = buf.data
+            val bits = laneBytes shl 3
+            val lanes = 8 / laneBytes
+            val mask = if (laneBytes == 4) 0xFFFFFFFFL else (1L shl bits) - 1
+            while (count - i >= lanes) {
+                val idx = a ushr 3
+                val w = d[idx]
+                var out = 0L
+                for (k in 0 until lanes) {
+                    val sh = k * bits
+                    out = out or ((transform(i + k, ((w ushr sh) and mask).toInt()).toLong() and mask) shl sh)
+                }
+                d[idx] = out
+                i += lanes
+                a += 8
+            }
+        }
+        while (i < count) {
+            store(buf, a, laneBytes, transform(i, load(buf, a, laneBytes)))
+            i++
+            a += laneBytes
+        }
+    }
+
+    /** Unsigned lane sum. */
+    fun sum(addr: Int, count: Int, laneBytes: Int): Long {
+        var s = 0L
+        val mask = if (laneBytes == 4) 0xFFFFFFFFL else -1L
+        forEachLane(addr, count, laneBytes) { _, v -> s += v.toLong() and mask }
+        return s
+    }
+
+    /** XOR of all lanes. */
+    fun xor(addr: Int, count: Int, laneBytes: Int): Int {
+        var x = 0
+        forEachLane(addr, count, laneBytes) { _, v -> x = x xor v }
+        return x
+    }
+
+    /** Copy lanes to `dst[off, off + count)`, zero-extended (32-bit lanes as raw bits). */
+    fun copyLanes(addr: Int, count: Int, laneBytes: Int, dst: IntArray, off: Int) {
+        if (laneBytes == 4) {
+            GlobalHeap.packed.readInts(addr, dst, off, count)
+            return
+        }
+        forEachLane(addr, count, laneBytes) { i, v -> dst[off + i] = v }
+    }
+
+    /** Adler-32 of [count] bytes at [addr], continuing from [adler] (1 for a fresh checksum). */
+    fun adler32(adler: Int, addr: Int, count: Int): Int {
+        var a = (adler and 0xFFFF).toLong()
+        var b = (adler ushr 16).toLong()
+        var done = 0
+        while (done < count) {
+            val n = minOf(ADLER_NMAX, count - done)
+            forEachLane(addr + done, n, 1) { _, v ->
+                a += v
+                b += a
+            }
+            a %= ADLER_MOD
+            b %= ADLER_MOD
+            done += n
+        }
+        return ((b shl 16) or a).toInt()
+    }
+
+    /** CRC-32 of [count] bytes at [addr], continuing from [crc] (0 for a fresh checksum). */
+    fun crc32(crc: Int, addr: Int, count: Int): Int {
+        val t = CRC_TABLE
+        val buf = GlobalHeap.packed
+        var c = crc.inv()
+        var a = addr
+        var rem = count
+        while (rem > 0 && (a and 7) != 0) {
+            c = (c ushr 8) xor t[(c xor buf.getByte(a)) and 0xFF]
+            a++
+            rem--
+        }
+        val d = buf.data
+        while (rem >= 8) {
+            val w = d[a ushr 3]
+            val lo = c xor w.toInt()
+            val hi = (w ushr 32).toInt()
+            c = t[7 * 256 + (lo and 0xFF)] xor t[6 * 256 + ((lo ushr 8) and 0xFF)] xor
+                t[5 * 256 + ((lo ushr 16) and 0xFF)] xor t[4 * 256 + (lo ushr 24)] xor
+                t[3 * 256 + (hi and 0xFF)] xor t[2 * 256 + ((hi ushr 8) and 0xFF)] xor
+                t[256 + ((hi ushr 16) and 0xFF)] xor t[hi ushr 24]
+            a += 8
+            rem -= 8
+        }
+        while (rem > 0) {
+            c = (c ushr 8) xor t[(c xor buf.getByte(a)) and 0xFF]
+            a++
+            rem--
+        }
+        return c.inv()
+    }
+}
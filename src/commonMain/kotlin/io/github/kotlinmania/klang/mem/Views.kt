@@ -31,6 +31,16 @@ import io.github.kotlinmania.klang.bitwise.BitShiftConfig
  * [IllegalArgumentException]. For performance-critical code that has already
  * validated indices, consider using [GlobalHeap] directly.
  *
+ * ## Bulk Operations
+ *
+ * `forEachIndexed`, `mapInPlace`, `copyTo(IntArray)` and the `sum` / `xor`
+ * (and, on [U8View], `adler32` / `crc32`) reductions check the view against
+ * the heap once and then stream [PackedBuffer] words (see [ViewKernels]),
+ * so a loop over a view costs no per-element bounds check or address
+ * decode. `unsafeGet` / `unsafeSet` skip the index check for audited inner
+ * loops; an index outside the view reads or writes whatever heap memory
+ * lies there.
+ *
  * ## Use Cases
  *
  * - **Structured data**: Treating raw memory as typed arrays
@@ -96,6 +106,43 @@ data class U8View(val base: Int, val length: Int) {
      * @throws IllegalArgumentException if slice parameters are invalid.
      */
     fun slice(offset: Int, len: Int): U8View { require(offset>=0 && len>=0 && offset+len<=length); return U8View(base+offset,len) }
+
+    /** Unsigned byte at [i] without the index check. The caller guarantees `i in 0 until length`. */
+    fun unsafeGet(i: Int): Int = GlobalHeap.lbu(base + i)
+
+    /** Store the low byte of [v] at [i] without the index check. */
+    fun unsafeSet(i: Int, v: Int) = GlobalHeap.sb(base + i, v.toByte())
+
+    /** Call [action] with every index and unsigned byte, in order. */
+    inline fun forEachIndexed(action: (index: Int, value: Int) -> Unit) {
+        ViewKernels.checkSpan(base, length)
+        ViewKernels.forEachLane(base, length, 1, action)
+    }
+
+    /** Replace every byte with the low 8 bits of [transform] applied to it. */
+    inline fun mapInPlace(transform: (value: Int) -> Int) {
+        ViewKernels.checkSpan(base, length)
+        ViewKernels.mapLanes(base, length, 1) { _, v -> transform(v) }
+    }
+
+    /** Copy the bytes, zero-extended, into `dst[dstOffset, dstOffset + length)`. */
+    fun copyTo(dst: IntArray, dstOffset: Int = 0) {
+        require(dstOffset >= 0 && dstOffset <= dst.size - length)
+        ViewKernels.checkSpan(base, length)
+        ViewKernels.copyLanes(base, length, 1, dst, dstOffset)
+    }
+
+    /** Sum of the unsigned bytes. */
+    fun sum(): Long { ViewKernels.checkSpan(base, length); return ViewKernels.sum(base, length, 1) }
+
+    /** XOR of all bytes (0..255). */
+    fun xor(): Int { ViewKernels.checkSpan(base, length); return ViewKernels.xor(base, length, 1) }
+
+    /** zlib `adler32(adler, view)`: Adler-32 continuing from [adler] (1 to start). */
+    fun adler32(adler: Int = 1): Int { ViewKernels.checkSpan(base, length); return ViewKernels.adler32(adler, base, length) }
+
+    /** zlib `crc32(crc, view)`: CRC-32 continuing from [crc] (0 to start). */
+    fun crc32(crc: Int = 0): Int { ViewKernels.checkSpan(base, length); return ViewKernels.crc32(crc, base, length) }
 }
 
 /**
@@ -153,6 +200,37 @@ data class U16View(val base: Int, val limbCount: Int) {
      * @throws IllegalArgumentException if slice parameters are invalid.
      */
     fun slice(offset: Int, len: Int): U16View { require(offset>=0 && len>=0 && offset+len<=limbCount); return U16View(base+offset*2, len) }
+
+    /** Unsigned 16-bit limb at [i] without the index check. The caller guarantees `i in 0 until limbCount`. */
+    fun unsafeGet(i: Int): Int = GlobalHeap.lh(base + i * 2).toInt() and 0xFFFF
+
+    /** Store the low 16 bits of [v] at limb [i] without the index check. */
+    fun unsafeSet(i: Int, v: Int) = GlobalHeap.sh(base + i * 2, v.toShort())
+
+    /** Call [action] with every index and unsigned limb, in order. */
+    inline fun forEachIndexed(action: (index: Int, value: Int) -> Unit) {
+        ViewKernels.checkSpan(base, limbCount * 2)
+        ViewKernels.forEachLane(base, limbCount, 2, action)
+    }
+
+    /** Replace every limb with the low 16 bits of [transform] applied to it. */
+    inline fun mapInPlace(transform: (value: Int) -> Int) {
+        ViewKernels.checkSpan(base, limbCount * 2)
+        ViewKernels.mapLanes(base, limbCount, 2) { _, v -> transform(v) }
+    }
+
+    /** Copy the limbs, zero-extended, into `dst[dstOffset, dstOffset + limbCount)`. */
+    fun copyTo(dst: IntArray, dstOffset: Int = 0) {
+        require(dstOffset >= 0 && dstOffset <= dst.size - limbCount)
+        ViewKernels.checkSpan(base, limbCount * 2)
+        ViewKernels.copyLanes(base, limbCount, 2, dst, dstOffset)
+    }
+
+    /** Sum of the unsigned limbs. */
+    fun sum(): Long { ViewKernels.checkSpan(base, limbCount * 2); return ViewKernels.sum(base, limbCount, 2) }
+
+    /** XOR of all limbs (0..65535). */
+    fun xor(): Int { ViewKernels.checkSpan(base, limbCount * 2); return ViewKernels.xor(base, limbCount, 2) }
 }
 
 /**
@@ -197,5 +275,36 @@ data class U32View(val base: Int, val wordCount: Int) {
      * @throws IllegalArgumentException if slice parameters are invalid.
      */
     fun slice(offset: Int, len: Int): U32View { require(offset>=0 && len>=0 && offset+len<=wordCount); return U32View(base+offset*4, len) }
+
+    /** 32-bit word at [i] without the index check. The caller guarantees `i in 0 until wordCount`. */
+    fun unsafeGet(i: Int): Int = GlobalHeap.lw(base + i * 4)
+
+    /** Store [v] at word [i] without the index check. */
+    fun unsafeSet(i: Int, v: Int) = GlobalHeap.sw(base + i * 4, v)
+
+    /** Call [action] with every index and word, in order. */
+    inline fun forEachIndexed(action: (index: Int, value: Int) -> Unit) {
+        ViewKernels.checkSpan(base, wordCount * 4)
+        ViewKernels.forEachLane(base, wordCount, 4, action)
+    }
+
+    /** Replace every word with [transform] applied to it. */
+    inline fun mapInPlace(transform: (value: Int) -> Int) {
+        ViewKernels.checkSpan(base, wordCount * 4)
+        ViewKernels.mapLanes(base, wordCount, 4) { _, v -> transform(v) }
+    }
+
+    /** Copy the words into `dst[dstOffset, dstOffset + wordCount)`. */
+    fun copyTo(dst: IntArray, dstOffset: Int = 0) {
+        require(dstOffset >= 0 && dstOffset <= dst.size - wordCount)
+        ViewKernels.checkSpan(base, wordCount * 4)
+        ViewKernels.copyLanes(base, wordCount, 4, dst, dstOffset)
+    }
+
+    /** Sum of the words read as unsigned 32-bit values. */
+    fun sum(): Long { ViewKernels.checkSpan(base, wordCount * 4); return ViewKernels.sum(base, wordCount, 4) }
+
+    /** XOR of all words. */
+    fun xor(): Int { ViewKernels.checkSpan(base, wordCount * 4); return ViewKernels.xor(base, wordCount, 4) }
 }
 
@@ -18,6 +18,8 @@ import kotlin.math.min
  * - **Limb conversion**: Converts between hex strings and 16-bit limb arrays (little-endian)
  * - **Arbitrary precision**: No fixed width limits, handles integers of any size
  * - **Table-driven shifts**: Uses precomputed lookup tables for efficient nibble-level operations
+ * - **Limb path**: [LimbBuffer] parses once, shifts 16-bit limbs with
+ *   [io.github.kotlinmania.klang.bitwise.ArrayBitShifts], and formats only on output
  *
  * ## Use Cases
  *
@@ -30,6 +32,7 @@ import kotlin.math.min
  * @see rightShiftHexString
  * @see limbsToHex
  * @see hexToLimbs
+ * @see LimbBuffer
  */
 
 /**
@@ -94,15 +97,43 @@ private fun buildRightNibbleTable(r: Int): Array<NibbleShift> {
     return table
 }
 
-/**
- * Removes leading zeros from a hex string, preserving "0" for zero values.
- *
- * @param hex The hex string to trim.
- * @return The hex string without leading zeros, or "0" if all zeros.
- */
-private fun trimLeadingZeros(hex: String): String {
-    val h = hex.trimStart('0')
-    return if (h.isEmpty()) "0" else h
+/** Left/right nibble tables for r = 1..3, built once on first use (index 0 is unused). */
+private val leftNibbleTables: Array<Array<NibbleShift>> by lazy {
+    Array(4) { r -> if (r == 0) emptyArray() else buildLeftNibbleTable(r) }
+}
+private val rightNibbleTables: Array<Array<NibbleShift>> by lazy {
+    Array(4) { r -> if (r == 0) emptyArray() else buildRightNibbleTable(r) }
+}
+
+private const val HEX_CHARS = "0123456789abcdef"
+
+/** Digit value of ASCII code c, or -1 if c is not a hex digit (either case). */
+private val HEX_VALUE = IntArray(128) { c ->
+    when (c.toChar()) {
+        in '0'..'9' -> c - '0'.code
+        in 'a'..'f' -> c - 'a'.code + 10
+        in 'A'..'F' -> c - 'A'.code + 10
+        else -> -1
+    }
+}
+
+/** Two lowercase hex characters per byte value, pair b at [2 * b]. */
+private val HEX_PAIRS = CharArray(512) { i -> if (i % 2 == 0) HEX_CHARS[i / 32] else HEX_CHARS[(i / 2) % 16] }
+
+/** Value of the hex digit at [hex][i]; throws [NumberFormatException] on anything else. */
+private fun hexDigit(hex: String, i: Int): Int {
+    val c = hex[i].code
+    val v = if (c < 128) HEX_VALUE[c] else -1
+    if (v < 0) throw NumberFormatException("Invalid hex digit '${hex[i]}' at $i in \"$hex\"")
+    return v
+}
+
+/** Index of the first significant digit in hex[from, end): skips a "0x"/"0X" prefix and leading zeros. */
+private fun firstSignificant(hex: String, from: Int, end: Int): Int {
+    var i = from
+    if (end - i >= 2 && hex[i] == '0' && (hex[i + 1] == 'x' || hex[i + 1] == 'X')) i += 2
+    while (i < end && hex[i] == '0') i++
+    return i
 }
 
 /**
@@ -114,40 +145,70 @@ private fun trimLeadingZeros(hex: String): String {
  * @param limbs The limb array to convert (16-bit values, little-endian).
  * @return A lowercase hex string with no leading zeros (except "0" for zero).
  */
-fun limbsToHex(limbs: IntArray): String {
-    if (limbs.isEmpty()) return "0"
-    val sb = StringBuilder(limbs.size * 4)
-    for (i in limbs.indices.reversed()) {
+fun limbsToHex(limbs: IntArray): String = limbsToHex(limbs, limbs.size)
+
+/**
+ * Converts the low [count] limbs of [limbs] (little-endian) to a hexadecimal string.
+ *
+ * Each limb is formatted as four characters at once from a byte-pair table,
+ * into a single output buffer.
+ *
+ * @param limbs The limb array to convert (16-bit values, little-endian).
+ * @param count Number of limbs to format, from index 0.
+ * @return A lowercase hex string with no leading zeros (except "0" for zero).
+ */
+fun limbsToHex(limbs: IntArray, count: Int): String {
+    require(count in 0..limbs.size) { "count $count outside 0..${limbs.size}" }
+    var top = count - 1
+    while (top >= 0 && (limbs[top] and 0xFFFF) == 0) top--
+    if (top < 0) return "0"
+    val out = CharArray((top + 1) * 4)
+    var p = 0
+    for (i in top downTo 0) {
         val v = limbs[i] and 0xFFFF
-        val chunk = v.toString(16).padStart(4, '0')
-        sb.append(chunk)
+        val hi = (v / 256) * 2
+        val lo = (v and 0xFF) * 2
+        out[p] = HEX_PAIRS[hi]
+        out[p + 1] = HEX_PAIRS[hi + 1]
+        out[p + 2] = HEX_PAIRS[lo]
+        out[p + 3] = HEX_PAIRS[lo + 1]
+        p += 4
     }
-    return trimLeadingZeros(sb.toString().lowercase())
+    var lead = 0
+    while (lead < 3 && out[lead] == '0') lead++
+    return out.concatToString(lead, out.size)
 }
 
 /**
  * Parses a hexadecimal string into an array of 16-bit limbs (little-endian).
  *
  * The input hex string is MSB-first, but the output limbs are stored in
- * little-endian order (least significant limb at index 0).
+ * little-endian order (least significant limb at index 0). Digits are read
+ * in place, four per limb, without intermediate strings.
  *
  * @param hexIn The hex string to parse (may have "0x" prefix, case-insensitive).
  * @return An array of 16-bit limbs representing the value.
+ * @throws NumberFormatException if a character is not a hex digit.
  */
 fun hexToLimbs(hexIn: String): IntArray {
-    var hex = hexIn.lowercase().trim()
-    if (hex.startsWith("0x")) hex = hex.substring(2)
-    hex = trimLeadingZeros(hex)
-    if (hex == "0") return intArrayOf(0)
-    val limbCount = (hex.length + 3) / 4
-    val limbs = IntArray(limbCount)
-    var idx = hex.length
+    var start = 0
+    var end = hexIn.length
+    while (start < end && hexIn[start].isWhitespace()) start++
+    while (end > start && hexIn[end - 1].isWhitespace()) end--
+    start = firstSignificant(hexIn, start, end)
+    if (start == end) return intArrayOf(0)
+    val limbs = IntArray((end - start + 3) / 4)
+    var idx = end
     var li = 0
-    while (idx > 0) {
-        val start = (idx - 4).coerceAtLeast(0)
-        val slice = hex.substring(start, idx)
-        limbs[li++] = slice.toInt(16)
-        idx = start
+    while (idx - start >= 4) {
+        limbs[li++] = hexDigit(hexIn, idx - 4) * 4096 + hexDigit(hexIn, idx - 3) * 256 +
+            hexDigit(hexIn, idx - 2) * 16 + hexDigit(hexIn, idx - 1)
+        idx -= 4
+    }
+    if (idx > start) {
+        var v = 0
+        for (k in start until idx) v = v * 16 + hexDigit(hexIn, k)
+        limbs[li] = v
     }
     return limbs
 }
@@ -165,31 +226,39 @@ fun hexToLimbs(hexIn: String): IntArray {
  * 2. Handle remaining bit shifts (s % 4) using nibble lookup tables
  * 3. Propagate carries from LSB to MSB
  *
+ * The result is written right to left into one buffer. For repeated shifts
+ * of the same value, use [LimbBuffer] instead.
+ *
  * @param hexIn The input hex string (case-insensitive, may have "0x" prefix).
  * @param s The number of bits to shift left (must be non-negative).
  * @return The shifted hex string (lowercase, no leading zeros except "0").
  */
 fun leftShiftHexString(hexIn: String, s: Int): String {
     require(s >= 0)
-    val hex0 = trimLeadingZeros(hexIn.lowercase())
-    if (hex0 == "0" || s == 0) return hex0
+    val start = firstSignificant(hexIn, 0, hexIn.length)
+    val len = hexIn.length - start
+    if (len == 0) return "0"
     val q = s / 4
     val r = s % 4
-    val base = if (q > 0) hex0 + "0".repeat(q) else hex0
-    if (r == 0) return base
+    val out = CharArray(len + q + 1)
+    var p = out.size
+    repeat(q) { out[--p] = '0' }
 
-    val table = buildLeftNibbleTable(r)
-    val sb = StringBuilder(base.length + 1)
+    val table = if (r == 0) null else leftNibbleTables[r]
     var carry = 0
     // process from LSB nibble (rightmost) to MSB
-    for (i in base.lastIndex downTo 0) {
-        val nibble = base[i].digitToInt(16)
-        val entry = table[carry * 16 + nibble]
-        sb.append(entry.out)
-        carry = entry.carry
+    for (i in hexIn.lastIndex downTo start) {
+        val nibble = hexDigit(hexIn, i)
+        if (table == null) {
+            out[--p] = HEX_CHARS[nibble]
+        } else {
+            val entry = table[carry * 16 + nibble]
+            out[--p] = entry.out
+            carry = entry.carry
+        }
     }
-    if (carry != 0) sb.append(carry.toString(16))
-    return trimLeadingZeros(sb.reverse().toString())
+    if (carry != 0) out[--p] = HEX_CHARS[carry]
+    return out.concatToString(p, out.size)
 }
 
 /**
@@ -211,24 +280,28 @@ fun leftShiftHexString(hexIn: String, s: Int): String {
  */
 fun rightShiftHexString(hexIn: String, s: Int): String {
     require(s >= 0)
-    val hex0 = trimLeadingZeros(hexIn.lowercase())
-    if (hex0 == "0" || s == 0) return hex0
+    val start = firstSignificant(hexIn, 0, hexIn.length)
     val q = s / 4
     val r = s % 4
-    if (hex0.length <= q) return "0"
-    val base = if (q > 0) hex0.substring(0, hex0.length - q) else hex0
-    if (r == 0) return trimLeadingZeros(base)
+    val keep = hexIn.length - start - q
+    if (keep <= 0) return "0"
 
-    val table = buildRightNibbleTable(r)
-    val sb = StringBuilder(base.length)
+    val table = if (r == 0) null else rightNibbleTables[r]
+    val out = CharArray(keep)
     var carry = 0
     // process from MSB nibble (leftmost) to LSB
-    for (i in 0 until base.length) {
-        val nibble = base[i].digitToInt(16)
-        val entry = table[carry * 16 + nibble]
-        sb.append(entry.out)
-        carry = entry.carry
+    for (k in 0 until keep) {
+        val nibble = hexDigit(hexIn, start + k)
+        if (table == null) {
+            out[k] = HEX_CHARS[nibble]
+        } else {
+            val entry = table[carry * 16 + nibble]
+            out[k] = entry.out
+            carry = entry.carry
+        }
     }
-    return trimLeadingZeros(sb.toString())
+    var p = 0
+    while (p < keep - 1 && out[p] == '0') p++
+    return out.concatToString(p, keep)
 }
 
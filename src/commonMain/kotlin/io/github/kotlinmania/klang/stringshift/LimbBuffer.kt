@@ -0,0 +1,145 @@
+package io.github.kotlinmania.klang.stringshift
+
+import io.github.kotlinmania.klang.bitwise.ArrayBitShifts
+
+/**
+ * LimbBuffer: growable arbitrary-precision unsigned integer held as 16-bit
+ * limbs (little-endian, one limb per Int), for chains of shifts between a
+ * hex parse and a hex format.
+ *
+ * [leftShiftHexString] / [rightShiftHexString] rebuild a string per call.
+ * A LimbBuffer parses once with [hexToLimbs], shifts in place with
+ * [ArrayBitShifts] (a limb move for whole 16-bit steps, one funnel pass for
+ * the rest), and formats with [limbsToHex] only when [toHex] is called.
+ * Storage grows as left shifts need it and is reused afterwards, so a
+ * sequence of shifts allocates nothing once the buffer is large enough.
+ *
+ * ```kotlin
+ * val v = LimbBuffer.fromHex("0x1f")
+ * v.shl(130).shr(3)
+ * v.toHex()  // "f8" followed by 31 zeros, same as the two string shifts
+ * ```
+ *
+ * The value is kept normalized: [size] counts limbs up to the most
+ * significant non-zero one, and is 1 for zero.
+ */
+class LimbBuffer private constructor(private var limbs: IntArray, size: Int) {
+    /** Limbs in use, little-endian. Always at least 1. */
+    var size: Int = size
+        private set
+
+    /** Zero, with room for [capacity] limbs before the first resize. */
+    constructor(capacity: Int = 8) : this(IntArray(capacity.coerceAtLeast(1)), 1)
+
+    init {
+        normalize()
+    }
+
+    /** Limb [i] (0..0xFFFF); 0 above [size]. */
+    operator fun get(i: Int): Int {
+        require(i >= 0) { "limb index $i < 0" }
+        return if (i < size) limbs[i] else 0
+    }
+
+    val isZero: Boolean get() = size == 1 && limbs[0] == 0
+
+    /** Number of significant bits (0 for zero). */
+    val bitLength: Int
+        get() {
+            val top = limbs[size - 1]
+            return if (top == 0) 0 else (size - 1) * 16 + 32 - top.countLeadingZeroBits()
+        }
+
+    /** Replace the value with the one parsed from [hex] (see [hexToLimbs]). */
+    fun setHex(hex: String): LimbBuffer {
+        val parsed = hexToLimbs(hex)
+        ensureCapacity(parsed.size)
+        parsed.copyInto(limbs)
+        size = parsed.size
+        normalize()
+        return this
+    }
+
+    /** Multiply by 2^[s] in place. */
+    fun shl(s: Int): LimbBuffer {
+        require(s >= 0) { "shift $s < 0" }
+        if (s == 0 || isZero) return this
+        val words = s / 16
+        val bits = s % 16
+        val newSize = size + words + (if (bits != 0) 1 else 0)
+        ensureCapacity(newSize)
+        limbs.fill(0, size, newSize)
+        ArrayBitShifts.shl16LEWordsInPlace(limbs, 0, size + words, words)
+        // The extra top limb is zero going in, so it receives every bit that leaves the old top
+        if (bits != 0) ArrayBitShifts.shl16LEInPlace(limbs, 0, newSize, bits)
+        size = newSize
+        normalize()
+        return this
+    }
+
+    /** Divide by 2^[s] in place, discarding the bits shifted out. */
+    fun shr(s: Int): LimbBuffer {
+        require(s >= 0) { "shift $s < 0" }
+        if (s == 0 || isZero) return this
+        val words = s / 16
+        val bits = s % 16
+        if (words >= size) return clear()
+        ArrayBitShifts.rsh16LEWordsInPlace(limbs, 0, size, words)
+        size -= words
+        if (bits != 0) ArrayBitShifts.rsh16LEInPlace(limbs, 0, size, bits)
+        normalize()
+        return this
+    }
+
+    /** Set the value to zero, keeping the storage. */
+    fun clear(): LimbBuffer {
+        limbs[0] = 0
+        size = 1
+        return this
+    }
+
+    /** Lowercase hex, no leading zeros ("0" for zero); formats [size] limbs. */
+    fun toHex(): String = limbsToHex(limbs, size)
+
+    /** The [size] limbs as a new array, in the [hexToLimbs] layout. */
+    fun toLimbs(): IntArray = limbs.copyOf(size)
+
+    fun copy(): LimbBuffer = LimbBuffer(limbs.copyOf(size), size)
+
+    override fun equals(other: Any?): Boolean {
+        if (this === other) return true
+        if (other !is LimbBuffer || other.size != size) return false
+        for (i in 0 until size) if (limbs[i] != other.limbs[i]) return false
+        return true
+    }
+
+    override fun hashCode(): Int {
+        var h = size
+        for (i in 0 until size) h = h * 31 + limbs[i]
+        return h
+    }
+
+    override fun toString(): String = "LimbBuffer(0x${toHex()})"
+
+    private fun ensureCapacity(n: Int) {
+        if (n > limbs.size) limbs = limbs.copyOf(maxOf(n, limbs.size * 2))
+    }
+
+    private fun normalize() {
+        while (size > 1 && limbs[size - 1] == 0) size--
+    }
+
+    companion object {
+        /** Parse [hex] (optional "0x", either case) once into a new buffer. */
+        fun fromHex(hex: String): LimbBuffer {
+            val parsed = hexToLimbs(hex)
+            return LimbBuffer(parsed, parsed.size)
+        }
+
+        /** Wrap a copy of 16-bit little-endian [limbs] (each masked to 0..0xFFFF). */
+        fun fromLimbs(limbs: IntArray): LimbBuffer {
+            if (limbs.isEmpty()) return LimbBuffer()
+            return LimbBuffer(IntArray(limbs.size) { limbs[it] and 0xFFFF }, limbs.size)
+        }
+    }
+}
@@ -0,0 +1,118 @@
+package io.github.kotlinmania.klang.bitwise
+
+import io.github.kotlinmania.klang.mem.GlobalHeap
+import io.github.kotlinmania.klang.mem.KMalloc
+import kotlinx.coroutines.test.runTest
+import kotlin.random.Random
+import kotlin.test.BeforeTest
+import kotlin.test.Test
+import kotlin.test.assertEquals
+
+class ArrayBitShiftsPackedWordTest {
+    @BeforeTest
+    fun setup() {
+        KMalloc.init(1 shl 18)
+    }
+
+    private fun limbs(rnd: Random, n: Int) = IntArray(n) { rnd.nextInt() and 0xFFFF }
+
+    @Test
+    fun shl64MatchesSixteenBitLimbs() {
+        val rnd = Random(0x5EED)
+        repeat(20) {
+            val n = 4 * (1 + rnd.nextInt(12))
+            val a = limbs(rnd, n)
+            val s = 1 + rnd.nextInt(15)
+            val carryIn = rnd.nextInt() and 0xFFFF
+            val words = LongArray(n / 4)
+            ArrayBitShifts.pack16To64(a, 0, n, words)
+            val r16 = ArrayBitShifts.shl16LEInPlace(a, 0, n, s, carryIn)
+            val r64 = ArrayBitShifts.shl64LEInPlace(words, 0, words.size, s, carryIn.toLong() and 0xFFFFL)
+            val back = IntArray(n)
+            ArrayBitShifts.unpack64To16(words, 0, back, 0, n)
+            assertEquals(a.toList(), back.toList(), "s=$s")
+            assertEquals(r16.carryOut.toLong(), r64.carryOut, "carry s=$s")
+        }
+    }
+
+    @Test
+    fun zeroShiftPassesCarryThrough() {
+        val w = intArrayOf(0x12345678, -1)
+        assertEquals(ArrayBitShifts.ShiftResult(0x5A5A, false), ArrayBitShifts.shl16LEInPlace(intArrayOf(1, 2), 0, 2, 0, 0x5A5A))
+        assertEquals(ArrayBitShifts.ShiftResult(0x7EADBEEF, false), ArrayBitShifts.shl32LEInPlace(w, 0, 2, 0, 0x7EADBEEF))
+        assertEquals(listOf(0x12345678, -1), w.toList())
+        val l = longArrayOf(1L, -2L)
+        assertEquals(ArrayBitShifts.WordShiftResult(-0x123456789AL, false), ArrayBitShifts.shl64LEInPlace(l, 0, 2, 0, -0x123456789AL))
+        assertEquals(listOf(1L, -2L), l.toList())
+    }
+
+    @Test
+    fun parallelZeroShiftPassesCarryThrough() = runTest {
+        val l = LongArray(1 shl 16) { it.toLong() }
+        assertEquals(ArrayBitShifts.WordShiftResult(77L, false), ArrayBitShifts.shl64LEInPlaceParallel(l, 0, l.size, 0, 77L))
+        assertEquals(3L, l[3])
+    }
+
+    @Test
+    fun rsh32MatchesSixteenBitLimbs() {
+        val rnd = Random(0xBEEF)
+        repeat(20) {
+            val n = 2 * (1 + rnd.nextInt(12))
+            val a = limbs(rnd, n)
+            val s = 1 + rnd.nextInt(15)
+            val words = IntArray(n / 2)
+            ArrayBitShifts.pack16To32(a, 0, n, words)
+            val r16 = ArrayBitShifts.rsh16LEInPlace(a, 0, n, s)
+            val r32 = ArrayBitShifts.rsh32LEInPlace(words, 0, words.size, s)
+            val back = IntArray(n)
+            ArrayBitShifts.unpack32To16(words, 0, back, 0, n)
+            assertEquals(a.toList(), back.toList(), "s=$s")
+            assertEquals(r16.carryOut, r32.carryOut, "carry s=$s")
+        }
+    }
+
+    @Test
+    fun wideShiftsRoundTrip() {
+        val rnd = Random(42)
+        val orig = LongArray(9) { rnd.nextLong() }
+        for (s in intArrayOf(1, 17, 31, 32, 33, 63)) {
+            val a = orig.copyOf(10)
+            a[9] = 0L
+            val out = ArrayBitShifts.shl64LEInPlace(a, 0, 10, s)
+            assertEquals(0L, out.carryOut)
+            val r = ArrayBitShifts.rsh64LEInPlace(a, 0, 10, s)
+            assertEquals(0L, r.carryOut)
+            assertEquals(orig.toList(), a.copyOf(9).toList(), "s=$s")
+        }
+        val w = intArrayOf(0x80000001.toInt(), 0x7FFFFFFF)
+        val r = ArrayBitShifts.shl32LEInPlace(w, 0, 2, 1, 1)
+        assertEquals(listOf(3, 0xFFFFFFFF.toInt()), w.toList())
+        assertEquals(0, r.carryOut)
+    }
+
+    @Test
+    fun heapWordPathMatchesIntArrayAtEveryAlignment() {
+        val rnd = Random(7)
+        for (misalign in 0 until 8) {
+            val len = 13 + misalign
+            val a = limbs(rnd, len)
+            val b = a.copyOf()
+            val base = KMalloc.malloc(len * 2 + 16) + misalign
+            for (i in 0 until len) GlobalHeap.sh(base + i * 2, a[i].toShort())
+            val s = 1 + rnd.nextInt(15)
+            val rl = ArrayBitShifts.shl16LEInPlace(a, 0, len, s, 0x5A5A)
+            val hl = ArrayBitShifts.shl16LEInPlace(base, 0, len, s, 0x5A5A)
+            assertEquals(rl.carryOut, hl.carryOut, "shl carry misalign=$misalign")
+            for (i in 0 until len) {
+                assertEquals(a[i], GlobalHeap.lh(base + i * 2).toInt() and 0xFFFF, "shl misalign=$misalign i=$i")
+            }
+            for (i in 0 until len) GlobalHeap.sh(base + i * 2, b[i].toShort())
+            val rr = ArrayBitShifts.rsh16LEInPlace(b, 0, len, s)
+            val hr = ArrayBitShifts.rsh16LEInPlace(base, 0, len, s)
+            assertEquals(rr, hr, "rsh misalign=$misalign")
+            for (i in 0 until len) {
+                assertEquals(b[i], GlobalHeap.lh(base + i * 2).toInt() and 0xFFFF, "rsh misalign=$misalign i=$i")
+            }
+        }
+    }
+}
@@ -0,0 +1,97 @@
+package io.github.kotlinmania.klang.bitwise
+
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertFalse
+import kotlin.test.assertTrue
+
+class BitShiftEnginesTest {
+    private val patterns = longArrayOf(
+        0L, 1L, 0x7FL, 0x80L, 0xFFL, 0x7FFFL, 0x8000L, 0xFFFFL, 0x5555L, 0xAAAAL,
+        0x7FFFFFFFL, 0x80000000L, 0xFFFFFFFFL, 0x12345678L, -1L, -0x80L,
+    )
+
+    @Test
+    fun nativeAndArithmeticAgreeOnPackedLeftShift() {
+        for (v in patterns) {
+            for (s in 0 until 8) {
+                assertEquals(NativeShift8.leftShiftPacked(v, s), ArithmeticShift8.leftShiftPacked(v, s), "8 v=$v s=$s")
+            }
+            for (s in 0 until 16) {
+                assertEquals(NativeShift16.leftShiftPacked(v, s), ArithmeticShift16.leftShiftPacked(v, s), "16 v=$v s=$s")
+            }
+            for (s in 0 until 32) {
+                assertEquals(NativeShift32.leftShiftPacked(v, s), ArithmeticShift32.leftShiftPacked(v, s), "32 v=$v s=$s")
+                assertEquals(NativeShift32.rightShift(v, s), ArithmeticShift32.rightShift(v, s), "32 >> v=$v s=$s")
+            }
+        }
+    }
+
+    @Test
+    fun packedCarryDecodes() {
+        val p = NativeShift16.leftShiftPacked(0x8001L, 1)
+        assertEquals(0x0002L, ShiftPacked.value(p))
+        assertEquals(0x1L, ShiftPacked.carry(p))
+        assertTrue(ShiftPacked.overflow(p))
+        assertFalse(ShiftPacked.overflow(NativeShift16.leftShiftPacked(0x4001L, 1)))
+        assertEquals(ShiftPacked.pack(0x2L, 0x1L), p)
+    }
+
+    @Test
+    fun thirtyTwoBitCarryIsExact() {
+        val p = NativeShift32.leftShiftPacked(0xFFFFFFFFL, 4)
+        assertEquals(0xFFFFFFF0L, ShiftPacked.value(p))
+        assertEquals(0xFL, ShiftPacked.carry(p))
+
+        val r = BitShiftEngine(BitShiftMode.NATIVE, 32).leftShift(0x80000001L, 1)
+        assertEquals(0x2L, r.value)
+        assertEquals(0x1L, r.carry)
+        assertTrue(r.overflow)
+    }
+
+    @Test
+    fun facadeMatchesEngines() {
+        for (mode in listOf(BitShiftMode.NATIVE, BitShiftMode.ARITHMETIC, BitShiftMode.AUTO)) {
+            for (width in intArrayOf(8, 16, 32)) {
+                val engine = BitShiftEngine(mode, width)
+                for (v in patterns) {
+                    for (s in 0 until width) {
+                        val packed = engine.leftShiftPacked(v, s)
+                        val r = engine.leftShift(v, s)
+                        assertEquals(ShiftPacked.value(packed), r.value, "$mode/$width v=$v s=$s")
+                        assertEquals(ShiftPacked.carry(packed), r.carry, "$mode/$width v=$v s=$s")
+                        assertEquals(r.value, engine.leftShiftValue(v, s))
+                        assertEquals(engine.unsignedRightShift(v, s).value, engine.unsignedRightShiftValue(v, s))
+                    }
+                }
+            }
+        }
+    }
+
+    @Test
+    fun autoResolvesThirtyTwoBitToNative() {
+        assertEquals(BitShiftMode.NATIVE, BitShiftConfig.resolveMode(32, BitShiftMode.AUTO))
+    }
+
+    @Test
+    fun sixtyFourBitCarry() {
+        assertEquals(0x1L, NativeShift64.leftShiftCarry(Long.MIN_VALUE, 1))
+        assertEquals(0xFL, NativeShift64.leftShiftCarry(-1L, 4))
+        assertEquals(0L, NativeShift64.leftShiftCarry(-1L, 0))
+        val r = BitShiftEngine(BitShiftMode.NATIVE, 64).leftShift(-1L, 4)
+        assertEquals(-16L, r.value)
+        assertEquals(0xFL, r.carry)
+        assertTrue(r.overflow)
+        assertFailsWith<IllegalStateException> { BitShiftEngine(BitShiftMode.ARITHMETIC, 64).leftShift(1L, 1) }
+    }
+
+    @Test
+    fun bitwiseAndMasks() {
+        assertEquals(0x0FL, ArithmeticShift8.and(0xFFL, 0x0FL))
+        assertEquals(NativeShift16.xor(0x1234L, 0xFFFFL), ArithmeticShift16.xor(0x1234L, 0xFFFFL))
+        assertEquals(NativeShift32.not(0L), ArithmeticShift32.not(0L))
+        assertEquals(NativeShift32.mask(12), ArithmeticShift32.mask(12))
+        assertEquals(-1L, NativeShift64.mask(64))
+    }
+}
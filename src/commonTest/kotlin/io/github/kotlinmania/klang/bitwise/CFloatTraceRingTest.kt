@@ -0,0 +1,69 @@
+package io.github.kotlinmania.klang.bitwise
+
+import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.launch
+import kotlinx.coroutines.test.runTest
+import kotlinx.coroutines.withContext
+import kotlin.concurrent.Volatile
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertTrue
+
+class CFloatTraceRingTest {
+    @Volatile
+    private var writerDone = false
+
+    private fun record(c: Int) = intArrayOf(c, c * 3 + 1, c xor 0x5A5A5A5A, c * 7)
+
+    @Test
+    fun quiescentSnapshotKeepsFullRing() {
+        val ring = CFloatTraceRing(8, 0)
+        ring.reset(epoch = 1, sampleEvery = 1)
+        for (c in 0 until 20) record(c).let { ring.append(it[0], it[1], it[2], it[3]) }
+        val out = ring.snapshot()
+        assertEquals(8 * CFloatTraceRing.RECORD_INTS, out.size)
+        assertEquals(12, out[0])
+        assertEquals(12L, ring.dropped)
+    }
+
+    @Test
+    fun concurrentSnapshotsNeverReturnTornRecords() = runTest {
+        // Multi-threaded on JVM/native; on JS/Wasm the writer simply runs first.
+        // A tiny ring keeps the writer overwriting the slots the readers copy.
+        for (capacity in intArrayOf(2, 16)) {
+            val ring = CFloatTraceRing(capacity, 0)
+            ring.reset(epoch = 1, sampleEvery = 1)
+            writerDone = false
+            var snapshots = 0
+            withContext(Dispatchers.Default) {
+                launch {
+                    for (c in 0 until 2_000_000) record(c).let { ring.append(it[0], it[1], it[2], it[3]) }
+                    writerDone = true
+                }
+                repeat(3) {
+                    launch {
+                        do {
+                            checkSnapshot(ring.snapshot())
+                            snapshots++
+                        } while (!writerDone)
+                    }
+                }
+            }
+            checkSnapshot(ring.snapshot())
+            assertTrue(snapshots > 0)
+        }
+    }
+
+    /** Every record's four ints derive from one counter, and counters are consecutive. */
+    private fun checkSnapshot(out: IntArray) {
+        val n = out.size / CFloatTraceRing.RECORD_INTS
+        for (i in 0 until n) {
+            val c = out[i * CFloatTraceRing.RECORD_INTS]
+            val want = record(c)
+            for (k in 1 until CFloatTraceRing.RECORD_INTS) {
+                assertEquals(want[k], out[i * CFloatTraceRing.RECORD_INTS + k], "record $c int $k")
+            }
+            if (i > 0) assertEquals(out[(i - 1) * CFloatTraceRing.RECORD_INTS] + 1, c, "records in order")
+        }
+    }
+}
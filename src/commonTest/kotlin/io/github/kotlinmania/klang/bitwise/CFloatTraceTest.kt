@@ -0,0 +1,93 @@
+package io.github.kotlinmania.klang.bitwise
+
+import io.github.kotlinmania.klang.fp.CFloat32
+import kotlin.test.AfterTest
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertNull
+
+class CFloatTraceTest {
+    @AfterTest
+    fun restore() {
+        CFloatTrace.stop()
+        CFloatTrace.traceAllOps()
+        CFloatTrace.configure(capacity = CFloatTrace.DEFAULT_CAPACITY, sampleEvery = 1)
+    }
+
+    @Test
+    fun recordsCFloat32Ops() {
+        val (_, trace) = CFloatTrace.withTracing {
+            val a = CFloat32.fromFloat(1.0f) + CFloat32.fromFloat(2.0f)
+            (-a).abs()
+        }
+        assertEquals(listOf("plus", "abs"), trace.map { it.op })
+        assertEquals(CFloatTrace.Entry("plus", 0x3F800000, 0x40000000, 0x40400000), trace[0])
+        assertNull(trace[1].rhsBits)
+        assertEquals(3.0f, trace[1].result)
+    }
+
+    @Test
+    fun ringKeepsNewestRecords() {
+        CFloatTrace.configure(capacity = 8)
+        CFloatTrace.start()
+        for (i in 0 until 20) CFloatTrace.log(CFloatTrace.OP_PLUS, i, i, i)
+        val trace = CFloatTrace.stop()
+        assertEquals((12 until 20).toList(), trace.map { it.lhsBits })
+        assertEquals(12L, CFloatTrace.droppedCount())
+    }
+
+    @Test
+    fun samplingKeepsFirstOfEveryN() {
+        CFloatTrace.configure(sampleEvery = 3)
+        CFloatTrace.start()
+        for (i in 0 until 10) CFloatTrace.log(CFloatTrace.OP_TIMES, i, 0, 0)
+        assertEquals(listOf(0, 3, 6, 9), CFloatTrace.stop().map { it.lhsBits })
+    }
+
+    @Test
+    fun filterRunsBeforeSampling() {
+        CFloatTrace.traceOps("div")
+        CFloatTrace.start()
+        CFloatTrace.log(CFloatTrace.OP_PLUS, 1, 1, 2)
+        CFloatTrace.log(CFloatTrace.OP_DIV, 6, 3, 2)
+        CFloatTrace.log("custom", 7, null, 7)
+        assertEquals(listOf("div"), CFloatTrace.stop().map { it.op })
+    }
+
+    @Test
+    fun startClearsPreviousSession() {
+        CFloatTrace.start()
+        CFloatTrace.log(CFloatTrace.OP_MINUS, 1, 1, 0)
+        CFloatTrace.start()
+        CFloatTrace.log(CFloatTrace.OP_MINUS, 2, 2, 0)
+        assertEquals(listOf(2), CFloatTrace.stop().map { it.lhsBits })
+    }
+
+    @Test
+    fun stringOpsAreRegistered() {
+        val code = CFloatTrace.opcodeOf("myOp")
+        assertEquals(code, CFloatTrace.opcodeOf("myOp"))
+        assertEquals("myOp", CFloatTrace.opName(code))
+        assertEquals(CFloatTrace.OP_DIV_F, CFloatTrace.opcodeOf("divF"))
+    }
+
+    @Test
+    fun exportLayout() {
+        CFloatTrace.start()
+        CFloatTrace.log(CFloatTrace.OP_DIV, 0x3F800000, 0x40400000, 0x3EAAAAAB)
+        CFloatTrace.stop()
+        val dump = CFloatTrace.export()
+        fun u32(at: Int) = (dump[at].toInt() and 0xFF) or ((dump[at + 1].toInt() and 0xFF) shl 8) or
+            ((dump[at + 2].toInt() and 0xFF) shl 16) or ((dump[at + 3].toInt() and 0xFF) shl 24)
+        assertEquals("CFTR", dump.copyOfRange(0, 4).decodeToString())
+        assertEquals(1, u32(4))
+        var p = 16
+        repeat(u32(12)) { p += 1 + (dump[p].toInt() and 0xFF) }
+        assertEquals(1, u32(p))                      // writers
+        assertEquals(1, u32(p + 4 + 4 + 8))           // records of writer 0
+        val rec = p + 20
+        assertEquals(CFloatTrace.OP_DIV or 0x100, u32(rec))
+        assertEquals(0x3EAAAAAB, u32(rec + 12))
+        assertEquals(dump.size, rec + 16)
+    }
+}
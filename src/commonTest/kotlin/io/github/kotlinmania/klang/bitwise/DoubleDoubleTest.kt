@@ -0,0 +1,106 @@
+package io.github.kotlinmania.klang.bitwise
+
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+
+class DoubleDoubleTest {
+    private val zero = DoubleDouble(0.0, 0.0)
+
+    private fun assertBits(expected: DoubleDouble, actual: DoubleDouble, label: String) {
+        assertEquals(expected.hi.toRawBits(), actual.hi.toRawBits(), "$label (hi)")
+        assertEquals(expected.lo.toRawBits(), actual.lo.toRawBits(), "$label (lo)")
+    }
+
+    /** Deterministic mixed-magnitude inputs (LCG, no platform RNG). */
+    private fun samples(n: Int, seed: Long): DoubleArray {
+        var x = seed
+        return DoubleArray(n) {
+            x = x * 6364136223846793005L + 1442695040888963407L
+            val mantissa = (x ushr 11).toDouble() / (1L shl 53).toDouble()
+            val exponent = ((x ushr 3) and 0x1F).toInt() - 16
+            val sign = if (x and 1L == 0L) 1.0 else -1.0
+            sign * mantissa * Double.fromBits((1023L + exponent) shl 52)
+        }
+    }
+
+    @Test
+    fun twoSumErrorIsExact() {
+        assertEquals(1e-20, DoubleDouble.twoSumError(1.0, 1e-20, 1.0 + 1e-20))
+        assertEquals(0.0, DoubleDouble.twoSumError(1.5, 2.25, 1.5 + 2.25))
+        // Order-independent, unlike the quick variant
+        assertEquals(1e-20, DoubleDouble.twoSumError(1e-20, 1.0, 1e-20 + 1.0))
+        assertEquals(1e-20, DoubleDouble.quickTwoSumError(1.0, 1e-20, 1.0 + 1e-20))
+    }
+
+    @Test
+    fun twoProdErrorIsExact() {
+        // (1 + 2^-30)^2 = 1 + 2^-29 + 2^-60; the 2^-60 term is rounded away
+        val a = 1.0 + Double.fromBits((1023L - 30) shl 52)
+        val p = a * a
+        assertEquals(Double.fromBits((1023L - 60) shl 52), DoubleDouble.twoProdError(a, a, p))
+        assertEquals(0.0, DoubleDouble.twoProdError(3.0, 0.5, 1.5))
+    }
+
+    @Test
+    fun accumulatorMatchesOperators() {
+        val xs = samples(500, 1)
+        val ys = samples(500, 2)
+        var expected = zero
+        val acc = DDAccumulator()
+        for (i in xs.indices) {
+            expected = (expected + xs[i]).addProduct(xs[i], ys[i]) + DoubleDouble(ys[i], xs[i] * 1e-17)
+            acc.add(xs[i])
+            acc.addProduct(xs[i], ys[i])
+            acc.add(DoubleDouble(ys[i], xs[i] * 1e-17))
+        }
+        assertBits(expected, acc.toDoubleDouble(), "accumulator")
+        acc.reset()
+        assertBits(zero, acc.toDoubleDouble(), "reset")
+    }
+
+    @Test
+    fun minusMatchesNegatedPlus() {
+        val xs = samples(200, 3)
+        for (i in 0 until xs.size - 3 step 4) {
+            val a = DoubleDouble(xs[i], xs[i + 1] * 1e-17)
+            val b = DoubleDouble(xs[i + 2], xs[i + 3] * 1e-17)
+            assertBits(a + (-b), a - b, "i=$i")
+        }
+    }
+
+    @Test
+    fun sumMatchesFoldAndBeatsDouble() {
+        val xs = samples(1000, 4)
+        assertBits(xs.fold(zero) { acc, v -> acc + v }, DoubleDouble.sum(xs), "sum")
+        assertBits(xs.copyOfRange(10, 20).fold(zero) { acc, v -> acc + v }, DoubleDouble.sum(xs, 10, 20), "range")
+
+        val tiny = DoubleArray(1001) { if (it == 0) 1.0 else 1e-17 }
+        assertEquals(1.0, tiny.sum(), "naive Double loses every 1e-17 addend")
+        assertEquals(1.0 + 1e-14, DoubleDouble.sum(tiny).toDouble(), 1e-16)
+    }
+
+    @Test
+    fun dotMatchesAddProductAndCancelsExactly() {
+        val xs = samples(1000, 5)
+        val ys = samples(1000, 6)
+        var expected = zero
+        for (i in xs.indices) expected = expected.addProduct(xs[i], ys[i])
+        assertBits(expected, DoubleDouble.dot(xs, ys), "dot")
+
+        val a = doubleArrayOf(1e16, 1.0, -1e16)
+        val b = doubleArrayOf(1.0, 1.0, 1.0)
+        assertEquals(1.0, DoubleDouble.dot(a, b).toDouble())
+        assertEquals(1e16, DoubleDouble.dot(a, b, length = 2).hi)
+        assertFailsWith<IllegalArgumentException> { DoubleDouble.dot(a, b, length = 4) }
+    }
+
+    @Test
+    fun timesMatchesReferenceProduct() {
+        // (1 + 2^-30)(1 - 2^-30) = 1 - 2^-60, exact in double-double
+        val u = Double.fromBits((1023L - 30) shl 52)
+        val r = DoubleDouble(1.0 + u, 0.0) * DoubleDouble(1.0 - u, 0.0)
+        assertEquals(1.0, r.hi)
+        assertEquals(-Double.fromBits((1023L - 60) shl 52), r.lo)
+    }
+}
@@ -0,0 +1,138 @@
+package io.github.kotlinmania.klang.bitwise
+
+import io.github.kotlinmania.klang.int.UInt128
+import io.github.kotlinmania.klang.int.hpc.HeapUInt128
+import io.github.kotlinmania.klang.mem.GlobalHeap
+import io.github.kotlinmania.klang.mem.KMalloc
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertTrue
+
+/**
+ * Bit-exact vectors from `tools/float128_ieee754_validator.c` (GCC `__float128`).
+ */
+class Float128MathTest {
+    private fun setup() {
+        GlobalHeap.init(1 shl 20)
+        KMalloc.init(1 shl 18)
+    }
+
+    private fun q(hi: Long, lo: Long) = UInt128(hi, lo)
+
+    private fun assertBits(expected: UInt128, actual: UInt128, message: String) {
+        assertEquals(expected.toHexString(), actual.toHexString(), message)
+    }
+
+    private val one = Float128Math.ONE
+    private val two = q(0x4000_0000_0000_0000L, 0L)
+    private val three = q(0x4000_8000_0000_0000L, 0L)
+    private val ten = q(0x4002_4000_0000_0000L, 0L)
+    private val half = q(0x3FFE_0000_0000_0000L, 0L)
+    private val ulp = q(0x3F8F_0000_0000_0000L, 0L) // 2^-112
+    private val minSub = q(0L, 1L)
+    private val minNorm = q(0x0001_0000_0000_0000L, 0L)
+    private val max = q(0x7FFE_FFFF_FFFF_FFFFL, -1L)
+
+    @Test
+    fun divisionRoundsToNearest() {
+        setup()
+        assertBits(q(0x3FFD_5555_5555_5555L, 0x5555_5555_5555_5555L), Float128Math.divBits(one, three), "1/3")
+        assertBits(q(0x3FFE_5555_5555_5555L, 0x5555_5555_5555_5555L), Float128Math.divBits(two, three), "2/3")
+        assertBits(q(0x3FFB_9999_9999_9999L, -0x6666_6666_6666_6666L), Float128Math.divBits(one, ten), "1/10")
+    }
+
+    @Test
+    fun multiplicationKeepsAllProductBits() {
+        setup()
+        val pi = q(0x4000_921F_B544_42D1L, -0x7B96_7673_3AE8_FE48L)
+        assertBits(q(0x4002_3BD3_CC9B_E45DL, -0x1A5B_523B_264C_FEE8L), Float128Math.mulBits(pi, pi), "pi*pi")
+        assertBits(minSub, Float128Math.mulBits(one, minSub), "1 * min subnormal")
+    }
+
+    @Test
+    fun additionTiesRoundToEven() {
+        setup()
+        val halfUlp = q(0x3F8E_0000_0000_0000L, 0L)
+        assertBits(q(0x3FFF_0000_0000_0000L, 1L), Float128Math.addBits(one, ulp), "1 + 2^-112")
+        assertBits(one, Float128Math.addBits(one, halfUlp), "1 + 2^-113")
+        assertBits(q(0x3FFF_0000_0000_0000L, 2L), Float128Math.addBits(q(0x3FFF_0000_0000_0000L, 1L), halfUlp), "(1 + 2^-112) + 2^-113")
+    }
+
+    @Test
+    fun subnormalsRoundAndNormalize() {
+        setup()
+        assertBits(Float128Math.ZERO, Float128Math.mulBits(minSub, half), "min subnormal * 0.5")
+        assertBits(q(0L, 2L), Float128Math.mulBits(minSub, q(0x3FFF_8000_0000_0000L, 0L)), "min subnormal * 1.5")
+        assertBits(q(0x0000_FFFF_FFFF_FFFFL, -1L), Float128Math.subBits(minNorm, minSub), "min normal - min subnormal")
+        assertBits(q(0x0000_8000_0000_0000L, 0L), Float128Math.divBits(minNorm, two), "min normal / 2")
+        assertBits(minNorm, Float128Math.addBits(q(0x0000_8000_0000_0000L, 0L), q(0x0000_8000_0000_0000L, 0L)), "subnormal carry into normal")
+        assertBits(q(0x1FC8_0000_0000_0000L, 0L), Float128Math.sqrtBits(minSub), "sqrt(min subnormal)")
+    }
+
+    @Test
+    fun overflowGoesToInfinity() {
+        setup()
+        assertBits(Float128Math.INF, Float128Math.mulBits(max, two), "max * 2")
+        assertBits(Float128Math.INF, Float128Math.addBits(max, max), "max + max")
+        assertBits(Float128Math.NEG_INF, Float128Math.mulBits(Float128Math.negateBits(max), two), "-max * 2")
+    }
+
+    @Test
+    fun squareRootIsCorrectlyRounded() {
+        setup()
+        // libquadmath's sqrtq(2) is one ulp high (…EA96); the tool's exact root gives …EA95
+        assertBits(q(0x3FFF_6A09_E667_F3BCL, -0x36F7_4D04_EC99_156BL), Float128Math.sqrtBits(two), "sqrt(2)")
+        assertBits(q(0x3FFF_BB67_AE85_84CAL, -0x58C4_DA8B_D28F_8748L), Float128Math.sqrtBits(three), "sqrt(3)")
+        assertBits(two, Float128Math.sqrtBits(q(0x4001_0000_0000_0000L, 0L)), "sqrt(4)")
+    }
+
+    @Test
+    fun fusedMultiplyAddRoundsOnce() {
+        setup()
+        val onePlus = q(0x3FFF_0000_0000_0000L, 1L)
+        val oneMinus = q(0x3FFE_FFFF_FFFF_FFFFL, -1L)
+        val minusOne = Float128Math.negateBits(one)
+        assertBits(q(0xBF1F_0000_0000_0000uL.toLong(), 0L), Float128Math.fmaBits(onePlus, oneMinus, minusOne), "fma(1+u, 1-u, -1)")
+        assertBits(Float128Math.ZERO, Float128Math.subBits(Float128Math.mulBits(onePlus, oneMinus), one), "(1+u)*(1-u) - 1")
+        val third = Float128Math.divBits(one, three)
+        assertBits(q(0xBF8D_0000_0000_0000uL.toLong(), 0L), Float128Math.fmaBits(three, third, minusOne), "fma(3, 1/3, -1)")
+        assertBits(q(0L, 2L), Float128Math.fmaBits(minSub, half, minSub), "fma(min, 0.5, min)")
+    }
+
+    @Test
+    fun specialValuesFollowIeee() {
+        setup()
+        val negZero = Float128Math.negateBits(Float128Math.ZERO)
+        assertTrue(Float128Math.isNaN(Float128Math.subBits(Float128Math.INF, Float128Math.INF)), "inf - inf")
+        assertTrue(Float128Math.isNaN(Float128Math.mulBits(Float128Math.ZERO, Float128Math.INF)), "0 * inf")
+        assertTrue(Float128Math.isNaN(Float128Math.divBits(Float128Math.ZERO, Float128Math.ZERO)), "0 / 0")
+        assertTrue(Float128Math.isNaN(Float128Math.sqrtBits(Float128Math.negateBits(one))), "sqrt(-1)")
+        assertBits(Float128Math.INF, Float128Math.divBits(one, Float128Math.ZERO), "1 / 0")
+        assertBits(Float128Math.ZERO, Float128Math.subBits(three, three), "x - x")
+        assertBits(negZero, Float128Math.addBits(negZero, negZero), "-0 + -0")
+        assertBits(negZero, Float128Math.mulBits(negZero, one), "-0 * 1")
+        assertBits(negZero, Float128Math.sqrtBits(negZero), "sqrt(-0)")
+    }
+
+    @Test
+    fun float64ConversionsRoundToNearestEven() {
+        setup()
+        val tie = q(0x3FFF_0000_0000_0000L, 0x0800_0000_0000_0000L) // 1 + 2^-53
+        assertEquals(0x3FF0_0000_0000_0000L, Float128Math.toFloat64(tie), "1 + 2^-53")
+        assertEquals(0x3FF0_0000_0000_0001L, Float128Math.toFloat64(Float128Math.addBits(tie, ulp)), "1 + 2^-53 + 2^-112")
+        assertEquals(0x3FD5_5555_5555_5555L, Float128Math.toFloat64(Float128Math.divBits(one, three)), "1/3")
+        assertEquals(1L, Float128Math.toFloat64(q(0x3BCC_8000_0000_0000L, 0L)), "3 * 2^-1076")
+        assertEquals(0L, Float128Math.toFloat64(q(0x3BCC_0000_0000_0000L, 0L)), "2^-1075")
+        assertBits(q(0x3BCD_0000_0000_0000L, 0L), Float128Math.fromFloat64(Double.MIN_VALUE.toRawBits()), "Double.MIN_VALUE")
+        assertEquals(Double.MIN_VALUE.toRawBits(), Float128Math.toFloat64(Float128Math.fromFloat64(Double.MIN_VALUE.toRawBits())), "round trip")
+    }
+
+    @Test
+    fun heapWrappersMatchRegisterCore() {
+        setup()
+        val a = HeapUInt128.fromUInt128(one)
+        val b = HeapUInt128.fromUInt128(three)
+        assertBits(Float128Math.divBits(one, three), Float128Math.divBits(a, b).toUInt128(), "heap div")
+        assertEquals(2.0, Double.fromBits(Float128Math.toFloat64Bits(Float128Math.sqrtBits(Float128Math.fromFloat64Bits(4.0.toRawBits())))))
+    }
+}
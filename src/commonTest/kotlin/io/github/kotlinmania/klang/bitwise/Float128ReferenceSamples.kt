@@ -0,0 +1,305 @@
+package io.github.kotlinmania.klang.bitwise
+
+/**
+ * Generated by `tools/float128_vectorgen --kotlin-samples 24 --seed 11400714819323198485`; do not edit.
+ *
+ * Each constant is a complete KQV1 vector file in hex, decoded by [ReferenceVectors].
+ */
+internal object Float128ReferenceSamples {
+    const val F128_ADD =
+        "4b515631010140001800000000000000157c4a7fb979379e7100000000000000" +
+        "76606e02b9eef064ad4df30bae7700800000000000000000000000000000ff7f000000000000000000000000000000000000000000000000000000000000ff7f" +
+        "9e803bd69bc41f0efd11a7adf879004075bd8555bfda2ea3b8e6fa7d38fc0300000000000000000000000000000000009e803bd69bc41f0efd11a7adf8790040" +
+        "13f6bdcdd3b386dce47bfac1e88100403781ed6c1e6e716c7d857d982c8e984e000000000000000000000000000000003781ed6c1e6e716c7d857d982c8e984e" +
+        "5e0ed25688e21c2d20bfbc0cffff0080ac0bdae088eca817b9aa17944911ff7f00000000000000000000000000000000ac0bdae088eca817b9aa17944991ff7f" +
+        "265a2938e963b3f3d9df29e02e58fe7fa6afa6fdfeb547892600b34e107f761100000000000000000000000000000000265a2938e963b3f3d9df29e02e58fe7f" +
+        "0000243226b71071732b0d63160bb4bf0000243226b71071732b0d63160bb43f0000000000000000000000000000000000000000000000000000000000000000" +
+        "eaa2efd9b6314c0730ed813339e26676eaa2efd9b6314c0730ed813339e266f60000000000000000000000000000000000000000000000000000000000000000" +
+        "1c578ace3fccb6e11a4349641f0a737b00000000000000f03f8453858779ba3f000000000000000000000000000000001c578ace3fccb6e11a4349641f0a737b" +
+        "0000000000000000000000000000ffff038465534be05db2a210fe0610a1651f000000000000000000000000000000000000000000000000000000000000ffff" +
+        "bc2e6cbe0ad7571d9136ce42ea8002002972666c165dcda1aa81ece6229c02000000000000000000000000000000000072506995109a92df1d5cdd94868e0300" +
+        "3f343191ba633a8337e41eb72aa0010055b0abbd759a8a8082ab5d23ce2d03000000000000000000000000000000000065fdf76164335961906425d1d8950300" +
+        "05b21377c0b447a4c4e07184dba36ce487d98835761408b93f3c85e55290cc8b0000000000000000000000000000000005b21377c0b447a4c4e07184dba36ce4" +
+        "43799541eb61a42dbabc555fc71ba25343799541eb61a42dbabc555fc71ba2d30000000000000000000000000000000000000000000000000000000000000000" +
+        "306fededa9c8ab3ded4e1d0f299d008000000000000000a39d6cb8a91347d23f0000000000000000000000000000000000000000000000a39d6cb8a91347d23f" +
+        "a03ee941d96305d31bbdd2bab2e422c0a03ee941d96305d31bbdd2bab2e422400000000000000000000000000000000000000000000000000000000000000000" +
+        "712c5db08a0b8e1061289ed38c1f2f5ac65421d736c8f1c0b7d8a0962d78128900000000000000000000000000000000712c5db08a0b8e1061289ed38c1f2f5a" +
+        "5b940c135c40c5885364c23599a2018000000000000000000000000000000000000000000000000000000000000000005b940c135c40c5885364c23599a20180" +
+        "4ba7b88dbe37b02133dc0b2a0850d301b68868576966371b021aa955ad960300000000000000000000000000000000004ba7b88dbe37b02133dc0b2a0850d301" +
+        "accc2bf52b76c99f06152c7d6c8dfdbfabcc2bf52b76c99f06152c7d6c8dfd3f0000000000000000000000000000000000000000000000000000000000008dbf" +
+        "00000000000000000000000000526240feffffffffffffffffffffffff5162c0000000000000000000000000000000000000000000000000000000000000f33f" +
+        "91030f0bb45b722db2513ff888af3feb0a258d66faa5475562f444b6cab39d7f000000000000000000000000000000000a258d66faa5475562f444b6cab39d7f" +
+        "e4776235a4c3cd22e1a226bc5da30180e4776235a4c3cd22e1a226bc5da301000000000000000000000000000000000000000000000000000000000000000000" +
+        "d23c8ce8527a82b638f5c3d88337fe3f86f0593a986f45e387e0e8cadba3010000000000000000000000000000000000d23c8ce8527a82b638f5c3d88337fe3f" +
+        "ec0b380932fe22e760c6aa9b1bbd03a99bfb749b4328f0138ac8a8e4dd7bb8c2000000000000000000000000000000009bfb749b4328f0138ac8a8e4dd7bb8c2"
+
+    const val F128_SUB =
+        "4b515631010240001800000000000000167c4a7fb979379e7100000000000000" +
+        "b45c6f16b32df0546e2d75caae7701807b5106364bc6f02e2bc8797f86ae01000000000000000000000000000000000018d73a26ff79f0c1cc7af7a41a930280" +
+        "7fb3545a41395ee8d4d54916c12cfebf7db3545a41395ee8d4d54916c12cfe3f000000000000000000000000000000007eb3545a41395ee8d4d54916c12cffbf" +
+        "77d62055359db0199a368329ebdc610882f6a333dd654086c98590d7fe1501800000000000000000000000000000000077d62055359db0199a368329ebdc6108" +
+        "f495c8cf5aeff430f7e17429869cfdbf0000000000000000000000000000000000000000000000000000000000000000f495c8cf5aeff430f7e17429869cfdbf" +
+        "694fa5ea96bbf122b0ecc76e2b28ff7faebda848be8bacecef401315859afe3f00000000000000000000000000000000694fa5ea96bbf122b0ecc76e2ba8ff7f" +
+        "de8d4fd378f6a2b6ad99efe713c463a4de8d4fd378f6a2b6ad99efe713c4632400000000000000000000000000000000de8d4fd378f6a2b6ad99efe713c464a4" +
+        "ca19fc6a274099dec5a77787fb81cfc4a36460b27a0d0f8496daed772638000000000000000000000000000000000000ca19fc6a274099dec5a77787fb81cfc4" +
+        "ec6a8df2e86d09d702b72e9bd068aa771a9ab14d31c672001085adf5abecfcff000000000000000000000000000000001a9ab14d31c672001085adf5abecfc7f" +
+        "28f088c2599f80327ae90307cce28c716118db3a2cfd49cb7f6fa42445c301c00000000000000000000000000000000028f088c2599f80327ae90307cce28c71" +
+        "bae02072accb64fdb364e49f2c790300db6d014cddb722ca7175325b2712fe7f00000000000000000000000000000000db6d014cddb722ca7175325b2712feff" +
+        "371268f3f3b4a4814fdc1e136cfa0200371268f3f3b4a4814fdc1e136cfa028000000000000000000000000000000000371268f3f3b4a4814fdc1e136cfa0300" +
+        "400ef2a5cb74352d00ab32d3790e58c0a7703002c70bde8c8c15c3e42a98fc7f00000000000000000000000000000000a7703002c70bde8c8c15c3e42a98fcff" +
+        "2c7b28bd618af398db1b7bdb16a7008000000000000000000000000000000000000000000000000000000000000000002c7b28bd618af398db1b7bdb16a70080" +
+        "d3088d7d3617f6bdeeded6cb44b6fd7f0000000000000000000000000000ff7f000000000000000000000000000000000000000000000000000000000000ffff" +
+        "588f5f94fe60fcf10a69721384e7000020b02e9a0d7cae350a5051bf5d10acbf0000000000000000000000000000000020b02e9a0d7cae350a5051bf5d10ac3f" +
+        "a260936c73960f0446b2415949f501c0948cc4ff75345b2c1283c51519a4235900000000000000000000000000000000948cc4ff75345b2c1283c51519a423d9" +
+        "6b79f5c6fefd785fd4dfe9236b3300c06a79f5c6fefd785fd4dfe9236b330040000000000000000000000000000000006a79f5c6fefd785fd4dfe9236b3301c0" +
+        "c845f9981e269fa5c36518e8f886a9f6c745f9981e269fa5c36518e8f886a97600000000000000000000000000000000c845f9981e269fa5c36518e8f886aaf6" +
+        "9ae92abbe70ee352bdb38aa7bd7f7e3b9ae92abbe70ee352bdb38aa7bd7f7ebb000000000000000000000000000000009ae92abbe70ee352bdb38aa7bd7f7f3b" +
+        "843059b796a7748162b30dae26bc00017b446648473a92031354ba1e1d75a0f2000000000000000000000000000000007b446648473a92031354ba1e1d75a072" +
+        "00000000000000000000000000000000618f037bdefedc7a8472eef110a6c0bd00000000000000000000000000000000618f037bdefedc7a8472eef110a6c03d" +
+        "5f46886531996170ee98928f6872688c787358547958721726efca9e61fba8e100000000000000000000000000000000787358547958721726efca9e61fba861" +
+        "ed3c17fd729f042455fc3a61fa56fc7feb3c17fd729f042455fc3a61fa56fcff00000000000000000000000000000000ec3c17fd729f042455fc3a61fa56fd7f" +
+        "90951976a50a4573c1888682d7d8c8cd17f9771267151f0535b1d200c12792840000000000000000000000000000000090951976a50a4573c1888682d7d8c8cd"
+
+    const val F128_MUL =
+        "4b515631010340001800000000000000177c4a7fb979379e7100000000000000" +
+        "f5486e1ab56cf0442f0df78aae7700804e5a20ef36b19b8336fc35b82827dc3b0000000000000000000000000000000000000000000000000000000000000080" +
+        "77964b1f2475db1d1193f009aabc231dc0c4a6550753ae30f77bd16b36ceffbf000000000000000000000000000000007148696dcab6e1513a998ab26c91249d" +
+        "685a1c22f876ec8dc5f6de3bc2ab6858176604d99c6f96661d255229163fc53200000000000000000000000000000000476936bdd4a66bbb3dac2b08960a2f4b" +
+        "0000000000000000000000000000000086205f4dc90ed374cfc41b10b14cfd3f0000000000000000000000000000000000000000000000000000000000000000" +
+        "03305e6d16c728494b448341229236363babbbf8bd3212c0491960415ae002000000000000000000000000000000000000000000000000000000000000000000" +
+        "d38e976e8c3319ef09cd90994b3873b5d18e976e8c3319ef09cd90994b38733500000000000000000000000000000000c01e23879cb59cc1be4aa45cf87ce7aa" +
+        "0000000000000000000000000000ffffc4adf5bd77e5a4d6b5189c781deeff7f00000000000000000000000000000000c4adf5bd77e5a4d6b5189c781deeff7f" +
+        "b0dd770bb90724be017b23c24a9a1b40ac70929bb6037d904cf009dbaead47f700000000000000000000000000000000baf3f4a5d45e08c08aa599c2535864f7" +
+        "245411ea1e4bf1aa583efef105f50000b9e893e4f5e90bc073852823e69efeff00000000000000000000000000000000a8785219c75190dafd2b57e21b8d00c0" +
+        "00000000000000000000000000b04e40000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000" +
+        "e42b71fecd7fa13ff5284f1187eadf647a7cadee5831e1b21c33041964d48fb100000000000000000000000000000000ae92a08f72612b9f445b2b5cbfc070d6" +
+        "7479eff5bf4c35100a7fc2dd72e6fd9a0000000000000000000000000000ff7f000000000000000000000000000000000000000000000000000000000000ffff" +
+        "da1643e2355c586c7e92ed18af57fe3fd91643e2355c586c7e92ed18af57febf000000000000000000000000000000002893e314202e1d77cab58fac66cdfdbf" +
+        "d94e6f500f527ce837173ac2e131fefff251a1deb7276a603aa45dfb72cdffff00000000000000000000000000000000f251a1deb7276a603aa45dfb72cdffff" +
+        "c05c645020520b8b5048007e0ffc0180aa3d40b9c812c6e8e3c4d0346d2d61df000000000000000000000000000000001ac73317115b6f0c0a3a48791b2b641f" +
+        "f9121452dc9a1d6f1950b2611813fe7f000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000" +
+        "a7f4eb1d4d14d14a531a0d5243e89b72a9f4eb1d4d14d14a531a0d5243e89bf2000000000000000000000000000000000000000000000000000000000000ffff" +
+        "25841c3893481ccf35a8401db4120180093c12bf4c970ac7574f238d355fb867000000000000000000000000000000008c017e89cd8f6afce4ccd86ade78baa7" +
+        "60fbcee600d8d5b3b54a5e4a0263fc7f7243951280502e06ebacdace5ceb0f3000000000000000000000000000000000f2ebb2900fc1a2016255280cb3540d70" +
+        "ad56f2bcbe0463ec849431b68c4400804e7498ba1875b5ae327e633f6d6ffd7f000000000000000000000000000000007aca1e7d00dc8f2049b04fe88b89fdbf" +
+        "4b285dc84ad4e3e0bc7b1e1ee71f0200b8daa1c17502d474d5962c01d6528d6400000000000000000000000000000000e933e85bc2e1de96537949d20f7d9024" +
+        "040aa5e95009f38e02c3a42cb092c3fc019c061f965ab8d54904d50cdf0cfd3f00000000000000000000000000000000c782180d9533395018b5624aefa6c1fc" +
+        "3d872ceae674c7686b4b3b69d5f109533c872ceae674c7686b4b3b69d5f109d300000000000000000000000000000000ecc0e693bf62961f6241402a0fe414e6" +
+        "ace3d11d7d51997c56bde55480b37819f8ecd24f55e770675a9135acc2ffc8860000000000000000000000000000000000000000000000000000000000000080"
+
+    const val F128_DIV =
+        "4b515631010440001800000000000000187c4a7fb979379e7100000000000000" +
+        "3d876f5e97a3f3b4e0ee684dad770180b023cdfdd1e6467146bbc497a5d9ff3f00000000000000000000000000000000a2eea3625e9b229eb32f576d0ccb0080" +
+        "4d114986055829acb6bd0025eb90eb344e114986055829acb6bd0025eb90ebb400000000000000000000000000000000fffffffffffffffffffffffffffffebf" +
+        "7dc9faf49cedb1ab5d3027f0bc0c3f490000c03eeb4d137f3b2f0b56503c4d4000000000000000000000000000000000a1634e0e52f6c10330bb98defdb2f048" +
+        "00000000000000000000000000000000ffffffffffffffffffffffffffffff7f00000000000000000000000000000000ffffffffffffffffffffffffffffff7f" +
+        "9728c3e17ec0497b9a46c4759e8f9f3f86a5ffd5697855adbf7c0bd815f6dea100000000000000000000000000000000017c6fee092340b3f3dd14a08297bfdd" +
+        "0000000000000000000000000000ff7f0100000000000000000000000000ffff000000000000000000000000000000000100000000000000000000000080ffff" +
+        "000000000000000080fa293873e012c0b075a014e39e3ce7b7e3cd8158110300000000000000000000000000000000000000000000000000000000000000ffff" +
+        "bc16a0a29253122a686a731eb02d197c00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000ff7f" +
+        "5e62c7c0f0650396042dc7ebfdfc00005f62c7c0f0650396042dc7ebfdfc008000000000000000000000000000000000fefffffffffffffffffffffffffffebf" +
+        "77da58df0f86d76455318fef4074427b76da58df0f86d76455318fef407442fb000000000000000000000000000000000100000000000000000000000000ffbf" +
+        "6159feb6826af10eec4612b15cd402805f59feb6826af10eec4612b15cd40200000000000000000000000000000000000100000000000000000000000000ffbf" +
+        "ea3fa241f83fbe2ae921a230b1feb58deb3fa241f83fbe2ae921a230b1feb50d00000000000000000000000000000000fffffffffffffffffffffffffffffebf" +
+        "63ab4b9786404e30dcdf01007d50ff7f3a4e19216a62f3b3a9e976ca9b4bfc7f0000000000000000000000000000000063ab4b9786404e30dcdf01007dd0ff7f" +
+        "0000000000e0321a701056d23941d7bf0000000000000000000000000000ff7f0000000000000000000000000000000000000000000000000000000000000080" +
+        "6b7834e7d804856429814977c1b40300e8f276607546bef1cbf1881576bd23a5000000000000000000000000000000004e2e92474af2cc10b598027efef5de9a" +
+        "00000000000000700b9abdcd4a5f26c001000000000000700b9abdcd4a5f264000000000000000000000000000000000fffffffffffffffffffffffffffffebf" +
+        "ed99cb5f1ec32982131f9192bcfb00005ec06fc252d8b91cb5552caef6b6fcff0000000000000000000000000000000000000000000000000000000000000080" +
+        "885fb731d666b3636eb3fb6e14a458c766a38f6bbbef41a49f1cbc357abefeff00000000000000000000000000000000d32ca3a848a7f5e071f41d7dbae15807" +
+        "0000000000000000000000000000ff7fd8b9e9e0bebfe5f336b78129f6a01ba4000000000000000000000000000000000000000000000000000000000000ffff" +
+        "cef5fb5683aa901bd92b0409382bffffaeb2b3eecd10866b953da55bcf3fff3f00000000000000000000000000000000cef5fb5683aa901bd92b040938abffff" +
+        "0000000000000000000000000000000067af21c5f393bec007500f1af4cf03800000000000000000000000000000000000000000000000000000000000000080" +
+        "afeda8779bde0c5380170d27f5950080aeeda8779bde0c5380170d27f5950000000000000000000000000000000000000200000000000000000000000000ffbf" +
+        "590d7fcc290396c227dffdd1e10cc9b09b94fd99713976b3e43fe9c8b27dd73f0000000000000000000000000000000042371fd6a7ed261304caa6d8ab68f0b0" +
+        "00000000000000000000000000000000ffffffffffffffffffffffffffffff7f00000000000000000000000000000000ffffffffffffffffffffffffffffff7f"
+
+    const val F128_SQRT =
+        "4b515631010540001800000000000000197c4a7fb979379e7100000000000000" +
+        "7c936e5291e2f3a4a1ceea0dad7760040000000000000000000000000000000000000000000000000000000000000000519fe0c12a393356260f9ba392b62f22" +
+        "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000" +
+        "0000000000000000000000000000ff7f00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000ff7f" +
+        "8b8e702b9277400169d19236ffdf00000000000000000000000000000000000000000000000000000000000000000000357c1695a3bf706bfad3c0c9eddeff1f" +
+        "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000" +
+        "b3e1b0169552b64e0f3e5e6353ecd3000000000000000000000000000000000000000000000000000000000000000000712ff806591bb70177dbd9be03636920" +
+        "14877eb939cefd5fff954685d86200000000000000000000000000000000000000000000000000000000000000000000f80963b271c0427b3ef760dc253eff1f" +
+        "7f2dcee6b475c4d943fe114b06113f7c0000000000000000000000000000000000000000000000000000000000000000388298954ea3a903e991ea1260081f5e" +
+        "095ed816c39f16ef2f730338fe930300000000000000000000000000000000000000000000000000000000000000000058168934bc48d8e8ccb444df97410120" +
+        "bc3ab1b345f9deccfd80123290043c1a00000000000000000000000000000000000000000000000000000000000000006a62e419c9ad79b00749584a406d1d2d" +
+        "b31cb8ff3fff0fc19413b5aeb386008000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000080ffff" +
+        "0000000000000000000000000000ffff00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000080ffff" +
+        "3f29cfd3fa8bf65679036a9ae009030000000000000000000000000000000000000000000000000000000000000000000f7014e694840a9f2d330856e4040120" +
+        "572ce96db1f1c8a4436a5bc7a42001400000000000000000000000000000000000000000000000000000000000000000950f10d68f1b35b405a5210fd50f0040" +
+        "d2dbeaccd07ae04b97426ef10ca8ffff0000000000000000000000000000000000000000000000000000000000000000d2dbeaccd07ae04b97426ef10ca8ffff" +
+        "8c28fdbdd44b70ce2a93185e93cc028000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000080ffff" +
+        "00000042d735c0503f05aa79f6ba26400000000000000000000000000000000000000000000000000000000000000000145f8fe477f0943d4fb499663bdc1240" +
+        "449512733d4595b16ed5edd7e7730000000000000000000000000000000000000000000000000000000000000000000065793593430ee2749cd498a58258ff1f" +
+        "86f416fbcdc7d7c600c3fb38b66fae1e000000000000000000000000000000000000000000000000000000000000000040f1c0293437575e9f25a42ce6b1562f" +
+        "8cc9908fbaafa8e822172bc17a22b1f900000000000000000000000000000000000000000000000000000000000000000000000000000000000000000080ffff" +
+        "22f2bd42aaa47e05ed47775121010f0800000000000000000000000000000000000000000000000000000000000000004bfab4401eb7c28dfe8af37f90000724" +
+        "00000000000000000050ba0946b20040000000000000000000000000000000000000000000000000000000000000000045b3bba6c98aaa30902bb6b989d7ff3f" +
+        "ebe441c3a2d4dd144d737208a814000000000000000000000000000000000000000000000000000000000000000000004be85328482a02dfed028d1de022fe1f" +
+        "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+
+    const val F128_FMA =
+        "4b5156310106400018000000000000001a7c4a7fb979379e7100000000000000" +
+        "beaf6f469b21f39462ae6cccad77bfa2bcaf6f469b21f39462ae6cccad77bf22ca8eaed3352ad7f2822a7251a7138005f01cec8a9964865a758bfccaac030e05" +
+        "2730848891349012ba0e683b043125d5d7f598169d9a6e4b0b8e4cccd969feff000000000000000000000000000000000000000000000000000000000000ff7f" +
+        "0000000000000000000000000000000000000000000000000000000000000000f1d98d1492c3f0dd254a5d9285f3ef18f1d98d1492c3f0dd254a5d9285f3ef18" +
+        "4889062d27ab0894d9e83b26f5b800004989062d27ab0894d9e83b26f5b800800f29afc88df809c40f60d59e0ece01400f29afc88df809c40f60d59e0ece0140" +
+        "0000000000000000000000000000ffff0000000000000000000000000000ff7f000000000000000000000000000000000000000000000000000000000000ffff" +
+        "d587dc67e252872d71f264b02fe0fdff0000000000000000000000000000ff7fc4f038d5832f707902a3e92809def7400000000000000000000000000000ffff" +
+        "feaef3301c5b131893561eabe57701c0f83ce7184ab4fb0472855225a0b369557753b1d0dc1203c7d2929a9def6cd7b6e15fc66eca88c8fea76e0e34d33f6cd5" +
+        "691d278b4ffa5b28d21d1ae92e09c234fee03be33f34ec142ea8c1b4498630e914772ae9534cd5e9f1d21c3a1005000082b9f291383f25495bd8bbd04994f3dd" +
+        "d77ae0400bce989b39d7a1be4c100080d4d85d9cbf4fe3e1bd9461337ae7c26270866bc725ec49a21834da2f2a34fd7f70866bc725ec49a21834da2f2a34fd7f" +
+        "dce716033c7fb004146403fb4d99a593902c4c3900e15d32084cb107511f01c0af51d2f6de69142f7b8a92f94cc300007c36fc6b5e4628029dd361fa5fcba713" +
+        "c78f467e6bb2653ba0332a0d3036000000000000000000000000000000000000b5833d54dbacae9c5550335d9428fc7fb5833d54dbacae9c5550335d9428fc7f" +
+        "5f125e24bec1d81f2fd89021af153e2d5e125e24bec1d81f2fd89021af153eada9517bf861de2c298255120fedbf5f36a9517bf861de2c298255120fedbf5f36" +
+        "9e43ce3e9038aede83eeb6174f04f680e0ebaebad76ea5c25e9fb1a9cdcd0412a5b6b398391622682162becdcd613fbea5b6b398391622682162becdcd613fbe" +
+        "a632b1d1806598845c7dcc42650b54c0000000000000000000000000000000000000000000c2e63eef9d9f05340224c00000000000c2e63eef9d9f05340224c0" +
+        "fc16d6d41183543836255f8fa2d3c62ee8e3e9586a7ae7ffa7c716b5db4646070100000000000000000000000000008001000000000000000000000000000080" +
+        "59ef0e7ce5e5b10b9ea3354989b0ffbf3713aab4cc95ba4784d9958ba33b9f34cd23e66d9049b43db43c59fe3297feffcd23e66d9049b43db43c59fe3297feff" +
+        "039523689bcad287c061c2a32e17ff7f049523689bcad287c061c2a32e17ffff41eece8e5f34d3e0ca852cfc1a730300049523689bcad287c061c2a32e97ffff" +
+        "4b895758d579992e713d6402ab38ec2090083966d0469fdcadbedede64b5030084a885b09eda65de5cec690a26b601c084a885b09eda65de5cec690a26b601c0" +
+        "09820d1aa7e15b044d8299d78f08172e0000000000000000000000000000ff7f00000000c02a83e4688d9034877ff03f0000000000000000000000000000ff7f" +
+        "f7a3dd619010b3aa497f178982fafe7f4d01a299c6cdf785e8d2b472efe9623a0000000000000000000000000000ff7f0000000000000000000000000000ff7f" +
+        "ae5cd61d9e7949bedd19495f855802800000000000000000000000000000ff7f51839b90a2858670f8d4b413794d91c70000000000000000000000000000ffff" +
+        "000000000000000000000000000000003cbb9e191ea431e766ed676b901a18e90000000000000000000000000000000000000000000000000000000000000000" +
+        "a7488852569be58011fbab7877b3b74055f71837273ba4a8536310e81cb3fdbfb05677a158b4cef558749acd74c1fd56b05677a158b4cef558749acd74c1fd56" +
+        "000000000000000000c0a1168f75e43f13bf005b39403d44aa9c24d8b39a0100000000000000000000000000a805d7bf000000000000000000000000a805d7bf"
+
+    const val DD_ADD =
+        "4b5156310301400018000000000000001b7c4a7fb979379e6a00000000000000" +
+        "4879bbce157067334a3c6efff4fdf3afe93779b8145a805e000000000000000000000000000000000000000000000000e93779b8145a805e4879bbce15706733" +
+        "00000000000014c00000000000000000d61e0e40423060d7000000000000000000000000000000000000000000000000d61e0e40423060d700000000000014c0" +
+        "db07a1d48715f1dd4fad959c8f4382da25891b23a64dc6c1ceb5174757b167be00000000000000000000000000000000db07a1d48715f1dd4fad959c8f4382da" +
+        "45cb85b04212241f6ec0416d3896b29b5db59e2b291fb54076be430ab94a57bd000000000000000000000000000000005db59e2b291fb54076be430ab94a57bd" +
+        "1370949d14c8172a5cc4ebb1f4fabca62aef5261f610b340c26f00b1a841513d000000000000000000000000000000002aef5261f610b340c26f00b1a841513d" +
+        "62c6c209a5185fa8f0297701026ce62462c6c209a5185f28f0297701026ce6a40000000000000000000000000000000000000000000000000000000000000000" +
+        "3d4a836d707e469e5dfe5bcecd87ee1a00000000000000800000000000000000000000000000000000000000000000003d4a836d707e469e5dfe5bcecd87ee1a" +
+        "38597284266da1b29efbba03f7c236af38597284266da1329efbba03f7c2362f0000000000000000000000000000000000000000000000000000000000000000" +
+        "cfba444e23cd0f4c5fe9cfbe71fd8b48cfba444e23cd0fcc855bea2770fe8bc80000000000000000000000000000000000c0444e23cdbfc70000000000000000" +
+        "89256064be06202eccd8b10ca2a9c82a0000000000000840000000000000000000000000000000000000000000000000000000000000084089256064be06202e" +
+        "8c620ce23c2764badf4540d65ad3e7b600000000000000000000000000000000000000000000000000000000000000008c620ce23c2764badf4540d65ad3e7b6" +
+        "f78cff80b947e8c8b0a2244889ba8a45f78cff80b947e848b1a0b1b858ba8ac5000000000000000000000000000000000080ff80b94798440000000000000000" +
+        "6b117e71b3679cc778dc0cc038292cc46b117e71b3679c4770a2da5eaa292c440000000000000000000000000000000000007e71b3674c430000000000000000" +
+        "031eeb9a52a82e32f82a1737a445a0ae031eeb9a52a82eb2a49661d81e46a02e000000000000000000000000000000000000eb9a52a8ce2d0000000000000000" +
+        "beff40f5b5dc11584f031209117899d4beff40f5b5dc11d857adc1ee9f78995400000000000000000000000000000000000041f5b5dcc1530000000000000000" +
+        "e7f0185f21917b311f08fb2078ef1c2e8a878494f4a1e25167cbbbf3d83d674e000000000000000000000000000000008a878494f4a1e25167cbbbf3d83d674e" +
+        "e6ab5a0baaf9a4b1f21de9306a5b472e6c462253e021e61d000000000000000000000000000000000000000000000000e6ab5a0baaf9a4b1f21de9306a5b472e" +
+        "00000000000000800000000000000000f837c9d12391303cecd4cf154786d5b800000000000000000000000000000000f837c9d12391303cecd4cf154786d5b8" +
+        "d62d266b7e791c5e83361f0e25dea45a5060e084ac6132227645ab5fd5e2df9e00000000000000000000000000000000d62d266b7e791c5e83361f0e25dea45a" +
+        "61c947183d6cc449733f8cd761936dc6f2dfbd95ac1d3bb0a07a0baa4f72b02c0000000000000000000000000000000061c947183d6cc449733f8cd761936dc6" +
+        "95da272f0927d61bdc124509a90d4518ed883777af9750256363cdea4875f2a100000000000000000000000000000000ed883777af9750256363cdea4875f2a1" +
+        "e74691fa589117ab1079fc7b832db1a7f6f3092b0a61ac590325075dfc39325600000000000000000000000000000000f6f3092b0a61ac590325075dfc393256" +
+        "1256e21edccb69b1c35da750d2740eae1256e21edccb6931a57c831cec740e2e000000000000000000000000000000000000e21edccb092d0000000000000000" +
+        "2c15056db5b95ed78812293e26c3eb532c15056db5b95e577e38becae8c2ebd3000000000000000000000000000000000000056db5b9fe520000000000000000"
+
+    const val DD_SUB =
+        "4b5156310302400018000000000000001c7c4a7fb979379e6a00000000000000" +
+        "56e72fdfd56f2f3d908aafcbda20b33956e72fdfd56f2fbd908aafcbda20b3b90000000000000000000000000000000056e72fdfd56f3f3d908aafcbda20c339" +
+        "9ba94c838468db40d6933f5c734a783da01992c266970840b553587b579e80bc000000000000000000000000000000000b9516c8bf67db40787511676bf57abd" +
+        "c15caad9e62dda2eb85c2a8695317f2bc15caad9e62ddaae0e8343587b317fab00000000000000000000000000000000c15caad9e62dea2ee3ef366f88318f2b" +
+        "8b5da8dfadb083e249738acceec3155ff209a17118d386379a4adcc453a72334000000000000000000000000000000008b5da8dfadb083e249738acceec3155f" +
+        "aad525f60122d4dc3cd55626fdc977d9ede4428833e85dbbccc5b3e954dcf9b700000000000000000000000000000000aad525f60122d4dc3cd55626fdc977d9" +
+        "0000000000000840000000000000000058f0d46e704683baec88d26fe987103700000000000000000000000000000000000000000000084058f0d46e7046833a" +
+        "6ef2b9b47e02c83ff093438d43e06b3c0000000000001cc000000000000000000000000000000000000000000000000093cfa5f513c01c40a01c6a1c02dfbc3c" +
+        "f1173402b9c5183a924bbb3088feb4b6f1173402b9c518bac64d74f6a0feb43600000000000000000000000000000000f1173402b9c5283aaccc979394fec4b6" +
+        "b550c305ea89d23e0000000000000000d6231f16989aeddd000000000000000000000000000000000000000000000000d6231f16989aed5db550c305ea89d23e" +
+        "a64195ca5681f54dc02b5479cd278d4aa0071fa73e7d949f31fdc921ae5d1a9c00000000000000000000000000000000a64195ca5681f54dc02b5479cd278d4a" +
+        "87e59fa8a38728d1de5035a60a19c44d4bd0c4f64798e42f7ef5d7166a4e8d2c0000000000000000000000000000000087e59fa8a38728d1de5035a60a19c44d" +
+        "db2acfb7edca57643ea65e5d9dcbe8e0db2acfb7edca57e4dc153af3cccbe86000000000000000000000000000000000db2acfb7edca67640d5e4c28b5cbf8e0" +
+        "df296f966c6c84be7461d87b7cf02d3b713a64e1edcb05a446459c7df493aca000000000000000000000000000000000df296f966c6c84be7461d87b7cf02d3b" +
+        "c7684be049243ad8d7ae8cad4aaed854d9b960588388194b0f455daa2e38be4700000000000000000000000000000000c7684be049243ad8d7ae8cad4aaed854" +
+        "0129cce287aa2422ad7a42c8c6a4a01eb91d3dd6d47bde4352d991efcd9373c000000000000000000000000000000000b91d3dd6d47bdec352d991efcd937340" +
+        "ff7ec32848243d3716d3cf305087a9b3b68b465323746e26c8a60f246ab9fea200000000000000000000000000000000ff7ec32848243d3716d3cf305087a9b3" +
+        "e471da19efd8412aebdde479e93ad526f2af81f066ff814fa796490af40b2ccc00000000000000000000000000000000f2af81f066ff81cfa796490af40b2c4c" +
+        "590eb0af5008eacb47ec64cdceb28348590eb0af5008ea4bf79bb5d5e8b283c800000000000000000000000000000000590eb0af5008facb1f448dd1dbb29348" +
+        "9b70b25427f2d2b60000000000000000c90f8f091f7bd3bbb58aae5294280f3800000000000000000000000000000000c90f8f091f7bd33b4b75f3b096280fb8" +
+        "9675a0cb97528d1c54643947947827996ce76c1d8f74144e0000000000000000000000000000000000000000000000006ce76c1d8f7414ce9675a0cb97528d1c" +
+        "4892dec6b35ed1d33edcbdc2138c6ed000000000000000800000000000000000000000000000000000000000000000004892dec6b35ed1d33edcbdc2138c6ed0" +
+        "8478fb8979a3b9b80345af0b87445d358478fb8979a3b93808bb35686d445db5000000000000000000000000000000008478fb8979a3c9b80680f2397a446d35" +
+        "0000000000000000000000000000000065c0e6f7945ed8d328e57ed3daa10d500000000000000000000000000000000065c0e6f7945ed85328e57ed3daa10dd0" +
+        "fe4fff19e8cfa74507bf8e46048b4b42fe4fff19e8cfa7c506f35ee6338b4bc200000000000000000000000000000000fe4fff19e8cfb74506d976161c8b5b42"
+
+    const val DD_MUL =
+        "4b5156310303400018000000000000001d7c4a7fb979379e6a00000000000000" +
+        "7ec1a9b1faeb11bab366ea58c9e899b67ec1a9b1faeb113a5a2dd50811e99936000000000000000000000000000000006d8d031d0d1334b47197d9a5b433dcb0" +
+        "776670d759b6cdbc2a9c572b77bf6eb9fccfa0b9509ad7b17c280ac332de7c2e0000000000000000000000000000000070b9711759eab52ef5c6c15474bb41ab" +
+        "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000" +
+        "b5193f4bdb48762d2e544945e1d61b2ab5193f4bdb4876adaceaffd60dd71baa00000000000000000000000000000000dc5b50d0a609ff9ac2dddc831e229b17" +
+        "260bf9c17049224d000ca2a7f0709749241b16d023ce2f4adc382a2069f7c146000000000000000000000000000000001a490779f22c62572b8c033927dfde53" +
+        "0000000000000840000000000000000000000000000008c0000000000000a8bb0000000000000000000000000000000000000000000022c0000000000000c2bb" +
+        "6f19d8a9bb0ac92128065dba08c7669e330ecabc1e2989a30000000000000000000000000000000000000000000000005d8def6a90b063854682b23b03290402" +
+        "99e786dea05519b4a23f1ed17dc9bfb0c4f24fca1e20602a000000000000000000000000000000000000000000000000cf3c29e17c88899e384b924bc3ce171b" +
+        "ccf7bd9d1fbec5c66b342095d530594300000000000014c0000000000000000000000000000000000000000000000000bf752d85a72deb46864168fa0a7d7fc3" +
+        "84043e4420710fcf0ed6eecd7944a14b85092e570cd8664cc0abe7500ef30bc900000000000000000000000000000000022bcce80d7286db3cef1fa821e021d8" +
+        "0571466ae0d5605275be22b5ad55054f3df7bd8420e14b9bf6b253999f6be99700000000000000000000000000000000d98f9a8ecc55bdadcd36e1e8be2f4eaa" +
+        "62c747ee2c0043d57eec8fc00f2dead100000000000014400000000000000000000000000000000000000000000000003bb9d92938c067d5c0f37c16760ab7d1" +
+        "e6b17405b48b8432c6c4b92f73dffcae3af09aa7680260e3d407c4aeae0efddf000000000000000000000000000000000ba040dfcb8ef4d5a2cf434d165e9552" +
+        "00000000000000000000000000000000236b5d663dd136deadcdd2178a87cada0000000000000000000000000000000000000000000000000000000000000000" +
+        "d9a4eb25e5239b5cc9a1231361e2295900000000000008c0000000000000000000000000000000000000000000000000a3bb70dceb5ab4dc528d4a636e2c3959" +
+        "00000000000000000000000000000000fdb3d1402fe9b220a885f5abb7ab1b9d0000000000000000000000000000000000000000000000000000000000000000" +
+        "af3b1790d3fff43080abe12cfdc39dade99d652127e33d51dab1cb840accc9cd00000000000000000000000000000000c28b0f2de89c4342f13b554b658ccc3e" +
+        "0000000000000840000000000000000000000000000008c0000000000000a8bb0000000000000000000000000000000000000000000022c0000000000000c2bb" +
+        "d5933e4fee4ff5b72f9a6affac7d5534d5933e4fee4ff537188e4ffe017f55b400000000000000000000000000000000114530df6063fcafedfc7d04bdf871ac" +
+        "e50ce75b3ce0c3dbe15c2bd8583d52d83acd41a3c9914920b179901ced7de71c0000000000000000000000000000000060495eee78c31fbc60b8c22d936dbdb8" +
+        "0000000000001c4000000000000000003e59aeabf9090e3a200cb8b4edca92b600000000000000000000000000000000168e3876ba483a3ac8eabd03e01cbf36" +
+        "d67fa17305e24637061bafbbc236eb33000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000" +
+        "3c8159ba0366cb372edf786c642b6334cc364a151ac49a9df46b3d0d2cc7161a00000000000000000000000000000000e7a15b33caea769514ec8572f98ef011" +
+        "c5ac59b389ae0432cf8001d05b93a2aec5ac59b389ae04b2cf8001d05b93a22e000000000000000000000000000000009425fe37c8bb1aa4424d98022e0ebb20"
+
+    const val DD_DIV =
+        "4b5156310304400018000000000000001e7c4a7fb979379e6a00000000000000" +
+        "458f210a8fe6f25ca8732054e06a9259359ad50e3806e3aee4aaba761dd96dab000000000000000000000000000000008e90a9dfbecaffedd3d5fd854d959fea" +
+        "90abb69188fb96d38ca54aa805523450ae561c49fc7019e34aef2280f415bfdf0000000000000000000000000000000057c9ee4847e86c3080e68d9d512adbac" +
+        "aeb1331e9244ccbceb7e36c5387b3db9aeb1331e9244cc3c2662580efd7c3d3900000000000000000000000000000000000000000000f0bf19feffffffff9f3b" +
+        "9512ff1fbbae86af78b125bcdd0c0aac9512ff1fbbae862f78b125bcdd0c0a2c00000000000000000000000000000000000000000000f0bf0000000000000000" +
+        "2ac612f17c6d76268840f0116bdd1d232ac612f17c6d76a69b316d7f81dd1da300000000000000000000000000000000000000000000f0bf432900000000903b" +
+        "950b4e82704a3db72c8e5eda7bd6d83300000000000018c0000000000000000000000000000000000000000000000000b80734acf586133738a16b6ead1bba33" +
+        "774b367f6a9cbf310e71fe3ec7505b2e9ae7006d5acbc82966ba9ede560169a60000000000000000000000000000000008e4ab831a66e447fbc75f52896e8144" +
+        "282252621d4de1b22dc63525366f872fd5c333b5afcf3eda502073b4e888d756000000000000000000000000000000009bd33569fef79118a36e22c540960495" +
+        "52e2d237ffa533c806fc084d7191d8c4560365e41bdbceb807359b02efed3d35000000000000000000000000000000009f1aca128160544fa09c57694968fccb" +
+        "e2f184e6931abac197614096284f15be95be3a2b6c7dc5bb7b7bb8832b116ab8000000000000000000000000000000003e63d539696fe345412f0a1ebbb083c2" +
+        "0000000000000080000000000000000042dcdaa9f0bc309ecb47840bcd4cd59a0000000000000000000000000000000000000000000000000000000000000080" +
+        "0508bade2d4b6224ef0631a24d50d3a00000000000000080000000000000000000000000000000000000000000000000000000000000f07f0000000000000000" +
+        "87c8905724593ad3d2a3ad364832dd4faf29d72e6eabd5da7c6b38622441765700000000000000000000000000000000b128569757745338d75f73ca5986f334" +
+        "00000000000000800000000000000000f361860b5f663dbaa0fbb88df82fdfb60000000000000000000000000000000000000000000000000000000000000080" +
+        "90f0191aa193fc60c57421e3f56c885d17390abc0104c0639e3bd080718c6fe000000000000000000000000000000000a29b14e37a8c2c3d44492a87ebf9c739" +
+        "2bb2f9c81588c34eb2cfb10bd81324cb2bb2f9c81588c3ceb2cfb10bd813244b00000000000000000000000000000000000000000000f0bf0000000000000080" +
+        "00000000000014400000000000000000f93da0626743572bb42f6b0a373eec27000000000000000000000000000000000387c1a1da82ab547b6a516d04b7f750" +
+        "f8c50a5693bfb99a026d3221b6eb25970000000000000080000000000000000000000000000000000000000000000000000000000000f0ff0000000000000000" +
+        "b558bf50a88d67c38abd13ee29b3054013dd5622135d6554a2fb5de3b3de0651000000000000000000000000000000008371c988d7a3f1ae30dde91e54d97bab" +
+        "16a09ebc8b9f6a9eb5ae0e1ad876fa1a5d58e4d0fa27c454a0bbde5f7ecd69d1000000000000000000000000000000005497a6e2302295890878f8ce2fca3806" +
+        "51443d160140a1257188acda81ac4ba25ff6f7328e342a644f83f55a2e2cb4e000000000000000000000000000000000c9eb62d180106501ec2d0e0000000000" +
+        "eecb2cc6b99813bfa3449fb1b0b7b23b3b474735b60830a05780f693cc8ddb1c00000000000000000000000000000000409de50a148ed35e920b6268a99e605b" +
+        "0000000000001cc00000000000000000b2b9c85c77e4b4e4883f9f3c1bda4ee100000000000000000000000000000000071757b77271551b8cd179476157fd17" +
+        "fe22f9d57dc757b900000000000000007277c62df01df0c039efac99e7ea953d00000000000000000000000000000000bbc117f4519b5738d0448cfe752aceb4"
+
+    const val DD_SQRT =
+        "4b5156310305400018000000000000001f7c4a7fb979379e6a00000000000000" +
+        "6ca9a764a0620c36138fc005f3caafb2000000000000000000000000000000000000000000000000000000000000000012f794cb7323fe3adbb80740d88493b7" +
+        "2ce8b4986da2b249e52e7d4a4d7955c60000000000000000000000000000000000000000000000000000000000000000b4c5a5cb5e44d1441e3958fa30027941" +
+        "d4029872d225354f778bf86d63f2d64b000000000000000000000000000000000000000000000000000000000000000041d149150965924785920149a24b3944" +
+        "c727833b8ed6362d00000000000000000000000000000000000000000000000000000000000000000000000000000000470205119e1d9336910bf683be303d33" +
+        "44f9adb161698a5d981b65c1f6e526da0000000000000000000000000000000000000000000000000000000000000000c78526086512bd4e35d6d003acfb5bcb" +
+        "af34613c18cea853f43e00052fd229d00000000000000000000000000000000000000000000000000000000000000000dbfa06cb7c2ccc497f6a3ce244e25ec6" +
+        "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000" +
+        "95ec3d39594dd1298657995ec7f861a6000000000000000000000000000000000000000000000000000000000000000077fa521a6aa3e034109b6c93579d8a31" +
+        "0000000000001c4000000000000000000000000000000000000000000000000000000000000000000000000000000000eaf8d2a97f2a054079c033b0621ca2bc" +
+        "0b8ca6cff0d8305eb28aaa0d33f8d05a00000000000000000000000000000000000000000000000000000000000000003d226826126b104f6d8fc993b407ba4b" +
+        "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000" +
+        "f41ee7012da197252c73b1e3d95f3da20000000000000000000000000000000000000000000000000000000000000000bc738451b171c3321cbd36044ee5582f" +
+        "40cd941f197b42208288f3d8f0adea1c000000000000000000000000000000000000000000000000000000000000000058580a498651183014df2d73932e9eac" +
+        "5c625ddd94fd465c005265038273aad80000000000000000000000000000000000000000000000000000000000000000eac671edad1f1b4e9e9fc14902cdacca" +
+        "00000000000000800000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000800000000000000000" +
+        "4bea40d241e7976498434001d405aae00000000000000000000000000000000000000000000000000000000000000000e8c1498d718e43526c69ab5ed728e24e" +
+        "1b287539ad639d41b06dead32dd930be000000000000000000000000000000000000000000000000000000000000000002768ce74dafc5408665bd89bd716c3d" +
+        "000000000000144000000000000000000000000000000000000000000000000000000000000000000000000000000000a8f4979b77e3014018fdfc1963509fbc" +
+        "936a505e072db11f1f370db3982f269c0000000000000000000000000000000000000000000000000000000000000000dfaf5a9bd893d02f071e4704e628652c" +
+        "13e70288d8b5315363e473c1b016aa4f0000000000000000000000000000000000000000000000000000000000000000de37b99c5dd590498bd2a49af5c635c6" +
+        "4b7d6ed6ea70283f90e2e5f39717bf3b00000000000000000000000000000000000000000000000000000000000000002b6b1f4b60f78b3f8f7141e6b2be25bc" +
+        "f193e38a3f76172693d526877761b622000000000000000000000000000000000000000000000000000000000000000070fca4cfff5f03335f0ccacd987a61af" +
+        "c0e0131d2a9e565e7c3cad10c914fa5a0000000000000000000000000000000000000000000000000000000000000000da108bd9f505234f0481531a5f4ebfcb" +
+        "181ce5852d65c837175e012f1a7d6bb4000000000000000000000000000000000000000000000000000000000000000012194f18a8f0db3bb1c6491e4a6a5538"
+}
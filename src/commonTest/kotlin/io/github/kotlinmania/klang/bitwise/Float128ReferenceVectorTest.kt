@@ -0,0 +1,123 @@
+package io.github.kotlinmania.klang.bitwise
+
+import io.github.kotlinmania.klang.fp.CFloat128
+import io.github.kotlinmania.klang.int.UInt128
+import io.github.kotlinmania.klang.mem.GlobalHeap
+import io.github.kotlinmania.klang.mem.KMalloc
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+
+/**
+ * Conformance against `tools/float128_vectorgen.c` output.
+ *
+ * The embedded [Float128ReferenceSamples] are small; larger runs feed a
+ * generated `.kqv` file through the same [ReferenceVectors] stream.
+ */
+class Float128ReferenceVectorTest {
+    private fun setup() {
+        GlobalHeap.init(1 shl 20)
+        KMalloc.init(1 shl 18)
+    }
+
+    private fun run(hex: String, chunkSize: Int = 4096, check: (UInt128, UInt128, UInt128, UInt128) -> Unit): ReferenceVectors.Header {
+        val bytes = ReferenceVectors.hexToBytes(hex)
+        val stream = ReferenceVectors(check)
+        var pos = 0
+        while (pos < bytes.size) {
+            val n = minOf(chunkSize, bytes.size - pos)
+            stream.feed(bytes, pos, n)
+            pos += n
+        }
+        return stream.finish()
+    }
+
+    private fun assertFloat128(expected: UInt128, actual: UInt128, label: String) {
+        if (Float128Math.isNaN(expected) && Float128Math.isNaN(actual)) return
+        assertEquals(expected.toHexString(), actual.toHexString(), label)
+    }
+
+    private fun checkFloat128(hex: String, op: (UInt128, UInt128, UInt128) -> UInt128) {
+        setup()
+        val header = run(hex) { a, b, c, r ->
+            assertFloat128(r, op(a, b, c), "a=${a.toHexString()} b=${b.toHexString()} c=${c.toHexString()}")
+        }
+        assertEquals(ReferenceVectors.FLAVOR_F128, header.flavor)
+        assertEquals(113, header.precisionBits)
+    }
+
+    private fun dd(field: UInt128) = CFloat128(ReferenceVectors.ddHi(field), ReferenceVectors.ddLo(field))
+
+    private fun checkDoubleDouble(hex: String, op: (CFloat128, CFloat128) -> CFloat128) {
+        setup()
+        val header = run(hex) { a, b, _, r ->
+            val expected = dd(r)
+            val actual = op(dd(a), dd(b))
+            val label = "a=${dd(a)} b=${dd(b)}"
+            if (expected.hi.isNaN()) {
+                assertEquals(true, actual.hi.isNaN(), label)
+            } else {
+                assertEquals(expected.hi.toRawBits(), actual.hi.toRawBits(), "$label (hi)")
+                assertEquals(expected.lo.toRawBits(), actual.lo.toRawBits(), "$label (lo)")
+            }
+        }
+        assertEquals(ReferenceVectors.FLAVOR_DD, header.flavor)
+    }
+
+    @Test
+    fun float128Add() = checkFloat128(Float128ReferenceSamples.F128_ADD) { a, b, _ -> Float128Math.addBits(a, b) }
+
+    @Test
+    fun float128Sub() = checkFloat128(Float128ReferenceSamples.F128_SUB) { a, b, _ -> Float128Math.subBits(a, b) }
+
+    @Test
+    fun float128Mul() = checkFloat128(Float128ReferenceSamples.F128_MUL) { a, b, _ -> Float128Math.mulBits(a, b) }
+
+    @Test
+    fun float128Div() = checkFloat128(Float128ReferenceSamples.F128_DIV) { a, b, _ -> Float128Math.divBits(a, b) }
+
+    @Test
+    fun float128Sqrt() = checkFloat128(Float128ReferenceSamples.F128_SQRT) { a, _, _ -> Float128Math.sqrtBits(a) }
+
+    @Test
+    fun float128Fma() = checkFloat128(Float128ReferenceSamples.F128_FMA) { a, b, c -> Float128Math.fmaBits(a, b, c) }
+
+    @Test
+    fun doubleDoubleAdd() = checkDoubleDouble(Float128ReferenceSamples.DD_ADD) { a, b -> a + b }
+
+    @Test
+    fun doubleDoubleSub() = checkDoubleDouble(Float128ReferenceSamples.DD_SUB) { a, b -> a - b }
+
+    @Test
+    fun doubleDoubleMul() = checkDoubleDouble(Float128ReferenceSamples.DD_MUL) { a, b -> a * b }
+
+    @Test
+    fun doubleDoubleDiv() = checkDoubleDouble(Float128ReferenceSamples.DD_DIV) { a, b -> a / b }
+
+    @Test
+    fun doubleDoubleSqrt() = checkDoubleDouble(Float128ReferenceSamples.DD_SQRT) { a, _ -> a.sqrt() }
+
+    @Test
+    fun streamHandlesRecordsSplitAcrossChunks() {
+        setup()
+        val whole = mutableListOf<String>()
+        run(Float128ReferenceSamples.F128_MUL) { a, _, _, r -> whole.add(a.toHexString() + r.toHexString()) }
+        val split = mutableListOf<String>()
+        // 7 divides neither the 32-byte header nor the 64-byte record
+        val header = run(Float128ReferenceSamples.F128_MUL, chunkSize = 7) { a, _, _, r -> split.add(a.toHexString() + r.toHexString()) }
+        assertEquals(whole, split)
+        assertEquals(header.count, split.size.toLong())
+        assertEquals(ReferenceVectors.OP_MUL, header.op)
+    }
+
+    @Test
+    fun streamRejectsBadInput() {
+        val valid = ReferenceVectors.hexToBytes(Float128ReferenceSamples.F128_ADD)
+        assertFailsWith<IllegalArgumentException> {
+            ReferenceVectors { _, _, _, _ -> }.feed(valid.copyOf().also { it[0] = 0 })
+        }
+        assertFailsWith<IllegalStateException> {
+            ReferenceVectors { _, _, _, _ -> }.apply { feed(valid, 0, valid.size - 1) }.finish()
+        }
+    }
+}
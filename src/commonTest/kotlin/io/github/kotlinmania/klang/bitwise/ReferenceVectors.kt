@@ -0,0 +1,141 @@
+package io.github.kotlinmania.klang.bitwise
+
+import io.github.kotlinmania.klang.int.UInt128
+
+/**
+ * Streaming decoder for KQV1 reference-vector files written by
+ * `tools/float128_vectorgen.c`.
+ *
+ * A file is a 32-byte header followed by 64-byte records of four 16-byte
+ * little-endian fields (a, b, c, result). [feed] accepts the file in chunks
+ * of any size, so a multi-gigabyte conformance run never has to be in memory
+ * at once; complete records are handed to the callback as they arrive.
+ *
+ * Field encoding depends on [Header.flavor]:
+ * - [FLAVOR_F128], [FLAVOR_LD]: binary128 bit pattern ([UInt128.lo] is the low word)
+ * - [FLAVOR_DD]: double-double, [ddHi] / [ddLo] give the two Double components
+ */
+internal class ReferenceVectors(
+    private val onRecord: (a: UInt128, b: UInt128, c: UInt128, result: UInt128) -> Unit,
+) {
+    class Header(val flavor: Int, val op: Int, val count: Long, val seed: Long, val precisionBits: Int)
+
+    private val pending = ByteArray(RECORD_BYTES)
+    private var pendingSize = 0
+    private var headerBytes: ByteArray? = ByteArray(HEADER_BYTES)
+
+    /** Parsed header, available once the first 32 bytes have been fed. */
+    var header: Header? = null
+        private set
+
+    /** Records delivered so far. */
+    var records: Long = 0
+        private set
+
+    /** Feed the next [length] bytes of the file, starting at [offset] in [chunk]. */
+    fun feed(chunk: ByteArray, offset: Int = 0, length: Int = chunk.size - offset) {
+        var pos = offset
+        val end = offset + length
+        headerBytes?.let { h ->
+            val n = minOf(HEADER_BYTES - pendingSize, end - pos)
+            chunk.copyInto(h, pendingSize, pos, pos + n)
+            pendingSize += n
+            pos += n
+            if (pendingSize < HEADER_BYTES) return
+            header = parseHeader(h)
+            headerBytes = null
+            pendingSize = 0
+        }
+        // Finish a record split across chunks
+        if (pendingSize > 0) {
+            val n = minOf(RECORD_BYTES - pendingSize, end - pos)
+            chunk.copyInto(pending, pendingSize, pos, pos + n)
+            pendingSize += n
+            pos += n
+            if (pendingSize < RECORD_BYTES) return
+            emit(pending, 0)
+            pendingSize = 0
+        }
+        // Whole records straight out of the chunk
+        while (end - pos >= RECORD_BYTES) {
+            emit(chunk, pos)
+            pos += RECORD_BYTES
+        }
+        chunk.copyInto(pending, 0, pos, end)
+        pendingSize = end - pos
+    }
+
+    /** Check that the stream ended on a record boundary with the advertised record count. */
+    fun finish(): Header {
+        val h = checkNotNull(header) { "Truncated reference vectors: no header" }
+        check(pendingSize == 0) { "Truncated reference vectors: partial record" }
+        check(records == h.count) { "Reference vectors: expected ${h.count} records, got $records" }
+        return h
+    }
+
+    private fun emit(bytes: ByteArray, at: Int) {
+        check(records < header!!.count) { "Reference vectors: more records than the header declares" }
+        onRecord(field(bytes, at), field(bytes, at + 16), field(bytes, at + 32), field(bytes, at + 48))
+        records++
+    }
+
+    companion object {
+        const val FLAVOR_F128 = 1
+        const val FLAVOR_LD = 2
+        const val FLAVOR_DD = 3
+
+        const val OP_ADD = 1
+        const val OP_SUB = 2
+        const val OP_MUL = 3
+        const val OP_DIV = 4
+        const val OP_SQRT = 5
+        const val OP_FMA = 6
+
+        const val HEADER_BYTES = 32
+        const val RECORD_BYTES = 64
+
+        /** High component of a double-double field. */
+        fun ddHi(field: UInt128): Double = Double.fromBits(field.lo)
+
+        /** Low component of a double-double field. */
+        fun ddLo(field: UInt128): Double = Double.fromBits(field.hi)
+
+        /** Decode a lowercase or uppercase hex string (the `--kotlin-samples` encoding). */
+        fun hexToBytes(hex: String): ByteArray {
+            require(hex.length % 2 == 0) { "Odd hex length" }
+            return ByteArray(hex.length / 2) { i -> ((nibble(hex[2 * i]) shl 4) or nibble(hex[2 * i + 1])).toByte() }
+        }
+
+        private fun nibble(c: Char): Int = when (c) {
+            in '0'..'9' -> c - '0'
+            in 'a'..'f' -> c - 'a' + 10
+            in 'A'..'F' -> c - 'A' + 10
+            else -> throw IllegalArgumentException("Invalid hex digit '$c'")
+        }
+
+        private fun parseHeader(h: ByteArray): Header {
+            require(h[0] == 'K'.code.toByte() && h[1] == 'Q'.code.toByte() && h[2] == 'V'.code.toByte() && h[3] == '1'.code.toByte()) {
+                "Not a KQV1 reference-vector file"
+            }
+            val recordSize = u16(h, 6)
+            require(recordSize == RECORD_BYTES) { "Unsupported record size $recordSize" }
+            return Header(
+                flavor = h[4].toInt() and 0xFF,
+                op = h[5].toInt() and 0xFF,
+                count = u64(h, 8),
+                seed = u64(h, 16),
+                precisionBits = u16(h, 24),
+            )
+        }
+
+        private fun u16(b: ByteArray, at: Int): Int = (b[at].toInt() and 0xFF) or ((b[at + 1].toInt() and 0xFF) shl 8)
+
+        private fun u64(b: ByteArray, at: Int): Long {
+            var v = 0L
+            for (i in 7 downTo 0) v = (v shl 8) or (b[at + i].toLong() and 0xFF)
+            return v
+        }
+
+        private fun field(b: ByteArray, at: Int): UInt128 = UInt128(u64(b, at + 8), u64(b, at))
+    }
+}
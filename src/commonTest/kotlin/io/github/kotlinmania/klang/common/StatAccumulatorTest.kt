@@ -0,0 +1,121 @@
+package io.github.kotlinmania.klang.common
+
+import kotlinx.coroutines.test.runTest
+import kotlin.math.abs
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertTrue
+
+class StatAccumulatorTest {
+    private fun assertClose(expected: Double, actual: Double, message: String) {
+        val tol = 1e-9 * maxOf(1.0, abs(expected))
+        assertTrue(abs(expected - actual) <= tol, "$message: expected $expected, got $actual")
+    }
+
+    private fun sample(n: Int): FloatArray {
+        var seed = 2463534242L
+        return FloatArray(n) {
+            seed = (seed * 6364136223846793005L + 1442695040888963407L)
+            1000.0f + ((seed ushr 40).toInt() % 20001 - 10000) * 0.01f
+        }
+    }
+
+    @Test
+    fun describeBasics() {
+        val s = StatOps.describe(floatArrayOf(1.0f, 2.0f, 3.0f, 4.0f, 5.0f), center = 3.0f)
+        assertEquals(5L, s.count)
+        assertEquals(3.0, s.mean)
+        assertEquals(2.0, s.variance)
+        assertEquals(2.5, s.sampleVariance)
+        assertEquals(1.0f, s.min)
+        assertEquals(5.0f, s.max)
+        assertClose(1.2, s.meanAbsoluteDeviation, "mad")
+    }
+
+    @Test
+    fun addMatchesAddAll() {
+        val data = sample(1000)
+        val one = StatAccumulator(7.0f)
+        for (v in data) one.add(v)
+        val bulk = StatAccumulator(7.0f).apply { addAll(data) }
+        assertEquals(one.count, bulk.count)
+        assertEquals(one.mean, bulk.mean)
+        assertEquals(one.m2, bulk.m2)
+        assertEquals(one.absDeviationSum, bulk.absDeviationSum)
+        assertEquals(one.min, bulk.min)
+        assertEquals(one.max, bulk.max)
+    }
+
+    @Test
+    fun mergeMatchesSinglePass() {
+        val data = sample(4099)
+        val whole = StatOps.describe(data)
+        for (split in intArrayOf(0, 1, 17, 2048, 4098, 4099)) {
+            val left = StatOps.describe(data, 0, split)
+            left.merge(StatOps.describe(data, split, data.size - split))
+            assertEquals(whole.count, left.count, "count @$split")
+            assertClose(whole.mean, left.mean, "mean @$split")
+            assertClose(whole.m2, left.m2, "m2 @$split")
+            assertClose(whole.absDeviationSum, left.absDeviationSum, "abs @$split")
+            assertEquals(whole.min, left.min, "min @$split")
+            assertEquals(whole.max, left.max, "max @$split")
+        }
+    }
+
+    @Test
+    fun describeParallelMatchesDescribe() = runTest {
+        // 3 * 8192 + 777 is not a multiple of any chunk size; 5000 stays sequential
+        val data = sample(3 * 8192 + 777 + 13)
+        for ((offset, length) in listOf(13 to 3 * 8192 + 777, 0 to 3 * 8192 + 790, 5 to 5000)) {
+            for (parallelism in intArrayOf(0, 2, 3, 8)) {
+                val seq = StatOps.describe(data, offset, length, center = 999.0f)
+                val par = StatOps.describeParallel(data, offset, length, center = 999.0f, parallelism = parallelism)
+                val ctx = "offset=$offset length=$length p=$parallelism"
+                assertEquals(seq.count, par.count, "count $ctx")
+                assertClose(seq.mean, par.mean, "mean $ctx")
+                assertClose(seq.m2, par.m2, "m2 $ctx")
+                assertClose(seq.absDeviationSum, par.absDeviationSum, "abs $ctx")
+                assertEquals(seq.min, par.min, "min $ctx")
+                assertEquals(seq.max, par.max, "max $ctx")
+            }
+        }
+        assertFailsWith<IllegalArgumentException> { StatOps.describeParallel(data, 1, data.size) }
+    }
+
+    @Test
+    fun varianceStableWithLargeOffset() {
+        // Float sum-of-squares would cancel catastrophically around 1e4
+        val data = FloatArray(10000) { 10000.0f + (it % 2) }
+        assertClose(0.25, StatOps.describe(data).variance, "variance")
+        assertEquals(0.25f, StatOps.variance(data))
+    }
+
+    @Test
+    fun varianceDefaultAgreesWithExplicitMean() {
+        val data = floatArrayOf(1.0f, 2.0f, 3.0f, 4.0f, 5.0f)
+        assertEquals(2.0f, StatOps.variance(data))
+        assertEquals(2.0f, StatOps.variance(data, mean = 3.0f))
+        assertEquals(0.0f, StatOps.variance(data, 2, 0))
+    }
+
+    @Test
+    fun emptyAndReset() {
+        val acc = StatAccumulator()
+        assertEquals(0.0, acc.variance)
+        assertEquals(0.0, acc.meanAbsoluteDeviation)
+        acc.merge(StatAccumulator())
+        assertEquals(0L, acc.count)
+        acc.addAll(floatArrayOf(4.0f, 6.0f))
+        acc.reset()
+        assertEquals(0L, acc.count)
+        assertEquals(Float.POSITIVE_INFINITY, acc.min)
+    }
+
+    @Test
+    fun mergeRejectsDifferentCenters() {
+        assertFailsWith<IllegalArgumentException> {
+            StatAccumulator(0.0f).merge(StatAccumulator(1.0f))
+        }
+    }
+}
@@ -0,0 +1,123 @@
+package io.github.kotlinmania.klang.common
+
+import io.github.kotlinmania.klang.mem.GlobalHeap
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+
+class StructArrayTest {
+    // struct Particle { float x; float y; double mass; short tag; }
+    private val particle = StructLayout.layoutStruct(
+        listOf(StructLayout.Field(4, 4), StructLayout.Field(4, 4), StructLayout.Field(8, 8), StructLayout.Field(2, 2)),
+    )
+    private val modes = listOf(StructArrayMode.AOS, StructArrayMode.SOA, StructArrayMode.AOSOA(4), StructArrayMode.AOSOA(1))
+
+    private fun fill(a: StructArray) {
+        for (i in 0 until a.count) {
+            a.setFloat(i, 0, i + 0.5f)
+            a.setFloat(i, 1, -i.toFloat())
+            a.setDouble(i, 2, i * 1.25)
+            a.setShort(i, 3, (i * 3).toShort())
+        }
+    }
+
+    private fun assertRecords(a: StructArray) {
+        for (i in 0 until a.count) {
+            assertEquals(i + 0.5f, a.getFloat(i, 0), "x[$i] in ${a.mode}")
+            assertEquals(-i.toFloat(), a.getFloat(i, 1), "y[$i] in ${a.mode}")
+            assertEquals(i * 1.25, a.getDouble(i, 2), "mass[$i] in ${a.mode}")
+            assertEquals((i * 3).toShort(), a.getShort(i, 3), "tag[$i] in ${a.mode}")
+        }
+    }
+
+    @Test
+    fun aosMatchesHandWrittenCAddressing() {
+        GlobalHeap.init(1 shl 16)
+        val a = StructLayout.arrayOf(particle, 10)
+        assertEquals(24, particle.size)
+        assertEquals(intArrayOf(4, 4, 8, 2).toList(), particle.fieldSizes.toList())
+        for (i in 0 until 10) for (f in 0 until 4) {
+            assertEquals(a.base + i * particle.size + particle.offsets[f], a.fieldAddr(i, f))
+        }
+        assertEquals(0, a.base % particle.align)
+    }
+
+    @Test
+    fun everyModeStoresDisjointFieldsInsideItsFootprint() {
+        GlobalHeap.init(1 shl 16)
+        val n = 13
+        for (mode in modes) {
+            val a = StructLayout.arrayOf(particle, n, mode)
+            val seen = HashSet<Int>()
+            for (i in 0 until n) for (f in 0 until 4) {
+                val addr = a.fieldAddr(i, f)
+                assertEquals(0, addr % particle.fieldSizes[f], "alignment of ($i, $f) in $mode")
+                for (b in 0 until particle.fieldSizes[f]) assertEquals(true, seen.add(addr + b), "overlap at ($i, $f) in $mode")
+                assertEquals(true, addr >= a.base && addr + particle.fieldSizes[f] <= a.base + a.byteSize)
+            }
+            fill(a)
+            assertRecords(a)
+        }
+        val soa = StructLayout.arrayOf(particle, 8, StructArrayMode.SOA)
+        assertEquals(soa.fieldAddr(0, 0) + 4, soa.fieldAddr(1, 0), "SOA columns are contiguous")
+    }
+
+    @Test
+    fun cursorsAndForEachFieldVisitRecordsInOrder() {
+        GlobalHeap.init(1 shl 16)
+        for (mode in modes) {
+            val a = StructLayout.arrayOf(particle, 11, mode)
+            for (f in 0 until 4) {
+                val c = a.cursor(f, start = 2)
+                for (i in 2 until 11) {
+                    assertEquals(a.fieldAddr(i, f), c.addr, "cursor ($i, $f) in $mode")
+                    c.advance()
+                }
+                val visited = ArrayList<Int>()
+                a.forEachField(f, from = 1, to = 10) { i, addr ->
+                    assertEquals(a.fieldAddr(i, f), addr)
+                    visited.add(i)
+                }
+                assertEquals((1 until 10).toList(), visited)
+            }
+        }
+    }
+
+    @Test
+    fun columnTransfersUseEveryMode() {
+        GlobalHeap.init(1 shl 16)
+        val n = 19
+        val xs = FloatArray(n) { it * 0.75f }
+        val ms = DoubleArray(n) { 100.0 - it }
+        for (mode in modes) {
+            val a = StructLayout.arrayOf(particle, n, mode)
+            a.writeFloats(0, xs)
+            a.writeDoubles(2, ms)
+            for (i in 0 until n) assertEquals(xs[i], a.getFloat(i, 0))
+            val back = FloatArray(n + 2)
+            a.readFloats(0, back, off = 2, from = 3, n = n - 3)
+            assertEquals(xs.copyOfRange(3, n).toList(), back.copyOfRange(2, n - 1).toList())
+            val mb = DoubleArray(n)
+            a.readDoubles(2, mb)
+            assertEquals(ms.toList(), mb.toList())
+        }
+        val a = StructLayout.arrayOf(particle, n)
+        assertFailsWith<IllegalArgumentException> { a.readDoubles(0, DoubleArray(n)) }
+        assertFailsWith<IllegalArgumentException> { a.writeFloats(0, xs, from = 1, n = n) }
+    }
+
+    @Test
+    fun convertBetweenLayoutsPreservesRecords() {
+        GlobalHeap.init(1 shl 17)
+        val n = 21
+        for (from in modes) for (to in modes) {
+            val src = StructLayout.arrayOf(particle, n, from)
+            fill(src)
+            val dst = src.convert(to)
+            assertEquals(to, dst.mode)
+            assertRecords(dst)
+        }
+        val mismatched = StructLayout.arrayOf(particle, n - 1)
+        assertFailsWith<IllegalArgumentException> { StructLayout.arrayOf(particle, n).copyTo(mismatched) }
+    }
+}
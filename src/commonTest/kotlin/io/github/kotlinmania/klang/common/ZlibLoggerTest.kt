@@ -0,0 +1,125 @@
+package io.github.kotlinmania.klang.common
+
+import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.launch
+import kotlinx.coroutines.test.runTest
+import kotlinx.coroutines.withContext
+import kotlin.test.AfterTest
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFalse
+import kotlin.test.assertTrue
+
+class ZlibLoggerTest {
+    @AfterTest
+    fun restore() {
+        ZlibLogger.setEnabled(false)
+        ZlibLogger.setDebug(false)
+        ZlibLogger.setBitwiseVerbose(false)
+        ZlibLogger.flush()
+        ZlibLogger.blockSink = ::logToFile
+        ZlibLogger.blockSize = 64 * 1024
+    }
+
+    /** Route blocks into a list; the sink runs on the writer thread, read only after flush(). */
+    private fun capture(): MutableList<String> {
+        val blocks = mutableListOf<String>()
+        ZlibLogger.blockSink = { blocks.add(it) }
+        return blocks
+    }
+
+    /** Message text of every captured line, timestamps and prefixes stripped. */
+    private fun messages(blocks: List<String>): List<String> =
+        blocks.joinToString("").lineSequence().filter { it.isNotEmpty() }.map { it.substringAfterLast("] ") }.toList()
+
+    @Test
+    fun lazyMessageSkippedWhenDisabled() {
+        ZlibLogger.setEnabled(false)
+        var built = 0
+        ZlibLogger.logHuffman("build") { built++; "never" }
+        ZlibLogger.log(ZlibLogger.INF_CODES, ZlibLogger.LEVEL_TRACE) { built++; "never" }
+        assertEquals(0, built)
+    }
+
+    @Test
+    fun presetsMapToCategoryBits() {
+        ZlibLogger.setEnabled(true)
+        assertTrue(ZlibLogger.isEnabled(ZlibLogger.INFLATE))
+        assertFalse(ZlibLogger.isEnabled(ZlibLogger.INFLATE, ZlibLogger.LEVEL_DEBUG))
+        assertFalse(ZlibLogger.isEnabled(ZlibLogger.BITWISE), "bitwise needs BITWISE_VERBOSE")
+        ZlibLogger.setDebug(true)
+        ZlibLogger.setBitwiseVerbose(true)
+        assertTrue(ZlibLogger.isEnabled(ZlibLogger.BITWISE, ZlibLogger.LEVEL_DEBUG))
+        assertFalse(ZlibLogger.isEnabled(ZlibLogger.CRC32, ZlibLogger.LEVEL_TRACE))
+    }
+
+    @Test
+    fun categoryLevelIsCumulativeAndIsolated() {
+        ZlibLogger.setEnabled(false)
+        ZlibLogger.setCategoryLevel(ZlibLogger.HUFFMAN, ZlibLogger.LEVEL_DEBUG)
+        assertTrue(ZlibLogger.isEnabled(ZlibLogger.HUFFMAN, ZlibLogger.LEVEL_INFO))
+        assertTrue(ZlibLogger.isEnabled(ZlibLogger.HUFFMAN, ZlibLogger.LEVEL_DEBUG))
+        assertFalse(ZlibLogger.isEnabled(ZlibLogger.HUFFMAN, ZlibLogger.LEVEL_TRACE))
+        assertFalse(ZlibLogger.isEnabled(ZlibLogger.TREE))
+        assertFalse(ZlibLogger.isEnabled(ZlibLogger.INF_TREE, ZlibLogger.LEVEL_TRACE))
+        ZlibLogger.setCategoryLevel(ZlibLogger.HUFFMAN, -1)
+        assertFalse(ZlibLogger.isEnabled(ZlibLogger.HUFFMAN))
+    }
+
+    @Test
+    fun linesStayInOrderAcrossBlocks() {
+        val blocks = capture()
+        ZlibLogger.blockSize = 64
+        ZlibLogger.setEnabled(true)
+        for (i in 0 until 2000) ZlibLogger.log("line $i")
+        ZlibLogger.flush()
+        assertEquals((0 until 2000).map { "line $it" }, messages(blocks))
+        assertTrue(blocks.size > 1 || logWriterMode == LogWriterMode.IMMEDIATE, "expected several blocks")
+    }
+
+    @Test
+    fun flushReturnsAfterFullQueue() = runTest {
+        val blocks = mutableListOf<String>()
+        var spin = 0L
+        ZlibLogger.blockSink = { block ->
+            // Slow sink so producers outrun the writer and fill the queue
+            repeat(20_000) { spin += it }
+            blocks.add(block)
+        }
+        ZlibLogger.blockSize = 32
+        ZlibLogger.setEnabled(true)
+        val producers = 8
+        val perProducer = 400
+        withContext(Dispatchers.Default) {
+            repeat(producers) { p ->
+                launch { for (i in 0 until perProducer) ZlibLogger.log("p$p $i") }
+            }
+        }
+        ZlibLogger.flush()
+        val got = messages(blocks)
+        assertEquals(producers * perProducer, got.size)
+        for (p in 0 until producers) {
+            assertEquals((0 until perProducer).map { "p$p $it" }, got.filter { it.startsWith("p$p ") }, "producer $p order")
+        }
+    }
+
+    @Test
+    fun failingSinkDoesNotStopWriter() {
+        val blocks = mutableListOf<String>()
+        var calls = 0
+        ZlibLogger.blockSink = { block ->
+            if (calls++ == 0) {
+                // The writer thread survives even an Error; producers only swallow Exceptions
+                if (logWriterMode == LogWriterMode.BACKGROUND) throw Error("sink failed") else throw IllegalStateException("sink failed")
+            }
+            blocks.add(block)
+        }
+        ZlibLogger.blockSize = 1
+        ZlibLogger.setEnabled(true)
+        ZlibLogger.log("lost")
+        ZlibLogger.flush()
+        for (i in 0 until 50) ZlibLogger.log("after $i")
+        ZlibLogger.flush()
+        assertEquals((0 until 50).map { "after $it" }, messages(blocks))
+    }
+}
@@ -0,0 +1,92 @@
+package io.github.kotlinmania.klang.fp
+
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertTrue
+
+class Float32ConfigTest {
+    private fun hex(bits: Int) = bits.toUInt().toString(16).padStart(8, '0')
+
+    @Test
+    fun softKernelsReproduceConformanceVectors() {
+        val v = Float32Conformance.VECTORS
+        for (i in v.indices step Float32Conformance.ROW) {
+            val label = "a=${hex(v[i])} b=${hex(v[i + 1])} c=${hex(v[i + 2])}"
+            assertEquals(hex(v[i + 3]), hex(Float32Math.addBits(v[i], v[i + 1])), "add $label")
+            assertEquals(hex(v[i + 4]), hex(Float32Math.subBits(v[i], v[i + 1])), "sub $label")
+            assertEquals(hex(v[i + 5]), hex(Float32Math.mulBits(v[i], v[i + 1])), "mul $label")
+            assertEquals(hex(v[i + 6]), hex(Float32Math.divBits(v[i], v[i + 1])), "div $label")
+            assertEquals(hex(v[i + 7]), hex(Float32Math.fmaBits(v[i], v[i + 1], v[i + 2])), "fma $label")
+        }
+    }
+
+    @Test
+    fun autoResolvesFromHostCheck() {
+        val expected = if (Float32Config.hostConformant) Float32Mode.NATIVE else Float32Mode.SOFT
+        assertEquals(expected, Float32Config.resolveMode(Float32Mode.AUTO))
+        assertEquals(Float32Mode.SOFT, Float32Config.resolveMode(Float32Mode.SOFT))
+    }
+
+    @Test
+    fun modesAgreeBitForBitIncludingNaN() {
+        val specials = intArrayOf(
+            0x00000000, 0x80000000.toInt(), 0x00000001, 0x007FFFFF, 0x00800000, 0x3F800000,
+            0x7F7FFFFF, 0x7F800000, 0xFF800000.toInt(), 0x7FC00000, 0x7F800001, 0xFFC12345.toInt(),
+        )
+        var seed = 12345
+        val values = IntArray(specials.size + 200) { i ->
+            if (i < specials.size) specials[i] else {
+                seed = seed * 1103515245 + 12345
+                seed
+            }
+        }
+        fun run(): IntArray {
+            val out = IntArray(values.size * 5)
+            for (i in values.indices) {
+                val a = Float.fromBits(values[i])
+                val b = Float.fromBits(values[(i * 7 + 3) % values.size])
+                val c = Float.fromBits(values[(i * 13 + 5) % values.size])
+                out[i * 5] = Float32Math.add(a, b).toRawBits()
+                out[i * 5 + 1] = Float32Math.sub(a, b).toRawBits()
+                out[i * 5 + 2] = Float32Math.mul(a, b).toRawBits()
+                out[i * 5 + 3] = Float32Math.div(a, b).toRawBits()
+                out[i * 5 + 4] = Float32Math.fma(a, b, c).toRawBits()
+            }
+            return out
+        }
+        var soft = IntArray(0)
+        var auto = IntArray(0)
+        Float32Config.withMode(Float32Mode.SOFT) { soft = run() }
+        Float32Config.withMode(Float32Mode.AUTO) { auto = run() }
+        for (i in soft.indices) assertEquals(hex(soft[i]), hex(auto[i]), "op ${i % 5} at ${i / 5}")
+    }
+
+    @Test
+    fun fmaRoundsOnce() {
+        // (1 + 2^-23)(1 - 2^-23) - 1 = -2^-46 exactly; mul-then-add rounds the product to 1
+        val a = Float.fromBits(0x3F800001)
+        val b = Float.fromBits(0x3F7FFFFE)
+        assertEquals(0.0f, Float32Math.add(Float32Math.mul(a, b), -1.0f))
+        assertEquals(hex(0xA8800000.toInt()), hex(Float32Math.fma(a, b, -1.0f).toRawBits()))
+        assertEquals(10.0f, Float32Math.fma(2.0f, 3.0f, 4.0f))
+    }
+
+    @Test
+    fun fmaBitsNaNRules() {
+        val inf = 0x7F800000
+        assertEquals(hex(0x7FC00001), hex(Float32Math.fmaBits(0x7F800001, 0x3F800000, 0x7FC00002)))
+        assertEquals(hex(0x7FC00002), hex(Float32Math.fmaBits(0x3F800000, 0x3F800000, 0x7F800002)))
+        assertEquals(hex(0x7FC00000), hex(Float32Math.fmaBits(inf, 0, 0x3F800000)))
+        assertEquals(hex(0x7FC00000), hex(Float32Math.fmaBits(inf, 0x3F800000, 0xFF800000.toInt())))
+        assertEquals(hex(inf), hex(Float32Math.fmaBits(inf, 0x3F800000, 0x3F800000)))
+    }
+
+    @Test
+    fun doubleToFloatRoundsJustAboveHalfMinSubnormal() {
+        // 0.75 * 2^-149 lies in [2^-150, 2^-149): nearest binary32 is the minimum subnormal
+        val d = 0.75 * Double.fromBits((1023L - 149) shl 52)
+        assertEquals(1, Float32Math.doubleToFloatBits(d.toRawBits()))
+        assertEquals(0, Float32Math.doubleToFloatBits((0.5 * Double.fromBits((1023L - 149) shl 52)).toRawBits()))
+        assertTrue(Float32Math.doubleToFloatBits((-0.75 * Double.fromBits((1023L - 149) shl 52)).toRawBits()) == 0x80000001.toInt())
+    }
+}
@@ -0,0 +1,125 @@
+package io.github.kotlinmania.klang.fp
+
+import io.github.kotlinmania.klang.bitwise.Float16Math
+import io.github.kotlinmania.klang.bitwise.HalfPrecisionMath
+import io.github.kotlinmania.klang.mem.GlobalHeap
+import io.github.kotlinmania.klang.mem.KMalloc
+import kotlin.random.Random
+import kotlin.test.BeforeTest
+import kotlin.test.Test
+import kotlin.test.assertEquals
+
+class HalfConvertTest {
+    @BeforeTest
+    fun setup() {
+        KMalloc.init(1 shl 18)
+    }
+
+    private val edgeBits = intArrayOf(
+        0, 1, 0x80000000.toInt(), 0x00800000, 0x387FFFFF, 0x38800000, 0x38801000, 0x38802000,
+        0x3F800000, 0x3F801000, 0x3F803000, 0x477FE000, 0x477FEFFF, 0x477FF000, 0x47800000,
+        0x7F7FFFFF, 0x7F800000, 0xFF800000.toInt(), 0x7FC00000, 0x7F800001, 0xFFC12345.toInt(),
+        0x7F810000, 0xC0490FDB.toInt(), 0x3F7FFF80, 0x3F7FFF7F,
+    )
+
+    private fun samples(): IntArray {
+        val rnd = Random(0xF16)
+        return edgeBits + IntArray(20000) { rnd.nextInt() }
+    }
+
+    @Test
+    fun f16DecodeMatchesScalarForAllCodes() {
+        for (h in 0 until 0x10000) {
+            assertEquals(Float16Math.toFloat32Bits(h), HalfPrecisionMath.f16ToF32Bits(h), "h=0x${h.toString(16)}")
+        }
+    }
+
+    @Test
+    fun f16EncodeMatchesScalar() {
+        for (f in samples()) {
+            assertEquals(Float16Math.fromFloat32Bits(f), HalfPrecisionMath.f32ToF16Bits(f), "f=0x${f.toUInt().toString(16)}")
+        }
+    }
+
+    @Test
+    fun bf16EncodeMatchesScalar() {
+        for (f in samples()) {
+            val expected = CBF16.fromFloatBits(f).toBits().toInt() and 0xFFFF
+            assertEquals(expected, HalfPrecisionMath.f32ToBf16Bits(f), "f=0x${f.toUInt().toString(16)}")
+        }
+        assertEquals(0x3F800000, HalfPrecisionMath.bf16ToF32Bits(0x3F80))
+    }
+
+    @Test
+    fun arrayOverloadsRoundTrip() {
+        val halves = ShortArray(0x10000) { it.toShort() }
+        val floats = FloatArray(halves.size)
+        HalfConvert.convertF16ToF32(halves, 0, floats, 0, halves.size)
+        val back = ShortArray(halves.size)
+        HalfConvert.convertF32ToF16(floats, 0, back, 0, floats.size)
+        for (h in 0 until 0x10000) {
+            val exp = (h ushr 10) and 0x1F
+            val frac = h and 0x3FF
+            val got = back[h].toInt() and 0xFFFF
+            when {
+                // NaN sign is not guaranteed to survive a Float round trip on every target
+                exp == 0x1F && frac != 0 -> assertEquals(Float16Math.NAN_BITS, got and 0x7FFF, "h=0x${h.toString(16)}")
+                exp == 0 -> assertEquals(h and 0x8000, got, "h=0x${h.toString(16)}") // subnormals flush on encode
+                else -> assertEquals(h, got, "h=0x${h.toString(16)}")
+            }
+        }
+
+        val src = floatArrayOf(1.0f, -2.5f, 3.0e38f, 1.0e-40f)
+        val bf = ShortArray(6)
+        HalfConvert.convertF32ToBF16(src, 0, bf, 2, src.size)
+        val out = FloatArray(4)
+        HalfConvert.convertBF16ToF32(bf, 2, out, 0, 4)
+        for (i in src.indices) assertEquals(CBF16.fromFloat(src[i]).toFloat(), out[i])
+    }
+
+    @Test
+    fun heapPathsMatchArraysAtEveryAlignment() {
+        val rnd = Random(77)
+        val n = 37
+        val floats = FloatArray(n) { Float.fromBits(rnd.nextInt(0x3000_0000, 0x4800_0000)) * if (rnd.nextBoolean()) 1f else -1f }
+        val f16 = ShortArray(n)
+        val bf16 = ShortArray(n)
+        HalfConvert.convertF32ToF16(floats, 0, f16, 0, n)
+        HalfConvert.convertF32ToBF16(floats, 0, bf16, 0, n)
+        for (srcMis in intArrayOf(0, 2, 4, 6)) {
+            for (dstMis in intArrayOf(0, 4)) {
+                val fAddr = KMalloc.malloc(n * 4 + 16)
+                val fBase = fAddr + (8 - (fAddr and 7)) % 8 + dstMis
+                val hAddr = KMalloc.malloc(n * 2 + 16)
+                val hBase = hAddr + (8 - (hAddr and 7)) % 8 + srcMis
+                GlobalHeap.writeFloats(fBase, floats)
+
+                HalfConvert.convertF32ToF16(fBase, hBase, n)
+                for (i in 0 until n) assertEquals(f16[i], GlobalHeap.lh(hBase + i * 2), "f16 enc $srcMis/$dstMis i=$i")
+                val decoded = FloatArray(n)
+                HalfConvert.convertF16ToF32(hBase, decoded, 0, n)
+                val expected = FloatArray(n)
+                HalfConvert.convertF16ToF32(f16, 0, expected, 0, n)
+                assertEquals(expected.toList(), decoded.toList())
+                HalfConvert.convertF16ToF32(hBase, fBase, n)
+                for (i in 0 until n) assertEquals(expected[i], GlobalHeap.lwf(fBase + i * 4), "f16 dec $srcMis/$dstMis i=$i")
+
+                GlobalHeap.writeFloats(fBase, floats)
+                HalfConvert.convertF32ToBF16(fBase, hBase, n)
+                for (i in 0 until n) assertEquals(bf16[i], GlobalHeap.lh(hBase + i * 2), "bf16 enc $srcMis/$dstMis i=$i")
+                HalfConvert.convertBF16ToF32(hBase, fBase, n)
+                val bfExpected = FloatArray(n)
+                HalfConvert.convertBF16ToF32(bf16, 0, bfExpected, 0, n)
+                for (i in 0 until n) assertEquals(bfExpected[i], GlobalHeap.lwf(fBase + i * 4), "bf16 dec $srcMis/$dstMis i=$i")
+            }
+        }
+        // Odd source addresses take the per-element path
+        val odd = KMalloc.malloc(2 * n + 8) + 1
+        for (i in 0 until n) GlobalHeap.sh(odd + i * 2, f16[i])
+        val decoded = FloatArray(n)
+        HalfConvert.convertF16ToF32(odd, decoded, 0, n)
+        val expected = FloatArray(n)
+        HalfConvert.convertF16ToF32(f16, 0, expected, 0, n)
+        assertEquals(expected.toList(), decoded.toList())
+    }
+}
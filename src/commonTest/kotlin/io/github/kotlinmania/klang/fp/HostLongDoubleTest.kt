@@ -0,0 +1,79 @@
+package io.github.kotlinmania.klang.fp
+
+import io.github.kotlinmania.klang.fp.HostLongDouble.Format
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertFalse
+import kotlin.test.assertNull
+
+class HostLongDoubleTest {
+    private fun encode(format: Format, vararg hi: Double): LongArray {
+        val out = LongArray(2 * hi.size)
+        HostLongDouble.fromDoubleDouble(format, hi, DoubleArray(hi.size), out)
+        return out
+    }
+
+    private fun decode(format: Format, words: LongArray): DoubleArray {
+        val hi = DoubleArray(words.size / 2)
+        HostLongDouble.toDoubleDouble(format, words, hi, DoubleArray(hi.size))
+        return hi
+    }
+
+    @Test
+    fun unavailableTargetsRejectEveryFormat() {
+        if (HostLongDouble.isAvailable) return
+        assertNull(HostLongDouble.longDoubleFlavor)
+        assertEquals(0, HostLongDouble.longDoubleMantissaBits)
+        for (f in Format.entries) {
+            assertFalse(HostLongDouble.isSupported(f))
+            assertFailsWith<UnsupportedOperationException> { HostLongDouble.add(f, LongArray(2), LongArray(2), LongArray(2)) }
+        }
+    }
+
+    @Test
+    fun batchedArithmeticMatchesExactResults() {
+        for (f in Format.entries) {
+            if (!HostLongDouble.isSupported(f)) continue
+            val a = encode(f, 1.0, 6.0, 1.5, 9.0)
+            val b = encode(f, 2.0, 3.0, 0.25, 2.0)
+            val out = LongArray(a.size)
+            HostLongDouble.add(f, a, b, out)
+            assertEquals(listOf(3.0, 9.0, 1.75, 11.0), decode(f, out).toList(), "$f add")
+            HostLongDouble.sub(f, a, b, out)
+            assertEquals(listOf(-1.0, 3.0, 1.25, 7.0), decode(f, out).toList(), "$f sub")
+            HostLongDouble.mul(f, a, b, out)
+            assertEquals(listOf(2.0, 18.0, 0.375, 18.0), decode(f, out).toList(), "$f mul")
+            HostLongDouble.div(f, a, b, out)
+            assertEquals(listOf(0.5, 2.0, 6.0, 4.5), decode(f, out).toList(), "$f div")
+            HostLongDouble.sqrt(f, a, out)
+            assertEquals(3.0, decode(f, out)[3], "$f sqrt")
+            assertFailsWith<IllegalArgumentException> { HostLongDouble.add(f, a, b, out, n = 5) }
+        }
+    }
+
+    @Test
+    fun encodingFollowsTheHostFormat() {
+        if (!HostLongDouble.isAvailable) return
+        val bits = HostLongDouble.longDoubleMantissaBits
+        val one = encode(Format.LONG_DOUBLE, 1.0).toList()
+        when (bits) {
+            53 -> assertEquals(listOf(1.0.toRawBits(), 0L), one)
+            64 -> assertEquals(listOf(Long.MIN_VALUE, 0x3FFFL), one)
+            113 -> assertEquals(listOf(0L, 0x3FFF_0000_0000_0000L), one)
+        }
+
+        // 1 + 2^-60 survives a round trip only with a significand of at least 61 bits
+        val w = LongArray(2)
+        HostLongDouble.fromDoubleDouble(Format.LONG_DOUBLE, doubleArrayOf(1.0), doubleArrayOf(0x1p-60), w)
+        val lo = DoubleArray(1)
+        HostLongDouble.toDoubleDouble(Format.LONG_DOUBLE, w, DoubleArray(1), lo)
+        assertEquals(if (bits >= 61) 0x1p-60 else 0.0, lo[0])
+
+        if (HostLongDouble.isSupported(Format.FLOAT128)) {
+            val two = encode(Format.FLOAT128, 2.0)
+            HostLongDouble.sqrt(Format.FLOAT128, two, two)
+            assertEquals(listOf(0xC908B2FB1366EA95uL.toLong(), 0x3FFF6A09E667F3BCL), two.toList())
+        }
+    }
+}
@@ -0,0 +1,161 @@
+package io.github.kotlinmania.klang.fp
+
+import io.github.kotlinmania.klang.bitwise.MxElementMath
+import io.github.kotlinmania.klang.mem.GlobalHeap
+import io.github.kotlinmania.klang.mem.KMalloc
+import kotlin.math.abs
+import kotlin.random.Random
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertTrue
+
+class MxCodecTest {
+    @Test
+    fun e4m3CodesRoundTripAtUnitScale() {
+        for (code in 0 until 256) {
+            if ((code and 0x7F) == MxElementMath.E4M3_NAN) {
+                assertTrue(MxCodec.decodeElement(MxElementFormat.E4M3, code).isNaN())
+                continue
+            }
+            val v = MxCodec.decodeElement(MxElementFormat.E4M3, code)
+            assertEquals(code, MxElementMath.encodeE4M3(v.toRawBits(), 0), "code=$code v=$v")
+        }
+        assertEquals(448.0f, MxCodec.decodeElement(MxElementFormat.E4M3, 0x7E))
+        assertEquals(-0.001953125f, MxCodec.decodeElement(MxElementFormat.E4M3, 0x81))
+    }
+
+    @Test
+    fun e2m1TableAndRounding() {
+        val values = floatArrayOf(0f, 0.5f, 1f, 1.5f, 2f, 3f, 4f, 6f)
+        for (code in 0 until 8) {
+            assertEquals(values[code], MxCodec.decodeElement(MxElementFormat.E2M1, code))
+            assertEquals(-values[code], MxCodec.decodeElement(MxElementFormat.E2M1, code or 8))
+        }
+        // Ties go to the even code; overflow saturates
+        assertEquals(0x2, MxElementMath.encodeE2M1(1.25f.toRawBits(), 0))
+        assertEquals(0x4, MxElementMath.encodeE2M1(2.5f.toRawBits(), 0))
+        assertEquals(0x6, MxElementMath.encodeE2M1(5.0f.toRawBits(), 0))
+        assertEquals(0x7, MxElementMath.encodeE2M1(100f.toRawBits(), 0))
+        assertEquals(0xF, MxElementMath.encodeE2M1((-7f).toRawBits(), 0))
+        assertEquals(0x0, MxElementMath.encodeE2M1(0.25f.toRawBits(), 0))
+        assertEquals(0x1, MxElementMath.encodeE2M1(0.3f.toRawBits(), 0))
+    }
+
+    @Test
+    fun scaleTracksBlockMaximum() {
+        val src = FloatArray(70) { 0.01f }
+        src[5] = -300f      // block 0: floor(log2 300) = 8
+        src[40] = 1.0f      // block 1: 0
+        for (i in 64 until 70) src[i] = 0f
+        val scales = ByteArray(MxCodec.scaleCount(src.size))
+        val elems = ByteArray(MxCodec.elementBytes(src.size, MxElementFormat.E2M1))
+        MxCodec.quantize(src.size, src, 0, MxElementFormat.E2M1, scales, 0, elems, 0)
+        assertEquals(3, scales.size)
+        assertEquals(127 + 8 - 2, scales[0].toInt() and 0xFF)
+        assertEquals(127 - 2, scales[1].toInt() and 0xFF)
+        assertEquals(0, scales[2].toInt())
+        val out = FloatArray(src.size)
+        MxCodec.dequantize(src.size, MxElementFormat.E2M1, scales, 0, elems, 0, out, 0)
+        assertEquals(-256f, out[5])
+        assertEquals(1.0f, out[40])
+    }
+
+    @Test
+    fun quantizeErrorIsBounded() {
+        val rnd = Random(0x3C)
+        val n = 200
+        val src = FloatArray(n) { (rnd.nextFloat() - 0.5f) * 20f }
+        val scales = ByteArray(MxCodec.scaleCount(n))
+        val elems = ByteArray(n)
+        MxCodec.quantize(n, src, 0, MxElementFormat.E4M3, scales, 0, elems, 0)
+        val out = FloatArray(n)
+        MxCodec.dequantize(n, MxElementFormat.E4M3, scales, 0, elems, 0, out, 0)
+        for (i in 0 until n) {
+            // 3 mantissa bits: relative error ≤ 2^-4 for normal values
+            assertTrue(abs(out[i] - src[i]) <= abs(src[i]) / 16f + 1e-4f, "i=$i ${src[i]} -> ${out[i]}")
+        }
+    }
+
+    @Test
+    fun fusedDotMatchesPerBlockReference() {
+        val rnd = Random(11)
+        for (format in MxElementFormat.entries) {
+            val n = 77
+            val w = FloatArray(n) { rnd.nextFloat() * 4f - 2f }
+            val x = FloatArray(n + 3) { rnd.nextFloat() - 0.5f }
+            val scales = ByteArray(MxCodec.scaleCount(n))
+            val elems = ByteArray(MxCodec.elementBytes(n, format))
+            MxCodec.quantize(n, w, 0, format, scales, 0, elems, 0)
+            val dq = FloatArray(n)
+            MxCodec.dequantize(n, format, scales, 0, elems, 0, dq, 0)
+            var ref = 0.0f
+            var i = 0
+            while (i < n) {
+                val len = minOf(MxCodec.BLOCK_SIZE, n - i)
+                ref = Float32Math.add(ref, VectorOps.dotBlocked(len, dq, i, x, 3 + i))
+                i += len
+            }
+            assertEquals(ref, MxCodec.dot(n, format, scales, 0, elems, 0, x, 3), "$format")
+        }
+    }
+
+    @Test
+    fun gemvRowsMatchDot() {
+        val rnd = Random(5)
+        val m = 3
+        val k = 45
+        val format = MxElementFormat.E2M1
+        val rowScales = MxCodec.scaleCount(k)
+        val rowBytes = MxCodec.elementBytes(k, format)
+        val scales = ByteArray(m * rowScales)
+        val elems = ByteArray(m * rowBytes)
+        for (r in 0 until m) {
+            val row = FloatArray(k) { rnd.nextFloat() - 0.5f }
+            MxCodec.quantize(k, row, 0, format, scales, r * rowScales, elems, r * rowBytes)
+        }
+        val x = FloatArray(k) { rnd.nextFloat() }
+        val y = FloatArray(m)
+        MxCodec.gemv(m, k, format, scales, 0, elems, 0, x, 0, y, 0)
+        for (r in 0 until m) {
+            assertEquals(MxCodec.dot(k, format, scales, r * rowScales, elems, r * rowBytes, x, 0), y[r])
+        }
+    }
+
+    @Test
+    fun heapPathMatchesByteArrays() {
+        KMalloc.init(1 shl 16)
+        val rnd = Random(23)
+        for (format in MxElementFormat.entries) {
+            val n = 101
+            val w = FloatArray(n) { rnd.nextFloat() * 8f - 4f }
+            val x = FloatArray(n) { rnd.nextFloat() }
+            val scales = ByteArray(MxCodec.scaleCount(n))
+            val elems = ByteArray(MxCodec.elementBytes(n, format))
+            MxCodec.quantize(n, w, 0, format, scales, 0, elems, 0)
+            val sAddr = KMalloc.malloc(scales.size)
+            val eAddr = KMalloc.malloc(elems.size) + 1
+            MxCodec.quantizeToHeap(n, w, 0, format, sAddr, eAddr)
+            for (i in scales.indices) assertEquals(scales[i], GlobalHeap.lb(sAddr + i))
+            for (i in elems.indices) assertEquals(elems[i], GlobalHeap.lb(eAddr + i))
+            val a = FloatArray(n)
+            val b = FloatArray(n)
+            MxCodec.dequantize(n, format, scales, 0, elems, 0, a, 0)
+            MxCodec.dequantizeFromHeap(n, format, sAddr, eAddr, b, 0)
+            assertEquals(a.toList(), b.toList())
+            assertEquals(MxCodec.dot(n, format, scales, 0, elems, 0, x, 0), MxCodec.dotHeap(n, format, sAddr, eAddr, x, 0))
+        }
+    }
+
+    @Test
+    fun specialValues() {
+        val src = floatArrayOf(Float.NaN, Float.POSITIVE_INFINITY, -1f, 0f)
+        val scales = ByteArray(1)
+        val elems = ByteArray(4)
+        MxCodec.quantize(4, src, 0, MxElementFormat.E4M3, scales, 0, elems, 0)
+        assertEquals(127 - 8, scales[0].toInt() and 0xFF)
+        assertEquals(0x7F, elems[0].toInt())
+        assertEquals(0x7E, elems[1].toInt())
+        assertEquals(0xF8, elems[2].toInt() and 0xFF) // -1 × 2^8 = -256
+        assertEquals(0x00, elems[3].toInt())
+    }
+}
@@ -2,9 +2,11 @@ package io.github.kotlinmania.klang.fp
 
 import io.github.kotlinmania.klang.mem.GlobalHeap
 import io.github.kotlinmania.klang.mem.KMalloc
+import io.github.kotlinmania.klang.mem.U32View
 import kotlin.test.Test
 import kotlin.test.assertEquals
 import kotlin.test.assertTrue
+import kotlin.test.assertFailsWith
 import kotlin.math.abs
 
 class VectorOpsTest {
@@ -211,4 +213,111 @@ class VectorOpsTest {
         // Should be very close (within floating-point tolerance)
         assertTrue(error < 1e-5f, "Cross-platform consistency failed, error: $error")
     }
+
+    /** Spec of the blocked order: lane i % 8, ascending, fixed pairwise combine. */
+    private fun blockedReference(length: Int, x: FloatArray, xOff: Int, y: FloatArray, yOff: Int): Float {
+        val lanes = FloatArray(VectorOps.BLOCK_LANES)
+        for (i in 0 until length) {
+            val lane = i % VectorOps.BLOCK_LANES
+            lanes[lane] = Float32Math.add(lanes[lane], Float32Math.mul(x[xOff + i], y[yOff + i]))
+        }
+        val s01 = Float32Math.add(lanes[0], lanes[1])
+        val s23 = Float32Math.add(lanes[2], lanes[3])
+        val s45 = Float32Math.add(lanes[4], lanes[5])
+        val s67 = Float32Math.add(lanes[6], lanes[7])
+        return Float32Math.add(Float32Math.add(s01, s23), Float32Math.add(s45, s67))
+    }
+
+    private fun pseudoRandom(n: Int, seed: Int): FloatArray {
+        var s = seed
+        return FloatArray(n) {
+            s = s * 1103515245 + 12345
+            ((s ushr 8) % 20001 - 10000) / 997.0f
+        }
+    }
+
+    private fun heapFloats(values: FloatArray): U32View {
+        val view = U32View(GlobalHeap.malloc(values.size * 4), values.size)
+        GlobalHeap.writeFloats(view.base, values)
+        return view
+    }
+
+    @Test
+    fun dotBlockedFollowsLaneOrderForEveryTailLength() {
+        setup()
+        val x = pseudoRandom(64, 1)
+        val y = pseudoRandom(64, 2)
+        for (n in 0..40) {
+            val expected = blockedReference(n, x, 3, y, 5)
+            assertEquals(expected.toRawBits(), VectorOps.dotBlocked(n, x, 3, y, 5).toRawBits(), "length $n")
+        }
+    }
+
+    @Test
+    fun dotBlockedHeapMatchesArray() {
+        setup()
+        val x = pseudoRandom(4099, 3)
+        val y = pseudoRandom(4099, 4)
+        val hx = heapFloats(x)
+        val hy = heapFloats(y)
+        assertEquals(
+            VectorOps.dotBlocked(4096, x, 3, y, 1).toRawBits(),
+            VectorOps.dotBlocked(4096, hx, 3, hy, 1).toRawBits(),
+        )
+        assertEquals(blockedReference(4095, x, 0, y, 0).toRawBits(), VectorOps.dotBlocked(4095, hx, 0, hy, 0).toRawBits())
+    }
+
+    @Test
+    fun gemvRowsAreBlockedDots() {
+        setup()
+        val m = 5
+        val k = 19
+        val lda = 23
+        val a = pseudoRandom(2 + m * lda, 5)
+        val x = pseudoRandom(k, 6)
+        val y = FloatArray(m + 1)
+        VectorOps.gemv(m, k, a, 2, lda, x, 0, y, 1)
+        for (i in 0 until m) {
+            assertEquals(VectorOps.dotBlocked(k, a, 2 + i * lda, x, 0).toRawBits(), y[1 + i].toRawBits(), "row $i")
+        }
+
+        val hy = U32View(GlobalHeap.malloc(m * 4), m)
+        VectorOps.gemv(m, k, heapFloats(a), 2, lda, heapFloats(x), 0, hy, 0)
+        for (i in 0 until m) assertEquals(y[1 + i].toRawBits(), hy.get(i), "heap row $i")
+    }
+
+    @Test
+    fun gemmElementsAreBlockedDotsAcrossPanels() {
+        setup()
+        // n spans more than one packed panel
+        val m = 3
+        val n = VectorOps.GEMM_PANEL + 7
+        val k = 13
+        val a = pseudoRandom(m * k, 7)
+        val b = pseudoRandom(k * n, 8)
+        val c = FloatArray(m * n)
+        VectorOps.gemm(m, n, k, a, 0, k, b, 0, n, c, 0, n)
+        val col = FloatArray(k)
+        for (i in 0 until m) {
+            for (j in 0 until n) {
+                for (p in 0 until k) col[p] = b[p * n + j]
+                assertEquals(VectorOps.dotBlocked(k, a, i * k, col, 0).toRawBits(), c[i * n + j].toRawBits(), "C[$i][$j]")
+            }
+        }
+
+        val hc = U32View(GlobalHeap.malloc(m * n * 4), m * n)
+        VectorOps.gemm(m, n, k, heapFloats(a), 0, k, heapFloats(b), 0, n, hc, 0, n)
+        for (idx in 0 until m * n) assertEquals(c[idx].toRawBits(), hc.get(idx), "heap C[$idx]")
+    }
+
+    @Test
+    fun gemmSmallExact() {
+        setup()
+        val a = floatArrayOf(1f, 2f, 3f, 4f)
+        val b = floatArrayOf(5f, 6f, 7f, 8f)
+        val c = FloatArray(4)
+        VectorOps.gemm(2, 2, 2, a, 0, 2, b, 0, 2, c, 0, 2)
+        assertEquals(listOf(19f, 22f, 43f, 50f), c.toList())
+        assertFailsWith<IllegalArgumentException> { VectorOps.gemm(2, 2, 2, a, 0, 1, b, 0, 2, c, 0, 2) }
+    }
 }
@@ -0,0 +1,144 @@
+package io.github.kotlinmania.klang.int
+
+import io.github.kotlinmania.klang.bitwise.BitShiftMode
+import io.github.kotlinmania.klang.mem.GlobalHeap
+import io.github.kotlinmania.klang.mem.KMalloc
+import kotlin.random.Random
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+
+class SwARArraysTest {
+    private val modes = listOf(BitShiftMode.NATIVE, BitShiftMode.ARITHMETIC, BitShiftMode.AUTO)
+
+    private class Op(
+        val name: String,
+        val ref: (Int, Int) -> Int,
+        val words: (LongArray, LongArray, LongArray, Int, BitShiftMode) -> Unit,
+        val heap: (Int, Int, Int, Int, BitShiftMode) -> Unit,
+    )
+
+    private fun ops(bits: Int): List<Op> {
+        val max = (1 shl bits) - 1
+        return if (bits == 8) listOf(
+            Op("avgRound", { x, y -> (x + y + 1) / 2 }, { a, b, d, n, m -> SwARArrays.avgU8(a, b, d, n, true, m) }, { a, b, d, n, m -> SwARArrays.avgU8(a, b, d, n, true, m) }),
+            Op("avgTrunc", { x, y -> (x + y) / 2 }, { a, b, d, n, m -> SwARArrays.avgU8(a, b, d, n, false, m) }, { a, b, d, n, m -> SwARArrays.avgU8(a, b, d, n, false, m) }),
+            Op("addSat", { x, y -> minOf(x + y, max) }, SwARArrays::addSatU8, SwARArrays::addSatU8),
+            Op("subSat", { x, y -> maxOf(x - y, 0) }, SwARArrays::subSatU8, SwARArrays::subSatU8),
+            Op("min", { x, y -> minOf(x, y) }, SwARArrays::minU8, SwARArrays::minU8),
+            Op("max", { x, y -> maxOf(x, y) }, SwARArrays::maxU8, SwARArrays::maxU8),
+        ) else listOf(
+            Op("avgRound", { x, y -> (x + y + 1) / 2 }, { a, b, d, n, m -> SwARArrays.avgU16(a, b, d, n, true, m) }, { a, b, d, n, m -> SwARArrays.avgU16(a, b, d, n, true, m) }),
+            Op("avgTrunc", { x, y -> (x + y) / 2 }, { a, b, d, n, m -> SwARArrays.avgU16(a, b, d, n, false, m) }, { a, b, d, n, m -> SwARArrays.avgU16(a, b, d, n, false, m) }),
+            Op("addSat", { x, y -> minOf(x + y, max) }, SwARArrays::addSatU16, SwARArrays::addSatU16),
+            Op("subSat", { x, y -> maxOf(x - y, 0) }, SwARArrays::subSatU16, SwARArrays::subSatU16),
+            Op("min", { x, y -> minOf(x, y) }, SwARArrays::minU16, SwARArrays::minU16),
+            Op("max", { x, y -> maxOf(x, y) }, SwARArrays::maxU16, SwARArrays::maxU16),
+        )
+    }
+
+    /** Random lanes with the edge values 0, 1, max-1 and max over-represented. */
+    private fun lanes(rnd: Random, n: Int, bits: Int): IntArray {
+        val max = (1 shl bits) - 1
+        val edges = intArrayOf(0, 1, max - 1, max)
+        return IntArray(n) { if (rnd.nextInt(4) == 0) edges[rnd.nextInt(4)] else rnd.nextInt(max + 1) }
+    }
+
+    private fun pack(v: IntArray, bits: Int): LongArray {
+        val per = 64 / bits
+        val out = LongArray((v.size + per - 1) / per)
+        for (i in v.indices) out[i / per] = out[i / per] or (v[i].toLong() shl ((i % per) * bits))
+        return out
+    }
+
+    private fun lane(words: LongArray, i: Int, bits: Int): Int {
+        val per = 64 / bits
+        return ((words[i / per] ushr ((i % per) * bits)) and ((1L shl bits) - 1)).toInt()
+    }
+
+    @Test
+    fun wordKernelsMatchScalarLanesInEveryMode() {
+        val rnd = Random(29)
+        for (bits in listOf(8, 16)) for (n in listOf(0, 1, 3, 4, 7, 8, 9, 15, 64, 203)) {
+            val x = lanes(rnd, n, bits)
+            val y = lanes(rnd, n, bits)
+            val a = pack(x, bits)
+            val b = pack(y, bits)
+            for (op in ops(bits)) for (mode in modes) {
+                val dst = LongArray(a.size) { -1L }
+                op.words(a, b, dst, n, mode)
+                val ctx = "${op.name} u$bits n=$n $mode"
+                for (i in 0 until n) assertEquals(op.ref(x[i], y[i]), lane(dst, i, bits), "$ctx lane $i")
+                // Lanes past n in the last word are preserved
+                for (i in n until dst.size * (64 / bits)) assertEquals((1 shl bits) - 1, lane(dst, i, bits), "$ctx tail $i")
+            }
+            val sad = (0 until n).sumOf { kotlin.math.abs(x[it] - y[it]).toLong() }
+            for (mode in modes) {
+                val got = if (bits == 8) SwARArrays.absDiffSumU8(a, b, n, mode) else SwARArrays.absDiffSumU16(a, b, n, mode)
+                assertEquals(sad, got, "sad u$bits n=$n $mode")
+            }
+        }
+    }
+
+    @Test
+    fun heapKernelsHandleMisalignedOperands() {
+        KMalloc.init(1 shl 16)
+        val base = KMalloc.malloc(3 * 1024)
+        val rnd = Random(7)
+        val n = 77
+        for (bits in listOf(8, 16)) {
+            val lb = bits / 8
+            for ((pa, pb, pd) in listOf(Triple(0, 0, 0), Triple(3, 3, 3), Triple(1, 5, 2), Triple(2, 0, 6), Triple(1, 1, 1))) {
+                val aAddr = base + pa
+                val bAddr = base + 1024 + pb
+                val dAddr = base + 2048 + pd
+                for (op in ops(bits)) for (mode in modes) {
+                    val x = lanes(rnd, n, bits)
+                    val y = lanes(rnd, n, bits)
+                    for (i in 0 until n) {
+                        if (lb == 1) { GlobalHeap.sb(aAddr + i, x[i].toByte()); GlobalHeap.sb(bAddr + i, y[i].toByte()) }
+                        else { GlobalHeap.sh(aAddr + 2 * i, x[i].toShort()); GlobalHeap.sh(bAddr + 2 * i, y[i].toShort()) }
+                    }
+                    GlobalHeap.sb(dAddr - 1, 0x5A)
+                    GlobalHeap.sb(dAddr + n * lb, 0x5A)
+                    op.heap(aAddr, bAddr, dAddr, n, mode)
+                    val ctx = "${op.name} u$bits phases=($pa,$pb,$pd) $mode"
+                    for (i in 0 until n) {
+                        val got = if (lb == 1) GlobalHeap.lbu(dAddr + i) else GlobalHeap.lh(dAddr + 2 * i).toInt() and 0xFFFF
+                        assertEquals(op.ref(x[i], y[i]), got, "$ctx lane $i")
+                    }
+                    assertEquals(0x5A, GlobalHeap.lbu(dAddr - 1), "$ctx head guard")
+                    assertEquals(0x5A, GlobalHeap.lbu(dAddr + n * lb), "$ctx tail guard")
+                    val sad = (0 until n).sumOf { kotlin.math.abs(x[it] - y[it]).toLong() }
+                    val got = if (lb == 1) SwARArrays.absDiffSumU8(aAddr, bAddr, n, mode) else SwARArrays.absDiffSumU16(aAddr, bAddr, n, mode)
+                    assertEquals(sad, got, "$ctx sad")
+                }
+            }
+        }
+        KMalloc.free(base)
+    }
+
+    @Test
+    fun heapKernelsRunInPlace() {
+        KMalloc.init(1 shl 12)
+        val a = KMalloc.malloc(64) + 3
+        val b = KMalloc.malloc(64)
+        for (i in 0 until 40) {
+            GlobalHeap.sb(a + i, (200 + i).toByte())
+            GlobalHeap.sb(b + i, (i * 3).toByte())
+        }
+        SwARArrays.addSatU8(a, b, a, 40)
+        for (i in 0 until 40) assertEquals(minOf(200 + i + i * 3, 255), GlobalHeap.lbu(a + i), "lane $i")
+    }
+
+    @Test
+    fun rangesAreCheckedUpFront() {
+        KMalloc.init(1 shl 12)
+        val size = GlobalHeap.size
+        assertFailsWith<IllegalArgumentException> { SwARArrays.avgU8(0, 16, size - 4, 8) }
+        assertFailsWith<IllegalArgumentException> { SwARArrays.absDiffSumU16(0, size - 6, 4) }
+        assertFailsWith<IllegalArgumentException> { SwARArrays.minU8(LongArray(1), LongArray(2), LongArray(2), 9) }
+        assertFailsWith<IllegalArgumentException> { SwARArrays.maxU16(LongArray(1), LongArray(1), LongArray(1), -1) }
+        assertEquals(0L, SwARArrays.absDiffSumU8(size, size, 0))
+    }
+}
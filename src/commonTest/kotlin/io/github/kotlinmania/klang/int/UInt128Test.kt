@@ -0,0 +1,67 @@
+package io.github.kotlinmania.klang.int
+
+import io.github.kotlinmania.klang.int.hpc.HeapUInt128
+import io.github.kotlinmania.klang.mem.KMalloc
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertTrue
+
+class UInt128Test {
+    private val max64 = UInt128.fromULong(ULong.MAX_VALUE)
+
+    @Test
+    fun addSubCarryAcross64Bits() {
+        val sum = max64 + UInt128.ONE
+        assertEquals(UInt128(1L, 0L), sum)
+        assertEquals(max64, sum - UInt128.ONE)
+        // Wraps modulo 2^128 like unsigned __int128
+        assertEquals(UInt128.ZERO, UInt128.MAX_VALUE + UInt128.ONE)
+        assertEquals(UInt128.MAX_VALUE, UInt128.ZERO - UInt128.ONE)
+    }
+
+    @Test
+    fun multiplyHighMatchesPortableProduct() {
+        val samples = longArrayOf(0L, 1L, -1L, Long.MIN_VALUE, Long.MAX_VALUE, 0x9E3779B97F4A7C15uL.toLong(), 0xFFFF_FFFFL, 3L)
+        for (a in samples) for (b in samples) {
+            assertEquals(multiplyHighUnsignedPortable(a, b), multiplyHighUnsigned(a, b), "a=$a b=$b")
+        }
+        // (2^64 - 1)^2 = 2^128 - 2^65 + 1
+        assertEquals(UInt128(-2L, 1L), max64 * max64)
+        assertEquals("fffffffffffffffe0000000000000001", (max64 * max64).toHexString())
+    }
+
+    @Test
+    fun divRemRoundTrips() {
+        val n = UInt128(0x0123_4567_89AB_CDEFL, -0x0FED_CBA9_8765_4321L)
+        for (d in listOf(UInt128.fromULong(7uL), UInt128.fromULong(10_000_000_000_000_000_000uL), UInt128(3L, 5L), n)) {
+            val (q, r) = n.divRem(d)
+            assertTrue(r < d)
+            assertEquals(n, q * d + r)
+        }
+        assertFailsWith<ArithmeticException> { n / UInt128.ZERO }
+    }
+
+    @Test
+    fun shiftsAndDecimalString() {
+        assertEquals(UInt128(1L, 0L), UInt128.ONE shl 64)
+        assertEquals(UInt128(Long.MIN_VALUE, 0L), UInt128.ONE shl 127)
+        assertEquals(UInt128.ONE, (UInt128.ONE shl 127) shr 127)
+        assertEquals(UInt128.MAX_VALUE, UInt128(Long.MIN_VALUE, 0L) sar 127)
+        assertEquals("340282366920938463463374607431768211455", UInt128.MAX_VALUE.toString())
+        assertEquals("18446744073709551616", (max64 + UInt128.ONE).toString())
+    }
+
+    @Test
+    fun heapConversionsShareTheLimbLayout() {
+        KMalloc.init(1 shl 16)
+        val v = UInt128(0x1122_3344_5566_7788L, -0x0123_4567_89AB_CDF0L)
+        val c = C_UInt128.fromUInt128(v)
+        assertEquals(v, c.toUInt128())
+        assertEquals(c.toHexString(), "0x" + v.toHexString())
+        val h = HeapUInt128.fromUInt128(v)
+        assertEquals(v.toHexString(), h.toHexString())
+        assertEquals(v, h.toUInt128())
+        assertEquals(UInt128.fromLong(-5L), C_Int128.fromLong(-5L).toUInt128())
+    }
+}
@@ -4,6 +4,7 @@ import io.github.kotlinmania.klang.mem.GlobalHeap
 import io.github.kotlinmania.klang.mem.KMalloc
 import kotlin.test.Test
 import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
 import kotlin.test.assertTrue
 
 class HeapUInt128Test {
@@ -85,5 +86,83 @@ class HeapUInt128Test {
         assertTrue(a != c)
         assertEquals(a.hashCode(), b.hashCode())
     }
-}
 
+    @Test
+    fun inPlaceOpsMatchAllocatingOps() {
+        KMalloc.init(1 shl 18)
+        val a = HeapUInt128.fromULong(0xFFFF_FFFF_FFFF_FFFFuL)
+        val b = HeapUInt128.fromULong(0x1234_5678uL)
+        val expected = (a + b).shiftLeft(40).shiftRight(7) - b
+
+        val acc = HeapUInt128.copyOf(a)
+        acc.addAssign(b)
+        acc.shlAssign(40)
+        acc.shrAssign(7)
+        acc.subAssign(b)
+        assertEquals(expected, acc)
+
+        val dest = HeapUInt128.zero()
+        assertEquals(a + b, a.addInto(b, dest))
+        assertEquals(a - b, a.subInto(b, dest))
+        assertEquals(b.shiftLeft(90), b.shlInto(90, dest))
+        assertEquals(b.shiftRight(9), b.shrInto(9, dest))
+
+        // Aliased operands: x = x + x
+        val x = HeapUInt128.fromULong(21uL)
+        x.addAssign(x)
+        assertEquals(42, x.toIntArray()[0])
+    }
+
+    @Test
+    fun inPlaceLoopDoesNotGrowTheHeap() {
+        KMalloc.init(1 shl 18)
+        val acc = HeapUInt128.zero()
+        HeapUInt128.withScratch { s ->
+            val step = s.fromULong(3uL)
+            repeat(100_000) { acc.addAssign(step) }
+        }
+        val used = KMalloc.mainArena.usedBytes
+        // The scratch block was freed and is reused by the next scope
+        HeapUInt128.withScratch { s -> s.zero() }
+        assertEquals(used, KMalloc.mainArena.usedBytes)
+        assertEquals(300_000, acc.toIntArray()[0] + (acc.toIntArray()[1] shl 16))
+    }
+
+    @Test
+    fun scratchPoolIsBoundedAndScoped() {
+        KMalloc.init(1 shl 18)
+        var leaked: HeapUInt128Scratch? = null
+        HeapUInt128.withScratch(2) { s ->
+            leaked = s
+            val m = s.mark()
+            s.take(); s.take()
+            assertFailsWith<IllegalStateException> { s.take() }
+            s.release(m)
+            s.take()
+        }
+        assertFailsWith<IllegalStateException> { leaked!!.take() }
+    }
+
+    @Test
+    fun inPlaceOverflowStillThrows() {
+        KMalloc.init(1 shl 18)
+        val one = HeapUInt128.one()
+        val x = HeapUInt128.zero()
+        assertFailsWith<IllegalArgumentException> { x.subAssign(one) }
+        assertFailsWith<IllegalArgumentException> { one.shlInto(128, HeapUInt128.zero()) }
+    }
+
+    @Test
+    fun aliasedFullWidthShiftStillThrows() {
+        KMalloc.init(1 shl 18)
+        for (bits in listOf(128, 200)) {
+            val x = HeapUInt128.fromULong(0x1234uL)
+            assertFailsWith<IllegalArgumentException>("shlAssign($bits)") { x.shlAssign(bits) }
+            assertTrue(x.toIntArray().all { it == 0 }, "shlAssign($bits) leaves zero")
+        }
+        val y = HeapUInt128.one()
+        assertFailsWith<IllegalArgumentException> { y.shlInto(128, y) }
+        // Shifting zero out entirely is not an overflow
+        HeapUInt128.zero().shlAssign(128)
+    }
+}
@@ -0,0 +1,110 @@
+package io.github.kotlinmania.klang.mem
+
+import kotlin.random.Random
+import kotlin.test.BeforeTest
+import kotlin.test.Test
+import kotlin.test.assertEquals
+
+class CLibSearchTest {
+    @BeforeTest
+    fun setup() {
+        KMalloc.init(1 shl 18)
+    }
+
+    private fun put(addr: Int, bytes: ByteArray) {
+        for (i in bytes.indices) GlobalHeap.sb(addr + i, bytes[i])
+    }
+
+    private fun naiveMemmem(h: ByteArray, n: ByteArray): Int {
+        if (n.isEmpty()) return 0
+        for (i in 0..h.size - n.size) {
+            var j = 0
+            while (j < n.size && h[i + j] == n[j]) j++
+            if (j == n.size) return i
+        }
+        return -1
+    }
+
+    @Test
+    fun memmemMatchesNaiveAtEveryAlignment() {
+        val rnd = Random(0x51DE)
+        val buf = KMalloc.malloc(256)
+        val nbuf = KMalloc.malloc(32)
+        repeat(300) {
+            // Small alphabet so partial matches are common
+            val h = ByteArray(1 + rnd.nextInt(120)) { ('a' + rnd.nextInt(3)).code.toByte() }
+            val n = ByteArray(rnd.nextInt(6)) { ('a' + rnd.nextInt(3)).code.toByte() }
+            val hOff = buf + rnd.nextInt(8)
+            val nOff = nbuf + rnd.nextInt(8)
+            put(hOff, h)
+            put(nOff, n)
+            val expected = naiveMemmem(h, n)
+            val got = CLib.memmem(hOff, h.size, nOff, n.size)
+            assertEquals(if (expected < 0) 0 else hOff + expected, got, "h=${h.decodeToString()} n=${n.decodeToString()}")
+        }
+    }
+
+    @Test
+    fun strstrFindsSubstrings() {
+        val s = CString.strdup("GET /index.html HTTP/1.1")
+        assertEquals(s + 4, CLib.strstr(s, CString.strdup("/index")))
+        assertEquals(s + 16, CLib.strstr(s, CString.strdup("HTTP")))
+        assertEquals(s + 5, CLib.strstr(s, CString.strdup("i")))
+        assertEquals(0, CLib.strstr(s, CString.strdup("HTTP/2")))
+        assertEquals(s, CLib.strstr(s, CString.strdup("")))
+    }
+
+    @Test
+    fun memrchrFindsLastByte() {
+        val rnd = Random(99)
+        val buf = KMalloc.malloc(128)
+        repeat(200) {
+            val off = buf + rnd.nextInt(8)
+            val data = ByteArray(rnd.nextInt(80)) { (rnd.nextInt(4)).toByte() }
+            put(off, data)
+            val c = rnd.nextInt(4)
+            val idx = data.indexOfLast { it.toInt() == c }
+            assertEquals(if (idx < 0) 0 else off + idx, CLib.memrchr(off, c, data.size))
+            val first = data.indexOfFirst { it.toInt() == c }
+            assertEquals(if (first < 0) 0 else off + first, CLib.memchr(off, c, data.size))
+        }
+    }
+
+    @Test
+    fun spanFunctions() {
+        val s = CString.strdup("   \t  key = value")
+        assertEquals(6, CLib.strspn(s, CString.strdup(" \t")))
+        assertEquals(3, CLib.strspn(s, CString.strdup(" ")))
+        assertEquals(0, CLib.strspn(s, CString.strdup("")))
+        assertEquals(10, CLib.strcspn(s, CString.strdup("=")))
+        assertEquals(10, CLib.strcspn(s, CString.strdup("=;#")))
+        assertEquals(17, CLib.strcspn(s, CString.strdup("\u007f")))
+        assertEquals(17, CLib.strcspn(s, CString.strdup("")))
+        val hi = KMalloc.malloc(8)
+        put(hi, byteArrayOf(0xC3.toByte(), 0xA9.toByte(), 'x'.code.toByte(), 0))
+        val set = KMalloc.malloc(4)
+        put(set, byteArrayOf(0xA9.toByte(), 0xC3.toByte(), 0))
+        assertEquals(2, CLib.strspn(hi, set))
+        assertEquals(0, CLib.strcspn(hi, set))
+    }
+
+    @Test
+    fun strcmpAndMemcmpAcrossAlignments() {
+        val a = KMalloc.malloc(64)
+        val b = KMalloc.malloc(64)
+        val text = "the quick brown fox jumps".encodeToByteArray()
+        for (shift in 0 until 8) {
+            put(a + 1, text + 0.toByte())
+            put(b + shift, text + 0.toByte())
+            assertEquals(0, CLib.strcmp(a + 1, b + shift))
+            assertEquals(0, CLib.memcmp(a + 1, b + shift, text.size))
+            GlobalHeap.sb(b + shift + 20, 'z'.code.toByte())
+            assertEquals('j'.code - 'z'.code, CLib.strcmp(a + 1, b + shift))
+            assertEquals('j'.code - 'z'.code, CLib.memcmp(a + 1, b + shift, text.size))
+        }
+        assertEquals(text.size, CLib.strlen(a + 1))
+        assertEquals(a + 1 + 4, CLib.strchr(a + 1, 'q'.code))
+        assertEquals(0, CLib.strchr(a + 1, '!'.code))
+        assertEquals(a + 1 + text.size, CLib.strchr(a + 1, 0))
+    }
+}
@@ -0,0 +1,77 @@
+package io.github.kotlinmania.klang.mem
+
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+
+class GlobalHeapBulkTest {
+    @Test
+    fun floatsRoundTripAtEveryAlignment() {
+        KMalloc.init(1 shl 16)
+        val base = KMalloc.malloc(512)
+        val src = FloatArray(37) { it * 1.25f - 7.5f }
+        for (phase in 0 until 8) for (n in 0..src.size) {
+            val addr = base + phase
+            GlobalHeap.writeFloats(addr, src, 0, n)
+            for (i in 0 until n) assertEquals(src[i].toRawBits(), GlobalHeap.lw(addr + i * 4), "phase=$phase n=$n i=$i")
+            val dst = FloatArray(n + 2)
+            GlobalHeap.readFloats(addr, dst, 1, n)
+            for (i in 0 until n) assertEquals(src[i], dst[i + 1])
+        }
+        KMalloc.free(base)
+    }
+
+    @Test
+    fun intsDoNotClobberNeighbours() {
+        KMalloc.init(1 shl 16)
+        val base = KMalloc.malloc(256)
+        for (phase in 0 until 8) for (n in 0..17) {
+            GlobalHeap.memset(base, 0x5A, 256)
+            val addr = base + 16 + phase
+            GlobalHeap.writeInts(addr, IntArray(n) { -0x12345678 * (it + 1) })
+            for (b in 0 until 256) {
+                val inside = base + b >= addr && base + b < addr + n * 4
+                if (!inside) assertEquals(0x5A, GlobalHeap.lbu(base + b), "phase=$phase n=$n byte=$b")
+            }
+            val back = IntArray(n)
+            GlobalHeap.readInts(addr, back)
+            for (i in 0 until n) assertEquals(-0x12345678 * (i + 1), back[i])
+        }
+        KMalloc.free(base)
+    }
+
+    @Test
+    fun longsDoublesShortsRoundTrip() {
+        KMalloc.init(1 shl 16)
+        val base = KMalloc.malloc(512)
+        val longs = LongArray(11) { -0x61C8864680B583EBL * (it + 1) }
+        val doubles = DoubleArray(11) { it / 3.0 - 1.0 }
+        val shorts = ShortArray(23) { (it * 4099 - 30000).toShort() }
+        for (phase in 0 until 8) {
+            val addr = base + phase
+            GlobalHeap.writeLongs(addr, longs)
+            for (i in longs.indices) assertEquals(longs[i], GlobalHeap.ld(addr + i * 8))
+            val l = LongArray(longs.size); GlobalHeap.readLongs(addr, l)
+            for (i in longs.indices) assertEquals(longs[i], l[i])
+
+            GlobalHeap.writeDoubles(addr, doubles)
+            val d = DoubleArray(doubles.size); GlobalHeap.readDoubles(addr, d)
+            for (i in doubles.indices) assertEquals(doubles[i], d[i])
+
+            GlobalHeap.writeShorts(addr, shorts)
+            for (i in shorts.indices) assertEquals(shorts[i], GlobalHeap.lh(addr + i * 2))
+            val s = ShortArray(shorts.size); GlobalHeap.readShorts(addr, s)
+            for (i in shorts.indices) assertEquals(shorts[i], s[i])
+        }
+        KMalloc.free(base)
+    }
+
+    @Test
+    fun sliceOutOfBoundsIsRejected() {
+        KMalloc.init(1 shl 12)
+        val p = KMalloc.malloc(64)
+        assertFailsWith<IllegalArgumentException> { GlobalHeap.readFloats(p, FloatArray(4), 2, 3) }
+        assertFailsWith<IllegalArgumentException> { GlobalHeap.writeInts(p, IntArray(4), -1, 1) }
+        KMalloc.free(p)
+    }
+}
@@ -0,0 +1,121 @@
+package io.github.kotlinmania.klang.mem
+
+import kotlin.random.Random
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+
+class HeapSnapshotTest {
+    /** In-memory image: the sink appends words, the source replays them. */
+    private class Image : HeapSink, HeapSource {
+        var words = LongArray(64)
+        var size = 0
+        var pos = 0
+
+        override fun write(words: LongArray, offset: Int, count: Int) {
+            if (size + count > this.words.size) this.words = this.words.copyOf(maxOf(size + count, this.words.size * 2))
+            words.copyInto(this.words, size, offset, offset + count)
+            size += count
+        }
+
+        override fun read(words: LongArray, offset: Int, count: Int) {
+            require(pos + count <= size) { "Truncated heap image" }
+            this.words.copyInto(words, offset, pos, pos + count)
+            pos += count
+        }
+    }
+
+    private fun allocateSome(): List<Int> {
+        val ptrs = (1..40).map { i -> KMalloc.malloc(if (i % 7 == 0) 3000 + i else 16 * i) }
+        for ((i, p) in ptrs.withIndex()) GlobalHeap.sw(p, 0x5EED0000 or i)
+        // Leave holes in both the small bins and the large lists
+        for ((i, p) in ptrs.withIndex()) if (i % 3 == 0) KMalloc.free(p)
+        return ptrs
+    }
+
+    @Test
+    fun restoreReproducesDataAndAllocatorState() {
+        KMalloc.init(1 shl 16)
+        val ptrs = allocateSome()
+        val image = Image()
+        GlobalHeap.snapshot(image)
+        val used = GlobalHeap.used
+        val dump = GlobalHeap.packed.data.copyOf()
+        val sizes = listOf(48, 3010, 200, 16, 5000, 64)
+        val expected = sizes.map { KMalloc.malloc(it) }
+
+        KMalloc.init(1 shl 10)
+        GlobalHeap.restore(image)
+        assertEquals(image.size, image.pos)
+        assertEquals(used, GlobalHeap.used)
+        assertEquals(dump.toList(), GlobalHeap.packed.data.toList())
+        for ((i, p) in ptrs.withIndex()) if (i % 3 != 0) assertEquals(0x5EED0000 or i, GlobalHeap.lw(p))
+        assertEquals(expected, sizes.map { KMalloc.malloc(it) }, "allocation after restore matches the original run")
+    }
+
+    @Test
+    fun badImagesLeaveTheHeapUntouched() {
+        KMalloc.init(1 shl 12)
+        val p = KMalloc.malloc(32)
+        GlobalHeap.sd(p, 0x0123456789ABCDEFL)
+        val image = Image()
+        GlobalHeap.snapshot(image)
+
+        val wrongMagic = Image().apply { write(image.words.copyOf(image.size).also { it[0] = 0L }, 0, image.size) }
+        assertFailsWith<IllegalArgumentException> { GlobalHeap.restore(wrongMagic) }
+        val truncated = Image().apply { write(image.words, 0, image.size - 1) }
+        assertFailsWith<IllegalArgumentException> { GlobalHeap.restore(truncated) }
+        assertEquals(0x0123456789ABCDEFL, GlobalHeap.ld(p))
+        KMalloc.free(p)
+        assertEquals(p, KMalloc.malloc(32), "allocator state survives a failed restore")
+    }
+
+    @Test
+    fun snapshotRejectsLiveSubArenas() {
+        KMalloc.init(1 shl 16)
+        val arena = KArena.create(1 shl 12)
+        assertFailsWith<IllegalStateException> { GlobalHeap.snapshot(Image()) }
+        arena.dispose()
+        GlobalHeap.snapshot(Image())
+    }
+
+    @Test
+    fun corruptMetadataIsRejectedBeforeCommit() {
+        KMalloc.init(1 shl 12)
+        val p = KMalloc.malloc(32)
+        GlobalHeap.sd(p, 0x0123456789ABCDEFL)
+        val image = Image()
+        GlobalHeap.snapshot(image)
+        val capacity = image.words[2]
+        // Metadata starts at word 5: brk, binMask, flMask, then the list heads
+        for ((word, value) in listOf(5 to capacity + 8, 6 to -1L, 8 to capacity)) {
+            val bad = Image().apply { write(image.words.copyOf(image.size).also { it[word] = value }, 0, image.size) }
+            assertFailsWith<IllegalArgumentException>("meta word $word = $value") { GlobalHeap.restore(bad) }
+        }
+        assertEquals(0x0123456789ABCDEFL, GlobalHeap.ld(p))
+        KMalloc.free(p)
+        assertEquals(p, KMalloc.malloc(32), "allocator state survives a rejected image")
+    }
+
+    @Test
+    fun fileImagesRoundTripWhereSupported() {
+        KMalloc.init(1 shl 14)
+        val p = KMalloc.malloc(1000)
+        GlobalHeap.memset(p, 0x5A, 1000)
+        val path = heapImageTempPath("klang-heap-test-${Random.nextLong().toULong()}.img")
+        if (!HeapImage.fileBackingSupported) {
+            assertFailsWith<UnsupportedOperationException> { GlobalHeap.saveImage(path) }
+            return
+        }
+        try {
+            GlobalHeap.saveImage(path)
+            val next = KMalloc.malloc(64)
+            KMalloc.init(0)
+            GlobalHeap.loadImage(path)
+            for (i in 0 until 1000) assertEquals(0x5A, GlobalHeap.lbu(p + i))
+            assertEquals(next, KMalloc.malloc(64))
+        } finally {
+            deleteHeapImageFile(path)
+        }
+    }
+}
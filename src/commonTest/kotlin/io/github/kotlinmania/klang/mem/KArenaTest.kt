@@ -0,0 +1,77 @@
+package io.github.kotlinmania.klang.mem
+
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertSame
+import kotlin.test.assertTrue
+
+class KArenaTest {
+    @Test
+    fun boundArenaServesAllocationsFromItsRegion() {
+        KMalloc.init(1 shl 18)
+        val arena = KArena.create(1 shl 14)
+        val p = KMalloc.withArena(arena) { KMalloc.malloc(100) }
+        assertTrue(arena.owns(p), "allocation must land inside the arena region")
+        assertSame(KMalloc.mainArena, KMalloc.currentArena(), "binding is restored after withArena")
+        val q = KMalloc.malloc(100)
+        assertTrue(!arena.owns(q), "unbound thread allocates from the main arena")
+        KMalloc.withArena(arena) { KMalloc.free(p) }
+        KMalloc.free(q)
+        arena.dispose()
+    }
+
+    @Test
+    fun freeFromAnotherBindingIsDeferredToOwner() {
+        KMalloc.init(1 shl 18)
+        val arena = KArena.create(1 shl 14)
+        val p = KMalloc.withArena(arena) { KMalloc.malloc(64) }
+        // Freed while bound to main: queued on the owner, not applied yet
+        KMalloc.free(p)
+        // The owner's next malloc drains the queue and reuses the chunk
+        val again = KMalloc.withArena(arena) { KMalloc.malloc(64) }
+        assertEquals(p, again)
+        arena.dispose()
+    }
+
+    @Test
+    fun exhaustedArenaThrowsInsteadOfGrowing() {
+        KMalloc.init(1 shl 16)
+        val arena = KArena.create(256)
+        assertFailsWith<IllegalStateException> {
+            KMalloc.withArena(arena) { repeat(64) { KMalloc.malloc(64) } }
+        }
+        arena.dispose()
+    }
+
+    @Test
+    fun sharedArenaAcceptsDirectFreesFromAnyBinding() {
+        KMalloc.init(1 shl 18)
+        val shared = KArena.create(1 shl 14, shared = true)
+        val a = shared.malloc(48)
+        KMalloc.free(a) // routed to the shared arena and applied immediately
+        assertEquals(a, shared.malloc(48))
+        shared.dispose()
+    }
+
+    @Test
+    fun disposedArenaFallsBackToMain() {
+        KMalloc.init(1 shl 18)
+        val arena = KArena.create(1 shl 12)
+        KMalloc.bindArena(arena)
+        arena.dispose()
+        assertSame(KMalloc.mainArena, KMalloc.currentArena())
+        KMalloc.unbindArena()
+    }
+
+    @Test
+    fun kstackRegionComesFromArena() {
+        KMalloc.init(1 shl 18)
+        val arena = KArena.create(1 shl 14)
+        KStack.init(1 shl 12, arena)
+        val p = KStack.withFrame { KStack.alloca(32) }
+        assertTrue(arena.owns(p))
+        KMalloc.withArena(arena) { KStack.dispose() }
+        arena.dispose()
+    }
+}
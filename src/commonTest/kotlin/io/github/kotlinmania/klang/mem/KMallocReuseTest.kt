@@ -2,6 +2,7 @@ package io.github.kotlinmania.klang.mem
 
 import kotlin.test.Test
 import kotlin.test.assertEquals
+import kotlin.test.assertTrue
 
 class KMallocReuseTest {
     @Test
@@ -14,5 +15,50 @@ class KMallocReuseTest {
         assertEquals(b, c, "allocator should reuse recently freed chunk of same size class")
         KMalloc.free(a); KMalloc.free(c)
     }
-}
 
+    @Test
+    fun smallRequestSplitsNextLargerBin() {
+        KMalloc.init(1 shl 18)
+        val big = KMalloc.malloc(512)
+        val guard = KMalloc.malloc(16)
+        KMalloc.free(big)
+        // No 64-byte chunk is free; the 512-byte hole must be split, not the top bumped
+        val p = KMalloc.malloc(64)
+        assertEquals(big, p)
+        KMalloc.free(p); KMalloc.free(guard)
+    }
+
+    @Test
+    fun largeRequestsReuseSameClassHolesWithoutGrowing() {
+        KMalloc.init(1 shl 22)
+        val size = 40000
+        val ptrs = IntArray(16) { KMalloc.malloc(size) }
+        for (i in 1 until ptrs.size step 2) GlobalHeap.memset(ptrs[i], 0x11, size)
+        // Free every other block: same-class holes, each pinned by a live neighbour
+        for (i in ptrs.indices step 2) KMalloc.free(ptrs[i])
+        val used = KMalloc.mainArena.usedBytes
+        for (i in ptrs.indices step 2) {
+            ptrs[i] = KMalloc.malloc(size)
+            GlobalHeap.memset(ptrs[i], 0x7E, size)
+        }
+        assertEquals(used, KMalloc.mainArena.usedBytes, "every request fits an existing hole")
+        for (i in 1 until ptrs.size step 2) {
+            assertEquals(0x11, GlobalHeap.lbu(ptrs[i]))
+            assertEquals(0x11, GlobalHeap.lbu(ptrs[i] + size - 1))
+        }
+        for (p in ptrs) KMalloc.free(p)
+    }
+
+    @Test
+    fun largeRequestTakesHoleFromHigherClass() {
+        KMalloc.init(1 shl 22)
+        val hole = KMalloc.malloc(100000)
+        val guard = KMalloc.malloc(16)
+        KMalloc.free(hole)
+        val p = KMalloc.malloc(5000)
+        assertEquals(hole, p, "the only free block is split instead of bumping the top")
+        val q = KMalloc.malloc(5000)
+        assertTrue(q > p && q < guard, "the split remainder serves the next request")
+        KMalloc.free(p); KMalloc.free(q); KMalloc.free(guard)
+    }
+}
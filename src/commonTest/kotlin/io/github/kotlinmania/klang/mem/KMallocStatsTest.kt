@@ -0,0 +1,79 @@
+package io.github.kotlinmania.klang.mem
+
+import kotlin.test.AfterTest
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertTrue
+
+class KMallocStatsTest {
+    @AfterTest
+    fun disableStats() {
+        KMalloc.statsEnabled = false
+    }
+
+    @Test
+    fun countersTrackAllocatorEvents() {
+        KMalloc.init(1 shl 16)
+        KMalloc.statsEnabled = true
+        val a = KMalloc.malloc(40)
+        val b = KMalloc.malloc(40)
+        val c = KMalloc.malloc(2000)
+        KMalloc.free(a)
+        KMalloc.free(b) // merges with a
+        val d = KMalloc.malloc(16) // reuses and splits the merged chunk
+        val e = KMalloc.realloc(d, 4000)
+        val s = KMalloc.stats()
+
+        assertTrue(s.enabled)
+        assertEquals(5L, s.mallocCount)
+        assertEquals(3L, s.freeCount)
+        assertEquals(1L, s.reallocCount)
+        assertEquals(1L, s.reallocMoves)
+        assertEquals(1L, s.reuseCount)
+        assertEquals(4L, s.bumpCount)
+        assertTrue(s.coalesceCount >= 1)
+        assertTrue(s.splitCount >= 1)
+        assertEquals(2L, s.sizeClassMallocs[2]) // two 48-byte payloads
+        assertEquals(2L, s.sizeClassMallocs[KArena.BIN_COUNT]) // 2000 and the 4000-byte realloc target
+        assertEquals(2, s.liveChunks)
+        assertEquals(KMalloc.mainArena.payloadSize(c) + KMalloc.mainArena.payloadSize(e).toLong(), s.liveBytes)
+        assertTrue(s.peakLiveBytes >= s.liveBytes)
+        assertEquals((s.liveChunks + s.freeChunks) * KArena.OVERHEAD.toLong(), s.overheadBytes)
+        assertEquals(s.freeChunks, s.binOccupancy.sum() + s.largeFreeChunks)
+        assertEquals(s.brk.toLong(), s.liveBytes + s.freeBytes + s.overheadBytes)
+    }
+
+    @Test
+    fun disabledCountersStayZeroButWalkedFiguresAreExact() {
+        KMalloc.init(1 shl 16)
+        val ptrs = List(10) { KMalloc.malloc(100) }
+        KMalloc.free(ptrs[3])
+        val s = KMalloc.stats()
+        assertEquals(0L, s.mallocCount)
+        assertEquals(9, s.liveChunks)
+        assertEquals(1, s.freeChunks)
+
+        // Enabling mid-run seeds the live total from the heap walk
+        KMalloc.statsEnabled = true
+        for (p in ptrs) if (p != ptrs[3]) KMalloc.free(p)
+        val after = KMalloc.stats()
+        assertEquals(9L, after.freeCount)
+        assertEquals(0, after.liveChunks)
+        assertEquals(s.liveBytes, after.peakLiveBytes)
+    }
+
+    @Test
+    fun fragmentationWalkSummarizesFreeSpace() {
+        KMalloc.init(1 shl 16)
+        val ptrs = List(8) { KMalloc.malloc(256) }
+        for (i in 0 until 8 step 2) KMalloc.free(ptrs[i])
+        val r = KMalloc.dumpFragmentation()
+        assertEquals(8, r.chunks)
+        assertEquals(4, r.freeChunks)
+        assertEquals(4, r.freeRuns)
+        assertEquals(4 * KMalloc.mainArena.payloadSize(ptrs[1]).toLong(), r.freeBytes)
+        assertEquals(0.75, r.externalFragmentation, 1e-9)
+        assertEquals(4, r.freeSizeLog2Histogram[8])
+        assertTrue(r.toString().contains("4 free"))
+    }
+}
@@ -0,0 +1,86 @@
+package io.github.kotlinmania.klang.mem
+
+import io.github.kotlinmania.klang.common.StructLayout
+import io.github.kotlinmania.klang.int.hpc.HeapUInt128
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertNull
+import kotlin.test.assertSame
+import kotlin.test.assertTrue
+
+class KRegionTest {
+    @Test
+    fun allocationsBumpAndGrowAcrossBlocks() {
+        KMalloc.init(1 shl 18)
+        val region = KRegion(1024)
+        val a = region.alloc(100)
+        val b = region.alloc(8, 8)
+        assertEquals(0, a and 15)
+        assertEquals(0, b and 7)
+        assertTrue(b >= a + 100)
+        // Overflowing the block chains a new one instead of failing
+        val ptrs = List(40) { region.alloc(100, 4) }
+        assertTrue(region.blockCount > 1)
+        for ((i, p) in ptrs.withIndex()) GlobalHeap.sw(p, i)
+        for ((i, p) in ptrs.withIndex()) assertEquals(i, GlobalHeap.lw(p))
+        // A request larger than the block size gets a block of its own
+        val big = region.alloc(5000, 64)
+        assertEquals(0, big and 63)
+        GlobalHeap.memset(big, 0x7F, 5000)
+        assertEquals(0x7F, GlobalHeap.lbu(big + 4999))
+        region.dispose()
+        assertEquals(0, region.blockCount)
+    }
+
+    @Test
+    fun releaseRewindsToMarkAndReusesBlocks() {
+        KMalloc.init(1 shl 18)
+        val region = KRegion(1024)
+        region.alloc(64)
+        val m = region.mark()
+        val first = region.alloc(32)
+        repeat(30) { region.alloc(200) }
+        val blocks = region.blockCount
+        val capacity = region.capacityBytes
+        region.release(m)
+        assertEquals(first, region.alloc(32))
+        repeat(30) { region.alloc(200) }
+        assertEquals(blocks, region.blockCount, "retained blocks are reused, not reallocated")
+        assertEquals(capacity, region.capacityBytes)
+        region.reset()
+        assertEquals(blocks, region.blockCount)
+        assertFailsWith<IllegalArgumentException> { region.release((99L shl 32) or 16L) }
+        region.dispose()
+    }
+
+    @Test
+    fun withRegionRoutesAutosAndHeapValues() {
+        KMalloc.init(1 shl 18)
+        KStack.init(1 shl 12)
+        val region = KRegion(4096)
+        val sp = KStack.currentSp()
+        val stats = region.withRegion {
+            assertSame(region, KRegion.current())
+            val x = CAutos.int(41)
+            x.value = x.value + 1
+            val h = HeapUInt128.fromULong(7uL)
+            val layout = StructLayout.layoutStruct(listOf(StructLayout.Field(8, 8), StructLayout.Field(4, 4)))
+            val s = StructLayout.alloc(layout)
+            assertEquals(0, s and 7)
+            listOf(x.value, region.blockCount, h.addr, s)
+        }
+        assertEquals(42, stats[0])
+        assertEquals(1, stats[1])
+        assertEquals(sp, KStack.currentSp(), "autos did not touch the KStack frame")
+        assertNull(KRegion.current())
+        // The scope released everything: the next allocation starts at the same place again
+        val again = region.withRegion {
+            CAutos.int()
+            HeapUInt128.alloc().addr
+        }
+        assertEquals(stats[2], again)
+        region.dispose()
+        KStack.dispose()
+    }
+}
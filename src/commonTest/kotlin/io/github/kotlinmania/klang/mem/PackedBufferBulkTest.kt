@@ -0,0 +1,61 @@
+package io.github.kotlinmania.klang.mem
+
+import kotlin.test.Test
+import kotlin.test.assertEquals
+
+class PackedBufferBulkTest {
+    private fun pattern(i: Int): Int = (i * 37 + 11) and 0xFF
+
+    private fun seeded(size: Int): Pair<PackedBuffer, IntArray> {
+        val buf = PackedBuffer(size)
+        val ref = IntArray(size) { pattern(it) }
+        for (i in 0 until size) buf.setByte(i, ref[i])
+        return buf to ref
+    }
+
+    private fun assertSame(ref: IntArray, buf: PackedBuffer, msg: String) {
+        for (i in ref.indices) assertEquals(ref[i], buf.getByte(i), "$msg @ byte $i")
+    }
+
+    @Test
+    fun copyWordsMatchesBytewiseMemmoveForAllPhases() {
+        val size = 96
+        for (d in 0 until 24) for (s in 0 until 24) for (n in 0..64) {
+            if (d + n > size || s + n > size) continue
+            val (buf, ref) = seeded(size)
+            // memmove reference
+            if (d > s && d < s + n) {
+                for (i in n - 1 downTo 0) ref[d + i] = ref[s + i]
+            } else {
+                for (i in 0 until n) ref[d + i] = ref[s + i]
+            }
+            buf.copyWords(d, s, n)
+            assertSame(ref, buf, "copyWords(d=$d, s=$s, n=$n)")
+        }
+    }
+
+    @Test
+    fun fillWordsTouchesOnlyTargetRange() {
+        val size = 64
+        for (a in 0 until 16) for (n in 0..40) {
+            val (buf, ref) = seeded(size)
+            for (i in 0 until n) ref[a + i] = 0xA5
+            buf.fillWords(a, 0x1A5, n) // only low 8 bits are used
+            assertSame(ref, buf, "fillWords(a=$a, n=$n)")
+        }
+    }
+
+    @Test
+    fun globalHeapRoutesThroughWordPath() {
+        KMalloc.init(1 shl 16)
+        val p = KMalloc.malloc(256)
+        for (i in 0 until 256) GlobalHeap.sb(p + i, pattern(i).toByte())
+        // Misaligned, overlapping backward move
+        GlobalHeap.memmove(p + 13, p + 3, 200)
+        for (i in 0 until 200) assertEquals(pattern(3 + i), GlobalHeap.lbu(p + 13 + i))
+        GlobalHeap.memset(p + 1, 0, 100)
+        for (i in 1..100) assertEquals(0, GlobalHeap.lbu(p + i))
+        assertEquals(pattern(0), GlobalHeap.lbu(p))
+        KMalloc.free(p)
+    }
+}
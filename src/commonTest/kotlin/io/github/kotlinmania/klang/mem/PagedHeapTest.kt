@@ -0,0 +1,115 @@
+package io.github.kotlinmania.klang.mem
+
+import kotlin.random.Random
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertSame
+
+class PagedHeapTest {
+    private val seg = SegmentedBuffer.MIN_SEGMENT_BYTES
+
+    @Test
+    fun scalarAccessMatchesFlatHeapAcrossSegmentBoundaries() {
+        PagedHeap.init(0, seg)
+        GlobalHeap.init(3 * seg)
+        val rnd = Random(0xA11)
+        val p = PagedHeap.malloc(3L * seg)
+        for (edge in intArrayOf(seg, 2 * seg)) {
+            for (d in -9..9) {
+                val a = edge + d
+                val v = rnd.nextLong()
+                PagedHeap.sd(p + a, v)
+                GlobalHeap.sd(a, v)
+                PagedHeap.sw(p + a + 3, v.toInt())
+                GlobalHeap.sw(a + 3, v.toInt())
+                PagedHeap.sh(p + a + 1, (v ushr 7).toShort())
+                GlobalHeap.sh(a + 1, (v ushr 7).toShort())
+            }
+            for (a in edge - 24 until edge + 24) {
+                assertEquals(GlobalHeap.lbu(a), PagedHeap.lbu(p + a), "byte $a")
+                assertEquals(GlobalHeap.lh(a), PagedHeap.lh(p + a), "short $a")
+                assertEquals(GlobalHeap.lw(a), PagedHeap.lw(p + a), "int $a")
+                assertEquals(GlobalHeap.ld(a), PagedHeap.ld(p + a), "long $a")
+            }
+        }
+    }
+
+    @Test
+    fun growthAppendsWithoutMovingSegments() {
+        PagedHeap.init(0, seg)
+        val a = PagedHeap.malloc(100)
+        PagedHeap.sd(a, 0x1122334455667788L)
+        val before = PagedHeap.segmentCount
+        val buffer = SegmentedBuffer(seg)
+        buffer.ensure(seg.toLong())
+        val first = buffer.segment(0)
+        buffer.ensure(10L * seg)
+        assertSame(first, buffer.segment(0))
+        assertEquals(10, buffer.segmentCount)
+
+        val big = PagedHeap.malloc(5L * seg)
+        assertEquals(0L, big and 7L)
+        assertEquals(0x1122334455667788L, PagedHeap.ld(a))
+        assertEquals(before + 5, PagedHeap.segmentCount)
+        assertEquals(PagedHeap.segmentCount.toLong() * seg, PagedHeap.size)
+    }
+
+    @Test
+    fun bulkTransfersSpanSegments() {
+        PagedHeap.init(0, seg)
+        val n = seg / 2 + 5
+        val src = FloatArray(n) { it * 0.25f - 7f }
+        for (misalign in longArrayOf(0, 4, 6)) {
+            PagedHeap.reset()
+            val p = PagedHeap.malloc(n * 4L + 8) + misalign
+            PagedHeap.writeFloats(p, src)
+            val back = FloatArray(n)
+            PagedHeap.readFloats(p, back)
+            assertEquals(src.toList(), back.toList(), "misalign=$misalign")
+            assertEquals(src[n - 1], PagedHeap.lwf(p + 4L * (n - 1)))
+        }
+
+        PagedHeap.reset()
+        val words = LongArray(seg / 8 * 2 + 3) { it * 0x0101010101L }
+        val w = PagedHeap.malloc(words.size * 8L)
+        PagedHeap.writeLongs(w, words)
+        val out = LongArray(words.size)
+        PagedHeap.readLongs(w, out)
+        assertEquals(words.toList(), out.toList())
+    }
+
+    @Test
+    fun memmoveAndMemsetAreOverlapSafe() {
+        PagedHeap.init(0, seg)
+        GlobalHeap.init(4 * seg)
+        val len = 3 * seg
+        val p = PagedHeap.malloc(len.toLong())
+        val rnd = Random(3)
+        for (i in 0 until len) {
+            val b = rnd.nextInt().toByte()
+            PagedHeap.sb(p + i, b)
+            GlobalHeap.sb(i, b)
+        }
+        for ((dst, src, count) in listOf(
+            Triple(seg - 3, 5, seg + 100), Triple(13, seg - 3, seg + 7),
+            Triple(16, 8, 2 * seg), Triple(8, 24, 2 * seg - 40), Triple(101, 102, 300),
+        )) {
+            PagedHeap.memmove(p + dst, p + src, count.toLong())
+            GlobalHeap.memmove(dst, src, count)
+            for (i in 0 until len) assertEquals(GlobalHeap.lb(i), PagedHeap.lb(p + i), "move $dst<-$src i=$i")
+        }
+        PagedHeap.memset(p + 5, 0xAB, seg + 9L)
+        GlobalHeap.memset(5, 0xAB, seg + 9)
+        for (i in 0 until len) assertEquals(GlobalHeap.lb(i), PagedHeap.lb(p + i), "set i=$i")
+        val z = PagedHeap.calloc(16, 4)
+        for (i in 0 until 64) assertEquals(0, PagedHeap.lbu(z + i))
+    }
+
+    @Test
+    fun rejectsBadSegmentSizes() {
+        assertFailsWith<IllegalArgumentException> { SegmentedBuffer(3000) }
+        assertFailsWith<IllegalArgumentException> { SegmentedBuffer(1 shl 11) }
+        assertFailsWith<IllegalArgumentException> { GlobalHeap.ensureCapacity(Int.MAX_VALUE) }
+    }
+}
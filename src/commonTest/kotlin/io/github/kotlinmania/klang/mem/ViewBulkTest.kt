@@ -0,0 +1,117 @@
+package io.github.kotlinmania.klang.mem
+
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+
+class ViewBulkTest {
+    private fun fillPattern(base: Int, bytes: Int) {
+        for (i in 0 until bytes) GlobalHeap.sb(base + i, ((i * 37 + 11) and 0xFF).toByte())
+    }
+
+    @Test
+    fun bulkOperationsMatchElementwiseAccessAtEveryPhase() {
+        KMalloc.init(1 shl 16)
+        val base = KMalloc.malloc(512)
+        fillPattern(base, 512)
+        for (phase in 0 until 8) for (n in listOf(0, 1, 3, 7, 8, 9, 31, 64)) {
+            val addr = base + phase
+            val views = listOf(
+                Triple(U8View(addr, n), { i: Int -> U8View(addr, n).get(i) }, 1),
+                Triple(U16View(addr, n), { i: Int -> U16View(addr, n).get(i) }, 2),
+                Triple(U32View(addr, n), { i: Int -> U32View(addr, n).get(i) }, 4),
+            )
+            for ((view, get, lane) in views) {
+                val expected = IntArray(n) { get(it) }
+                val seen = ArrayList<Int>()
+                val dst = IntArray(n + 1)
+                when (view) {
+                    is U8View -> { view.forEachIndexed { i, v -> assertEquals(seen.size, i); seen.add(v) }; view.copyTo(dst, 1) }
+                    is U16View -> { view.forEachIndexed { i, v -> assertEquals(seen.size, i); seen.add(v) }; view.copyTo(dst, 1) }
+                    is U32View -> { view.forEachIndexed { i, v -> assertEquals(seen.size, i); seen.add(v) }; view.copyTo(dst, 1) }
+                }
+                val ctx = "lane=$lane phase=$phase n=$n"
+                assertEquals(expected.toList(), seen, ctx)
+                assertEquals(expected.toList(), dst.copyOfRange(1, n + 1).toList(), ctx)
+                val mask = if (lane == 4) 0xFFFFFFFFL else -1L
+                val sum = when (view) { is U8View -> view.sum(); is U16View -> view.sum(); else -> (view as U32View).sum() }
+                val xor = when (view) { is U8View -> view.xor(); is U16View -> view.xor(); else -> (view as U32View).xor() }
+                assertEquals(expected.sumOf { it.toLong() and mask }, sum, ctx)
+                assertEquals(expected.fold(0) { a, v -> a xor v }, xor, ctx)
+            }
+        }
+        KMalloc.free(base)
+    }
+
+    @Test
+    fun mapInPlaceRewritesOnlyTheView() {
+        KMalloc.init(1 shl 16)
+        val base = KMalloc.malloc(256)
+        val pattern = { off: Int -> (off * 37 + 11) and 0xFF }
+        for (phase in 0 until 8) {
+            val off = 16 + phase
+            val addr = base + off
+            fillPattern(base, 256)
+            val bytes = U8View(addr, 45)
+            bytes.mapInPlace { it + 1 }
+            for (i in 0 until 45) assertEquals((pattern(off + i) + 1) and 0xFF, bytes.unsafeGet(i), "u8 phase=$phase i=$i")
+            assertEquals(pattern(off - 1), GlobalHeap.lbu(addr - 1))
+            assertEquals(pattern(off + 45), GlobalHeap.lbu(addr + 45))
+
+            fillPattern(base, 256)
+            val limbs = U16View(addr, 21)
+            val before16 = IntArray(21) { limbs.get(it) }
+            limbs.mapInPlace { it * 3 + 1 }
+            for (i in 0 until 21) assertEquals((before16[i] * 3 + 1) and 0xFFFF, limbs.unsafeGet(i), "u16 phase=$phase i=$i")
+            assertEquals(pattern(off + 42), GlobalHeap.lbu(addr + 42))
+
+            fillPattern(base, 256)
+            val words = U32View(addr, 11)
+            val before32 = IntArray(11) { words.get(it) }
+            words.mapInPlace { it.inv() }
+            for (i in 0 until 11) assertEquals(before32[i].inv(), words.unsafeGet(i), "u32 phase=$phase i=$i")
+            assertEquals(pattern(off - 1), GlobalHeap.lbu(addr - 1))
+            assertEquals(pattern(off + 44), GlobalHeap.lbu(addr + 44))
+        }
+        KMalloc.free(base)
+    }
+
+    @Test
+    fun checksumsMatchZlibVectors() {
+        KMalloc.init(1 shl 16)
+        val base = KMalloc.malloc(4096)
+        for ((phase, text) in listOf(0 to "123456789", 3 to "123456789")) {
+            val addr = base + phase
+            for (i in text.indices) GlobalHeap.sb(addr + i, text[i].code.toByte())
+            assertEquals(0xCBF43926.toInt(), U8View(addr, text.length).crc32(), "phase=$phase")
+        }
+        val wiki = "Wikipedia"
+        for (i in wiki.indices) GlobalHeap.sb(base + i, wiki[i].code.toByte())
+        assertEquals(0x11E60398, U8View(base, wiki.length).adler32())
+
+        // Chained checksums equal one pass, and the long-run Adler path defers its modulo correctly
+        fillPattern(base, 4096)
+        val whole = U8View(base, 4096)
+        assertEquals(whole.crc32(), U8View(base + 1000, 3096).crc32(U8View(base, 1000).crc32()))
+        assertEquals(whole.adler32(), U8View(base + 77, 4019).adler32(U8View(base, 77).adler32()))
+        var a = 1L
+        var b = 0L
+        for (i in 0 until 4096) {
+            a = (a + whole.get(i)) % 65521
+            b = (b + a) % 65521
+        }
+        assertEquals(((b shl 16) or a).toInt(), whole.adler32())
+        KMalloc.free(base)
+    }
+
+    @Test
+    fun rangeIsCheckedOnceUpFront() {
+        KMalloc.init(1 shl 12)
+        val size = GlobalHeap.size
+        assertFailsWith<IllegalArgumentException> { U8View(size - 4, 8).sum() }
+        assertFailsWith<IllegalArgumentException> { U16View(size - 4, 4).forEachIndexed { _, _ -> } }
+        assertFailsWith<IllegalArgumentException> { U32View(-4, 2).xor() }
+        assertFailsWith<IllegalArgumentException> { U32View(0, 4).copyTo(IntArray(3)) }
+        assertEquals(0L, U8View(size, 0).sum())
+    }
+}
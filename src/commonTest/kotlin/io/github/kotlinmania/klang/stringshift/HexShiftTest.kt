@@ -0,0 +1,66 @@
+package io.github.kotlinmania.klang.stringshift
+
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertTrue
+
+class HexShiftTest {
+    private val samples = listOf(
+        "0", "1", "f", "8000", "ffff", "10000", "DeadBeef", "0x1F", "000abc",
+        "123456789abcdef0fedcba9876543210", "f".repeat(37), "8" + "0".repeat(40),
+    )
+
+    @Test
+    fun hexAndLimbsRoundTrip() {
+        assertEquals(listOf(0x5678, 0x1234), hexToLimbs("0x12345678").toList())
+        assertEquals(listOf(0xbeef, 0xdead, 0xc), hexToLimbs("  CDEADbeef\n").toList())
+        assertEquals(listOf(0), hexToLimbs("0000").toList())
+        assertEquals(listOf(0), hexToLimbs("").toList())
+        assertEquals("1", limbsToHex(intArrayOf(1, 0, 0)))
+        assertEquals("0", limbsToHex(intArrayOf()))
+        assertEquals("a0000", limbsToHex(intArrayOf(0, 0xa, 0x1234), 2))
+        for (h in samples) {
+            val canon = h.removePrefix("0x").lowercase().trimStart('0').ifEmpty { "0" }
+            assertEquals(canon, limbsToHex(hexToLimbs(h)), h)
+        }
+        assertFailsWith<NumberFormatException> { hexToLimbs("12g4") }
+        assertFailsWith<NumberFormatException> { leftShiftHexString("1z", 1) }
+    }
+
+    @Test
+    fun stringShiftsMatchLimbBuffer() {
+        for (h in samples) for (s in listOf(0, 1, 2, 3, 4, 5, 15, 16, 17, 33, 64, 131)) {
+            val left = leftShiftHexString(h, s)
+            val right = rightShiftHexString(h, s)
+            assertEquals(LimbBuffer.fromHex(h).shl(s).toHex(), left, "$h << $s")
+            assertEquals(LimbBuffer.fromHex(h).shr(s).toHex(), right, "$h >> $s")
+            assertEquals(LimbBuffer.fromHex(h).toHex(), rightShiftHexString(left, s), "($h << $s) >> $s")
+        }
+        assertEquals("2", leftShiftHexString("1", 1))
+        assertEquals("1e", leftShiftHexString("F", 1))
+        assertEquals("7fff", rightShiftHexString("ffff", 1))
+        assertEquals("0", rightShiftHexString("ffff", 16))
+    }
+
+    @Test
+    fun limbBufferChainsShiftsInPlace() {
+        val v = LimbBuffer.fromHex("0x1f")
+        v.shl(130).shr(3)
+        assertEquals("f8" + "0".repeat(31), v.toHex())
+        assertEquals(132, v.bitLength)
+        assertEquals(9, v.size)
+
+        v.shr(132)
+        assertTrue(v.isZero)
+        assertEquals(1, v.size)
+        assertEquals("0", v.toHex())
+
+        val w = LimbBuffer(capacity = 1).setHex("ffff")
+        w.shl(1)
+        assertEquals(listOf(0xfffe, 0x1), w.toLimbs().toList())
+        assertEquals(LimbBuffer.fromLimbs(intArrayOf(0xfffe, 1, 0)), w)
+        assertEquals(0, w[5])
+        assertEquals("LimbBuffer(0x1fffe)", w.toString())
+    }
+}
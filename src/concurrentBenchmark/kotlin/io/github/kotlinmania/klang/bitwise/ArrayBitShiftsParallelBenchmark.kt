@@ -0,0 +1,49 @@
+package io.github.kotlinmania.klang.bitwise
+
+import kotlinx.benchmark.Benchmark
+import kotlinx.benchmark.BenchmarkMode
+import kotlinx.benchmark.BenchmarkTimeUnit
+import kotlinx.benchmark.Mode
+import kotlinx.benchmark.OutputTimeUnit
+import kotlinx.benchmark.Param
+import kotlinx.benchmark.Scope
+import kotlinx.benchmark.Setup
+import kotlinx.benchmark.State
+import kotlinx.coroutines.runBlocking
+
+/**
+ * Parallel scaling of the chunked [ArrayBitShifts] shifts on the
+ * [ArrayBitShiftsBenchmark] sizes, from one chunk to eight.
+ *
+ * Lives in concurrentBenchmark (JVM and native) because each op has to block
+ * on the coroutine scope; JS and Wasm have no `runBlocking`. Compare a row
+ * with `parallelism=1` to read the speedup, and with the pthreads rows of
+ * `tools/klang_bench_baseline.c` for the C equivalent.
+ */
+@State(Scope.Benchmark)
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(BenchmarkTimeUnit.MICROSECONDS)
+class ArrayBitShiftsParallelBenchmark {
+
+    @Param("1", "2", "4", "8")
+    var parallelism: Int = 0
+
+    private val limbs = IntArray(ArrayBitShiftsBenchmark.LIMBS)
+    private val words = LongArray(ArrayBitShiftsBenchmark.LIMBS / 4)
+
+    @Setup
+    fun setup() {
+        for (i in limbs.indices) limbs[i] = (i * 40503) and 0xFFFF
+        ArrayBitShifts.pack16To64(limbs, 0, limbs.size, words)
+    }
+
+    @Benchmark
+    fun shl16Limbs(): Int = runBlocking {
+        ArrayBitShifts.shl16LEInPlaceParallel(limbs, 0, limbs.size, 5, limbs[limbs.size - 1] ushr 11, parallelism).carryOut
+    }
+
+    @Benchmark
+    fun shl64Words(): Long = runBlocking {
+        ArrayBitShifts.shl64LEInPlaceParallel(words, 0, words.size, 5, words[words.size - 1] ushr 59, parallelism).carryOut
+    }
+}
@@ -0,0 +1,10 @@
+package io.github.kotlinmania.klang.bitwise
+
+// Single-threaded runtime: one slot is the thread-local slot.
+private var threadRing: CFloatTraceRing? = null
+
+internal actual fun boundTraceRing(): CFloatTraceRing? = threadRing
+
+internal actual fun bindTraceRingToThread(ring: CFloatTraceRing?) {
+    threadRing = ring
+}
@@ -14,3 +14,14 @@ actual fun logToFile(line: String) {
 actual fun getEnv(name: String): String? = null
 
 actual fun currentTimestamp(): String = Date().toISOString()
+
+// Console output is line-oriented; keep one call per line.
+internal actual val logWriterMode: LogWriterMode = LogWriterMode.IMMEDIATE
+
+internal actual fun installLogFlushHook(flush: () -> Unit) {}
+
+internal actual fun launchLogWriter(body: suspend () -> Unit): Unit =
+    throw UnsupportedOperationException("no background log writer on this target")
+
+internal actual fun <T> blockOnLogWriter(body: suspend () -> T): T =
+    throw UnsupportedOperationException("no background log writer on this target")
@@ -0,0 +1,5 @@
+package io.github.kotlinmania.klang.fp
+
+// Kotlin/JS Float is a JS number: `a * b` is evaluated in binary64 and never
+// rounded back to binary32, so the soft-float kernels are always used.
+internal actual val float32HostIsBinary32: Boolean = false
@@ -0,0 +1,3 @@
+package io.github.kotlinmania.klang.int
+
+internal actual fun multiplyHighUnsigned(a: Long, b: Long): Long = multiplyHighUnsignedPortable(a, b)
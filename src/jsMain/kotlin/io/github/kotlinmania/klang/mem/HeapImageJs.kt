@@ -0,0 +1,10 @@
+package io.github.kotlinmania.klang.mem
+
+// No file backend here; GlobalHeap.snapshot / restore with a HeapSink / HeapSource still work.
+internal actual val heapImageFilesSupported: Boolean = false
+
+internal actual fun openHeapImageFile(path: String, write: Boolean, imageWords: Long): HeapImageFile? = null
+
+internal actual fun heapImageTempPath(name: String): String = name
+
+internal actual fun deleteHeapImageFile(path: String) {}
@@ -0,0 +1,10 @@
+package io.github.kotlinmania.klang.mem
+
+// Single-threaded runtime: one slot is the thread-local slot.
+private var threadRegion: KRegion? = null
+
+internal actual fun boundRegion(): KRegion? = threadRegion
+
+internal actual fun bindRegionToThread(region: KRegion?) {
+    threadRegion = region
+}
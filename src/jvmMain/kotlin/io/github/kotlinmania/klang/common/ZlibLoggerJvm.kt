@@ -2,12 +2,40 @@
 
 package io.github.kotlinmania.klang.common
 
+import kotlinx.coroutines.CoroutineScope
+import kotlinx.coroutines.DelicateCoroutinesApi
+import kotlinx.coroutines.ExperimentalCoroutinesApi
+import kotlinx.coroutines.launch
+import kotlinx.coroutines.newSingleThreadContext
+import kotlinx.coroutines.runBlocking
+
 actual var LOG_FILE_PATH: String? = null
 
 actual fun logToFile(line: String) {
-    println(line)
+    print(line)
 }
 
 actual fun getEnv(name: String): String? = System.getenv(name)
 
 actual fun currentTimestamp(): String = System.currentTimeMillis().toString()
+
+// Blocks go to the writer thread; the shutdown hook drains the queue.
+internal actual val logWriterMode: LogWriterMode = LogWriterMode.BACKGROUND
+
+// The writer gets its own (daemon) thread so it runs even when Dispatchers.Default
+// is saturated by the producers waiting on it.
+@OptIn(DelicateCoroutinesApi::class, ExperimentalCoroutinesApi::class)
+internal actual fun launchLogWriter(body: suspend () -> Unit) {
+    CoroutineScope(newSingleThreadContext("klang-log-writer")).launch { body() }
+}
+
+internal actual fun <T> blockOnLogWriter(body: suspend () -> T): T = runBlocking { body() }
+
+// `Runtime` and `Thread` come from the default `java.lang` import.
+internal actual fun installLogFlushHook(flush: () -> Unit) {
+    try {
+        Runtime.getRuntime().addShutdownHook(Thread { flush() })
+    } catch (_: Throwable) {
+        // Security manager or shutdown already in progress
+    }
+}
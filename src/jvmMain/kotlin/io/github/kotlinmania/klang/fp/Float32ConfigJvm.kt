@@ -0,0 +1,4 @@
+package io.github.kotlinmania.klang.fp
+
+// JVM float arithmetic is strict IEEE binary32 (JEP 306, always-strict since 17).
+internal actual val float32HostIsBinary32: Boolean = true
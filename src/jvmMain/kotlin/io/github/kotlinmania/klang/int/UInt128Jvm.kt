@@ -0,0 +1,7 @@
+package io.github.kotlinmania.klang.int
+
+// `Math` comes from the default `java.lang` import on Kotlin/JVM. multiplyHigh
+// is the signed high product (JDK 9+, intrinsified); the two masked terms
+// convert it to the unsigned one.
+internal actual fun multiplyHighUnsigned(a: Long, b: Long): Long =
+    Math.multiplyHigh(a, b) + ((a shr 63) and b) + ((b shr 63) and a)
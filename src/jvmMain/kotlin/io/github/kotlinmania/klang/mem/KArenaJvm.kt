@@ -0,0 +1,11 @@
+package io.github.kotlinmania.klang.mem
+
+// `ThreadLocal` comes from the default `java.lang` import on Kotlin/JVM
+// (no explicit import line needed).
+private val threadArena = ThreadLocal<KArena?>()
+
+internal actual fun boundArena(): KArena? = threadArena.get()
+
+internal actual fun bindArenaToThread(arena: KArena?) {
+    threadArena.set(arena)
+}
@@ -0,0 +1,11 @@
+package io.github.kotlinmania.klang.mem
+
+// `ThreadLocal` comes from the default `java.lang` import on Kotlin/JVM
+// (no explicit import line needed).
+private val threadRegion = ThreadLocal<KRegion?>()
+
+internal actual fun boundRegion(): KRegion? = threadRegion.get()
+
+internal actual fun bindRegionToThread(region: KRegion?) {
+    threadRegion.set(region)
+}
@@ -0,0 +1,55 @@
+@file:OptIn(kotlinx.cinterop.ExperimentalForeignApi::class, kotlin.experimental.ExperimentalNativeApi::class)
+
+package io.github.kotlinmania.klang.mem
+
+import kotlinx.cinterop.CPointer
+import kotlinx.cinterop.addressOf
+import kotlinx.cinterop.convert
+import kotlinx.cinterop.toKString
+import kotlinx.cinterop.usePinned
+import platform.posix.FILE
+import platform.posix.fclose
+import platform.posix.fopen
+import platform.posix.fread
+import platform.posix.fwrite
+import platform.posix.getenv
+import platform.posix.remove
+
+// mingwX64 has no <sys/mman.h>, so heap words go straight between the pinned
+// LongArray and stdio instead of a mapping: one copy, no staging buffer.
+// x64 is little-endian, so the in-memory words already are the image byte
+// order.
+
+internal actual val heapImageFilesSupported: Boolean = true
+
+internal actual fun openHeapImageFile(path: String, write: Boolean, imageWords: Long): HeapImageFile? {
+    check(Platform.isLittleEndian) { "Heap image files require a little-endian target" }
+    val file = fopen(path, if (write) "wb" else "rb")
+        ?: throw IllegalStateException("Cannot open heap image $path")
+    return StdioHeapImageFile(file)
+}
+
+internal actual fun heapImageTempPath(name: String): String =
+    (getenv("TEMP")?.toKString()?.trimEnd('\\', '/') ?: ".") + "\\" + name
+
+internal actual fun deleteHeapImageFile(path: String) {
+    remove(path)
+}
+
+private class StdioHeapImageFile(private val file: CPointer<FILE>) : HeapImageFile {
+    override fun write(words: LongArray, offset: Int, count: Int) {
+        if (count == 0) return
+        val n = words.usePinned { fwrite(it.addressOf(offset), 8u, count.convert(), file) }
+        check(n.toLong() == count.toLong()) { "Short write to heap image" }
+    }
+
+    override fun read(words: LongArray, offset: Int, count: Int) {
+        if (count == 0) return
+        val n = words.usePinned { fread(it.addressOf(offset), 8u, count.convert(), file) }
+        require(n.toLong() == count.toLong()) { "Truncated heap image" }
+    }
+
+    override fun close() {
+        fclose(file)
+    }
+}
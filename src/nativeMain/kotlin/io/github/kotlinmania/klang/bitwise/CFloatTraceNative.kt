@@ -0,0 +1,13 @@
+package io.github.kotlinmania.klang.bitwise
+
+import kotlin.native.concurrent.ThreadLocal
+
+// Each Kotlin/Native worker thread sees its own copy of this slot.
+@ThreadLocal
+private var threadRing: CFloatTraceRing? = null
+
+internal actual fun boundTraceRing(): CFloatTraceRing? = threadRing
+
+internal actual fun bindTraceRingToThread(ring: CFloatTraceRing?) {
+    threadRing = ring
+}
@@ -6,6 +6,12 @@ package io.github.kotlinmania.klang.common
 
 import kotlinx.cinterop.memScoped
 import kotlinx.cinterop.toKString
+import kotlinx.coroutines.CoroutineScope
+import kotlinx.coroutines.DelicateCoroutinesApi
+import kotlinx.coroutines.ExperimentalCoroutinesApi
+import kotlinx.coroutines.launch
+import kotlinx.coroutines.newSingleThreadContext
+import kotlinx.coroutines.runBlocking
 import kotlin.time.Clock
 import platform.posix.fclose
 import platform.posix.fopen
@@ -31,3 +37,17 @@ actual fun getEnv(name: String): String? {
     val v = getenv(name)
     return v?.toKString()
 }
+
+// Blocks go to the writer thread; call ZlibLogger.flush() before exit.
+internal actual val logWriterMode: LogWriterMode = LogWriterMode.BACKGROUND
+
+// The writer gets its own worker thread so it runs even when Dispatchers.Default
+// is saturated by the producers waiting on it.
+@OptIn(DelicateCoroutinesApi::class, ExperimentalCoroutinesApi::class)
+internal actual fun launchLogWriter(body: suspend () -> Unit) {
+    CoroutineScope(newSingleThreadContext("klang-log-writer")).launch { body() }
+}
+
+internal actual fun <T> blockOnLogWriter(body: suspend () -> T): T = runBlocking { body() }
+
+internal actual fun installLogFlushHook(flush: () -> Unit) {}
@@ -0,0 +1,4 @@
+package io.github.kotlinmania.klang.fp
+
+// LLVM lowers Float to IEEE binary32 instructions (SSE on x86-64, FP on AArch64).
+internal actual val float32HostIsBinary32: Boolean = true
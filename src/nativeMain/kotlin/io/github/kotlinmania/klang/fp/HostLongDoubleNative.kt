@@ -0,0 +1,45 @@
+@file:OptIn(kotlinx.cinterop.ExperimentalForeignApi::class)
+
+package io.github.kotlinmania.klang.fp
+
+import io.github.kotlinmania.klang.cinterop.longdouble.kld_binary
+import io.github.kotlinmania.klang.cinterop.longdouble.kld_from_double_double
+import io.github.kotlinmania.klang.cinterop.longdouble.kld_has_float128
+import io.github.kotlinmania.klang.cinterop.longdouble.kld_long_double_mant_dig
+import io.github.kotlinmania.klang.cinterop.longdouble.kld_sqrt
+import io.github.kotlinmania.klang.cinterop.longdouble.kld_to_double_double
+import kotlinx.cinterop.addressOf
+import kotlinx.cinterop.usePinned
+
+// One foreign call per batch into tools/klang_longdouble.h; the arrays are
+// pinned for the call and the C side reads and writes them in place.
+internal actual val hostLongDoubleBackend: HostLongDoubleBackend? = NativeHostLongDouble
+
+private object NativeHostLongDouble : HostLongDoubleBackend {
+    override val longDoubleMantissaBits: Int = kld_long_double_mant_dig()
+    override val hasFloat128: Boolean = kld_has_float128() != 0
+
+    override fun binary(format: Int, op: Int, a: LongArray, b: LongArray, out: LongArray, n: Int): Int =
+        a.usePinned { pa ->
+            b.usePinned { pb ->
+                out.usePinned { po -> kld_binary(format, op, pa.addressOf(0), pb.addressOf(0), po.addressOf(0), n) }
+            }
+        }
+
+    override fun sqrt(format: Int, a: LongArray, out: LongArray, n: Int): Int =
+        a.usePinned { pa -> out.usePinned { po -> kld_sqrt(format, pa.addressOf(0), po.addressOf(0), n) } }
+
+    override fun fromDoubleDouble(format: Int, hi: DoubleArray, lo: DoubleArray, out: LongArray, n: Int): Int =
+        hi.usePinned { ph ->
+            lo.usePinned { pl ->
+                out.usePinned { po -> kld_from_double_double(format, ph.addressOf(0), pl.addressOf(0), po.addressOf(0), n) }
+            }
+        }
+
+    override fun toDoubleDouble(format: Int, src: LongArray, hi: DoubleArray, lo: DoubleArray, n: Int): Int =
+        src.usePinned { ps ->
+            hi.usePinned { ph ->
+                lo.usePinned { pl -> kld_to_double_double(format, ps.addressOf(0), ph.addressOf(0), pl.addressOf(0), n) }
+            }
+        }
+}
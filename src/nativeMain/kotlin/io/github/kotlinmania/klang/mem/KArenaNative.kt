@@ -0,0 +1,13 @@
+package io.github.kotlinmania.klang.mem
+
+import kotlin.native.concurrent.ThreadLocal
+
+// Each Kotlin/Native worker thread sees its own copy of this slot.
+@ThreadLocal
+private var threadArena: KArena? = null
+
+internal actual fun boundArena(): KArena? = threadArena
+
+internal actual fun bindArenaToThread(arena: KArena?) {
+    threadArena = arena
+}
@@ -0,0 +1,13 @@
+package io.github.kotlinmania.klang.mem
+
+import kotlin.native.concurrent.ThreadLocal
+
+// Each Kotlin/Native worker thread sees its own copy of this slot.
+@ThreadLocal
+private var threadRegion: KRegion? = null
+
+internal actual fun boundRegion(): KRegion? = threadRegion
+
+internal actual fun bindRegionToThread(region: KRegion?) {
+    threadRegion = region
+}
@@ -0,0 +1,107 @@
+@file:OptIn(kotlinx.cinterop.ExperimentalForeignApi::class, kotlin.experimental.ExperimentalNativeApi::class)
+
+package io.github.kotlinmania.klang.mem
+
+import kotlinx.cinterop.ByteVar
+import kotlinx.cinterop.CPointer
+import kotlinx.cinterop.addressOf
+import kotlinx.cinterop.alloc
+import kotlinx.cinterop.convert
+import kotlinx.cinterop.memScoped
+import kotlinx.cinterop.plus
+import kotlinx.cinterop.ptr
+import kotlinx.cinterop.reinterpret
+import kotlinx.cinterop.toKString
+import kotlinx.cinterop.toLong
+import kotlinx.cinterop.usePinned
+import platform.posix.MAP_SHARED
+import platform.posix.O_CREAT
+import platform.posix.O_RDONLY
+import platform.posix.O_RDWR
+import platform.posix.O_TRUNC
+import platform.posix.PROT_READ
+import platform.posix.PROT_WRITE
+import platform.posix.close
+import platform.posix.fstat
+import platform.posix.ftruncate
+import platform.posix.getenv
+import platform.posix.memcpy
+import platform.posix.mmap
+import platform.posix.munmap
+import platform.posix.open
+import platform.posix.stat
+import platform.posix.unlink
+
+// POSIX targets (posixMain: Apple, Linux, Android Native) mmap the image
+// whole: heap words are memcpy'd between the pinned LongArray and the
+// mapping, one copy, no stdio buffer. mingwX64 has no <sys/mman.h> and keeps
+// the stdio backend in mingwMain. Every supported native target is
+// little-endian, so the in-memory words already are the image byte order.
+
+internal actual val heapImageFilesSupported: Boolean = true
+
+internal actual fun openHeapImageFile(path: String, write: Boolean, imageWords: Long): HeapImageFile? {
+    check(Platform.isLittleEndian) { "Heap image files require a little-endian target" }
+    // 0644 for a new file
+    val fd = if (write) open(path, O_RDWR or O_CREAT or O_TRUNC, 0x1A4) else open(path, O_RDONLY)
+    check(fd >= 0) { "Cannot open heap image $path" }
+    try {
+        val bytes = if (write) {
+            val n = imageWords * 8
+            check(ftruncate(fd, n.convert()) == 0) { "Cannot size heap image $path" }
+            n
+        } else {
+            memScoped {
+                val st = alloc<stat>()
+                check(fstat(fd, st.ptr) == 0) { "Cannot stat heap image $path" }
+                // Whole words only; a trailing partial word is never part of an image
+                st.st_size.toLong() and 7L.inv()
+            }
+        }
+        val base = if (bytes == 0L) {
+            null
+        } else {
+            val prot = if (write) PROT_READ or PROT_WRITE else PROT_READ
+            val p = mmap(null, bytes.convert(), prot, MAP_SHARED, fd, 0)
+            check(p != null && p.toLong() != -1L) { "Cannot map heap image $path" }
+            p.reinterpret<ByteVar>()
+        }
+        // The mapping keeps the file contents reachable; the descriptor is no longer needed
+        return PosixHeapImageFile(base, bytes)
+    } catch (e: Throwable) {
+        // O_TRUNC already emptied the file: don't leave a half-made image behind
+        if (write) unlink(path)
+        throw e
+    } finally {
+        close(fd)
+    }
+}
+
+internal actual fun heapImageTempPath(name: String): String =
+    (getenv("TMPDIR")?.toKString()?.trimEnd('/') ?: "/tmp") + "/" + name
+
+internal actual fun deleteHeapImageFile(path: String) {
+    unlink(path)
+}
+
+private class PosixHeapImageFile(private val base: CPointer<ByteVar>?, private val bytes: Long) : HeapImageFile {
+    private var pos = 0L
+
+    override fun write(words: LongArray, offset: Int, count: Int) {
+        if (count == 0) return
+        check(pos + count * 8L <= bytes) { "Heap image larger than the ${bytes / 8} words reserved" }
+        words.usePinned { memcpy(base + pos, it.addressOf(offset), (count * 8L).convert()) }
+        pos += count * 8L
+    }
+
+    override fun read(words: LongArray, offset: Int, count: Int) {
+        if (count == 0) return
+        require(pos + count * 8L <= bytes) { "Truncated heap image" }
+        words.usePinned { memcpy(it.addressOf(offset), base + pos, (count * 8L).convert()) }
+        pos += count * 8L
+    }
+
+    override fun close() {
+        if (base != null) munmap(base, bytes.convert())
+    }
+}
@@ -0,0 +1,4 @@
+package io.github.kotlinmania.klang.fp
+
+// No C toolchain types are reachable from this target.
+internal actual val hostLongDoubleBackend: HostLongDoubleBackend? = null
@@ -0,0 +1,10 @@
+package io.github.kotlinmania.klang.mem
+
+// Single-threaded runtime: one slot is the thread-local slot.
+private var threadArena: KArena? = null
+
+internal actual fun boundArena(): KArena? = threadArena
+
+internal actual fun bindArenaToThread(arena: KArena?) {
+    threadArena = arena
+}
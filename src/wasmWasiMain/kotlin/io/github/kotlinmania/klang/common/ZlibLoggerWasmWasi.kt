@@ -7,9 +7,20 @@ import kotlin.time.Clock
 actual var LOG_FILE_PATH: String? = null
 
 actual fun logToFile(line: String) {
-    println(line)
+    print(line)
 }
 
 actual fun getEnv(name: String): String? = null
 
 actual fun currentTimestamp(): String = Clock.System.now().toString()
+
+// No threads: lines are batched and each block is written by the producer.
+internal actual val logWriterMode: LogWriterMode = LogWriterMode.BLOCKING_BATCH
+
+internal actual fun installLogFlushHook(flush: () -> Unit) {}
+
+internal actual fun launchLogWriter(body: suspend () -> Unit): Unit =
+    throw UnsupportedOperationException("no background log writer on this target")
+
+internal actual fun <T> blockOnLogWriter(body: suspend () -> T): T =
+    throw UnsupportedOperationException("no background log writer on this target")
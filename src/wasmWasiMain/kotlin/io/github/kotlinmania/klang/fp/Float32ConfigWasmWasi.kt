@@ -0,0 +1,4 @@
+package io.github.kotlinmania.klang.fp
+
+// Wasm f32 arithmetic is specified as IEEE binary32 round-to-nearest-even.
+internal actual val float32HostIsBinary32: Boolean = true
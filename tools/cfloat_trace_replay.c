@@ -0,0 +1,124 @@
+/**
+ * cfloat_trace_replay.c - Replay a CFloatTrace binary dump with C float arithmetic
+ *
+ * Compile: gcc -std=c11 -O2 -ffp-contract=off -o cfloat_trace_replay cfloat_trace_replay.c -lm
+ * Run:     ./cfloat_trace_replay trace.cftr [max-mismatches-to-print]
+ *
+ * Reads the dump written by CFloatTrace.export() (format documented on
+ * CFloatTrace), recomputes every replayable record with binary32 C
+ * arithmetic and reports records whose result bits differ. NaN results match
+ * any NaN (payloads are not compared). fma/fmaF records are counted but not
+ * replayed: the addend is not part of the record.
+ *
+ * Exit status: 0 if every replayed record matches, 1 on mismatch, 2 on a
+ * malformed dump.
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define FLAG_RHS 0x100u
+
+enum kind { K_SKIP, K_ADD, K_SUB, K_MUL, K_DIV, K_ABS };
+
+static const uint8_t *buf;
+static size_t len, pos;
+
+static int need(size_t n) { return pos + n <= len; }
+static uint32_t u32(void) {
+    uint32_t v = (uint32_t)buf[pos] | (uint32_t)buf[pos + 1] << 8 |
+                 (uint32_t)buf[pos + 2] << 16 | (uint32_t)buf[pos + 3] << 24;
+    pos += 4;
+    return v;
+}
+static uint64_t u64(void) { uint64_t lo = u32(); return lo | (uint64_t)u32() << 32; }
+
+static float f_of(uint32_t b) { float f; memcpy(&f, &b, 4); return f; }
+static uint32_t bits_of(float f) { uint32_t b; memcpy(&b, &f, 4); return b; }
+
+static enum kind classify(const char *name) {
+    if (!strncmp(name, "plus", 4)) return K_ADD;       /* plus, plusF, plusExact, plusExactF */
+    if (!strncmp(name, "minus", 5)) return K_SUB;
+    if (!strncmp(name, "times", 5)) return K_MUL;      /* times, timesF, timesExact, timesExactF */
+    if (!strcmp(name, "div") || !strcmp(name, "divF")) return K_DIV;
+    if (!strcmp(name, "abs")) return K_ABS;
+    return K_SKIP;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s trace.cftr [max-print]\n", argv[0]);
+        return 2;
+    }
+    long max_print = argc > 2 ? strtol(argv[2], NULL, 10) : 20;
+    FILE *f = fopen(argv[1], "rb");
+    if (!f) { perror(argv[1]); return 2; }
+    fseek(f, 0, SEEK_END);
+    len = (size_t)ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *data = malloc(len ? len : 1);
+    if (!data || fread(data, 1, len, f) != len) { fprintf(stderr, "read failed\n"); return 2; }
+    fclose(f);
+    buf = data;
+
+    if (!need(20) || memcmp(buf, "CFTR", 4) != 0) { fprintf(stderr, "not a CFTR dump\n"); return 2; }
+    pos = 4;
+    uint32_t version = u32(), sample_every = u32(), op_count = u32();
+    if (version != 1 || op_count > 256) { fprintf(stderr, "unsupported dump (version %u)\n", version); return 2; }
+
+    char names[256][256];
+    enum kind kinds[256];
+    for (uint32_t i = 0; i < op_count; i++) {
+        if (!need(1)) return 2;
+        uint8_t n = buf[pos++];
+        if (!need(n)) return 2;
+        memcpy(names[i], buf + pos, n);
+        names[i][n] = 0;
+        pos += n;
+        kinds[i] = classify(names[i]);
+    }
+
+    if (!need(4)) return 2;
+    uint32_t writers = u32();
+    uint64_t replayed = 0, skipped = 0, mismatched = 0, dropped_total = 0;
+    printf("CFloatTrace dump: %u ops, %u writers, 1-in-%u sampling\n", op_count, writers, sample_every);
+    for (uint32_t w = 0; w < writers; w++) {
+        if (!need(16)) return 2;
+        uint32_t id = u32();
+        uint64_t dropped = u64();
+        uint32_t records = u32();
+        dropped_total += dropped;
+        if (!need((size_t)records * 16)) return 2;
+        for (uint32_t r = 0; r < records; r++) {
+            uint32_t head = u32(), lhs = u32(), rhs = u32(), result = u32();
+            uint32_t op = head & 0xFFu;
+            if (op >= op_count || kinds[op] == K_SKIP) { skipped++; continue; }
+            float a = f_of(lhs), b = f_of(rhs), c;
+            switch (kinds[op]) {
+            case K_ADD: c = a + b; break;
+            case K_SUB: c = a - b; break;
+            case K_MUL: c = a * b; break;
+            case K_DIV: c = a / b; break;
+            default:    c = fabsf(a); break;
+            }
+            replayed++;
+            uint32_t expect = bits_of(c);
+            int same = isnan(c) ? isnan(f_of(result)) : expect == result;
+            if (!same) {
+                if ((long)mismatched < max_print) {
+                    printf("writer %u #%u %-12s lhs=%08X rhs=%s%08X kotlin=%08X c=%08X\n",
+                           id, r, names[op], lhs, (head & FLAG_RHS) ? "" : "-", rhs, result, expect);
+                }
+                mismatched++;
+            }
+        }
+    }
+    printf("replayed %llu, skipped %llu, dropped %llu, mismatched %llu\n",
+           (unsigned long long)replayed, (unsigned long long)skipped,
+           (unsigned long long)dropped_total, (unsigned long long)mismatched);
+    free(data);
+    return mismatched ? 1 : 0;
+}
@@ -12,14 +12,47 @@
  * - Sum of many small numbers (catastrophic cancellation)
  * - Product of near-unity values
  * - Compensated summation (Kahan)
+ *
+ * The throughput section times double-double kernels the way native code
+ * would run them: Dekker-split vs FMA two_prod, and scalar vs SIMD
+ * structure-of-arrays batch add/mul/dot (4-wide AVX2, 2-wide NEON). Each
+ * kernel gets warmup calls and several timed repetitions with
+ * clock_gettime(CLOCK_MONOTONIC); min and median ns/op are reported.
+ * The host long double / __float128 batch kernels from klang_longdouble.h
+ * (the Strict-C backend behind HostLongDouble) are timed alongside.
+ *
+ * Compile: gcc -std=c11 -O2 -march=native -o float128_benchmark float128_benchmark.c -lm
+ * Run:     ./float128_benchmark              (precision tests + throughput)
+ *          ./float128_benchmark --bench-only (throughput only)
+ *
+ * Without -march=native (or -mavx2 -mfma) the SIMD rows fall back to the
+ * scalar FMA kernels and are labeled as such.
  */
 
+#define _POSIX_C_SOURCE 199309L
+
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 #include <float.h>
 #include <time.h>
 
+#include "klang_longdouble.h"
+
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#define DD_SIMD_NAME "avx2"
+#define DD_SIMD_WIDTH 4
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define DD_SIMD_NAME "neon"
+#define DD_SIMD_WIDTH 2
+#else
+#define DD_SIMD_NAME "none"
+#define DD_SIMD_WIDTH 1
+#endif
+
 // ============================================================================
 // Double-Double Arithmetic (QD library algorithms)
 // ============================================================================
@@ -107,6 +140,30 @@ static inline dd_real dd_mul(dd_real a, dd_real b) {
     return result;
 }
 
+// Error-free transformation: two-product using a fused multiply-add.
+// fma(a, b, -p) is the exact rounding error of p = a * b, replacing the
+// six-multiply Dekker split (identical results barring overflow).
+static inline dd_real two_prod_fma(double a, double b) {
+    double p = a * b;
+    double err = fma(a, b, -p);
+    dd_real result = {p, err};
+    return result;
+}
+
+// Double-double multiplication, QD "sloppy" form on top of the FMA two-product
+static inline dd_real dd_mul_fma(dd_real a, dd_real b) {
+    dd_real p = two_prod_fma(a.hi, b.hi);
+    double lo = p.lo + fma(a.hi, b.lo, a.lo * b.hi);
+    return quick_two_sum(p.hi, lo);
+}
+
+// Same algorithm with the Dekker split, for a like-for-like two_prod comparison
+static inline dd_real dd_mul_split(dd_real a, dd_real b) {
+    dd_real p = two_prod(a.hi, b.hi);
+    double lo = p.lo + (a.hi * b.lo + a.lo * b.hi);
+    return quick_two_sum(p.hi, lo);
+}
+
 // Convert to double
 static inline double dd_to_double(dd_real a) {
     return a.hi + a.lo;
@@ -124,6 +181,13 @@ static void dd_print(const char* label, dd_real x) {
            label, x.hi, x.lo, x.hi + x.lo);
 }
 
+// Monotonic wall clock in seconds
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
 // ============================================================================
 // Test Cases
 // ============================================================================
@@ -200,16 +264,16 @@ void test_summation() {
     const double small = 1e-8;
     
     // Simple double summation
-    clock_t start = clock();
+    double start = now_seconds();
     double d_sum = 0.0;
     for (int i = 0; i < n; i++) {
         d_sum += small;
     }
-    clock_t end = clock();
-    double d_time = (double)(end - start) / CLOCKS_PER_SEC;
+    double end = now_seconds();
+    double d_time = end - start;
     
     // Kahan summation (compensated)
-    start = clock();
+    start = now_seconds();
     double k_sum = 0.0;
     double k_c = 0.0;
     for (int i = 0; i < n; i++) {
@@ -218,18 +282,18 @@ void test_summation() {
         k_c = (t - k_sum) - y;
         k_sum = t;
     }
-    end = clock();
-    double k_time = (double)(end - start) / CLOCKS_PER_SEC;
+    end = now_seconds();
+    double k_time = end - start;
     
     // Double-double summation
-    start = clock();
+    start = now_seconds();
     dd_real dd_sum = dd_from_double(0.0);
     dd_real dd_small = dd_from_double(small);
     for (int i = 0; i < n; i++) {
         dd_sum = dd_add(dd_sum, dd_small);
     }
-    end = clock();
-    double dd_time = (double)(end - start) / CLOCKS_PER_SEC;
+    end = now_seconds();
+    double dd_time = end - start;
     
     printf("\nResults:\n");
     printf("  double:            %.15f (error: %.2e, time: %.3fs)\n", 
@@ -275,6 +339,322 @@ void test_product() {
            dd_to_double(dd_prod), fabs(dd_to_double(dd_prod) - expected));
 }
 
+// ============================================================================
+// Batch Kernels (structure of arrays)
+// ============================================================================
+
+// hi[] and lo[] in separate arrays so SIMD lanes load contiguous doubles
+typedef struct {
+    double *hi;
+    double *lo;
+    size_t n;
+} dd_soa;
+
+static void dd_add_batch_scalar(const dd_soa *a, const dd_soa *b, dd_soa *out) {
+    for (size_t i = 0; i < a->n; i++) {
+        dd_real r = dd_add((dd_real){a->hi[i], a->lo[i]}, (dd_real){b->hi[i], b->lo[i]});
+        out->hi[i] = r.hi;
+        out->lo[i] = r.lo;
+    }
+}
+
+static void dd_mul_batch_split(const dd_soa *a, const dd_soa *b, dd_soa *out) {
+    for (size_t i = 0; i < a->n; i++) {
+        dd_real r = dd_mul_split((dd_real){a->hi[i], a->lo[i]}, (dd_real){b->hi[i], b->lo[i]});
+        out->hi[i] = r.hi;
+        out->lo[i] = r.lo;
+    }
+}
+
+static void dd_mul_batch_fma(const dd_soa *a, const dd_soa *b, dd_soa *out) {
+    for (size_t i = 0; i < a->n; i++) {
+        dd_real r = dd_mul_fma((dd_real){a->hi[i], a->lo[i]}, (dd_real){b->hi[i], b->lo[i]});
+        out->hi[i] = r.hi;
+        out->lo[i] = r.lo;
+    }
+}
+
+// sum(a[i] * b[i]) accumulated in one double-double
+static dd_real dd_dot_split(const dd_soa *a, const dd_soa *b) {
+    dd_real acc = {0.0, 0.0};
+    for (size_t i = 0; i < a->n; i++) {
+        acc = dd_add(acc, dd_mul_split((dd_real){a->hi[i], a->lo[i]}, (dd_real){b->hi[i], b->lo[i]}));
+    }
+    return acc;
+}
+
+static dd_real dd_dot_fma(const dd_soa *a, const dd_soa *b) {
+    dd_real acc = {0.0, 0.0};
+    for (size_t i = 0; i < a->n; i++) {
+        acc = dd_add(acc, dd_mul_fma((dd_real){a->hi[i], a->lo[i]}, (dd_real){b->hi[i], b->lo[i]}));
+    }
+    return acc;
+}
+
+#if DD_SIMD_WIDTH > 1
+
+#if defined(__AVX2__)
+typedef __m256d vd;
+#define V_LOAD(p) _mm256_loadu_pd(p)
+#define V_STORE(p, v) _mm256_storeu_pd((p), (v))
+#define V_ZERO() _mm256_setzero_pd()
+#define V_ADD(a, b) _mm256_add_pd((a), (b))
+#define V_SUB(a, b) _mm256_sub_pd((a), (b))
+#define V_MUL(a, b) _mm256_mul_pd((a), (b))
+#define V_FMA(a, b, c) _mm256_fmadd_pd((a), (b), (c))   // a * b + c
+#define V_FMS(a, b, c) _mm256_fmsub_pd((a), (b), (c))   // a * b - c
+#else
+typedef float64x2_t vd;
+#define V_LOAD(p) vld1q_f64(p)
+#define V_STORE(p, v) vst1q_f64((p), (v))
+#define V_ZERO() vdupq_n_f64(0.0)
+#define V_ADD(a, b) vaddq_f64((a), (b))
+#define V_SUB(a, b) vsubq_f64((a), (b))
+#define V_MUL(a, b) vmulq_f64((a), (b))
+#define V_FMA(a, b, c) vfmaq_f64((c), (a), (b))
+#define V_FMS(a, b, c) vfmaq_f64(vnegq_f64(c), (a), (b))
+#endif
+
+static inline void v_two_sum(vd a, vd b, vd *s, vd *e) {
+    *s = V_ADD(a, b);
+    vd bb = V_SUB(*s, a);
+    *e = V_ADD(V_SUB(a, V_SUB(*s, bb)), V_SUB(b, bb));
+}
+
+static inline void v_quick_two_sum(vd a, vd b, vd *s, vd *e) {
+    *s = V_ADD(a, b);
+    *e = V_SUB(b, V_SUB(*s, a));
+}
+
+static inline void v_dd_add(vd ah, vd al, vd bh, vd bl, vd *rh, vd *rl) {
+    vd s, e;
+    v_two_sum(ah, bh, &s, &e);
+    v_quick_two_sum(s, V_ADD(V_ADD(al, bl), e), rh, rl);
+}
+
+// Lane-wise dd_mul_fma
+static inline void v_dd_mul(vd ah, vd al, vd bh, vd bl, vd *rh, vd *rl) {
+    vd p = V_MUL(ah, bh);
+    vd e = V_FMS(ah, bh, p);
+    vd lo = V_ADD(e, V_FMA(ah, bl, V_MUL(al, bh)));
+    v_quick_two_sum(p, lo, rh, rl);
+}
+
+static void dd_add_batch_simd(const dd_soa *a, const dd_soa *b, dd_soa *out) {
+    size_t i = 0;
+    for (; i + DD_SIMD_WIDTH <= a->n; i += DD_SIMD_WIDTH) {
+        vd rh, rl;
+        v_dd_add(V_LOAD(a->hi + i), V_LOAD(a->lo + i), V_LOAD(b->hi + i), V_LOAD(b->lo + i), &rh, &rl);
+        V_STORE(out->hi + i, rh);
+        V_STORE(out->lo + i, rl);
+    }
+    for (; i < a->n; i++) {
+        dd_real r = dd_add((dd_real){a->hi[i], a->lo[i]}, (dd_real){b->hi[i], b->lo[i]});
+        out->hi[i] = r.hi;
+        out->lo[i] = r.lo;
+    }
+}
+
+static void dd_mul_batch_simd(const dd_soa *a, const dd_soa *b, dd_soa *out) {
+    size_t i = 0;
+    for (; i + DD_SIMD_WIDTH <= a->n; i += DD_SIMD_WIDTH) {
+        vd rh, rl;
+        v_dd_mul(V_LOAD(a->hi + i), V_LOAD(a->lo + i), V_LOAD(b->hi + i), V_LOAD(b->lo + i), &rh, &rl);
+        V_STORE(out->hi + i, rh);
+        V_STORE(out->lo + i, rl);
+    }
+    for (; i < a->n; i++) {
+        dd_real r = dd_mul_fma((dd_real){a->hi[i], a->lo[i]}, (dd_real){b->hi[i], b->lo[i]});
+        out->hi[i] = r.hi;
+        out->lo[i] = r.lo;
+    }
+}
+
+// One double-double accumulator per lane, combined at the end
+static dd_real dd_dot_simd(const dd_soa *a, const dd_soa *b) {
+    vd acc_h = V_ZERO(), acc_l = V_ZERO();
+    size_t i = 0;
+    for (; i + DD_SIMD_WIDTH <= a->n; i += DD_SIMD_WIDTH) {
+        vd ph, pl;
+        v_dd_mul(V_LOAD(a->hi + i), V_LOAD(a->lo + i), V_LOAD(b->hi + i), V_LOAD(b->lo + i), &ph, &pl);
+        v_dd_add(acc_h, acc_l, ph, pl, &acc_h, &acc_l);
+    }
+    double lanes_h[DD_SIMD_WIDTH], lanes_l[DD_SIMD_WIDTH];
+    V_STORE(lanes_h, acc_h);
+    V_STORE(lanes_l, acc_l);
+    dd_real acc = {0.0, 0.0};
+    for (int k = 0; k < DD_SIMD_WIDTH; k++) acc = dd_add(acc, (dd_real){lanes_h[k], lanes_l[k]});
+    for (; i < a->n; i++) {
+        acc = dd_add(acc, dd_mul_fma((dd_real){a->hi[i], a->lo[i]}, (dd_real){b->hi[i], b->lo[i]}));
+    }
+    return acc;
+}
+
+#else
+
+#define dd_add_batch_simd dd_add_batch_scalar
+#define dd_mul_batch_simd dd_mul_batch_fma
+#define dd_dot_simd dd_dot_fma
+
+#endif
+
+// ============================================================================
+// Throughput Harness
+// ============================================================================
+
+#define BENCH_N 4096        // elements per batch call (fits in L1/L2)
+#define BENCH_WARMUP 3
+#define BENCH_REPS 9
+#define BENCH_MIN_SECONDS 0.02
+
+enum { KERNEL_ADD, KERNEL_MUL_SPLIT, KERNEL_MUL_FMA, KERNEL_MUL_SIMD,
+       KERNEL_ADD_SIMD, KERNEL_DOT_SPLIT, KERNEL_DOT_FMA, KERNEL_DOT_SIMD,
+       KERNEL_LD_ADD, KERNEL_LD_MUL, KERNEL_LD_DIV, KERNEL_LD_SQRT,
+       KERNEL_Q_ADD, KERNEL_Q_MUL, KERNEL_Q_DIV, KERNEL_Q_SQRT };
+
+static dd_soa bench_a, bench_b, bench_out;
+static volatile double bench_sink;
+
+// Host-format copies of bench_a / bench_b, two int64 words per value
+static int64_t *host_a, *host_b, *host_out;
+
+static void dd_soa_alloc(dd_soa *v, size_t n) {
+    v->hi = malloc(n * sizeof(double));
+    v->lo = malloc(n * sizeof(double));
+    v->n = n;
+}
+
+static void dd_soa_fill(dd_soa *v, unsigned seed) {
+    srand(seed);
+    for (size_t i = 0; i < v->n; i++) {
+        double hi = 0.5 + (double)rand() / RAND_MAX;
+        double lo = hi * ((double)rand() / RAND_MAX - 0.5) * 0x1p-53;
+        dd_real r = quick_two_sum(hi, lo);
+        v->hi[i] = r.hi;
+        v->lo[i] = r.lo;
+    }
+}
+
+static void run_kernel(int kernel) {
+    dd_real d;
+    switch (kernel) {
+        case KERNEL_ADD: dd_add_batch_scalar(&bench_a, &bench_b, &bench_out); break;
+        case KERNEL_ADD_SIMD: dd_add_batch_simd(&bench_a, &bench_b, &bench_out); break;
+        case KERNEL_MUL_SPLIT: dd_mul_batch_split(&bench_a, &bench_b, &bench_out); break;
+        case KERNEL_MUL_FMA: dd_mul_batch_fma(&bench_a, &bench_b, &bench_out); break;
+        case KERNEL_MUL_SIMD: dd_mul_batch_simd(&bench_a, &bench_b, &bench_out); break;
+        case KERNEL_DOT_SPLIT: d = dd_dot_split(&bench_a, &bench_b); bench_sink = d.hi + d.lo; return;
+        case KERNEL_DOT_FMA: d = dd_dot_fma(&bench_a, &bench_b); bench_sink = d.hi + d.lo; return;
+        case KERNEL_DOT_SIMD: d = dd_dot_simd(&bench_a, &bench_b); bench_sink = d.hi + d.lo; return;
+        case KERNEL_LD_SQRT: kld_sqrt(KLD_FMT_LONG_DOUBLE, host_a, host_out, BENCH_N); bench_sink = (double)host_out[0]; return;
+        case KERNEL_Q_SQRT: kld_sqrt(KLD_FMT_FLOAT128, host_a, host_out, BENCH_N); bench_sink = (double)host_out[0]; return;
+        default: {
+            int fmt = kernel >= KERNEL_Q_ADD ? KLD_FMT_FLOAT128 : KLD_FMT_LONG_DOUBLE;
+            int op = (kernel - KERNEL_LD_ADD) % 4 == 0 ? KLD_ADD : (kernel - KERNEL_LD_ADD) % 4 == 1 ? KLD_MUL : KLD_DIV;
+            kld_binary(fmt, op, host_a, host_b, host_out, BENCH_N);
+            bench_sink = (double)host_out[0];
+            return;
+        }
+    }
+    bench_sink = bench_out.hi[bench_out.n - 1];
+}
+
+static int compare_doubles(const void *x, const void *y) {
+    double a = *(const double *)x, b = *(const double *)y;
+    return (a > b) - (a < b);
+}
+
+// Time one kernel: warmup, then BENCH_REPS repetitions of enough calls to
+// cover BENCH_MIN_SECONDS each. Prints min and median ns per element.
+static void bench_kernel(const char *label, int kernel) {
+    for (int i = 0; i < BENCH_WARMUP; i++) run_kernel(kernel);
+
+    // Calibrate calls per repetition
+    long calls = 1;
+    for (;;) {
+        double t0 = now_seconds();
+        for (long c = 0; c < calls; c++) run_kernel(kernel);
+        if (now_seconds() - t0 >= BENCH_MIN_SECONDS) break;
+        calls *= 2;
+    }
+
+    double ns_per_op[BENCH_REPS];
+    for (int r = 0; r < BENCH_REPS; r++) {
+        double t0 = now_seconds();
+        for (long c = 0; c < calls; c++) run_kernel(kernel);
+        double elapsed = now_seconds() - t0;
+        ns_per_op[r] = elapsed * 1e9 / ((double)calls * BENCH_N);
+    }
+    qsort(ns_per_op, BENCH_REPS, sizeof(double), compare_doubles);
+    printf("  %-28s %8.3f %8.3f %10.1f\n", label, ns_per_op[0], ns_per_op[BENCH_REPS / 2],
+           1e3 / ns_per_op[BENCH_REPS / 2]);
+}
+
+// FMA and Dekker two-products must agree exactly away from overflow
+static void check_two_prod_agreement(void) {
+    long mismatches = 0;
+    for (size_t i = 0; i < bench_a.n; i++) {
+        dd_real s = two_prod(bench_a.hi[i], bench_b.lo[i]);
+        dd_real f = two_prod_fma(bench_a.hi[i], bench_b.lo[i]);
+        if (s.hi != f.hi || s.lo != f.lo) mismatches++;
+    }
+    printf("  two_prod split vs fma: %ld / %zu mismatches\n", mismatches, bench_a.n);
+
+    dd_real d_split = dd_dot_split(&bench_a, &bench_b);
+    dd_real d_simd = dd_dot_simd(&bench_a, &bench_b);
+    double diff = fabs((d_split.hi - d_simd.hi) + (d_split.lo - d_simd.lo)) / fabs(d_split.hi);
+    printf("  dot split vs %s (reassociated): relative difference %.2e\n", DD_SIMD_NAME, diff);
+}
+
+void bench_throughput() {
+    printf("\n=== Throughput: double-double kernels (%d elements, %d reps) ===\n", BENCH_N, BENCH_REPS);
+    printf("SIMD: %s (%d-wide)\n\n", DD_SIMD_NAME, DD_SIMD_WIDTH);
+
+    dd_soa_alloc(&bench_a, BENCH_N);
+    dd_soa_alloc(&bench_b, BENCH_N);
+    dd_soa_alloc(&bench_out, BENCH_N);
+    dd_soa_fill(&bench_a, 1);
+    dd_soa_fill(&bench_b, 2);
+
+    check_two_prod_agreement();
+
+    printf("\n  %-28s %8s %8s %10s\n", "kernel", "min ns", "med ns", "Mop/s");
+    bench_kernel("add (scalar)", KERNEL_ADD);
+    bench_kernel("add (" DD_SIMD_NAME ")", KERNEL_ADD_SIMD);
+    bench_kernel("mul (scalar, split)", KERNEL_MUL_SPLIT);
+    bench_kernel("mul (scalar, fma)", KERNEL_MUL_FMA);
+    bench_kernel("mul (" DD_SIMD_NAME ", fma)", KERNEL_MUL_SIMD);
+    bench_kernel("dot (scalar, split)", KERNEL_DOT_SPLIT);
+    bench_kernel("dot (scalar, fma)", KERNEL_DOT_FMA);
+    bench_kernel("dot (" DD_SIMD_NAME ", fma)", KERNEL_DOT_SIMD);
+
+    // Strict-C batch kernels on the host formats (values rounded from bench_a/b)
+    host_a = malloc(2 * BENCH_N * sizeof(int64_t));
+    host_b = malloc(2 * BENCH_N * sizeof(int64_t));
+    host_out = malloc(2 * BENCH_N * sizeof(int64_t));
+    kld_from_double_double(KLD_FMT_LONG_DOUBLE, bench_a.hi, bench_a.lo, host_a, BENCH_N);
+    kld_from_double_double(KLD_FMT_LONG_DOUBLE, bench_b.hi, bench_b.lo, host_b, BENCH_N);
+    bench_kernel("long double add (host)", KERNEL_LD_ADD);
+    bench_kernel("long double mul (host)", KERNEL_LD_MUL);
+    bench_kernel("long double div (host)", KERNEL_LD_DIV);
+    bench_kernel("long double sqrt (host)", KERNEL_LD_SQRT);
+    if (kld_has_float128()) {
+        kld_from_double_double(KLD_FMT_FLOAT128, bench_a.hi, bench_a.lo, host_a, BENCH_N);
+        kld_from_double_double(KLD_FMT_FLOAT128, bench_b.hi, bench_b.lo, host_b, BENCH_N);
+        bench_kernel("binary128 add (soft-fp)", KERNEL_Q_ADD);
+        bench_kernel("binary128 mul (soft-fp)", KERNEL_Q_MUL);
+        bench_kernel("binary128 div (soft-fp)", KERNEL_Q_DIV);
+        bench_kernel("binary128 sqrt (exact)", KERNEL_Q_SQRT);
+    } else {
+        printf("  binary128: not available on this target\n");
+    }
+    free(host_a); free(host_b); free(host_out);
+
+    free(bench_a.hi); free(bench_a.lo);
+    free(bench_b.hi); free(bench_b.lo);
+    free(bench_out.hi); free(bench_out.lo);
+}
+
 // ============================================================================
 // Kotlin Interop Functions
 // ============================================================================
@@ -308,7 +688,12 @@ double compute_double_double_to_double(double hi, double lo) {
 // Main
 // ============================================================================
 
-int main() {
+int main(int argc, char **argv) {
+    if (argc > 1 && strcmp(argv[1], "--bench-only") == 0) {
+        bench_throughput();
+        return 0;
+    }
+
     printf("========================================\n");
     printf("Float128 Precision Benchmark\n");
     printf("========================================\n");
@@ -324,6 +709,7 @@ int main() {
     test_cancellation();
     test_summation();
     test_product();
+    bench_throughput();
     
     printf("\n========================================\n");
     printf("Conclusion:\n");
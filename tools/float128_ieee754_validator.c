@@ -13,6 +13,21 @@
 #include <string.h>
 #include <quadmath.h>
 
+typedef unsigned __int128 u128;
+
+static __float128 from_bits(uint64_t hi, uint64_t lo) {
+    u128 u = ((u128)hi << 64) | lo;
+    __float128 v;
+    memcpy(&v, &u, 16);
+    return v;
+}
+
+static u128 to_bits(__float128 v) {
+    u128 u;
+    memcpy(&u, &v, 16);
+    return u;
+}
+
 // Print __float128 as hex bit string
 void print_float128_bits(const char *label, __float128 value) {
     // __float128 is 128 bits = 16 bytes
@@ -163,6 +178,94 @@ void test_conversions() {
     printf("\n");
 }
 
+// Correctly rounded square root of a positive normal value by integer
+// digit-by-digit root. libquadmath's sqrtq() is not always correctly rounded
+// (sqrtq(2) comes out one ulp high), so square-root vectors come from here.
+static __float128 sqrt_exact(__float128 x) {
+    u128 bits = to_bits(x);
+    int e = (int)((bits >> 112) & 0x7FFF) - 16383;
+    u128 sig = (bits & ((((u128)1) << 112) - 1)) | (((u128)1) << 112);
+    if (e & 1) {
+        sig <<= 1;
+        e -= 1;
+    }
+    u128 rem = 0, root = 0;
+    for (int i = 0; i < 116; i++) {
+        int shift = 112 - 2 * i;
+        rem = (rem << 2) | (shift >= 0 ? (sig >> shift) & 3 : 0);
+        u128 trial = (root << 2) | 1;
+        root <<= 1;
+        if (rem >= trial) {
+            rem -= trial;
+            root |= 1;
+        }
+    }
+    if (rem) root |= 1;
+    int round = (int)(root & 7);
+    root >>= 3;
+    if (round > 4 || (round == 4 && (root & 1))) root += 1;
+    u128 result = ((u128)(e / 2 + 16383 - 1) << 112) + root;
+    return from_bits((uint64_t)(result >> 64), (uint64_t)result);
+}
+
+// Test square root and fused multiply-add
+void test_sqrt_fma() {
+    printf("\n=== Square Root and FMA ===\n\n");
+
+    __float128 one = 1.0Q;
+    __float128 ulp = ldexpq(1.0Q, -112);
+
+    print_float128_bits("sqrt(2) (exact rounding)", sqrt_exact(2.0Q));
+    printf("\n");
+    print_float128_bits("sqrtq(2) (libquadmath)", sqrtq(2.0Q));
+    printf("\n");
+    print_float128_bits("sqrt(3) (exact rounding)", sqrt_exact(3.0Q));
+    printf("\n");
+    print_float128_bits("fma(1 + 2^-112, 1 - 2^-112, -1)", fmaq(one + ulp, one - ulp, -one));
+    printf("\n");
+    print_float128_bits("(1 + 2^-112) * (1 - 2^-112) - 1", (one + ulp) * (one - ulp) - one);
+    printf("\n");
+    print_float128_bits("fma(3, 1/3, -1)", fmaq(3.0Q, one / 3.0Q, -one));
+    printf("\n");
+}
+
+// Test rounding at ties, subnormals and overflow
+void test_boundaries() {
+    printf("\n=== Rounding and Range Boundaries ===\n\n");
+
+    __float128 one = 1.0Q;
+    __float128 ulp = ldexpq(1.0Q, -112);
+    __float128 min_sub = from_bits(0, 1);
+    __float128 min_norm = from_bits(0x0001000000000000ULL, 0);
+    __float128 max = from_bits(0x7FFEFFFFFFFFFFFFULL, ~0ULL);
+
+    print_float128_bits("1 + 2^-112", one + ulp);
+    printf("\n");
+    print_float128_bits("1 + 2^-113 (tie, to even)", one + ulp / 2);
+    printf("\n");
+    print_float128_bits("(1 + 2^-112) + 2^-113 (tie, to even)", (one + ulp) + ulp / 2);
+    printf("\n");
+    print_float128_bits("min subnormal * 0.5 (tie, to zero)", min_sub * 0.5Q);
+    printf("\n");
+    print_float128_bits("min subnormal * 1.5 (tie, to even)", min_sub * 1.5Q);
+    printf("\n");
+    print_float128_bits("min normal - min subnormal", min_norm - min_sub);
+    printf("\n");
+    print_float128_bits("max * 2 (overflow)", max * 2.0Q);
+    printf("\n");
+
+    double d = (double)(one + ldexpq(1.0Q, -53));
+    uint64_t dbits;
+    memcpy(&dbits, &d, 8);
+    printf("(double)(1 + 2^-53) (tie, to even): %016llX\n", (unsigned long long)dbits);
+    d = (double)(one + ldexpq(1.0Q, -53) + ulp);
+    memcpy(&dbits, &d, 8);
+    printf("(double)(1 + 2^-53 + 2^-112): %016llX\n", (unsigned long long)dbits);
+    d = (double)ldexpq(3.0Q, -1076);
+    memcpy(&dbits, &d, 8);
+    printf("(double)(3 * 2^-1076) (subnormal): %016llX\n", (unsigned long long)dbits);
+}
+
 int main() {
     printf("========================================\n");
     printf("IEEE-754 Binary128 Validation Test Vectors\n");
@@ -173,6 +276,8 @@ int main() {
     test_arithmetic();
     test_precision();
     test_conversions();
+    test_sqrt_fma();
+    test_boundaries();
     
     printf("\n========================================\n");
     printf("All test vectors generated successfully\n");
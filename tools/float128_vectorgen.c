@@ -0,0 +1,532 @@
+/**
+ * float128_vectorgen.c - Batched binary reference vectors for quad-precision arithmetic
+ *
+ * Generates millions of random and edge-case operand triples for one operation
+ * and writes them, with reference results, to a compact little-endian binary
+ * file. Three reference flavors are available:
+ *
+ *   f128  GCC __float128 (IEEE-754 binary128), checked by Float128Math
+ *   ld    the host's long double, widened to binary128 (exact)
+ *   dd    double-double, using the same operation order as CFloat128
+ *
+ * Compile: gcc -std=gnu11 -O2 -ffp-contract=off -o float128_vectorgen float128_vectorgen.c -lm -lquadmath
+ * Run:     ./float128_vectorgen --flavor f128 --op fma --count 10000000 --out f128_fma.kqv
+ *          ./float128_vectorgen --kotlin-samples 24 > Float128ReferenceSamples.kt
+ *
+ * -ffp-contract=off matters for dd: a contracted a*b+c would not match the
+ * separately rounded Kotlin Double operations.
+ *
+ * ## File Format (all fields little-endian)
+ *
+ *   Header, 32 bytes:
+ *     0  char[4] magic "KQV1"
+ *     4  u8      flavor (1 = f128, 2 = ld, 3 = dd)
+ *     5  u8      op (1 add, 2 sub, 3 mul, 4 div, 5 sqrt, 6 fma)
+ *     6  u16     record size in bytes (64)
+ *     8  u64     record count
+ *    16  u64     generator seed
+ *    24  u16     reference precision in bits (113, LDBL_MANT_DIG, or 106 for dd)
+ *    26  u8[6]   reserved (0)
+ *
+ *   Records, 64 bytes each: four 16-byte fields a, b, c, result.
+ *     f128/ld: binary128 bit pattern, low 64 bits first (the UInt128.store layout)
+ *     dd:      hi Double bits, then lo Double bits
+ *   Unused operands (b and c for sqrt, c for two-operand ops) are zero.
+ *
+ * Square roots use an exact integer root because libquadmath's sqrtq() is
+ * not always correctly rounded (see float128_ieee754_validator.c).
+ */
+
+#include <float.h>
+#include <math.h>
+#include <quadmath.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef unsigned __int128 u128;
+
+enum { FLAVOR_F128 = 1, FLAVOR_LD = 2, FLAVOR_DD = 3 };
+enum { OP_ADD = 1, OP_SUB, OP_MUL, OP_DIV, OP_SQRT, OP_FMA };
+
+#define RECORD_BYTES 64
+#define HEADER_BYTES 32
+#define BATCH_RECORDS 4096
+
+static const char *const FLAVOR_NAMES[] = {"", "f128", "ld", "dd"};
+static const char *const OP_NAMES[] = {"", "add", "sub", "mul", "div", "sqrt", "fma"};
+
+// ============================================================================
+// Random source (xorshift64, deterministic for a given seed)
+// ============================================================================
+
+static uint64_t rng_state;
+
+static uint64_t next_u64(void) {
+    uint64_t x = rng_state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    rng_state = x;
+    return x;
+}
+
+static int next_below(int n) {
+    return (int)(next_u64() % (uint64_t)n);
+}
+
+// ============================================================================
+// Little-endian output
+// ============================================================================
+
+static void put_u64(unsigned char *p, uint64_t v) {
+    for (int i = 0; i < 8; i++) p[i] = (unsigned char)(v >> (8 * i));
+}
+
+static void put_u128(unsigned char *p, u128 v) {
+    put_u64(p, (uint64_t)v);
+    put_u64(p + 8, (uint64_t)(v >> 64));
+}
+
+static u128 f128_bits(__float128 x) {
+    u128 u;
+    memcpy(&u, &x, 16);
+    return u;
+}
+
+static __float128 f128_from_bits(u128 u) {
+    __float128 x;
+    memcpy(&x, &u, 16);
+    return x;
+}
+
+static uint64_t double_bits(double x) {
+    uint64_t u;
+    memcpy(&u, &x, 8);
+    return u;
+}
+
+static double double_from_bits(uint64_t u) {
+    double x;
+    memcpy(&x, &u, 8);
+    return x;
+}
+
+// ============================================================================
+// binary128 operands and exact square root
+// ============================================================================
+
+#define F128_SIGN ((u128)1 << 127)
+#define F128_FRAC_MASK ((((u128)1) << 112) - 1)
+
+// Random bit pattern with the exponent drawn from edge-heavy buckets
+static u128 random_f128(void) {
+    u128 v = ((u128)next_u64() << 64) | next_u64();
+    int e;
+    switch (next_below(10)) {
+        case 0: e = 0; break;                                            // subnormal
+        case 1: e = 1 + next_below(3); break;                            // smallest normals
+        case 2: e = 0x7FFE - next_below(3); break;                       // largest normals
+        case 3: e = 16383 + next_below(5) - 2; break;                    // around 1
+        case 4:                                                          // short significand (exact-ish)
+            v &= ~((((u128)1) << next_below(112)) - 1);
+            e = 16383 + next_below(200) - 100;
+            break;
+        case 5:                                                          // inf / NaN
+            e = 0x7FFF;
+            if (next_below(2)) v &= ~F128_FRAC_MASK;
+            break;
+        case 6: v = 0; e = 0; break;                                     // signed zero
+        default: e = next_below(0x7FFF); break;
+    }
+    return (v & (F128_SIGN | F128_FRAC_MASK)) | ((u128)e << 112);
+}
+
+static int leading_zeros_u128(u128 x) {
+    uint64_t hi = (uint64_t)(x >> 64);
+    if (hi) return __builtin_clzll(hi);
+    uint64_t lo = (uint64_t)x;
+    return lo ? 64 + __builtin_clzll(lo) : 128;
+}
+
+// Correctly rounded binary128 square root by digit-by-digit integer root
+static __float128 sqrt_exact_f128(__float128 x) {
+    u128 bits = f128_bits(x);
+    int exp = (int)((bits >> 112) & 0x7FFF);
+    if (exp == 0x7FFF || (bits & ~F128_SIGN) == 0 || (bits & F128_SIGN)) return sqrtq(x);
+    u128 sig = bits & F128_FRAC_MASK;
+    if (exp == 0) {
+        int shift = leading_zeros_u128(sig) - 15;
+        sig <<= shift;
+        exp = 1 - shift;
+    } else {
+        sig |= ((u128)1) << 112;
+    }
+    int e = exp - 16383;
+    if (e & 1) {
+        sig <<= 1;
+        e -= 1;
+    }
+    u128 rem = 0, root = 0;
+    for (int i = 0; i < 116; i++) {
+        int shift = 112 - 2 * i;
+        rem = (rem << 2) | (shift >= 0 ? (sig >> shift) & 3 : 0);
+        u128 trial = (root << 2) | 1;
+        root <<= 1;
+        if (rem >= trial) {
+            rem -= trial;
+            root |= 1;
+        }
+    }
+    if (rem) root |= 1;
+    int round = (int)(root & 7);
+    root >>= 3;
+    if (round > 4 || (round == 4 && (root & 1))) root += 1;
+    return f128_from_bits(((u128)(e / 2 + 16383 - 1) << 112) + root);
+}
+
+static void gen_f128(int op, u128 out[4]) {
+    __float128 a = f128_from_bits(random_f128());
+    __float128 b = f128_from_bits(random_f128());
+    __float128 c = f128_from_bits(random_f128());
+    // Bias a quarter of the cases towards cancellation
+    if (next_below(4) == 0) b = f128_from_bits((f128_bits(a) ^ F128_SIGN) + (u128)(next_below(5) - 2));
+    if (op == OP_FMA && next_below(8) == 0) c = f128_from_bits(f128_bits(-(a * b)) + (u128)(next_below(3) - 1));
+    // Mostly non-negative radicands, so sqrt records are not dominated by NaN
+    if (op == OP_SQRT && next_below(4) != 0) a = fabsq(a);
+
+    __float128 r;
+    switch (op) {
+        case OP_ADD: r = a + b; break;
+        case OP_SUB: r = a - b; break;
+        case OP_MUL: r = a * b; break;
+        case OP_DIV: r = a / b; break;
+        case OP_SQRT: r = sqrt_exact_f128(a); b = 0; break;
+        default: r = fmaq(a, b, c); break;
+    }
+    if (op != OP_FMA) c = 0;
+    out[0] = f128_bits(a);
+    out[1] = f128_bits(b);
+    out[2] = f128_bits(c);
+    out[3] = f128_bits(r);
+}
+
+// ============================================================================
+// long double (host format, widened exactly to binary128)
+// ============================================================================
+
+static long double random_ld(void) {
+    static const long double edges[] = {
+        0.0L, -0.0L, 1.0L, -1.0L, LDBL_MIN, -LDBL_MIN, LDBL_MAX, -LDBL_MAX,
+#ifdef LDBL_TRUE_MIN
+        LDBL_TRUE_MIN, -LDBL_TRUE_MIN,
+#endif
+    };
+    int pick = next_below(16);
+    if (pick == 0) return edges[next_below((int)(sizeof(edges) / sizeof(edges[0])))];
+    if (pick == 1) return next_below(2) ? (long double)INFINITY : (long double)NAN;
+    // Narrowing a random finite binary128 gives a uniformly messy host value
+    __float128 q;
+    do {
+        q = f128_from_bits(random_f128());
+    } while (isnanq(q) || isinfq(q));
+    return (long double)q;
+}
+
+static void gen_ld(int op, u128 out[4]) {
+    long double a = random_ld();
+    long double b = random_ld();
+    long double c = random_ld();
+    if (next_below(4) == 0) b = -a * (1.0L + (long double)(next_below(5) - 2) * LDBL_EPSILON);
+    if (op == OP_SQRT && next_below(4) != 0) a = fabsl(a);
+
+    long double r;
+    switch (op) {
+        case OP_ADD: r = a + b; break;
+        case OP_SUB: r = a - b; break;
+        case OP_MUL: r = a * b; break;
+        case OP_DIV: r = a / b; break;
+        case OP_SQRT: r = sqrtl(a); b = 0; break;
+        default: r = fmal(a, b, c); break;
+    }
+    if (op != OP_FMA) c = 0;
+    out[0] = f128_bits((__float128)a);
+    out[1] = f128_bits((__float128)b);
+    out[2] = f128_bits((__float128)c);
+    out[3] = f128_bits((__float128)r);
+}
+
+// ============================================================================
+// double-double, mirroring CFloat128 operation for operation
+// ============================================================================
+
+typedef struct {
+    double hi;
+    double lo;
+} dd_real;
+
+#define SPLIT_CONST 134217729.0  // 2^27 + 1
+
+static dd_real two_sum(double a, double b) {
+    double s = a + b;
+    double bb = s - a;
+    double err = (a - (s - bb)) + (b - bb);
+    return (dd_real){s, err};
+}
+
+static dd_real quick_two_sum(double a, double b) {
+    double s = a + b;
+    double err = b - (s - a);
+    return (dd_real){s, err};
+}
+
+static double split_high(double x) {
+    double c = SPLIT_CONST * x;
+    return c - (c - x);
+}
+
+static dd_real two_prod(double a, double b) {
+    double p = a * b;
+    double a_high = split_high(a);
+    double a_low = a - a_high;
+    double b_high = split_high(b);
+    double b_low = b - b_high;
+    double err = ((a_high * b_high - p) + a_high * b_low + a_low * b_high) + a_low * b_low;
+    return (dd_real){p, err};
+}
+
+static dd_real dd_add(dd_real a, dd_real b) {
+    dd_real s = two_sum(a.hi, b.hi);
+    double lo_sum = a.lo + b.lo + s.lo;
+    return quick_two_sum(s.hi, lo_sum);
+}
+
+static dd_real dd_neg(dd_real a) {
+    return (dd_real){-a.hi, -a.lo};
+}
+
+static dd_real dd_add_product(dd_real acc, double a, double b) {
+    dd_real p = two_prod(a, b);
+    dd_real s = two_sum(acc.hi, p.hi);
+    double t = acc.lo + p.lo + s.lo;
+    return quick_two_sum(s.hi, t);
+}
+
+static dd_real dd_mul(dd_real a, dd_real b) {
+    dd_real r = two_prod(a.hi, b.hi);
+    r = dd_add_product(r, a.hi, b.lo);
+    r = dd_add_product(r, a.lo, b.hi);
+    r = dd_add_product(r, a.lo, b.lo);
+    return r;
+}
+
+static dd_real dd_div(dd_real a, dd_real b) {
+    if (b.hi == 0.0 && b.lo == 0.0) return (dd_real){a.hi >= 0 ? INFINITY : -INFINITY, 0.0};
+    double q0 = a.hi / b.hi;
+    dd_real prod = dd_mul((dd_real){q0, 0.0}, b);
+    dd_real r = dd_add(a, dd_neg(prod));
+    double q1 = r.hi / b.hi;
+    return quick_two_sum(q0, q1);
+}
+
+static dd_real dd_sqrt(dd_real a) {
+    if (isnan(a.hi)) return (dd_real){NAN, 0.0};
+    if (a.hi == 0.0 && a.lo == 0.0) return a;
+    if (a.hi < 0.0) return (dd_real){NAN, 0.0};
+    if (isinf(a.hi)) return (dd_real){INFINITY, 0.0};
+    double q = sqrt(a.hi);
+    dd_real q_squared = dd_mul((dd_real){q, 0.0}, (dd_real){q, 0.0});
+    dd_real residual = dd_add(a, dd_neg(q_squared));
+    double correction = residual.hi / (2.0 * q);
+    return quick_two_sum(q, correction);
+}
+
+// Normalized double-double with hi in a range where Dekker splitting cannot overflow
+static dd_real random_dd(void) {
+    int pick = next_below(16);
+    if (pick == 0) return (dd_real){next_below(2) ? -0.0 : 0.0, 0.0};
+    if (pick == 1) return (dd_real){(double)(next_below(17) - 8), 0.0};
+    int exp = 1023 + next_below(1200) - 600;
+    uint64_t frac = next_u64() & 0x000FFFFFFFFFFFFFULL;
+    uint64_t sign = next_u64() & 0x8000000000000000ULL;
+    double hi = double_from_bits(sign | ((uint64_t)exp << 52) | frac);
+    if (pick == 2) return (dd_real){hi, 0.0};
+    // lo in (-ulp(hi)/2, ulp(hi)/2), then renormalize
+    double unit = (double)(int64_t)(next_u64() >> 11) / 9007199254740992.0 - 0.5;  // [-0.5, 0.5)
+    double lo = hi * unit * 0x1p-52;
+    return quick_two_sum(hi, lo);
+}
+
+static void gen_dd(int op, u128 out[4]) {
+    dd_real a = random_dd();
+    dd_real b = random_dd();
+    if (next_below(4) == 0) b = dd_add(dd_neg(a), (dd_real){a.hi * 0x1p-70 * (double)(next_below(5) - 2), 0.0});
+
+    dd_real r;
+    switch (op) {
+        case OP_ADD: r = dd_add(a, b); break;
+        case OP_SUB: r = dd_add(a, dd_neg(b)); break;
+        case OP_MUL: r = dd_mul(a, b); break;
+        case OP_DIV: r = dd_div(a, b); break;
+        default:
+            if (a.hi < 0.0) a = dd_neg(a);
+            r = dd_sqrt(a);
+            b = (dd_real){0.0, 0.0};
+            break;
+    }
+    out[0] = ((u128)double_bits(a.lo) << 64) | double_bits(a.hi);
+    out[1] = ((u128)double_bits(b.lo) << 64) | double_bits(b.hi);
+    out[2] = 0;
+    out[3] = ((u128)double_bits(r.lo) << 64) | double_bits(r.hi);
+}
+
+// ============================================================================
+// Drivers
+// ============================================================================
+
+static void generate_record(int flavor, int op, unsigned char *dst) {
+    u128 fields[4];
+    switch (flavor) {
+        case FLAVOR_F128: gen_f128(op, fields); break;
+        case FLAVOR_LD: gen_ld(op, fields); break;
+        default: gen_dd(op, fields); break;
+    }
+    for (int i = 0; i < 4; i++) put_u128(dst + 16 * i, fields[i]);
+}
+
+static void encode_header(unsigned char *h, int flavor, int op, uint64_t count, uint64_t seed) {
+    int precision = flavor == FLAVOR_F128 ? 113 : flavor == FLAVOR_LD ? LDBL_MANT_DIG : 106;
+    memset(h, 0, HEADER_BYTES);
+    memcpy(h, "KQV1", 4);
+    h[4] = (unsigned char)flavor;
+    h[5] = (unsigned char)op;
+    h[6] = RECORD_BYTES & 0xFF;
+    h[7] = RECORD_BYTES >> 8;
+    put_u64(h + 8, count);
+    put_u64(h + 16, seed);
+    h[24] = (unsigned char)(precision & 0xFF);
+    h[25] = (unsigned char)(precision >> 8);
+}
+
+static int write_file(const char *path, int flavor, int op, uint64_t count, uint64_t seed) {
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        perror(path);
+        return 1;
+    }
+    static unsigned char batch[BATCH_RECORDS * RECORD_BYTES];
+    unsigned char header[HEADER_BYTES];
+    encode_header(header, flavor, op, count, seed);
+    fwrite(header, 1, HEADER_BYTES, f);
+
+    rng_state = seed;
+    for (uint64_t done = 0; done < count;) {
+        uint64_t n = count - done < BATCH_RECORDS ? count - done : BATCH_RECORDS;
+        for (uint64_t i = 0; i < n; i++) generate_record(flavor, op, batch + i * RECORD_BYTES);
+        if (fwrite(batch, RECORD_BYTES, n, f) != n) {
+            perror(path);
+            fclose(f);
+            return 1;
+        }
+        done += n;
+    }
+    fclose(f);
+    fprintf(stderr, "%s: %llu %s %s records\n", path, (unsigned long long)count, FLAVOR_NAMES[flavor], OP_NAMES[op]);
+    return 0;
+}
+
+// Emit one hex constant per (flavor, op) block as a Kotlin source file for commonTest
+static int write_kotlin_samples(uint64_t count, uint64_t seed) {
+    static const int blocks[][2] = {
+        {FLAVOR_F128, OP_ADD}, {FLAVOR_F128, OP_SUB}, {FLAVOR_F128, OP_MUL},
+        {FLAVOR_F128, OP_DIV}, {FLAVOR_F128, OP_SQRT}, {FLAVOR_F128, OP_FMA},
+        {FLAVOR_DD, OP_ADD}, {FLAVOR_DD, OP_SUB}, {FLAVOR_DD, OP_MUL},
+        {FLAVOR_DD, OP_DIV}, {FLAVOR_DD, OP_SQRT},
+    };
+    unsigned char buf[RECORD_BYTES];
+
+    printf("package io.github.kotlinmania.klang.bitwise\n\n");
+    printf("/**\n");
+    printf(" * Generated by `tools/float128_vectorgen --kotlin-samples %llu --seed %llu`; do not edit.\n",
+           (unsigned long long)count, (unsigned long long)seed);
+    printf(" *\n");
+    printf(" * Each constant is a complete KQV1 vector file in hex, decoded by [ReferenceVectors].\n");
+    printf(" */\n");
+    printf("internal object Float128ReferenceSamples {\n");
+    for (size_t k = 0; k < sizeof(blocks) / sizeof(blocks[0]); k++) {
+        int flavor = blocks[k][0], op = blocks[k][1];
+        uint64_t block_seed = seed + k;
+        unsigned char header[HEADER_BYTES];
+        encode_header(header, flavor, op, count, block_seed);
+        rng_state = block_seed;
+
+        char name[32];
+        snprintf(name, sizeof(name), "%s_%s", FLAVOR_NAMES[flavor], OP_NAMES[op]);
+        for (char *p = name; *p; p++) {
+            if (*p >= 'a' && *p <= 'z') *p = (char)(*p - 'a' + 'A');
+        }
+        printf("    const val %s =\n        \"", name);
+        for (int i = 0; i < HEADER_BYTES; i++) printf("%02x", header[i]);
+        for (uint64_t r = 0; r < count; r++) {
+            generate_record(flavor, op, buf);
+            printf("\" +\n        \"");
+            for (int i = 0; i < RECORD_BYTES; i++) printf("%02x", buf[i]);
+        }
+        printf("\"\n%s", k + 1 < sizeof(blocks) / sizeof(blocks[0]) ? "\n" : "");
+    }
+    printf("}\n");
+    return 0;
+}
+
+static int lookup(const char *value, const char *const *names, int n) {
+    for (int i = 1; i < n; i++) {
+        if (strcmp(value, names[i]) == 0) return i;
+    }
+    return 0;
+}
+
+static void usage(void) {
+    fprintf(stderr,
+            "usage: float128_vectorgen --flavor f128|ld|dd --op add|sub|mul|div|sqrt|fma\n"
+            "                          [--count N] [--seed S] --out FILE\n"
+            "       float128_vectorgen --kotlin-samples N [--seed S]\n");
+}
+
+int main(int argc, char **argv) {
+    int flavor = 0, op = 0;
+    uint64_t count = 1000000, seed = 0x9E3779B97F4A7C15ULL, samples = 0;
+    const char *out = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+        if (!value) {
+            usage();
+            return 2;
+        }
+        if (strcmp(arg, "--flavor") == 0) flavor = lookup(value, FLAVOR_NAMES, 4);
+        else if (strcmp(arg, "--op") == 0) op = lookup(value, OP_NAMES, 7);
+        else if (strcmp(arg, "--count") == 0) count = strtoull(value, NULL, 0);
+        else if (strcmp(arg, "--seed") == 0) seed = strtoull(value, NULL, 0);
+        else if (strcmp(arg, "--out") == 0) out = value;
+        else if (strcmp(arg, "--kotlin-samples") == 0) samples = strtoull(value, NULL, 0);
+        else {
+            usage();
+            return 2;
+        }
+        i++;
+    }
+    if (seed == 0) seed = 1;  // xorshift needs a non-zero state
+
+    if (samples) return write_kotlin_samples(samples, seed);
+    if (!flavor || !op || !out) {
+        usage();
+        return 2;
+    }
+    if (flavor == FLAVOR_DD && op == OP_FMA) {
+        fprintf(stderr, "dd has no fused multiply-add (CFloat128 does not define one)\n");
+        return 2;
+    }
+    return write_file(out, flavor, op, count, seed);
+}
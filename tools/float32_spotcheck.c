@@ -0,0 +1,131 @@
+/**
+ * float32_spotcheck.c - C reference vectors for Float32 host conformance
+ *
+ * Compile: gcc -std=c11 -O2 -ffp-contract=off -o float32_spotcheck float32_spotcheck.c -lm
+ * Run:     ./float32_spotcheck            (human-readable)
+ *          ./float32_spotcheck --kotlin   (IntArray literal for Float32Conformance.VECTORS)
+ *
+ * Each row is a, b, c followed by the correctly rounded binary32 results of
+ * a+b, a-b, a*b, a/b and fmaf(a, b, c), all as raw bit patterns. The rows
+ * target the places a non-conformant host goes wrong: subnormal inputs and
+ * outputs (flush-to-zero), overflow, exact ties (double rounding through a
+ * wider format), signed zeros and catastrophic cancellation in fma.
+ *
+ * Rows whose results include a NaN are skipped: NaN payloads are not part of
+ * the host check (Float32Math routes NaN results through soft-float).
+ *
+ * Requires an x86-64 SSE or AArch64 host (no x87) and -ffp-contract=off so
+ * a*b+c is never fused by the compiler.
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+static float f_of(uint32_t b) { float f; memcpy(&f, &b, 4); return f; }
+static uint32_t bits_of(float f) { uint32_t b; memcpy(&b, &f, 4); return b; }
+
+static const uint32_t edge[][3] = {
+    /* plain values */
+    { 0x3F800000, 0x40000000, 0x40400000 },   /* 1, 2, 3 */
+    { 0x3DCCCCCD, 0x3E4CCCCD, 0x3E99999A },   /* 0.1, 0.2, 0.3 */
+    { 0xC0490FDB, 0x402DF854, 0x3F000000 },   /* -pi, e, 0.5 */
+    /* ties: 1 + 2^-24 and 1 + 3*2^-24 round to even */
+    { 0x3F800000, 0x33800000, 0x00000000 },
+    { 0x3F800001, 0x33800000, 0x00000000 },
+    { 0x3F800000, 0x34400000, 0x00000000 },
+    /* products that tie in binary32 but not in binary64 */
+    { 0x3F800001, 0x3F800001, 0xBF800000 },
+    { 0x3FFFFFFF, 0x3FFFFFFF, 0xC0800000 },
+    { 0x3F7FFFFF, 0x3F800001, 0xBF800000 },
+    /* subnormal inputs and outputs */
+    { 0x00000001, 0x00000001, 0x00000000 },
+    { 0x00400000, 0x3F000000, 0x00000001 },
+    { 0x00800000, 0x3F000000, 0x80000001 },
+    { 0x007FFFFF, 0x00000001, 0x00800000 },
+    { 0x00800000, 0xBF7FFFFF, 0x00000000 },
+    { 0x1E3CE508, 0x1E3CE508, 0x00000003 },   /* 1e-20^2 = 1e-40 is subnormal */
+    { 0x00000003, 0x40400000, 0x80000009 },
+    { 0x80800001, 0x00800000, 0x3F800000 },
+    /* overflow and near-overflow */
+    { 0x7F7FFFFF, 0x7F7FFFFF, 0xFF7FFFFF },
+    { 0x7F7FFFFF, 0x3F800001, 0x00000000 },
+    { 0x7F7FFFFF, 0x40000000, 0xFF7FFFFF },
+    { 0x7F000000, 0x00000001, 0x7F7FFFFF },
+    /* signed zeros */
+    { 0x00000000, 0x80000000, 0x80000000 },
+    { 0x80000000, 0x80000000, 0x00000000 },
+    { 0x3F800000, 0xBF800000, 0x80000000 },
+    { 0x80000000, 0x3F800000, 0x80000000 },
+    /* infinities (no NaN results) */
+    { 0x7F800000, 0x3F800000, 0x3F800000 },
+    { 0xFF800000, 0x40000000, 0xC0000000 },
+    { 0x3F800000, 0x7F800000, 0x00000000 },
+    /* fma cancellation: a*b + (-round(a*b)) is the exact product error */
+    { 0x3F800001, 0x3F7FFFFF, 0xBF800000 },
+    { 0x3DCCCCCD, 0x41200000, 0xBF800000 },
+    { 0x3EAAAAAB, 0x40400000, 0xBF800000 },
+    { 0x4B7FFFFF, 0x4B7FFFFF, 0xD77FFFFE },
+    /* division */
+    { 0x3F800000, 0x40400000, 0x00000000 },
+    { 0x00000001, 0x40000000, 0x00000000 },   /* 2^-149 / 2 ties to 0 */
+    { 0x00000003, 0x40000000, 0x00000000 },   /* 1.5 ulp ties to 2 */
+    { 0x7F7FFFFF, 0x00000001, 0x00000000 },
+    { 0x3F800000, 0x00000000, 0x00000000 },   /* 1/0 = inf */
+};
+
+static uint64_t rng = 0x9E3779B97F4A7C15ull;
+
+static uint32_t next(void) {
+    rng ^= rng << 13;
+    rng ^= rng >> 7;
+    rng ^= rng << 17;
+    return (uint32_t)(rng >> 16);
+}
+
+/* Random operand biased toward small exponents, subnormals and near-1 values. */
+static uint32_t random_operand(void) {
+    uint32_t x = next();
+    switch (next() & 7) {
+    case 0: return x & 0x807FFFFF;                       /* subnormal */
+    case 1: return (x & 0x803FFFFF) | 0x3F800000;        /* [1, 1.5) */
+    case 2: return (x & 0x80FFFFFF) | 0x00800000;        /* tiny normal */
+    default: return x & 0xBFFFFFFF;                      /* finite, |x| < 2 */
+    }
+}
+
+static int emit(uint32_t a, uint32_t b, uint32_t c, int kotlin) {
+    float fa = f_of(a), fb = f_of(b), fc = f_of(c);
+    float r[5] = { fa + fb, fa - fb, fa * fb, fa / fb, fmaf(fa, fb, fc) };
+    for (int i = 0; i < 5; i++) {
+        if (isnan(r[i])) return 0;
+    }
+    if (kotlin) {
+        printf("            0x%08X.toInt(), 0x%08X.toInt(), 0x%08X.toInt(), ",
+               a, b, c);
+        printf("0x%08X.toInt(), 0x%08X.toInt(), 0x%08X.toInt(), 0x%08X.toInt(), 0x%08X.toInt(),\n",
+               bits_of(r[0]), bits_of(r[1]), bits_of(r[2]), bits_of(r[3]), bits_of(r[4]));
+    } else {
+        printf("a=%08X b=%08X c=%08X  add=%08X sub=%08X mul=%08X div=%08X fma=%08X\n",
+               a, b, c, bits_of(r[0]), bits_of(r[1]), bits_of(r[2]), bits_of(r[3]), bits_of(r[4]));
+    }
+    return 1;
+}
+
+int main(int argc, char **argv) {
+    int kotlin = argc > 1 && strcmp(argv[1], "--kotlin") == 0;
+    int rows = 0;
+    if (!kotlin) printf("=== Float32 host conformance vectors ===\n\n");
+    for (size_t i = 0; i < sizeof(edge) / sizeof(edge[0]); i++) {
+        rows += emit(edge[i][0], edge[i][1], edge[i][2], kotlin);
+    }
+    /* Random rows; c = -(a*b) rounded makes half of them cancellation cases */
+    for (int i = 0; rows < 96 && i < 1000; i++) {
+        uint32_t a = random_operand(), b = random_operand();
+        uint32_t c = (i & 1) ? bits_of(-(f_of(a) * f_of(b))) : random_operand();
+        rows += emit(a, b, c, kotlin);
+    }
+    if (!kotlin) printf("\n%d rows\n", rows);
+    return 0;
+}
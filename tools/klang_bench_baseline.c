@@ -0,0 +1,454 @@
+/**
+ * C baselines for the klang benchmark suite.
+ *
+ * Each row runs the C equivalent of one kotlinx-benchmark method from
+ * src/commonBenchmark or src/concurrentBenchmark, on the same sizes and data,
+ * and is named after it: fully qualified benchmark plus @Param values. With
+ * --json the rows are written in the kotlinx-benchmark (JMH) report format, so
+ * `./gradlew benchmarkCompare` can print every Kotlin result as "x slower
+ * than C" on the same host.
+ *
+ * Covered: MemoryThroughputBenchmark (host libc), KMallocChurnBenchmark (host
+ * malloc), ArrayBitShiftsBenchmark and ArrayBitShiftsParallelBenchmark (same
+ * limb layout, pthreads worker pool in place of Dispatchers.Default),
+ * VectorOpsBenchmark (plain loops), and Float128ArithmeticBenchmark
+ * (__float128 where KLD_HAS_FLOAT128, double-double in the CFloat128 order).
+ *
+ * Build and run:
+ *   gcc -std=gnu11 -O2 -pthread -o klang_bench_baseline klang_bench_baseline.c -lm
+ *   ./klang_bench_baseline [--json out.json] [--filter substring]
+ *
+ * Timing: each row is calibrated to ~50 ms per run, then run BENCH_RUNS
+ * times; score is the median ns/op and the error half the min..max spread.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <math.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "klang_longdouble.h"
+
+#define BENCH_RUNS 7
+#define BENCH_TARGET_NS 50e6
+
+#define PKG "io.github.kotlinmania.klang."
+
+static volatile uint64_t sink;
+
+static inline void escape(void *p) { __asm__ volatile("" : : "g"(p) : "memory"); }
+
+/* aligned_alloc wants a size that is a multiple of the alignment. */
+static void *alloc64(size_t bytes) { return aligned_alloc(64, (bytes + 63) & ~(size_t)63); }
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/* ===== Reporting ===== */
+
+static FILE *json_out;
+static int json_rows;
+static const char *filter;
+
+typedef void (*bench_fn)(void);
+
+static int cmp_double(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+/* Time fn (one op per call) and emit a row for benchmark[param=value]. */
+static void run(const char *benchmark, const char *param, long value, bench_fn fn) {
+    char label[256];
+    if (param) snprintf(label, sizeof(label), "%s[%s=%ld]", benchmark, param, value);
+    else snprintf(label, sizeof(label), "%s", benchmark);
+    if (filter && !strstr(label, filter)) return;
+
+    long iters = 1;
+    for (;;) {
+        double t0 = now_ns();
+        for (long i = 0; i < iters; i++) fn();
+        double dt = now_ns() - t0;
+        if (dt >= BENCH_TARGET_NS / 4 || iters >= (1L << 40)) {
+            iters = (long)(iters * (BENCH_TARGET_NS / (dt > 1 ? dt : 1))) + 1;
+            break;
+        }
+        iters *= 4;
+    }
+    double ns[BENCH_RUNS];
+    for (int r = 0; r < BENCH_RUNS; r++) {
+        double t0 = now_ns();
+        for (long i = 0; i < iters; i++) fn();
+        ns[r] = (now_ns() - t0) / (double)iters;
+    }
+    qsort(ns, BENCH_RUNS, sizeof(double), cmp_double);
+    double score = ns[BENCH_RUNS / 2];
+    double error = (ns[BENCH_RUNS - 1] - ns[0]) / 2;
+
+    printf("  %-72s %14.3f ns/op  (+/- %.3f)\n", label + strlen(PKG), score, error);
+    if (json_out) {
+        fprintf(json_out, "%s\n  {\"benchmark\": \"%s\", \"mode\": \"avgt\", \"params\": {", json_rows++ ? "," : "", benchmark);
+        if (param) fprintf(json_out, "\"%s\": \"%ld\"", param, value);
+        fprintf(json_out, "}, \"primaryMetric\": {\"score\": %.6f, \"scoreError\": %.6f, \"scoreUnit\": \"ns/op\"}}", score, error);
+    }
+}
+
+/* ===== MemoryThroughputBenchmark ===== */
+
+static const long MEM_SIZES[] = { 16, 256, 4096, 65536, 1048576 };
+static size_t mem_size;
+static unsigned char *mem_src, *mem_dst, *mem_text;
+static int mem_fill;
+
+static void mem_memcpy_aligned(void) { memcpy(mem_dst, mem_src, mem_size); escape(mem_dst); }
+static void mem_memcpy_misaligned(void) { memcpy(mem_dst, mem_src + 3, mem_size); escape(mem_dst); }
+static void mem_memmove_overlap(void) { memmove(mem_dst + 1, mem_dst, mem_size); escape(mem_dst); }
+static void mem_memset(void) { mem_fill = (mem_fill + 1) & 0x7F; memset(mem_dst, mem_fill, mem_size); escape(mem_dst); }
+static void mem_memcmp_equal(void) {
+    memcpy(mem_dst, mem_src, mem_size);
+    escape(mem_dst);
+    sink = (uint64_t)memcmp(mem_src, mem_dst, mem_size);
+}
+static void mem_memchr_miss(void) { escape(mem_src); sink = (uint64_t)(uintptr_t)memchr(mem_src, 0x80, mem_size); }
+static void mem_strlen(void) { escape(mem_text); sink = strlen((const char *)mem_text); }
+
+static void bench_memory(void) {
+    const char *cls = PKG "mem.MemoryThroughputBenchmark.";
+    char name[160];
+    for (size_t k = 0; k < sizeof(MEM_SIZES) / sizeof(MEM_SIZES[0]); k++) {
+        mem_size = (size_t)MEM_SIZES[k];
+        mem_src = alloc64(mem_size + 64);
+        mem_dst = alloc64(mem_size + 64);
+        mem_text = alloc64(mem_size + 64);
+        for (size_t i = 0; i < mem_size + 16; i++) mem_src[i] = (unsigned char)(((i * 31 + 7) & 0x7F) | 1);
+        memcpy(mem_dst, mem_src, mem_size + 16);
+        memcpy(mem_text, mem_src, mem_size);
+        mem_text[mem_size - 1] = 0;
+#define MEM_ROW(method, fn) snprintf(name, sizeof(name), "%s%s", cls, method); run(name, "size", MEM_SIZES[k], fn)
+        MEM_ROW("memcpyAligned", mem_memcpy_aligned);
+        MEM_ROW("memcpyMisaligned", mem_memcpy_misaligned);
+        MEM_ROW("memmoveOverlap", mem_memmove_overlap);
+        MEM_ROW("memset", mem_memset);
+        MEM_ROW("memcmpEqual", mem_memcmp_equal);
+        MEM_ROW("memchrMiss", mem_memchr_miss);
+        MEM_ROW("strlen", mem_strlen);
+#undef MEM_ROW
+        free(mem_src);
+        free(mem_dst);
+        free(mem_text);
+    }
+}
+
+/* ===== KMallocChurnBenchmark ===== */
+
+#define CHURN_BATCH 64
+static const long CHURN_SIZES[] = { 16, 256, 4096 };
+static size_t churn_size;
+static void *churn_batch[CHURN_BATCH];
+
+static void churn_malloc_free(void) {
+    void *p = malloc(churn_size);
+    escape(p);
+    free(p);
+}
+
+static void churn_malloc_free_batch(void) {
+    for (int i = 0; i < CHURN_BATCH; i++) { churn_batch[i] = malloc(churn_size); escape(churn_batch[i]); }
+    for (int i = CHURN_BATCH - 1; i >= 0; i--) free(churn_batch[i]);
+}
+
+static void bench_churn(void) {
+    for (size_t k = 0; k < sizeof(CHURN_SIZES) / sizeof(CHURN_SIZES[0]); k++) {
+        churn_size = (size_t)CHURN_SIZES[k];
+        run(PKG "mem.KMallocChurnBenchmark.mallocFree", "size", CHURN_SIZES[k], churn_malloc_free);
+        run(PKG "mem.KMallocChurnBenchmark.mallocFreeBatch", "size", CHURN_SIZES[k], churn_malloc_free_batch);
+    }
+}
+
+/* ===== ArrayBitShiftsBenchmark / ArrayBitShiftsParallelBenchmark ===== */
+
+/* Same layout as the Kotlin IntArray: one 16-bit limb per int32. */
+#define LIMBS (1 << 20)
+#define WORDS (LIMBS / 4)
+static int32_t *limbs;
+static uint64_t *words;
+
+static void shl16_range(int32_t *a, int lo, int hi, int s, int32_t carry_low) {
+    int back = 16 - s;
+    for (int i = hi - 1; i > lo; i--) a[i] = ((a[i] << s) | ((a[i - 1] & 0xFFFF) >> back)) & 0xFFFF;
+    a[lo] = ((a[lo] << s) | carry_low) & 0xFFFF;
+}
+
+static void shl64_range(uint64_t *a, int lo, int hi, int s, uint64_t carry_low) {
+    for (int i = hi - 1; i > lo; i--) a[i] = (a[i] << s) | (a[i - 1] >> (64 - s));
+    a[lo] = (a[lo] << s) | carry_low;
+}
+
+static void shift_shl16(void) { shl16_range(limbs, 0, LIMBS, 5, limbs[LIMBS - 1] >> 11); }
+static void shift_shl64(void) { shl64_range(words, 0, WORDS, 5, words[WORDS - 1] >> 59); }
+
+static void shift_rsh16(void) {
+    int32_t low = limbs[0] & 0x1F;
+    for (int i = 0; i < LIMBS - 1; i++) limbs[i] = ((limbs[i] >> 5) | (limbs[i + 1] << 11)) & 0xFFFF;
+    limbs[LIMBS - 1] = (limbs[LIMBS - 1] >> 5) | (low << 11);
+}
+
+/* A persistent pool standing in for Dispatchers.Default: worker i runs chunk i. */
+#define POOL_MAX 8
+typedef struct { int wide; int lo, hi; uint64_t carry; } shift_job;
+static shift_job jobs[POOL_MAX];
+static pthread_t pool_threads[POOL_MAX];
+static pthread_mutex_t pool_mu = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t pool_go = PTHREAD_COND_INITIALIZER, pool_done = PTHREAD_COND_INITIALIZER;
+static unsigned pool_gen;
+static int pool_chunks, pool_pending, pool_started;
+
+static void run_job(const shift_job *j) {
+    if (j->wide) shl64_range(words, j->lo, j->hi, 5, j->carry);
+    else shl16_range(limbs, j->lo, j->hi, 5, (int32_t)j->carry);
+}
+
+static void *pool_worker(void *arg) {
+    int idx = (int)(intptr_t)arg;
+    unsigned seen = 0;
+    for (;;) {
+        pthread_mutex_lock(&pool_mu);
+        while (pool_gen == seen) pthread_cond_wait(&pool_go, &pool_mu);
+        seen = pool_gen;
+        int mine = idx < pool_chunks;
+        pthread_mutex_unlock(&pool_mu);
+        if (!mine) continue;
+        run_job(&jobs[idx]);
+        pthread_mutex_lock(&pool_mu);
+        if (--pool_pending == 0) pthread_cond_signal(&pool_done);
+        pthread_mutex_unlock(&pool_mu);
+    }
+    return NULL;
+}
+
+static int par_chunks;
+
+/* Mirrors ArrayBitShifts: carries below each chunk are read before any chunk writes. */
+static void parallel_shift(int wide) {
+    int n = wide ? WORDS : LIMBS;
+    int chunks = par_chunks;
+    int size = (n + chunks - 1) / chunks;
+    for (int ck = 0; ck < chunks; ck++) {
+        int lo = ck * size, hi = lo + size < n ? lo + size : n;
+        uint64_t carry;
+        if (wide) carry = ck == 0 ? words[WORDS - 1] >> 59 : words[lo - 1] >> 59;
+        else carry = (uint64_t)(ck == 0 ? limbs[LIMBS - 1] >> 11 : (limbs[lo - 1] & 0xFFFF) >> 11);
+        jobs[ck] = (shift_job){ wide, lo, hi, carry };
+    }
+    if (chunks == 1) { run_job(&jobs[0]); return; }
+    pthread_mutex_lock(&pool_mu);
+    pool_chunks = chunks;
+    pool_pending = chunks - 1;
+    pool_gen++;
+    pthread_cond_broadcast(&pool_go);
+    pthread_mutex_unlock(&pool_mu);
+    run_job(&jobs[0]);
+    pthread_mutex_lock(&pool_mu);
+    while (pool_pending) pthread_cond_wait(&pool_done, &pool_mu);
+    pthread_mutex_unlock(&pool_mu);
+}
+
+static void par_shl16(void) { parallel_shift(0); }
+static void par_shl64(void) { parallel_shift(1); }
+
+static void bench_shifts(void) {
+    limbs = alloc64(LIMBS * sizeof(int32_t));
+    words = alloc64(WORDS * sizeof(uint64_t));
+    for (int i = 0; i < LIMBS; i++) limbs[i] = (int32_t)(((uint32_t)i * 40503u) & 0xFFFF);
+    for (int i = 0; i < WORDS; i++) {
+        words[i] = 0;
+        for (int k = 0; k < 4; k++) words[i] |= (uint64_t)limbs[4 * i + k] << (16 * k);
+    }
+    run(PKG "bitwise.ArrayBitShiftsBenchmark.shl16Limbs", NULL, 0, shift_shl16);
+    run(PKG "bitwise.ArrayBitShiftsBenchmark.rsh16Limbs", NULL, 0, shift_rsh16);
+    run(PKG "bitwise.ArrayBitShiftsBenchmark.shl64Words", NULL, 0, shift_shl64);
+
+    if (!pool_started) {
+        for (int i = 1; i < POOL_MAX; i++) pthread_create(&pool_threads[i], NULL, pool_worker, (void *)(intptr_t)i);
+        pool_started = 1;
+    }
+    for (par_chunks = 1; par_chunks <= POOL_MAX; par_chunks *= 2) {
+        run(PKG "bitwise.ArrayBitShiftsParallelBenchmark.shl16Limbs", "parallelism", par_chunks, par_shl16);
+        run(PKG "bitwise.ArrayBitShiftsParallelBenchmark.shl64Words", "parallelism", par_chunks, par_shl64);
+    }
+    /* Workers stay parked in the pool until exit */
+}
+
+/* ===== VectorOpsBenchmark ===== */
+
+#define DOT_N 4096
+#define GM 64
+#define GK 256
+#define GN 64
+static float vx[DOT_N], vy[DOT_N], va[GM * GK], vb[GK * GN], vc[GM * GN], vout[GM];
+
+static void vec_dot_sequential(void) {
+    escape(vx);
+    float s = 0;
+    for (int i = 0; i < DOT_N; i++) s += vx[i] * vy[i];
+    sink = (uint64_t)(int64_t)s;
+}
+
+static void vec_dot_blocked(void) {
+    escape(vx);
+    float s[8] = { 0 };
+    int i = 0;
+    for (; i + 8 <= DOT_N; i += 8)
+        for (int l = 0; l < 8; l++) s[l] += vx[i + l] * vy[i + l];
+    float t = ((s[0] + s[1]) + (s[2] + s[3])) + ((s[4] + s[5]) + (s[6] + s[7]));
+    for (; i < DOT_N; i++) t += vx[i] * vy[i];
+    sink = (uint64_t)(int64_t)t;
+}
+
+static void vec_gemv(void) {
+    escape(va);
+    for (int i = 0; i < GM; i++) {
+        float s = 0;
+        for (int p = 0; p < GK; p++) s += va[i * GK + p] * vx[p];
+        vout[i] = s;
+    }
+    escape(vout);
+}
+
+static void vec_gemm(void) {
+    escape(va);
+    memset(vc, 0, sizeof(vc));
+    for (int i = 0; i < GM; i++)
+        for (int p = 0; p < GK; p++) {
+            float aip = va[i * GK + p];
+            for (int j = 0; j < GN; j++) vc[i * GN + j] += aip * vb[p * GN + j];
+        }
+    escape(vc);
+}
+
+static void bench_vectors(void) {
+    for (int i = 0; i < DOT_N; i++) { vx[i] = (float)(i % 17 - 8) * 0.125f; vy[i] = (float)(i % 13 - 6) * 0.25f; }
+    for (int i = 0; i < GM * GK; i++) va[i] = (float)(i % 11 - 5) * 0.5f;
+    for (int i = 0; i < GK * GN; i++) vb[i] = (float)(i % 7 - 3) * 0.75f;
+    run(PKG "fp.VectorOpsBenchmark.dotSequential", NULL, 0, vec_dot_sequential);
+    run(PKG "fp.VectorOpsBenchmark.dotBlocked", NULL, 0, vec_dot_blocked);
+    run(PKG "fp.VectorOpsBenchmark.gemv", NULL, 0, vec_gemv);
+    run(PKG "fp.VectorOpsBenchmark.gemm", NULL, 0, vec_gemm);
+}
+
+/* ===== Float128ArithmeticBenchmark ===== */
+
+typedef struct { double hi, lo; } dd;
+static dd dda, ddb;
+
+static inline dd two_sum(double a, double b) { double s = a + b, bb = s - a; return (dd){ s, (a - (s - bb)) + (b - bb) }; }
+static inline dd quick_two_sum(double a, double b) { double s = a + b; return (dd){ s, b - (s - a) }; }
+static inline double split_high(double a) { double t = 134217729.0 * a; return t - (t - a); }
+static inline dd two_prod(double a, double b) {
+    double p = a * b, ah = split_high(a), al = a - ah, bh = split_high(b), bl = b - bh;
+    return (dd){ p, ((ah * bh - p) + ah * bl + al * bh) + al * bl };
+}
+static inline dd dd_add(dd a, dd b) { dd s = two_sum(a.hi, b.hi); return quick_two_sum(s.hi, a.lo + b.lo + s.lo); }
+static inline dd dd_add_product(dd r, double a, double b) {
+    dd p = two_prod(a, b), s = two_sum(r.hi, p.hi);
+    return quick_two_sum(s.hi, r.lo + p.lo + s.lo);
+}
+static inline dd dd_mul(dd a, dd b) {
+    dd r = two_prod(a.hi, b.hi);
+    r = dd_add_product(r, a.hi, b.lo);
+    r = dd_add_product(r, a.lo, b.hi);
+    return dd_add_product(r, a.lo, b.lo);
+}
+static inline dd dd_div(dd a, dd b) {
+    double q0 = a.hi / b.hi;
+    dd p = dd_mul((dd){ q0, 0 }, b);
+    dd r = dd_add(a, (dd){ -p.hi, -p.lo });
+    return quick_two_sum(q0, r.hi / b.hi);
+}
+static inline dd dd_sqrt(dd a) {
+    double q = sqrt(a.hi);
+    dd sq = dd_mul((dd){ q, 0 }, (dd){ q, 0 });
+    dd r = dd_add(a, (dd){ -sq.hi, -sq.lo });
+    return quick_two_sum(q, r.hi / (2.0 * q));
+}
+
+static void dd_bench_add(void) { escape(&dda); dd r = dd_add(dda, ddb); sink = (uint64_t)(int64_t)(r.hi + r.lo); }
+static void dd_bench_mul(void) { escape(&dda); dd r = dd_mul(dda, ddb); sink = (uint64_t)(int64_t)(r.hi + r.lo); }
+static void dd_bench_div(void) { escape(&dda); dd r = dd_div(dda, ddb); sink = (uint64_t)(int64_t)(r.hi * 1e9); }
+static void dd_bench_sqrt(void) { escape(&ddb); dd r = dd_sqrt(ddb); sink = (uint64_t)(int64_t)(r.hi * 1e9); }
+
+#if KLD_HAS_FLOAT128
+static kld_f128 qa, qb;
+static int64_t qb_bits[2];
+static void q_sink(kld_f128 x) { int64_t w[2]; memcpy(w, &x, 16); sink = (uint64_t)(w[0] ^ w[1]); }
+static void q_add(void) { escape(&qa); q_sink(qa + qb); }
+static void q_mul(void) { escape(&qa); q_sink(qa * qb); }
+static void q_div(void) { escape(&qa); q_sink(qa / qb); }
+static void q_sqrt(void) {
+    int64_t out[2];
+    escape(qb_bits);
+    kld_sqrt128_bits((uint64_t)qb_bits[1], (uint64_t)qb_bits[0], out);
+    sink = (uint64_t)(out[0] ^ out[1]);
+}
+#endif
+
+static void bench_float128(void) {
+    const char *cls = PKG "fp.Float128ArithmeticBenchmark.";
+    char name[160];
+    dda = (dd){ 1.5, 0 };
+    ddb = (dd){ 2.7, 0 };
+#define FQ_ROW(method, fn) snprintf(name, sizeof(name), "%s%s", cls, method); run(name, NULL, 0, fn)
+#if KLD_HAS_FLOAT128
+    qa = (kld_f128)1.5;
+    qb = (kld_f128)2.7;
+    memcpy(qb_bits, &qb, 16);
+    FQ_ROW("float128MathAdd", q_add);
+    FQ_ROW("float128MathMultiply", q_mul);
+    FQ_ROW("float128MathDivide", q_div);
+    FQ_ROW("float128MathSqrt", q_sqrt);
+#else
+    printf("  binary128: not available on this target, Float128Math rows skipped\n");
+#endif
+    FQ_ROW("doubleDoubleAdd", dd_bench_add);
+    FQ_ROW("doubleDoubleMultiply", dd_bench_mul);
+    FQ_ROW("doubleDoubleDivide", dd_bench_div);
+    FQ_ROW("doubleDoubleSqrt", dd_bench_sqrt);
+#undef FQ_ROW
+}
+
+int main(int argc, char **argv) {
+    const char *json_path = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--json") && i + 1 < argc) json_path = argv[++i];
+        else if (!strcmp(argv[i], "--filter") && i + 1 < argc) filter = argv[++i];
+        else {
+            fprintf(stderr, "usage: %s [--json out.json] [--filter substring]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (json_path) {
+        json_out = fopen(json_path, "w");
+        if (!json_out) { perror(json_path); return 1; }
+        fputc('[', json_out);
+    }
+
+    printf("klang C baselines (median of %d runs)\n", BENCH_RUNS);
+    bench_memory();
+    bench_churn();
+    bench_shifts();
+    bench_vectors();
+    bench_float128();
+
+    if (json_out) {
+        fputs("\n]\n", json_out);
+        fclose(json_out);
+    }
+    return 0;
+}
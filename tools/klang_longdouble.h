@@ -0,0 +1,226 @@
+/**
+ * Batched host long double / __float128 arithmetic (Strict-C mode).
+ *
+ * Shared by the Kotlin/Native cinterop (src/nativeInterop/cinterop/klongdouble.def)
+ * and the C reference tools, so the Kotlin backend and the tools compute with
+ * the same code on the same toolchain.
+ *
+ * Every value crosses the boundary as two int64 words: the little-endian
+ * 16-byte memory image of the C object (word 0 = low 8 bytes). Formats:
+ *
+ *   KLD_FMT_LONG_DOUBLE  host `long double`: binary64 (LDBL_MANT_DIG 53, only
+ *                        word 0 used), x87 extended (64; word 1 holds sign and
+ *                        exponent in its low 16 bits) or binary128 (113)
+ *   KLD_FMT_FLOAT128     IEEE binary128: `__float128` on x86-64, or `long double`
+ *                        where that is binary128
+ *
+ * Each call processes n elements and returns 0, or -1 when the format is not
+ * available on this target (nothing is written). sqrt of binary128 is computed
+ * on the bit pattern and correctly rounded, as IEEE 754 requires (glibc
+ * sqrtf128 agrees; libquadmath's sqrtq can be 1 ulp off), so no libquadmath
+ * is needed.
+ */
+
+#ifndef KLANG_LONGDOUBLE_H
+#define KLANG_LONGDOUBLE_H
+
+#include <float.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum { KLD_ADD = 0, KLD_SUB = 1, KLD_MUL = 2, KLD_DIV = 3 };
+enum { KLD_FMT_LONG_DOUBLE = 0, KLD_FMT_FLOAT128 = 1 };
+
+#if defined(__SIZEOF_INT128__) && defined(__x86_64__) && defined(__SIZEOF_FLOAT128__) && !defined(_WIN32)
+#define KLD_HAS_FLOAT128 1
+typedef __float128 kld_f128;
+#elif defined(__SIZEOF_INT128__) && LDBL_MANT_DIG == 113
+#define KLD_HAS_FLOAT128 1
+typedef long double kld_f128;
+#else
+#define KLD_HAS_FLOAT128 0
+#endif
+
+/* Mantissa digits of the host long double (53, 64 or 113). */
+static inline int32_t kld_long_double_mant_dig(void) { return LDBL_MANT_DIG; }
+
+/* 1 when KLD_FMT_FLOAT128 is available. */
+static inline int32_t kld_has_float128(void) { return KLD_HAS_FLOAT128; }
+
+static inline long double kld_load_ld(const int64_t *p) {
+    long double x = 0;
+    memcpy(&x, p, sizeof(x) < 16 ? sizeof(x) : 16);
+    return x;
+}
+
+static inline void kld_store_ld(int64_t *p, long double x) {
+    int64_t w[2] = { 0, 0 };
+    memcpy(w, &x, sizeof(x) < 16 ? sizeof(x) : 16);
+#if LDBL_MANT_DIG == 64
+    w[1] &= 0xFFFF; /* x87 padding bytes are unspecified */
+#endif
+    p[0] = w[0];
+    p[1] = w[1];
+}
+
+#if KLD_HAS_FLOAT128
+static inline kld_f128 kld_load_q(const int64_t *p) {
+    kld_f128 x;
+    memcpy(&x, p, 16);
+    return x;
+}
+
+static inline void kld_store_q(int64_t *p, kld_f128 x) { memcpy(p, &x, 16); }
+
+/* Correctly rounded binary128 sqrt on the bit pattern (hi = word 1, lo = word 0). */
+static inline void kld_sqrt128_bits(uint64_t hi, uint64_t lo, int64_t *out) {
+#if defined(__x86_64__) || defined(__i386__)
+    const uint64_t default_nan = 0xFFFF800000000000ULL; /* x86 "real indefinite" */
+#else
+    const uint64_t default_nan = 0x7FFF800000000000ULL;
+#endif
+    const uint64_t frac_hi = 0x0000FFFFFFFFFFFFULL;
+    int sign = (int)(hi >> 63);
+    int32_t exp = (int32_t)((hi >> 48) & 0x7FFF);
+    unsigned __int128 mant = ((unsigned __int128)(hi & frac_hi) << 64) | lo;
+
+    if (exp == 0x7FFF) {
+        if (mant != 0) { out[0] = (int64_t)lo; out[1] = (int64_t)(hi | 0x0000800000000000ULL); return; }
+        if (!sign) { out[0] = (int64_t)lo; out[1] = (int64_t)hi; return; }
+        out[0] = 0; out[1] = (int64_t)default_nan; return;
+    }
+    if (exp == 0 && mant == 0) { out[0] = (int64_t)lo; out[1] = (int64_t)hi; return; } /* sqrt(-0) = -0 */
+    if (sign) { out[0] = 0; out[1] = (int64_t)default_nan; return; }
+
+    if (exp == 0) {
+        uint64_t mh = (uint64_t)(mant >> 64);
+        int clz = mh != 0 ? __builtin_clzll(mh) : 64 + __builtin_clzll((uint64_t)mant);
+        int shift = clz - 15; /* leading one to bit 112 */
+        mant <<= shift;
+        exp = 1 - shift;
+    } else {
+        mant |= (unsigned __int128)1 << 112;
+    }
+    int32_t e = exp - 16383; /* value = mant * 2^(e - 112) */
+    if (e & 1) { mant <<= 1; e -= 1; }
+
+    /* floor(sqrt(mant * 2^112)) as one Zimmermann SqrtRem step: a seed root
+     * of mant (57 bits, from the double sqrt and fixed up exactly), then a
+     * single division yields the low 56 root bits. */
+    uint64_t s0 = (uint64_t)__builtin_sqrt((double)mant);
+    while ((unsigned __int128)s0 * s0 > mant) s0--;
+    while ((unsigned __int128)(s0 + 1) * (s0 + 1) <= mant) s0++;
+    unsigned __int128 r0 = mant - (unsigned __int128)s0 * s0; /* <= 2 * s0 */
+    unsigned __int128 num = r0 << 56;
+    unsigned __int128 den = (unsigned __int128)s0 << 1;
+    unsigned __int128 q = num / den;
+    unsigned __int128 u = num - q * den;
+    unsigned __int128 root = ((unsigned __int128)s0 << 56) + q;
+    __int128 rem = (__int128)(u << 56) - (__int128)(q * q);
+    if (rem < 0) { rem += (__int128)(root << 1) - 1; root--; }
+    /* A square root is never exactly halfway: round up iff sqrt >= root + 1/2, i.e. rem > root. */
+    unsigned __int128 r = root + ((unsigned __int128)rem > root ? 1 : 0);
+    int32_t biased = e / 2 + 16383;
+    if (r >> 113) { r >>= 1; biased++; }
+    out[0] = (int64_t)(uint64_t)r;
+    out[1] = (int64_t)(((uint64_t)biased << 48) | ((uint64_t)(r >> 64) & frac_hi));
+}
+#endif
+
+#define KLD_BINARY_LOOP(T, LOAD, STORE, OP)                                 \
+    for (int32_t i = 0; i < n; i++) {                                       \
+        T x = LOAD(a + 2 * i), y = LOAD(b + 2 * i);                         \
+        STORE(out + 2 * i, x OP y);                                         \
+    }
+
+#define KLD_BINARY_SWITCH(T, LOAD, STORE)                                   \
+    switch (op) {                                                           \
+    case KLD_ADD: KLD_BINARY_LOOP(T, LOAD, STORE, +) break;                 \
+    case KLD_SUB: KLD_BINARY_LOOP(T, LOAD, STORE, -) break;                 \
+    case KLD_MUL: KLD_BINARY_LOOP(T, LOAD, STORE, *) break;                 \
+    case KLD_DIV: KLD_BINARY_LOOP(T, LOAD, STORE, /) break;                 \
+    default: return -1;                                                     \
+    }
+
+/* out[i] = a[i] OP b[i] for i < n. */
+static inline int32_t kld_binary(int32_t fmt, int32_t op, const int64_t *a, const int64_t *b, int64_t *out, int32_t n) {
+    if (fmt == KLD_FMT_LONG_DOUBLE) {
+        KLD_BINARY_SWITCH(long double, kld_load_ld, kld_store_ld)
+        return 0;
+    }
+#if KLD_HAS_FLOAT128
+    if (fmt == KLD_FMT_FLOAT128) {
+        KLD_BINARY_SWITCH(kld_f128, kld_load_q, kld_store_q)
+        return 0;
+    }
+#endif
+    return -1;
+}
+
+/* out[i] = sqrt(a[i]) for i < n. */
+static inline int32_t kld_sqrt(int32_t fmt, const int64_t *a, int64_t *out, int32_t n) {
+#if LDBL_MANT_DIG == 113 && KLD_HAS_FLOAT128
+    if (fmt == KLD_FMT_LONG_DOUBLE) fmt = KLD_FMT_FLOAT128;
+#endif
+    if (fmt == KLD_FMT_LONG_DOUBLE) {
+        for (int32_t i = 0; i < n; i++) kld_store_ld(out + 2 * i, __builtin_sqrtl(kld_load_ld(a + 2 * i)));
+        return 0;
+    }
+#if KLD_HAS_FLOAT128
+    if (fmt == KLD_FMT_FLOAT128) {
+        for (int32_t i = 0; i < n; i++) kld_sqrt128_bits((uint64_t)a[2 * i + 1], (uint64_t)a[2 * i], out + 2 * i);
+        return 0;
+    }
+#endif
+    return -1;
+}
+
+/* out[i] = hi[i] + lo[i] rounded once to the format. */
+static inline int32_t kld_from_double_double(int32_t fmt, const double *hi, const double *lo, int64_t *out, int32_t n) {
+    if (fmt == KLD_FMT_LONG_DOUBLE) {
+        for (int32_t i = 0; i < n; i++) kld_store_ld(out + 2 * i, (long double)hi[i] + (long double)lo[i]);
+        return 0;
+    }
+#if KLD_HAS_FLOAT128
+    if (fmt == KLD_FMT_FLOAT128) {
+        for (int32_t i = 0; i < n; i++) kld_store_q(out + 2 * i, (kld_f128)hi[i] + (kld_f128)lo[i]);
+        return 0;
+    }
+#endif
+    return -1;
+}
+
+/* hi[i] = (double)src[i], lo[i] = (double)(src[i] - hi[i]). */
+static inline int32_t kld_to_double_double(int32_t fmt, const int64_t *src, double *hi, double *lo, int32_t n) {
+    if (fmt == KLD_FMT_LONG_DOUBLE) {
+        for (int32_t i = 0; i < n; i++) {
+            long double x = kld_load_ld(src + 2 * i);
+            double h = (double)x;
+            hi[i] = h;
+            lo[i] = (double)(x - (long double)h);
+        }
+        return 0;
+    }
+#if KLD_HAS_FLOAT128
+    if (fmt == KLD_FMT_FLOAT128) {
+        for (int32_t i = 0; i < n; i++) {
+            kld_f128 x = kld_load_q(src + 2 * i);
+            double h = (double)x;
+            hi[i] = h;
+            lo[i] = (double)(x - (kld_f128)h);
+        }
+        return 0;
+    }
+#endif
+    return -1;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* KLANG_LONGDOUBLE_H */